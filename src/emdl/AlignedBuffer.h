@@ -0,0 +1,64 @@
+#pragma once
+
+#include <emdl/ArrayView.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace emdl
+{
+	//! Size of a cache line, used to align the buffers written by different threads
+	constexpr std::size_t CacheLineSize = 64;
+
+	//! Round a size up to the next multiple of the alignment (which must be a power of 2)
+	constexpr std::size_t alignSize(std::size_t size, std::size_t alignment = CacheLineSize)
+	{
+		return (size + alignment - 1) & ~(alignment - 1);
+	}
+
+	//! Test whether a pointer is aligned
+	inline bool isAligned(const void* ptr, std::size_t alignment = CacheLineSize)
+	{
+		return (reinterpret_cast<std::uintptr_t>(ptr) & (alignment - 1)) == 0;
+	}
+
+	//! Owning buffer whose data starts on an aligned address
+	class AlignedBuffer
+	{
+	public:
+		AlignedBuffer() = default;
+		explicit AlignedBuffer(std::size_t size, std::size_t alignment = CacheLineSize)
+		{
+			resize(size, alignment);
+		}
+
+		//! Not copyable, as the aligned offset would not be valid in the copy. Moving keeps the storage, so it stays aligned.
+		AlignedBuffer(const AlignedBuffer&) = delete;
+		AlignedBuffer& operator=(const AlignedBuffer&) = delete;
+
+		AlignedBuffer(AlignedBuffer&&) = default;
+		AlignedBuffer& operator=(AlignedBuffer&&) = default;
+
+		//! Reallocate the buffer with this size, filled with zeros (the previous content is not kept)
+		void resize(std::size_t size, std::size_t alignment = CacheLineSize)
+		{
+			m_storage.assign(size + alignment, 0);
+			const auto address = reinterpret_cast<std::uintptr_t>(m_storage.data());
+			m_offset = alignSize(address, alignment) - address;
+			m_size = size;
+		}
+
+		uint8_t* data() { return m_storage.data() + m_offset; }
+		const uint8_t* data() const { return m_storage.data() + m_offset; }
+		std::size_t size() const { return m_size; }
+		bool empty() const { return !m_size; }
+
+		ArrayView<uint8_t> view() { return {data(), m_size}; }
+		ArrayView<const uint8_t> view() const { return {data(), m_size}; }
+
+	private:
+		std::vector<uint8_t> m_storage;
+		std::size_t m_offset = 0, m_size = 0;
+	};
+
+} // namespace emdl
@@ -8,7 +8,8 @@
 
 namespace emdl
 {
-	// Wrapper around either a vector or an array view
+	// Wrapper around either a vector or an array view. Copies share the vector.
+	// A view can also keep alive the buffer it points into, so that it stays valid after the data set is destroyed.
 	class EMDL_API BinaryValue
 	{
 	public:
@@ -20,69 +21,37 @@ namespace emdl
 			: m_view(view)
 		{
 		}
-		BinaryValue(const vector_type& data)
-			: m_data(std::make_unique<vector_type>(data))
+		BinaryValue(view_type view, std::shared_ptr<const void> owner) // View inside a buffer owned by the shared pointer
+			: m_owner(std::move(owner))
+			, m_view(view)
 		{
 		}
-		BinaryValue(vector_type&& data)
-			: m_data(std::make_unique<vector_type>(std::move(data)))
-		{
-		}
-
-		BinaryValue(const BinaryValue& other) // Copy constructor
-		{
-			m_view = other.m_view;
-			if (other.m_data)
-				m_data = std::make_unique<vector_type>(*other.m_data);
-		}
-
-		BinaryValue(BinaryValue&& other) // Move constructor
-			: m_data(std::move(other.m_data))
-			, m_view(other.m_view)
-		{
-		}
-
-		BinaryValue& operator=(const BinaryValue& other) // Copy assignment
-		{
-			m_view = other.m_view;
-			if (other.m_data)
-				m_data = std::make_unique<vector_type>(*other.m_data);
-			return *this;
-		}
-
-		BinaryValue& operator=(BinaryValue&& other) // Move assignment
-		{
-			m_view = other.m_view;
-			m_data = std::move(other.m_data);
-			return *this;
-		}
+		BinaryValue(const vector_type& data) { set(data); }
+		BinaryValue(vector_type&& data) { set(std::move(data)); }
 
 		void set(view_type view)
 		{
-			m_data.reset();
+			m_owner.reset();
 			m_view = view;
 		}
-		void set(const vector_type& data) { m_data = std::make_unique<vector_type>(data); }
-		void set(vector_type&& data) { m_data = std::make_unique<vector_type>(std::move(data)); }
-
-		const void* data() const
+		void set(view_type view, std::shared_ptr<const void> owner)
 		{
-			if (m_data && !m_data->empty())
-				return m_data->data();
-			else if (!m_view.empty())
-				return m_view.data();
-			return nullptr;
+			m_owner = std::move(owner);
+			m_view = view;
 		}
-
-		std::size_t size() const
+		void set(const vector_type& data) { set(vector_type(data)); }
+		void set(vector_type&& data)
 		{
-			if (m_data && !m_data->empty())
-				return m_data->size();
-			else if (!m_view.empty())
-				return m_view.size();
-			return 0;
+			auto owned = std::make_shared<const vector_type>(std::move(data));
+			m_view = {owned->data(), owned->size()};
+			m_owner = std::move(owned);
 		}
 
+		const void* data() const { return m_view.empty() ? nullptr : m_view.data(); }
+		std::size_t size() const { return m_view.size(); }
+
+		view_type view() const { return {data(), size()}; }
+
 		vector_type get() const
 		{
 			const auto d = data();
@@ -93,8 +62,10 @@ namespace emdl
 			return {ptr, ptr + s};
 		}
 
-		bool empty() const { return (!m_data || m_data->empty()) && m_view.empty(); }
-		bool hasOwnership() const { return m_data != nullptr; }
+		bool empty() const { return m_view.empty(); }
+
+		// Test whether the memory is kept alive by this value: an owned vector, or a view inside a shared buffer
+		bool hasOwnership() const { return m_owner != nullptr; }
 
 		void takeOwnership()
 		{
@@ -102,14 +73,12 @@ namespace emdl
 				return;
 
 			assert(!m_view.empty());
-			const unsigned char* data = static_cast<const unsigned char*>(m_view.data());
-			m_data = std::make_unique<vector_type>();
-			m_data->assign(data, data + m_view.size());
+			set(get());
 		}
 
 	private:
-		std::unique_ptr<vector_type> m_data; // We own this data
-		view_type m_view; // We do not own the memory pointed by the view
+		std::shared_ptr<const void> m_owner; // Owner of the memory of the view, if any. Never modified, so it is shared by the copies.
+		view_type m_view;
 	};
 
 } // namespace emdl
@@ -1,63 +1,243 @@
 #include <emdl/IdGenerator.h>
+#include <emdl/Exception.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstring>
 #include <ctime>
 #include <limits>
-#include <memory>
 #include <random>
 
 namespace
 {
-	class IdGenerator
+	const uint32_t BlockSize = 1024; // Counter values reserved at once by a thread
+	const std::time_t Jan2000 = 946684800; // 01/01/2000 00:00:00 UTC
+	const size_t MaxSuffixLength = 21; // Seconds and counter, up to 10 digits each, and a dot
+
+	// Counter shared by all the threads, starting at a random value
+	std::atomic<uint32_t>& sharedCounter()
 	{
-	public:
-		static std::string getUid();
+		static std::atomic<uint32_t> counter{[] {
+			std::random_device rd;
+			std::default_random_engine engine(rd());
+			std::uniform_int_distribution<uint32_t> dist(0, std::numeric_limits<uint32_t>::max());
+			return dist(engine);
+		}()};
+		return counter;
+	}
 
-	private:
-		IdGenerator();
+	struct CounterBlock
+	{
+		uint32_t next = 0, remaining = 0, seconds = 0;
+	};
 
-		std::atomic<uint32_t> m_atomicCounter;
-		std::time_t m_timeRef;
+	// Take the next value of the block of this thread, reserving a new block (and reading the time) only when it is exhausted
+	void nextValues(uint32_t& seconds, uint32_t& counter)
+	{
+		thread_local CounterBlock block;
+		if (!block.remaining)
+		{
+			block.next = sharedCounter().fetch_add(BlockSize); // Unsigned int never overflows (i.e. MAX_INT +1 == 0)
+			block.remaining = BlockSize;
+			block.seconds = static_cast<uint32_t>(std::max<std::time_t>(0, std::time(nullptr) - Jan2000));
+		}
 
-		std::string seconds();
-		std::string counter();
-	};
+		--block.remaining;
+		seconds = block.seconds;
+		counter = block.next++;
+	}
 
-	IdGenerator::IdGenerator()
+	// Write the decimal representation of value, return the end of the written characters
+	char* writeNumber(char* out, uint32_t value)
 	{
-		/* January 01, 2000 */
-		std::tm refDate;
-		std::memset(&refDate, 0, sizeof(refDate));
-		refDate.tm_mday = 1;
-		refDate.tm_year = 100;
-		m_timeRef = std::mktime(&refDate);
+		char digits[10];
+		size_t nb = 0;
+		do
+		{
+			digits[nb++] = static_cast<char>('0' + value % 10);
+			value /= 10;
+		} while (value);
 
-		std::random_device rd;
-		std::default_random_engine engine(rd());
-		std::uniform_int_distribution<uint32_t> dist(0, std::numeric_limits<uint32_t>::max());
+		while (nb)
+			*out++ = digits[--nb];
+		return out;
+	}
 
-		m_atomicCounter = static_cast<uint32_t>(dist(engine));
+	char* writeSuffix(char* out)
+	{
+		uint32_t seconds = 0, counter = 0;
+		nextValues(seconds, counter);
+		out = writeNumber(out, seconds);
+		*out++ = '.';
+		return writeNumber(out, counter);
 	}
 
-	std::string IdGenerator::getUid()
+	const uint32_t Sha256Init[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+	const uint32_t Sha256K[64] = {
+		0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+		0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+		0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+		0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+		0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+		0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+		0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+		0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+	uint32_t rotr(uint32_t x, int n)
 	{
-		static IdGenerator gen;
-		return gen.seconds() + '.' + gen.counter();
+		return (x >> n) | (x << (32 - n));
 	}
 
-	std::string IdGenerator::seconds()
+	// SHA-256 (FIPS 180-4), used for the HMAC of remap
+	class Sha256
 	{
-		std::time_t now = std::time(nullptr);
-		const double diff = std::floor(std::difftime(now, m_timeRef));
-		const auto nbSeconds = static_cast<uint32_t>(diff);
+	public:
+		// Start from the initial state, or from the state after hashing length bytes (a multiple of 64)
+		explicit Sha256(const uint32_t* state = Sha256Init, uint64_t length = 0)
+			: m_length(length)
+		{
+			std::copy(state, state + 8, m_state);
+		}
+
+		void update(const void* data, size_t size)
+		{
+			auto bytes = static_cast<const uint8_t*>(data);
+			m_length += size;
+			while (size)
+			{
+				const auto count = std::min(size, 64 - m_blockSize);
+				std::memcpy(m_block + m_blockSize, bytes, count);
+				m_blockSize += count;
+				bytes += count;
+				size -= count;
+				if (m_blockSize == 64)
+				{
+					compress();
+					m_blockSize = 0;
+				}
+			}
+		}
+
+		void finish(uint8_t (&digest)[32])
+		{
+			const uint64_t bits = m_length * 8;
+			const uint8_t padding = 0x80;
+			update(&padding, 1);
+			const uint8_t zero = 0;
+			while (m_blockSize != 56)
+				update(&zero, 1);
+			uint8_t length[8];
+			for (int i = 0; i < 8; ++i)
+				length[i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+			update(length, 8);
 
-		return std::to_string(nbSeconds);
+			for (int i = 0; i < 32; ++i)
+				digest[i] = static_cast<uint8_t>(m_state[i / 4] >> (24 - 8 * (i % 4)));
+		}
+
+		const uint32_t* state() const
+		{
+			return m_state;
+		}
+
+	private:
+		void compress()
+		{
+			uint32_t w[64];
+			for (int i = 0; i < 16; ++i)
+				w[i] = (uint32_t(m_block[i * 4]) << 24) | (uint32_t(m_block[i * 4 + 1]) << 16) | (uint32_t(m_block[i * 4 + 2]) << 8) | m_block[i * 4 + 3];
+			for (int i = 16; i < 64; ++i)
+			{
+				const auto s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+				const auto s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+				w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+			}
+
+			uint32_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3], e = m_state[4], f = m_state[5], g = m_state[6], h = m_state[7];
+			for (int i = 0; i < 64; ++i)
+			{
+				const auto t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + Sha256K[i] + w[i];
+				const auto t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+				h = g;
+				g = f;
+				f = e;
+				e = d + t1;
+				d = c;
+				c = b;
+				b = a;
+				a = t1 + t2;
+			}
+
+			m_state[0] += a;
+			m_state[1] += b;
+			m_state[2] += c;
+			m_state[3] += d;
+			m_state[4] += e;
+			m_state[5] += f;
+			m_state[6] += g;
+			m_state[7] += h;
+		}
+
+		uint32_t m_state[8];
+		uint8_t m_block[64];
+		size_t m_blockSize = 0;
+		uint64_t m_length;
+	};
+
+	// State of SHA-256 after hashing the key block of HMAC, xored with pad
+	std::array<uint32_t, 8> hmacState(const std::string& key, uint8_t pad)
+	{
+		uint8_t block[64] = {};
+		if (key.size() > 64)
+		{
+			Sha256 sha;
+			sha.update(key.data(), key.size());
+			uint8_t digest[32];
+			sha.finish(digest);
+			std::memcpy(block, digest, 32);
+		}
+		else
+			std::memcpy(block, key.data(), key.size());
+
+		for (auto& byte : block)
+			byte ^= pad;
+		Sha256 sha;
+		sha.update(block, 64);
+
+		std::array<uint32_t, 8> state;
+		std::copy(sha.state(), sha.state() + 8, state.begin());
+		return state;
 	}
 
-	std::string IdGenerator::counter()
+	// Write the decimal representation of the 128 bits value hi:lo (at most 39 digits), return the number of digits
+	size_t writeNumber128(char* out, uint64_t hi, uint64_t lo)
 	{
-		return std::to_string(m_atomicCounter++); // Unsigned int never overflows (i.e. MAX_INT +1 == 0)
+		uint32_t limbs[4] = {static_cast<uint32_t>(hi >> 32), static_cast<uint32_t>(hi), static_cast<uint32_t>(lo >> 32), static_cast<uint32_t>(lo)};
+		char digits[45];
+		size_t nb = 0;
+		do
+		{
+			// Divide by 10^9 and write the 9 digits of the remainder
+			uint64_t remainder = 0;
+			for (auto& limb : limbs)
+			{
+				const uint64_t current = (remainder << 32) | limb;
+				limb = static_cast<uint32_t>(current / 1000000000);
+				remainder = current % 1000000000;
+			}
+			for (int i = 0; i < 9; ++i)
+			{
+				digits[nb++] = static_cast<char>('0' + remainder % 10);
+				remainder /= 10;
+			}
+		} while (limbs[0] || limbs[1] || limbs[2] || limbs[3]);
+
+		while (nb > 1 && digits[nb - 1] == '0') // Leading zeros of the last group
+			--nb;
+		for (size_t i = 0; i < nb; ++i)
+			out[i] = digits[nb - 1 - i];
+		return nb;
 	}
 }
 
@@ -65,6 +245,110 @@ namespace emdl
 {
 	std::string getUidSuffix()
 	{
-		return IdGenerator::getUid();
+		char buffer[MaxSuffixLength];
+		const auto end = writeSuffix(buffer);
+		return std::string(buffer, end);
+	}
+
+	bool isValidUid(const std::string& uid)
+	{
+		if (uid.empty() || uid.size() > MaxUidLength)
+			return false;
+
+		size_t componentStart = 0;
+		for (size_t i = 0; i <= uid.size(); ++i)
+		{
+			if (i == uid.size() || uid[i] == '.')
+			{
+				const auto length = i - componentStart;
+				if (!length || (length > 1 && uid[componentStart] == '0'))
+					return false;
+				componentStart = i + 1;
+			}
+			else if (uid[i] < '0' || uid[i] > '9')
+				return false;
+		}
+
+		return true;
+	}
+
+	UidGenerator::UidGenerator(std::string root, const std::string& key)
+		: m_root(std::move(root))
+		, m_hasKey(!key.empty())
+		, m_innerState(hmacState(key, 0x36))
+		, m_outerState(hmacState(key, 0x5c))
+	{
+		if (!isValidUid(m_root))
+			throw Exception("{} Invalid UID root '{}'", LOG_POSITION, m_root);
+		if (m_root.size() + 1 + MaxSuffixLength > MaxUidLength)
+			throw Exception("{} UID root '{}' is too long, it must have at most {} characters", LOG_POSITION, m_root, MaxUidLength - 1 - MaxSuffixLength);
+	}
+
+	bool UidGenerator::hasKey() const
+	{
+		return m_hasKey;
+	}
+
+	const std::string& UidGenerator::root() const
+	{
+		return m_root;
+	}
+
+	size_t UidGenerator::generate(UidBuffer& buffer) const
+	{
+		std::memcpy(buffer, m_root.data(), m_root.size());
+		char* out = buffer + m_root.size();
+		*out++ = '.';
+		out = writeSuffix(out);
+		*out = 0;
+		return out - buffer;
+	}
+
+	std::string UidGenerator::generate() const
+	{
+		UidBuffer buffer;
+		const auto size = generate(buffer);
+		return std::string(buffer, size);
+	}
+
+	size_t UidGenerator::remap(const char* uid, size_t size, UidBuffer& buffer) const
+	{
+		if (!m_hasKey)
+			throw Exception("{} Remapping UIDs needs a key", LOG_POSITION);
+
+		// HMAC-SHA-256 of the UID, starting from the hashed key blocks
+		uint8_t digest[32];
+		Sha256 inner(m_innerState.data(), 64);
+		inner.update(uid, size);
+		inner.finish(digest);
+		Sha256 outer(m_outerState.data(), 64);
+		outer.update(digest, sizeof(digest));
+		outer.finish(digest);
+
+		// The first 128 bits are written as a number
+		uint64_t hi = 0, lo = 0;
+		for (int i = 0; i < 8; ++i)
+		{
+			hi = (hi << 8) | digest[i];
+			lo = (lo << 8) | digest[i + 8];
+		}
+
+		char digits[45];
+		const auto nbDigits = writeNumber128(digits, hi, lo);
+		const auto length = std::min(nbDigits, MaxUidLength - m_root.size() - 1);
+
+		std::memcpy(buffer, m_root.data(), m_root.size());
+		buffer[m_root.size()] = '.';
+		std::memcpy(buffer + m_root.size() + 1, digits, length);
+		const auto total = m_root.size() + 1 + length;
+		buffer[total] = 0;
+		return total;
+	}
+
+	std::string UidGenerator::remap(const std::string& uid) const
+	{
+		UidBuffer buffer;
+		const auto size = remap(uid.data(), uid.size(), buffer);
+		return std::string(buffer, size);
 	}
 }
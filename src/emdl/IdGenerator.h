@@ -2,6 +2,8 @@
 
 #include <emdl/emdl_api.h>
 
+#include <array>
+#include <cstdint>
 #include <string>
 
 namespace emdl
@@ -13,4 +15,46 @@ namespace emdl
 	// b = auto increment absolute counter (starts at a random value and wraps at 2^32)
 	EMDL_API std::string getUidSuffix();
 
+	//! Maximum length of a UID
+	const size_t MaxUidLength = 64;
+
+	//! Buffer able to hold any UID and its terminating null character
+	using UidBuffer = char[MaxUidLength + 1];
+
+	//! Test whether the string is a valid UID: numeric components without leading zero, separated by dots, at most 64 characters
+	EMDL_API bool isValidUid(const std::string& uid);
+
+	//! Create UIDs under an organization root.
+	//! Each thread reserves blocks of the shared counter, so that generating a UID needs neither lock nor allocation.
+	class EMDL_API UidGenerator
+	{
+	public:
+		//! Throws if root is not a valid UID, or is too long to add the suffix of getUidSuffix.
+		//! The key of the HMAC used by remap: the mapping cannot be computed (or reverted by hashing candidate UIDs) without it, so it must be kept secret.
+		explicit UidGenerator(std::string root, const std::string& key = {});
+
+		const std::string& root() const;
+
+		//! Test whether a key was given, needed by remap
+		bool hasKey() const;
+
+		//! Write a new UID "root.seconds.counter" in buffer and return its length
+		size_t generate(UidBuffer& buffer) const;
+
+		//! Return a new UID
+		std::string generate() const;
+
+		//! Write in buffer a UID derived from the HMAC-SHA-256 of uid with the key, and return its length. Throws if there is no key.
+		//! The same uid is always mapped to the same result for a given root and key, in any thread or process.
+		size_t remap(const char* uid, size_t size, UidBuffer& buffer) const;
+
+		//! Return the UID derived from uid, see above
+		std::string remap(const std::string& uid) const;
+
+	private:
+		std::string m_root;
+		bool m_hasKey;
+		std::array<uint32_t, 8> m_innerState, m_outerState; // SHA-256 states after the key blocks of the HMAC, so the key itself is not kept
+	};
+
 }
@@ -0,0 +1,55 @@
+#include <emdl/MemoryArena.h>
+#include <emdl/AlignedBuffer.h>
+
+namespace
+{
+	// Number of bytes to skip so that the pointer is aligned
+	std::size_t padding(const unsigned char* ptr, std::size_t alignment)
+	{
+		const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+		return emdl::alignSize(address, alignment) - address;
+	}
+}
+
+namespace emdl
+{
+	MemoryArena::MemoryArena(std::size_t blockSize)
+		: m_blockSize(blockSize)
+	{
+	}
+
+	void* MemoryArena::allocate(std::size_t size, std::size_t alignment)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		// Large allocations get their own block, so that the current one is not wasted
+		if (size + alignment > m_blockSize / 4)
+		{
+			m_blocks.emplace_back(new unsigned char[size + alignment]);
+			m_capacity += size + alignment;
+			const auto block = m_blocks.back().get();
+			return block + padding(block, alignment);
+		}
+
+		auto offset = m_current ? padding(m_current, alignment) : 0;
+		if (!m_current || offset + size > m_remaining)
+		{
+			m_blocks.emplace_back(new unsigned char[m_blockSize]);
+			m_current = m_blocks.back().get();
+			m_remaining = m_blockSize;
+			m_capacity += m_blockSize;
+			offset = padding(m_current, alignment);
+		}
+
+		const auto ptr = m_current + offset;
+		m_current += offset + size;
+		m_remaining -= offset + size;
+		return ptr;
+	}
+
+	std::size_t MemoryArena::capacity() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_capacity;
+	}
+}
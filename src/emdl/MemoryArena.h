@@ -0,0 +1,94 @@
+#pragma once
+
+#include <emdl/emdl_api.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace emdl
+{
+	//! Monotonic memory: allocations are pointer bumps inside large blocks, and the memory is only released when the arena is destroyed.
+	//! Allocations are thread safe, so that the items of a data set can be parsed in parallel.
+	class EMDL_API MemoryArena
+	{
+	public:
+		explicit MemoryArena(std::size_t blockSize = 64 * 1024);
+
+		MemoryArena(const MemoryArena&) = delete;
+		MemoryArena& operator=(const MemoryArena&) = delete;
+
+		//! Return memory of the given size, aligned on the alignment (which must be a power of 2)
+		void* allocate(std::size_t size, std::size_t alignment);
+
+		//! Total size of the blocks allocated by the arena
+		std::size_t capacity() const;
+
+	private:
+		using Block = std::unique_ptr<unsigned char[]>;
+
+		const std::size_t m_blockSize;
+		std::vector<Block> m_blocks;
+		unsigned char* m_current = nullptr;
+		std::size_t m_remaining = 0;
+		std::size_t m_capacity = 0;
+		mutable std::mutex m_mutex;
+	};
+
+	using MemoryArenaSPtr = std::shared_ptr<MemoryArena>;
+
+	//! Standard allocator using an arena if it has one, or the heap otherwise. The arena must outlive the memory allocated from it.
+	template <class T>
+	class ArenaAllocator
+	{
+	public:
+		using value_type = T;
+		using propagate_on_container_copy_assignment = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+
+		ArenaAllocator(MemoryArena* arena = nullptr) noexcept
+			: m_arena(arena)
+		{
+		}
+
+		template <class U>
+		ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+			: m_arena(other.arena())
+		{
+		}
+
+		T* allocate(std::size_t n)
+		{
+			if (m_arena)
+				return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+			return static_cast<T*>(::operator new(n * sizeof(T)));
+		}
+
+		void deallocate(T* ptr, std::size_t) noexcept
+		{
+			if (!m_arena) // The memory of the arena is released all at once
+				::operator delete(ptr);
+		}
+
+		MemoryArena* arena() const noexcept { return m_arena; }
+
+	private:
+		MemoryArena* m_arena = nullptr;
+	};
+
+	template <class T, class U>
+	bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+	{
+		return lhs.arena() == rhs.arena();
+	}
+
+	template <class T, class U>
+	bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+	{
+		return lhs.arena() != rhs.arena();
+	}
+
+} // namespace emdl
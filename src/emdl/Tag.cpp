@@ -7,12 +7,6 @@
 
 namespace emdl
 {
-	Tag::Tag(uint16_t group, uint16_t element)
-		: group(group)
-		, element(element)
-	{
-	}
-
 	Tag::Tag(const std::string& str)
 		: group(static_cast<uint16_t>(std::stoul(str.substr(0, 4), 0, 16)))
 		, element(static_cast<uint16_t>(std::stoul(str.substr(4, 8), 0, 16)))
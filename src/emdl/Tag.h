@@ -12,7 +12,11 @@ namespace emdl
 	{
 	public:
 		Tag() = default;
-		Tag(uint16_t group, uint16_t element);
+		constexpr Tag(uint16_t group, uint16_t element)
+			: group(group)
+			, element(element)
+		{
+		}
 		Tag(const std::string& str); /// Create a tag from the string representation of its numeric value.
 
 		uint16_t group = 0;
@@ -0,0 +1,138 @@
+#include <emdl/ThreadPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace
+{
+	// State shared between the caller of parallelFor and the helper tasks, which may outlive the call
+	struct ParallelForState
+	{
+		ParallelForState(size_t count, const std::function<void(size_t)>& func)
+			: count(count)
+			, func(func)
+		{
+			next = 0;
+		}
+
+		// Process indices until there are none left
+		void work()
+		{
+			size_t index;
+			while ((index = next++) < count)
+			{
+				try
+				{
+					func(index);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					if (!exception)
+						exception = std::current_exception();
+				}
+
+				std::lock_guard<std::mutex> lock(mutex);
+				if (++done == count)
+					condition.notify_all();
+			}
+		}
+
+		const size_t count;
+		const std::function<void(size_t)> func;
+		std::atomic<size_t> next;
+		size_t done = 0;
+		std::exception_ptr exception;
+		std::mutex mutex;
+		std::condition_variable condition;
+	};
+}
+
+namespace emdl
+{
+	ThreadPool::ThreadPool(unsigned int nbThreads)
+	{
+		if (!nbThreads)
+			nbThreads = std::max(1u, std::thread::hardware_concurrency());
+
+		m_threads.reserve(nbThreads);
+		for (unsigned int i = 0; i < nbThreads; ++i)
+			m_threads.emplace_back([this] { run(); });
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_condition.notify_all();
+
+		for (auto& thread : m_threads)
+			thread.join();
+	}
+
+	unsigned int ThreadPool::size() const
+	{
+		return static_cast<unsigned int>(m_threads.size());
+	}
+
+	void ThreadPool::post(Task task)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_tasks.push_back(std::move(task));
+		}
+		m_condition.notify_one();
+	}
+
+	void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& func)
+	{
+		if (!count)
+			return;
+
+		// Each helper task owns a reference to the state, and this one is kept until the wait below has returned:
+		// the state is destroyed by whichever finishes last, never while a thread still uses its mutex or condition
+		auto state = std::make_shared<ParallelForState>(count, func);
+
+		// The caller also works, so we need one helper less
+		const size_t nbHelpers = std::min<size_t>(count, size() + 1) - 1;
+		for (size_t i = 0; i < nbHelpers; ++i)
+			post([state] { state->work(); });
+
+		state->work();
+
+		std::unique_lock<std::mutex> lock(state->mutex);
+		state->condition.wait(lock, [&state] { return state->done == state->count; });
+		if (state->exception)
+			std::rethrow_exception(state->exception);
+	}
+
+	ThreadPool& ThreadPool::global()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	void ThreadPool::run()
+	{
+		while (true)
+		{
+			Task task;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+				if (m_tasks.empty()) // Only when stopping
+					return;
+
+				task = std::move(m_tasks.front());
+				m_tasks.pop_front();
+			}
+
+			task();
+		}
+	}
+
+} // namespace emdl
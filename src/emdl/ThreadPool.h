@@ -0,0 +1,53 @@
+#pragma once
+
+#include <emdl/emdl_api.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace emdl
+{
+	//! Fixed size pool of worker threads
+	class EMDL_API ThreadPool
+	{
+	public:
+		using Task = std::function<void()>;
+
+		//! Create the pool, using the number of hardware threads if nbThreads is 0
+		explicit ThreadPool(unsigned int nbThreads = 0);
+
+		//! Wait for the queued tasks to finish and join the threads
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		//! Number of worker threads
+		unsigned int size() const;
+
+		//! Queue a task, executed as soon as a worker is available. The task must not throw.
+		void post(Task task);
+
+		//! Call func(i) for each i in [0, count) and wait for all of them to be done.
+		//! The calling thread takes part in the work, so this can be called from inside a task of the same pool.
+		//! The first exception thrown by func is rethrown here, once all calls are finished.
+		void parallelFor(size_t count, const std::function<void(size_t)>& func);
+
+		//! Pool shared by the library, created on first use with one thread per core
+		static ThreadPool& global();
+
+	private:
+		void run();
+
+		std::vector<std::thread> m_threads;
+		std::deque<Task> m_tasks;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		bool m_stop = false;
+	};
+
+} // namespace emdl
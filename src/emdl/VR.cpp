@@ -2,6 +2,7 @@
 #include <emdl/Exception.h>
 
 #include <boost/container/flat_map.hpp>
+#include <array>
 #include <vector>
 
 namespace
@@ -36,6 +37,7 @@ namespace
 			{ emdl::VR::OD,      "OD", VRT::Binary,	},
 			{ emdl::VR::OF,      "OF", VRT::Binary,	},
 			{ emdl::VR::OL,      "OL", VRT::Binary,	},
+			{ emdl::VR::OV,      "OV", VRT::Binary,	},
 			{ emdl::VR::OW,      "OW", VRT::Binary,	},
 			{ emdl::VR::PN,      "PN", VRT::String,	},
 			{ emdl::VR::SH,      "SH", VRT::String,	},
@@ -75,6 +77,24 @@ namespace
 
 		return vrMap;
 	}
+
+	// VR indexed by the 2 letters of its name
+	using VRTable = std::array<emdl::VR, 26 * 26>;
+	const VRTable& getVRTable()
+	{
+		static VRTable vrTable = [] {
+			VRTable vrt;
+			vrt.fill(emdl::VR::Invalid);
+			for (const auto& i : getVRInfos())
+			{
+				if (!i.name.empty())
+					vrt[(i.name[0] - 'A') * 26 + i.name[1] - 'A'] = i.vr;
+			}
+			return vrt;
+		}();
+
+		return vrTable;
+	}
 }
 
 namespace emdl
@@ -96,6 +116,34 @@ namespace emdl
 		throw Exception("Unknown VR: " + vr);
 	}
 
+	VR asVR(char first, char second)
+	{
+		if (first < 'A' || first > 'Z' || second < 'A' || second > 'Z')
+			return VR::Invalid;
+		return getVRTable()[(first - 'A') * 26 + second - 'A'];
+	}
+
+	bool hasLongLength(VR vr)
+	{
+		switch (vr)
+		{
+		case VR::OB:
+		case VR::OD:
+		case VR::OF:
+		case VR::OL:
+		case VR::OV:
+		case VR::OW:
+		case VR::SQ:
+		case VR::UC:
+		case VR::UR:
+		case VR::UT:
+		case VR::UN:
+			return true;
+		default:
+			return false;
+		}
+	}
+
 	VRType vrType(VR vr)
 	{
 		return getVRInfos()[static_cast<int>(vr)].type;
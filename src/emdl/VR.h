@@ -11,7 +11,7 @@ namespace emdl
 	{
 		// clang-format off
 		Unknown, // Not set, must look for the VR corresponding to a Tag
-		AE, AS, AT, CS, DA, DS, DT, FL, FD, IS, LO, LT, OB, OD, OF, OL, OW, PN, SH, 
+		AE, AS, AT, CS, DA, DS, DT, FL, FD, IS, LO, LT, OB, OD, OF, OL, OV, OW, PN, SH, 
 		SL, SQ, SS, ST, TM, UC, UI, UL, UN, UR, US, UT,
 		Invalid // Error value
 		// clang-format on
@@ -32,6 +32,12 @@ namespace emdl
 	/// Convert a string to its VR, or throw an exception.
 	EMDL_API VR asVR(const std::string& vr);
 
+	/// Convert the two characters of an encoded VR to the VR, without allocation. Returns VR::Invalid if unknown.
+	EMDL_API VR asVR(char first, char second);
+
+	/// Test whether the VR is encoded with a reserved field and a 32 bits length in explicit transfer syntaxes.
+	EMDL_API bool hasLongLength(VR vr);
+
 	/// Return the data type of the VR
 	EMDL_API VRType vrType(VR vr);
 }
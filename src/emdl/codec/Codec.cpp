@@ -0,0 +1,93 @@
+#include <emdl/codec/Codec.h>
+#include <emdl/dataset/DataSetAccessors.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+namespace
+{
+	template <class T>
+	T intOrDefault(const emdl::DataSet& dataSet, emdl::Tag tag, T defaultValue)
+	{
+		const auto elt = dataSet[tag];
+		if (!elt || elt->empty() || !elt->isInt())
+			return defaultValue;
+		return static_cast<T>(elt->asInt()[0]);
+	}
+}
+
+namespace emdl
+{
+	namespace codec
+	{
+		size_t ImageInfo::frameSize() const
+		{
+			const size_t nbSamples = static_cast<size_t>(rows) * columns * samplesPerPixel;
+			if (bitsAllocated == 1) // Packed bits
+				return (nbSamples + 7) / 8;
+			return nbSamples * (bitsAllocated / 8);
+		}
+
+		size_t ImageInfo::frameStride() const
+		{
+			return alignSize(frameSize());
+		}
+
+		ImageInfo ImageInfo::fromDataSet(const DataSet& dataSet)
+		{
+			ImageInfo info;
+			info.rows = intOrDefault<uint16_t>(dataSet, registry::Rows, 0);
+			info.columns = intOrDefault<uint16_t>(dataSet, registry::Columns, 0);
+			info.samplesPerPixel = intOrDefault<uint16_t>(dataSet, registry::SamplesPerPixel, 1);
+			info.bitsAllocated = intOrDefault<uint16_t>(dataSet, registry::BitsAllocated, 8);
+			info.bitsStored = intOrDefault<uint16_t>(dataSet, registry::BitsStored, info.bitsAllocated);
+			info.pixelRepresentation = intOrDefault<uint16_t>(dataSet, registry::PixelRepresentation, 0);
+			info.planarConfiguration = intOrDefault<uint16_t>(dataSet, registry::PlanarConfiguration, 0);
+			info.numberOfFrames = intOrDefault<uint32_t>(dataSet, registry::NumberOfFrames, 1);
+
+			const auto photometric = firstString(dataSet, registry::PhotometricInterpretation);
+			if (photometric)
+				info.photometricInterpretation = *photometric;
+
+			if (!info.rows || !info.columns)
+				throw Exception("{} Missing Rows or Columns", LOG_POSITION);
+			if (info.bitsAllocated % 8 != 0 && info.bitsAllocated != 1)
+				throw Exception("{} Unsupported BitsAllocated: {}", LOG_POSITION, info.bitsAllocated);
+
+			return info;
+		}
+
+		/*****************************************************************************/
+
+		Codec::~Codec() = default;
+
+		bool Codec::canEncode() const
+		{
+			return false;
+		}
+
+		Fragments Codec::encode(ArrayView<const uint8_t>, const ImageInfo&) const
+		{
+			throw Exception("{} The {} codec cannot encode", LOG_POSITION, name());
+		}
+
+		ArrayView<const uint8_t> Codec::joinFragments(const Fragments& frame, std::vector<uint8_t>& storage)
+		{
+			if (frame.size() == 1)
+				return {static_cast<const uint8_t*>(frame.front().data()), frame.front().size()};
+
+			size_t size = 0;
+			for (const auto& fragment : frame)
+				size += fragment.size();
+
+			storage.clear();
+			storage.reserve(size);
+			for (const auto& fragment : frame)
+			{
+				const auto ptr = static_cast<const uint8_t*>(fragment.data());
+				storage.insert(storage.end(), ptr, ptr + fragment.size());
+			}
+			return {storage.data(), storage.size()};
+		}
+
+	} // namespace codec
+} // namespace emdl
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <emdl/dataset/EncapsulatedPixelData.h>
+#include <emdl/AlignedBuffer.h>
+
+#include <string>
+
+namespace emdl
+{
+	namespace codec
+	{
+		//! Description of the pixels of an image, as found in the Image Pixel module
+		struct EMDL_API ImageInfo
+		{
+			uint16_t rows = 0;
+			uint16_t columns = 0;
+			uint16_t samplesPerPixel = 1;
+			uint16_t bitsAllocated = 8;
+			uint16_t bitsStored = 8;
+			uint16_t pixelRepresentation = 0; // 0: unsigned, 1: signed
+			uint16_t planarConfiguration = 0; // 0: interleaved, 1: planar
+			uint32_t numberOfFrames = 1;
+			std::string photometricInterpretation = "MONOCHROME2";
+
+			//! Size in bytes of one uncompressed frame
+			size_t frameSize() const;
+
+			//! Distance in bytes between two frames in a decoding output, so that each frame starts on a cache line
+			size_t frameStride() const;
+
+			//! Read the Image Pixel module attributes of the data set
+			static ImageInfo fromDataSet(const DataSet& dataSet);
+		};
+
+		//! Base class for the compression and decompression of frames of a specific transfer syntax
+		class EMDL_API Codec
+		{
+		public:
+			virtual ~Codec();
+
+			//! Name of the implementation, for diagnostics
+			virtual const char* name() const = 0;
+
+			//! Decode the fragments of one frame into output, which holds at least info.frameSize() bytes.
+			//! Multi-samples frames are written following info.planarConfiguration unless documented otherwise by the codec.
+			//! This must be thread safe, as frames are decoded in parallel.
+			virtual void decode(const Fragments& frame, const ImageInfo& info, ArrayView<uint8_t> output) const = 0;
+
+			//! Test whether this codec can also compress frames
+			virtual bool canEncode() const;
+
+			//! Encode one uncompressed frame, throw if canEncode() is false. This must be thread safe.
+			virtual Fragments encode(ArrayView<const uint8_t> frame, const ImageInfo& info) const;
+
+		protected:
+			//! Return a view on the whole bitstream of a frame, copying the fragments in storage only if there are more than one
+			static ArrayView<const uint8_t> joinFragments(const Fragments& frame, std::vector<uint8_t>& storage);
+		};
+
+	} // namespace codec
+} // namespace emdl
@@ -0,0 +1,91 @@
+#include <emdl/codec/CodecRegistry.h>
+#include <emdl/codec/RLECodec.h>
+#include <emdl/codec/JPEGCodec.h>
+#include <emdl/codec/JPEG2000Codec.h>
+#include <emdl/codec/JPEGLSCodec.h>
+
+#include <boost/container/flat_map.hpp>
+
+#include <mutex>
+
+namespace
+{
+	using emdl::TransferSyntax;
+	using CodecMap = boost::container::flat_map<TransferSyntax, emdl::codec::CodecSPtr>;
+
+	CodecMap createBuiltInCodecs()
+	{
+		CodecMap codecs;
+		codecs[TransferSyntax::RLELossless] = std::make_shared<emdl::codec::RLECodec>();
+
+#ifdef EMDL_WITH_LIBJPEG
+		auto jpeg = std::make_shared<emdl::codec::JPEGCodec>();
+		codecs[TransferSyntax::JPEGBaselineProcess1] = jpeg;
+		codecs[TransferSyntax::JPEGExtendedProcess2_4] = jpeg;
+#endif
+
+#ifdef EMDL_WITH_OPENJPEG
+		auto jpeg2000 = std::make_shared<emdl::codec::JPEG2000Codec>();
+		codecs[TransferSyntax::JPEG2000Lossless] = jpeg2000;
+		codecs[TransferSyntax::JPEG2000] = jpeg2000;
+		codecs[TransferSyntax::JPEG2000Part2Lossless] = jpeg2000;
+		codecs[TransferSyntax::JPEG2000Part2] = jpeg2000;
+#endif
+
+#ifdef EMDL_WITH_CHARLS
+		auto jpegls = std::make_shared<emdl::codec::JPEGLSCodec>();
+		codecs[TransferSyntax::JPEGLSLossless] = jpegls;
+		codecs[TransferSyntax::JPEGLSLossy] = jpegls;
+#endif
+
+		return codecs;
+	}
+
+	struct Registry
+	{
+		std::mutex mutex;
+		CodecMap codecs = createBuiltInCodecs();
+	};
+
+	Registry& registry()
+	{
+		static Registry instance;
+		return instance;
+	}
+}
+
+namespace emdl
+{
+	namespace codec
+	{
+		void registerCodec(TransferSyntax transferSyntax, CodecSPtr codec)
+		{
+			auto& reg = registry();
+			std::lock_guard<std::mutex> lock(reg.mutex);
+			if (codec)
+				reg.codecs[transferSyntax] = std::move(codec);
+			else
+				reg.codecs.erase(transferSyntax);
+		}
+
+		CodecSPtr findCodec(TransferSyntax transferSyntax)
+		{
+			auto& reg = registry();
+			std::lock_guard<std::mutex> lock(reg.mutex);
+			auto it = reg.codecs.find(transferSyntax);
+			return it != reg.codecs.end() ? it->second : nullptr;
+		}
+
+		std::vector<TransferSyntax> getSupportedTransferSyntaxes()
+		{
+			auto& reg = registry();
+			std::lock_guard<std::mutex> lock(reg.mutex);
+			std::vector<TransferSyntax> result;
+			result.reserve(reg.codecs.size());
+			for (const auto& codec : reg.codecs)
+				result.push_back(codec.first);
+			return result;
+		}
+
+	} // namespace codec
+} // namespace emdl
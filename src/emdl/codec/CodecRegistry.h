@@ -0,0 +1,26 @@
+#pragma once
+
+#include <emdl/codec/Codec.h>
+#include <emdl/TransferSyntaxes.h>
+
+#include <memory>
+#include <vector>
+
+namespace emdl
+{
+	namespace codec
+	{
+		using CodecSPtr = std::shared_ptr<const Codec>;
+
+		//! Register the codec used for a transfer syntax, replacing the previous one (a null codec removes it).
+		//! The built-in codecs (RLE, and JPEG, JPEG 2000 and JPEG-LS when their libraries were found) are registered on first use.
+		EMDL_API void registerCodec(TransferSyntax transferSyntax, CodecSPtr codec);
+
+		//! Return the codec registered for a transfer syntax, or nullptr if there is none
+		EMDL_API CodecSPtr findCodec(TransferSyntax transferSyntax);
+
+		//! List of the encapsulated transfer syntaxes having a registered codec
+		EMDL_API std::vector<TransferSyntax> getSupportedTransferSyntaxes();
+
+	} // namespace codec
+} // namespace emdl
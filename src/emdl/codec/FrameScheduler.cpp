@@ -0,0 +1,95 @@
+#include <emdl/codec/FrameScheduler.h>
+#include <emdl/codec/CodecRegistry.h>
+#include <emdl/dataset/DataSetAccessors.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <cstring>
+
+namespace
+{
+	using namespace emdl;
+
+	void checkOutput(ArrayView<uint8_t> output, const codec::ImageInfo& info)
+	{
+		const size_t required = info.numberOfFrames * info.frameStride();
+		if (output.size() < required)
+			throw Exception("{} Output buffer too small: {} bytes for {} frames of {} bytes", LOG_POSITION, output.size(), info.numberOfFrames, info.frameStride());
+		if (!isAligned(output.data()))
+			throw Exception("{} Output buffer is not aligned on a cache line", LOG_POSITION);
+	}
+
+	codec::CodecSPtr getCodec(TransferSyntax transferSyntax)
+	{
+		auto codec = codec::findCodec(transferSyntax);
+		if (!codec)
+			throw Exception("{} No codec registered for the transfer syntax {}", LOG_POSITION, getTransferSyntaxUID(transferSyntax));
+		return codec;
+	}
+}
+
+namespace emdl
+{
+	namespace codec
+	{
+		ImageInfo decodeFrames(const DataSet& dataSet, ArrayView<uint8_t> output, ThreadPool& pool)
+		{
+			const auto info = ImageInfo::fromDataSet(dataSet);
+			const auto transferSyntax = dataSet.transferSyntax();
+			if (isEncapsulated(transferSyntax))
+			{
+				decodeFrames(getEncapsulatedFrames(dataSet), info, transferSyntax, output, pool);
+				return info;
+			}
+
+			checkOutput(output, info);
+			const auto pixelData = firstBinary(dataSet, registry::PixelData);
+			if (!pixelData)
+				throw Exception("{} No PixelData in the data set", LOG_POSITION);
+
+			const size_t frameSize = info.frameSize();
+			if (pixelData->size() < info.numberOfFrames * frameSize)
+				throw Exception("{} PixelData is too small: {} bytes for {} frames of {} bytes", LOG_POSITION, pixelData->size(), info.numberOfFrames, frameSize);
+
+			// Only realign the frames, the copies are memory bound
+			const auto src = static_cast<const uint8_t*>(pixelData->data());
+			const auto dest = output.begin();
+			const size_t stride = info.frameStride();
+			pool.parallelFor(info.numberOfFrames, [&](size_t i) {
+				std::memcpy(dest + i * stride, src + i * frameSize, frameSize);
+			});
+			return info;
+		}
+
+		void decodeFrames(const Frames& frames, const ImageInfo& info, TransferSyntax transferSyntax, ArrayView<uint8_t> output, ThreadPool& pool)
+		{
+			checkOutput(output, info);
+			if (frames.size() != info.numberOfFrames)
+				throw Exception("{} Found {} frames, expected {}", LOG_POSITION, frames.size(), info.numberOfFrames);
+
+			const auto codec = getCodec(transferSyntax);
+			const size_t stride = info.frameStride();
+			pool.parallelFor(frames.size(), [&](size_t i) {
+				codec->decode(frames[i], info, {output.begin() + i * stride, stride});
+			});
+		}
+
+		Frames encodeFrames(ArrayView<const uint8_t> input, const ImageInfo& info, TransferSyntax transferSyntax, ThreadPool& pool)
+		{
+			const size_t frameSize = info.frameSize();
+			if (input.size() < info.numberOfFrames * frameSize)
+				throw Exception("{} Input buffer too small: {} bytes for {} frames of {} bytes", LOG_POSITION, input.size(), info.numberOfFrames, frameSize);
+
+			const auto codec = getCodec(transferSyntax);
+			if (!codec->canEncode())
+				throw Exception("{} The {} codec cannot encode", LOG_POSITION, codec->name());
+
+			Frames frames(info.numberOfFrames);
+			pool.parallelFor(frames.size(), [&](size_t i) {
+				frames[i] = codec->encode({input.data() + i * frameSize, frameSize}, info);
+			});
+			return frames;
+		}
+
+	} // namespace codec
+} // namespace emdl
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <emdl/codec/Codec.h>
+#include <emdl/ThreadPool.h>
+#include <emdl/TransferSyntaxes.h>
+
+namespace emdl
+{
+	namespace codec
+	{
+		//! Decode all the frames of the PixelData of the data set in parallel.
+		//! Frame i is written at output + i * info.frameStride(), output must hold numberOfFrames * frameStride bytes and be aligned on a cache line.
+		//! Native transfer syntaxes are copied, encapsulated ones use the codec registered for the transfer syntax of the data set.
+		EMDL_API ImageInfo decodeFrames(const DataSet& dataSet, ArrayView<uint8_t> output, ThreadPool& pool = ThreadPool::global());
+
+		//! Decode compressed frames in parallel, with the same output layout as above
+		EMDL_API void decodeFrames(const Frames& frames, const ImageInfo& info, TransferSyntax transferSyntax, ArrayView<uint8_t> output, ThreadPool& pool = ThreadPool::global());
+
+		//! Encode in parallel the info.numberOfFrames frames of input, which are contiguous (separated by info.frameSize() bytes)
+		EMDL_API Frames encodeFrames(ArrayView<const uint8_t> input, const ImageInfo& info, TransferSyntax transferSyntax, ThreadPool& pool = ThreadPool::global());
+
+	} // namespace codec
+} // namespace emdl
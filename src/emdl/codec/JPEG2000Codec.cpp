@@ -0,0 +1,138 @@
+#ifdef EMDL_WITH_OPENJPEG
+
+#include <emdl/codec/JPEG2000Codec.h>
+#include <emdl/Exception.h>
+
+#include <cstring>
+#include <memory>
+
+#include <openjpeg.h>
+
+namespace
+{
+	// Memory stream read by OpenJPEG
+	struct MemoryStream
+	{
+		const uint8_t* data;
+		size_t size;
+		size_t offset;
+	};
+
+	OPJ_SIZE_T readStream(void* buffer, OPJ_SIZE_T nbBytes, void* userData)
+	{
+		auto stream = static_cast<MemoryStream*>(userData);
+		if (stream->offset >= stream->size)
+			return static_cast<OPJ_SIZE_T>(-1);
+		const auto count = std::min<size_t>(nbBytes, stream->size - stream->offset);
+		std::memcpy(buffer, stream->data + stream->offset, count);
+		stream->offset += count;
+		return count;
+	}
+
+	OPJ_OFF_T skipStream(OPJ_OFF_T nbBytes, void* userData)
+	{
+		auto stream = static_cast<MemoryStream*>(userData);
+		if (nbBytes < 0)
+			nbBytes = -std::min<OPJ_OFF_T>(-nbBytes, stream->offset);
+		else
+			nbBytes = std::min<OPJ_OFF_T>(nbBytes, stream->size - stream->offset);
+		stream->offset += nbBytes;
+		return nbBytes;
+	}
+
+	OPJ_BOOL seekStream(OPJ_OFF_T offset, void* userData)
+	{
+		auto stream = static_cast<MemoryStream*>(userData);
+		if (offset < 0 || static_cast<size_t>(offset) > stream->size)
+			return OPJ_FALSE;
+		stream->offset = static_cast<size_t>(offset);
+		return OPJ_TRUE;
+	}
+
+	// Store the decoded samples with the number of bytes of the data set
+	template <class T>
+	void storeComponent(const opj_image_comp_t& comp, uint8_t* output, size_t step)
+	{
+		const size_t nbPixels = static_cast<size_t>(comp.w) * comp.h;
+		for (size_t i = 0; i < nbPixels; ++i)
+		{
+			const T value = static_cast<T>(comp.data[i]);
+			std::memcpy(output + i * step, &value, sizeof(T));
+		}
+	}
+
+	using StreamPtr = std::unique_ptr<opj_stream_t, decltype(&opj_stream_destroy)>;
+	using CodecPtr = std::unique_ptr<opj_codec_t, decltype(&opj_destroy_codec)>;
+	using ImagePtr = std::unique_ptr<opj_image_t, decltype(&opj_image_destroy)>;
+}
+
+namespace emdl
+{
+	namespace codec
+	{
+		const char* JPEG2000Codec::name() const
+		{
+			return "OpenJPEG";
+		}
+
+		void JPEG2000Codec::decode(const Fragments& frame, const ImageInfo& info, ArrayView<uint8_t> output) const
+		{
+			if (output.size() < info.frameSize())
+				throw Exception("{} Output buffer too small: {} bytes for a frame of {} bytes", LOG_POSITION, output.size(), info.frameSize());
+			if (info.bitsAllocated != 8 && info.bitsAllocated != 16)
+				throw Exception("{} OpenJPEG decoding of {} bits allocated is not supported", LOG_POSITION, info.bitsAllocated);
+
+			std::vector<uint8_t> joined;
+			const auto bitstream = joinFragments(frame, joined);
+			MemoryStream memory{bitstream.data(), bitstream.size(), 0};
+
+			// A raw codestream starts with the SOC and SIZ markers, otherwise this is a JP2 file
+			static const uint8_t codestreamMagic[] = {0xff, 0x4f, 0xff, 0x51};
+			const bool isCodestream = bitstream.size() >= 4 && !std::memcmp(bitstream.data(), codestreamMagic, 4);
+
+			StreamPtr stream(opj_stream_create(OPJ_J2K_STREAM_CHUNK_SIZE, OPJ_TRUE), &opj_stream_destroy);
+			opj_stream_set_user_data(stream.get(), &memory, nullptr);
+			opj_stream_set_user_data_length(stream.get(), bitstream.size());
+			opj_stream_set_read_function(stream.get(), readStream);
+			opj_stream_set_skip_function(stream.get(), skipStream);
+			opj_stream_set_seek_function(stream.get(), seekStream);
+
+			CodecPtr codec(opj_create_decompress(isCodestream ? OPJ_CODEC_J2K : OPJ_CODEC_JP2), &opj_destroy_codec);
+			opj_dparameters_t parameters;
+			opj_set_default_decoder_parameters(&parameters);
+			if (!opj_setup_decoder(codec.get(), &parameters))
+				throw Exception("{} Could not set up the OpenJPEG decoder", LOG_POSITION);
+
+			opj_image_t* rawImage = nullptr;
+			const bool headerRead = opj_read_header(stream.get(), codec.get(), &rawImage);
+			ImagePtr image(rawImage, &opj_image_destroy);
+			if (!headerRead
+				|| !opj_decode(codec.get(), stream.get(), image.get())
+				|| !opj_end_decompress(codec.get(), stream.get()))
+				throw Exception("{} OpenJPEG could not decode the frame", LOG_POSITION);
+
+			if (image->numcomps != info.samplesPerPixel)
+				throw Exception("{} JPEG 2000 frame has {} components, expected {}", LOG_POSITION, image->numcomps, info.samplesPerPixel);
+
+			const size_t bytesPerSample = info.bitsAllocated / 8;
+			const size_t nbPixels = static_cast<size_t>(info.rows) * info.columns;
+			const bool planar = (info.planarConfiguration == 1);
+			for (OPJ_UINT32 c = 0; c < image->numcomps; ++c)
+			{
+				const auto& comp = image->comps[c];
+				if (comp.w != info.columns || comp.h != info.rows)
+					throw Exception("{} JPEG 2000 component of {}x{} does not match the data set", LOG_POSITION, comp.w, comp.h);
+
+				uint8_t* dest = output.begin() + (planar ? c * nbPixels * bytesPerSample : c * bytesPerSample);
+				const size_t step = planar ? bytesPerSample : info.samplesPerPixel * bytesPerSample;
+				if (bytesPerSample == 1)
+					storeComponent<uint8_t>(comp, dest, step);
+				else
+					storeComponent<uint16_t>(comp, dest, step);
+			}
+		}
+
+	} // namespace codec
+} // namespace emdl
+
+#endif // EMDL_WITH_OPENJPEG
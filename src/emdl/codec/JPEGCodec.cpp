@@ -0,0 +1,102 @@
+#ifdef EMDL_WITH_LIBJPEG
+
+#include <emdl/codec/JPEGCodec.h>
+#include <emdl/Exception.h>
+
+#include <csetjmp>
+#include <cstdio>
+#include <cstring>
+
+#include <jpeglib.h>
+
+namespace
+{
+	// libjpeg reports fatal errors through a callback that must not return
+	struct ErrorManager
+	{
+		jpeg_error_mgr manager;
+		std::jmp_buf jump;
+		char message[JMSG_LENGTH_MAX];
+	};
+
+	void errorExit(j_common_ptr info)
+	{
+		auto errors = reinterpret_cast<ErrorManager*>(info->err);
+		(*info->err->format_message)(info, errors->message);
+		std::longjmp(errors->jump, 1);
+	}
+
+	void outputMessage(j_common_ptr)
+	{
+		// Do not print warnings on stderr
+	}
+}
+
+namespace emdl
+{
+	namespace codec
+	{
+		const char* JPEGCodec::name() const
+		{
+			return "libjpeg";
+		}
+
+		void JPEGCodec::decode(const Fragments& frame, const ImageInfo& info, ArrayView<uint8_t> output) const
+		{
+			if (output.size() < info.frameSize())
+				throw Exception("{} Output buffer too small: {} bytes for a frame of {} bytes", LOG_POSITION, output.size(), info.frameSize());
+			if (info.bitsAllocated != 8)
+				throw Exception("{} libjpeg only decodes 8 bits frames, not {}", LOG_POSITION, info.bitsAllocated);
+
+			std::vector<uint8_t> joined;
+			const auto bitstream = joinFragments(frame, joined);
+			const uint8_t* data = bitstream.data();
+			const size_t size = bitstream.size();
+
+			jpeg_decompress_struct cinfo;
+			ErrorManager errors;
+			cinfo.err = jpeg_std_error(&errors.manager);
+			errors.manager.error_exit = errorExit;
+			errors.manager.output_message = outputMessage;
+
+			if (setjmp(errors.jump))
+			{
+				jpeg_destroy_decompress(&cinfo);
+				throw Exception("{} JPEG decoding error: {}", LOG_POSITION, errors.message);
+			}
+
+			jpeg_create_decompress(&cinfo);
+			jpeg_mem_src(&cinfo, const_cast<unsigned char*>(data), static_cast<unsigned long>(size));
+			jpeg_read_header(&cinfo, TRUE);
+
+			if (cinfo.num_components == 3)
+				cinfo.out_color_space = JCS_RGB;
+			else if (cinfo.num_components != 1)
+			{
+				jpeg_destroy_decompress(&cinfo);
+				throw Exception("{} Unsupported number of JPEG components: {}", LOG_POSITION, cinfo.num_components);
+			}
+
+			jpeg_start_decompress(&cinfo);
+
+			if (cinfo.output_width != info.columns || cinfo.output_height != info.rows || cinfo.output_components != info.samplesPerPixel)
+			{
+				jpeg_destroy_decompress(&cinfo);
+				throw Exception("{} JPEG frame of {}x{}x{} does not match the data set", LOG_POSITION, cinfo.output_width, cinfo.output_height, cinfo.output_components);
+			}
+
+			const size_t rowSize = static_cast<size_t>(cinfo.output_width) * cinfo.output_components;
+			while (cinfo.output_scanline < cinfo.output_height)
+			{
+				JSAMPROW row = output.begin() + cinfo.output_scanline * rowSize;
+				jpeg_read_scanlines(&cinfo, &row, 1);
+			}
+
+			jpeg_finish_decompress(&cinfo);
+			jpeg_destroy_decompress(&cinfo);
+		}
+
+	} // namespace codec
+} // namespace emdl
+
+#endif // EMDL_WITH_LIBJPEG
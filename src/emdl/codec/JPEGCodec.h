@@ -0,0 +1,20 @@
+#pragma once
+
+#include <emdl/codec/Codec.h>
+
+namespace emdl
+{
+	namespace codec
+	{
+		//! 8 bits JPEG Baseline and Extended decoding, using libjpeg or libjpeg-turbo (when found at configure time).
+		//! Color frames are decoded to interleaved RGB, whatever the planar configuration of the data set.
+		class EMDL_API JPEGCodec : public Codec
+		{
+		public:
+			const char* name() const override;
+
+			void decode(const Fragments& frame, const ImageInfo& info, ArrayView<uint8_t> output) const override;
+		};
+
+	} // namespace codec
+} // namespace emdl
@@ -0,0 +1,93 @@
+#ifdef EMDL_WITH_CHARLS
+
+#include <emdl/codec/JPEGLSCodec.h>
+#include <emdl/Exception.h>
+
+#include <cstring>
+#include <memory>
+
+#include <charls/charls.h>
+
+namespace
+{
+	using DecoderPtr = std::unique_ptr<charls_jpegls_decoder, decltype(&charls_jpegls_decoder_destroy)>;
+
+	void check(charls_jpegls_errc error)
+	{
+		if (error != CHARLS_JPEGLS_ERRC_SUCCESS)
+			throw emdl::Exception("{} CharLS error: {}", LOG_POSITION, charls_get_error_message(error));
+	}
+
+	// Switch between planar and interleaved samples
+	void reshuffle(const uint8_t* input, uint8_t* output, size_t nbPixels, size_t nbSamples, size_t bytesPerSample, bool toPlanar)
+	{
+		for (size_t p = 0; p < nbPixels; ++p)
+		{
+			for (size_t s = 0; s < nbSamples; ++s)
+			{
+				const size_t interleaved = (p * nbSamples + s) * bytesPerSample;
+				const size_t planar = (s * nbPixels + p) * bytesPerSample;
+				if (toPlanar)
+					std::memcpy(output + planar, input + interleaved, bytesPerSample);
+				else
+					std::memcpy(output + interleaved, input + planar, bytesPerSample);
+			}
+		}
+	}
+}
+
+namespace emdl
+{
+	namespace codec
+	{
+		const char* JPEGLSCodec::name() const
+		{
+			return "CharLS";
+		}
+
+		void JPEGLSCodec::decode(const Fragments& frame, const ImageInfo& info, ArrayView<uint8_t> output) const
+		{
+			if (output.size() < info.frameSize())
+				throw Exception("{} Output buffer too small: {} bytes for a frame of {} bytes", LOG_POSITION, output.size(), info.frameSize());
+
+			std::vector<uint8_t> joined;
+			const auto bitstream = joinFragments(frame, joined);
+
+			DecoderPtr decoder(charls_jpegls_decoder_create(), &charls_jpegls_decoder_destroy);
+			if (!decoder)
+				throw Exception("{} Could not create the CharLS decoder", LOG_POSITION);
+
+			check(charls_jpegls_decoder_set_source_buffer(decoder.get(), bitstream.data(), bitstream.size()));
+			check(charls_jpegls_decoder_read_header(decoder.get()));
+
+			charls_frame_info frameInfo;
+			check(charls_jpegls_decoder_get_frame_info(decoder.get(), &frameInfo));
+			if (frameInfo.width != info.columns || frameInfo.height != info.rows || frameInfo.component_count != info.samplesPerPixel)
+				throw Exception("{} JPEG-LS frame of {}x{}x{} does not match the data set", LOG_POSITION, frameInfo.width, frameInfo.height, frameInfo.component_count);
+
+			charls_interleave_mode mode;
+			check(charls_jpegls_decoder_get_interleave_mode(decoder.get(), &mode));
+
+			size_t size = 0;
+			check(charls_jpegls_decoder_get_destination_size(decoder.get(), 0, &size));
+			if (size != info.frameSize())
+				throw Exception("{} JPEG-LS frame decodes to {} bytes, expected {}", LOG_POSITION, size, info.frameSize());
+
+			// CharLS writes planar samples when the stream is not interleaved, and interleaved samples otherwise
+			const bool decodedPlanar = (mode == CHARLS_INTERLEAVE_MODE_NONE);
+			const bool wantedPlanar = (info.planarConfiguration == 1);
+			if (info.samplesPerPixel == 1 || decodedPlanar == wantedPlanar)
+			{
+				check(charls_jpegls_decoder_decode_to_buffer(decoder.get(), output.begin(), size, 0));
+				return;
+			}
+
+			std::vector<uint8_t> decoded(size);
+			check(charls_jpegls_decoder_decode_to_buffer(decoder.get(), decoded.data(), size, 0));
+			reshuffle(decoded.data(), output.begin(), static_cast<size_t>(info.rows) * info.columns, info.samplesPerPixel, (info.bitsAllocated + 7) / 8, wantedPlanar);
+		}
+
+	} // namespace codec
+} // namespace emdl
+
+#endif // EMDL_WITH_CHARLS
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <emdl/codec/Codec.h>
+
+namespace emdl
+{
+	namespace codec
+	{
+		//! JPEG-LS decoding, using CharLS (when found at configure time)
+		class EMDL_API JPEGLSCodec : public Codec
+		{
+		public:
+			const char* name() const override;
+
+			void decode(const Fragments& frame, const ImageInfo& info, ArrayView<uint8_t> output) const override;
+		};
+
+	} // namespace codec
+} // namespace emdl
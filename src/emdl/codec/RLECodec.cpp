@@ -0,0 +1,191 @@
+#include <emdl/codec/RLECodec.h>
+#include <emdl/Exception.h>
+
+#include <cstring>
+
+namespace
+{
+	const size_t headerSize = 64; // Number of segments followed by 15 offsets
+	const size_t maxSegments = 15;
+
+	// PackBits decoding of one segment, writing one byte every "step" bytes
+	void decodeSegment(const uint8_t* data, size_t size, uint8_t* output, size_t nbBytes, size_t step)
+	{
+		size_t in = 0, out = 0;
+		while (out < nbBytes && in < size)
+		{
+			const auto n = static_cast<int8_t>(data[in++]);
+			if (n >= 0) // Literal run of n + 1 bytes
+			{
+				const size_t count = std::min<size_t>(n + 1, std::min(nbBytes - out, size - in));
+				if (step == 1)
+					std::memcpy(output + out, data + in, count);
+				else
+				{
+					for (size_t i = 0; i < count; ++i)
+						output[(out + i) * step] = data[in + i];
+				}
+				in += n + 1;
+				out += count;
+			}
+			else if (n != -128) // Replicate run of 1 - n bytes
+			{
+				if (in >= size)
+					break;
+				const auto value = data[in++];
+				const size_t count = std::min<size_t>(1 - n, nbBytes - out);
+				if (step == 1)
+					std::memset(output + out, value, count);
+				else
+				{
+					for (size_t i = 0; i < count; ++i)
+						output[(out + i) * step] = value;
+				}
+				out += count;
+			}
+		}
+
+		if (out != nbBytes)
+			throw emdl::Exception("{} RLE segment is too short: decoded {} bytes instead of {}", LOG_POSITION, out, nbBytes);
+	}
+
+	// PackBits encoding of one row, appended to the output
+	void encodeRow(const uint8_t* row, size_t size, std::vector<uint8_t>& output)
+	{
+		size_t i = 0;
+		while (i < size)
+		{
+			size_t run = 1;
+			while (i + run < size && run < 128 && row[i + run] == row[i])
+				++run;
+
+			if (run >= 2)
+			{
+				output.push_back(static_cast<uint8_t>(static_cast<int8_t>(1 - static_cast<int>(run))));
+				output.push_back(row[i]);
+				i += run;
+			}
+			else
+			{
+				// Extend the literal run until a replicate run of at least 3 bytes starts
+				const auto start = i++;
+				while (i < size && i - start < 128)
+				{
+					if (i + 2 < size && row[i] == row[i + 1] && row[i] == row[i + 2])
+						break;
+					++i;
+				}
+				output.push_back(static_cast<uint8_t>(i - start - 1));
+				output.insert(output.end(), row + start, row + i);
+			}
+		}
+	}
+}
+
+namespace emdl
+{
+	namespace codec
+	{
+		const char* RLECodec::name() const
+		{
+			return "RLE";
+		}
+
+		void RLECodec::decode(const Fragments& frame, const ImageInfo& info, ArrayView<uint8_t> output) const
+		{
+			if (output.size() < info.frameSize())
+				throw Exception("{} Output buffer too small: {} bytes for a frame of {} bytes", LOG_POSITION, output.size(), info.frameSize());
+			if (info.bitsAllocated % 8 != 0)
+				throw Exception("{} RLE does not support {} bits allocated", LOG_POSITION, info.bitsAllocated);
+
+			// A frame is usually contained in a single fragment, otherwise join them
+			std::vector<uint8_t> joined;
+			const auto bitstream = joinFragments(frame, joined);
+			const uint8_t* data = bitstream.data();
+			const size_t size = bitstream.size();
+
+			if (size < headerSize)
+				throw Exception("{} RLE frame is too small", LOG_POSITION);
+
+			uint32_t header[maxSegments + 1];
+			std::memcpy(header, data, headerSize);
+
+			const size_t bytesPerSample = info.bitsAllocated / 8;
+			const size_t nbSegments = info.samplesPerPixel * bytesPerSample;
+			if (nbSegments > maxSegments)
+				throw Exception("{} RLE cannot decode {} segments", LOG_POSITION, nbSegments);
+			if (header[0] != nbSegments)
+				throw Exception("{} RLE frame has {} segments, expected {}", LOG_POSITION, header[0], nbSegments);
+
+			const size_t nbPixels = static_cast<size_t>(info.rows) * info.columns;
+			const bool planar = (info.planarConfiguration == 1);
+			for (size_t s = 0; s < nbSegments; ++s)
+			{
+				const size_t start = header[s + 1];
+				const size_t end = (s + 1 < nbSegments) ? header[s + 2] : size;
+				if (start > end || end > size)
+					throw Exception("{} Invalid RLE segment offsets", LOG_POSITION);
+
+				// Segments are ordered by sample, then from the most significant byte
+				const size_t sample = s / bytesPerSample;
+				const size_t byteIndex = bytesPerSample - 1 - (s % bytesPerSample);
+				if (planar)
+					decodeSegment(data + start, end - start, output.begin() + sample * nbPixels * bytesPerSample + byteIndex, nbPixels, bytesPerSample);
+				else
+					decodeSegment(data + start, end - start, output.begin() + sample * bytesPerSample + byteIndex, nbPixels, info.samplesPerPixel * bytesPerSample);
+			}
+		}
+
+		bool RLECodec::canEncode() const
+		{
+			return true;
+		}
+
+		Fragments RLECodec::encode(ArrayView<const uint8_t> frame, const ImageInfo& info) const
+		{
+			if (frame.size() < info.frameSize())
+				throw Exception("{} Input frame too small: {} bytes for a frame of {} bytes", LOG_POSITION, frame.size(), info.frameSize());
+			if (info.bitsAllocated % 8 != 0)
+				throw Exception("{} RLE does not support {} bits allocated", LOG_POSITION, info.bitsAllocated);
+
+			const size_t bytesPerSample = info.bitsAllocated / 8;
+			const size_t nbSegments = info.samplesPerPixel * bytesPerSample;
+			if (nbSegments > maxSegments)
+				throw Exception("{} RLE cannot encode {} segments", LOG_POSITION, nbSegments);
+
+			const size_t nbPixels = static_cast<size_t>(info.rows) * info.columns;
+			const bool planar = (info.planarConfiguration == 1);
+
+			uint32_t header[maxSegments + 1] = {};
+			header[0] = static_cast<uint32_t>(nbSegments);
+
+			std::vector<uint8_t> result(headerSize);
+			result.reserve(headerSize + frame.size() + frame.size() / 64);
+			std::vector<uint8_t> row(info.columns);
+			for (size_t s = 0; s < nbSegments; ++s)
+			{
+				header[s + 1] = static_cast<uint32_t>(result.size());
+
+				const size_t sample = s / bytesPerSample;
+				const size_t byteIndex = bytesPerSample - 1 - (s % bytesPerSample);
+				const size_t step = planar ? bytesPerSample : info.samplesPerPixel * bytesPerSample;
+				const uint8_t* src = frame.data() + byteIndex + (planar ? sample * nbPixels * bytesPerSample : sample * bytesPerSample);
+
+				// Each row is encoded separately
+				for (size_t y = 0; y < info.rows; ++y)
+				{
+					for (size_t x = 0; x < info.columns; ++x)
+						row[x] = src[(y * info.columns + x) * step];
+					encodeRow(row.data(), row.size(), result);
+				}
+
+				if (result.size() % 2 == 1) // Segments have an even length
+					result.push_back(0);
+			}
+
+			std::memcpy(result.data(), header, headerSize);
+			return {BinaryValue(std::move(result))};
+		}
+
+	} // namespace codec
+} // namespace emdl
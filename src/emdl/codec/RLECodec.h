@@ -0,0 +1,22 @@
+#pragma once
+
+#include <emdl/codec/Codec.h>
+
+namespace emdl
+{
+	namespace codec
+	{
+		//! RLE Lossless (PS3.5 Annex G), always available
+		class EMDL_API RLECodec : public Codec
+		{
+		public:
+			const char* name() const override;
+
+			void decode(const Fragments& frame, const ImageInfo& info, ArrayView<uint8_t> output) const override;
+
+			bool canEncode() const override;
+			Fragments encode(ArrayView<const uint8_t> frame, const ImageInfo& info) const override;
+		};
+
+	} // namespace codec
+} // namespace emdl
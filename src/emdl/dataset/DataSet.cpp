@@ -1,4 +1,5 @@
 #include <emdl/dataset/DataSet.h>
+#include <emdl/dataset/reader/DataSetReader.h>
 #include <emdl/dataset/reader/ElementReader.h>
 #include <emdl/Exception.h>
 
@@ -6,20 +7,91 @@ namespace emdl
 {
 	const uint32_t DataSet::TagElementStruct::npos = static_cast<uint32_t>(-1);
 
-	DataSet::DataSet(TransferSyntax transferSyntax)
-		: m_transferSyntax(transferSyntax)
+	DataSet::DataSet(TransferSyntax transferSyntax, const MemoryArenaSPtr& arena)
+		: m_arena(arena)
+		, m_transferSyntax(transferSyntax)
+		, m_groups(arena.get())
+		, m_preparedElements(arena.get())
 	{
 	}
 
-	DataSet::DataSet(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax)
-		: m_buffer(buffer)
+	DataSet::DataSet(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena)
+		: m_arena(arena)
+		, m_buffer(buffer)
 		, m_view(view)
 		, m_transferSyntax(transferSyntax)
+		, m_groups(arena.get())
+		, m_preparedElements(arena.get())
+	{
+	}
+
+	DataSet::DataSet(const DataSet& other)
+		: m_arena(other.m_arena)
+		, m_buffer(other.m_buffer)
+		, m_view(other.m_view)
+		, m_transferSyntax(other.m_transferSyntax)
+		, m_groups(other.m_groups)
+		, m_deferred(other.m_deferred)
+		, m_preparedElements(other.m_preparedElements)
+		, m_modified(other.m_modified)
+	{
+		// The items of the sequences are copied (without copying their values), as they are parsed on first access.
+		// Encoded values are also copied (sharing the buffer), as they are decoded on first access.
+		// The elements returned by the non const getElement are copied, as the other data set can still modify them through its references.
+		for (auto& prepared : m_preparedElements)
+		{
+			if (prepared.element && (prepared.escaped || prepared.element->isDataSet() || prepared.element->value().isEncoded()))
+				prepared.element = makeElement(*prepared.element);
+			prepared.escaped = false;
+		}
+	}
+
+	DataSet& DataSet::operator=(const DataSet& other)
+	{
+		if (this != &other)
+			*this = DataSet(other);
+		return *this;
+	}
+
+	DataSet& DataSet::operator=(DataSet&& other)
 	{
+		if (this != &other)
+		{
+			// A default assignment would replace the arena first, and release it before the containers allocated in it.
+			// The previous content is destroyed at the end instead, its containers before its arena.
+			DataSet previous(std::move(*this));
+			m_arena = std::move(other.m_arena);
+			m_buffer = std::move(other.m_buffer);
+			m_view = other.m_view;
+			m_transferSyntax = other.m_transferSyntax;
+			m_groups = std::move(other.m_groups);
+			m_deferred = other.m_deferred;
+			m_preparedElements = std::move(other.m_preparedElements);
+			m_modified = other.m_modified;
+		}
+		return *this;
+	}
+
+	DataSet DataSet::deferred(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena)
+	{
+		DataSet dataSet(buffer, view, transferSyntax, arena);
+		dataSet.m_deferred = true;
+		return dataSet;
+	}
+
+	void DataSet::index() const
+	{
+		if (!m_deferred)
+			return;
+
+		auto dataSet = DataSetReader(m_buffer, m_view, m_transferSyntax, m_arena).readDataSet();
+		m_groups = std::move(dataSet.m_groups);
+		m_deferred = false;
 	}
 
 	bool DataSet::has(const Tag& tag) const
 	{
+		index();
 		auto itG = std::find_if(m_groups.begin(), m_groups.end(), [tag](const Group& g) {
 			return tag.group == g.group;
 		});
@@ -39,7 +111,7 @@ namespace emdl
 		if (vr == VR::Unknown)
 			vr = findVR(tag);
 
-		getPreparedElement(edit(tag)) = {true, Element{vr}};
+		getPreparedElement(edit(tag)) = {true, makeElement(vr)};
 	}
 
 	void DataSet::set(const Tag& tag, BinaryView view)
@@ -51,16 +123,17 @@ namespace emdl
 
 	void DataSet::set(const Tag& tag, const Element& element)
 	{
-		getPreparedElement(edit(tag)) = {true, element};
+		getPreparedElement(edit(tag)) = {true, makeElement(element)};
 	}
 
 	void DataSet::set(const Tag& tag, Element&& element)
 	{
-		getPreparedElement(edit(tag)) = {true, std::move(element)};
+		getPreparedElement(edit(tag)) = {true, makeElement(std::move(element))};
 	}
 
 	void DataSet::remove(const Tag& tag)
 	{
+		index();
 		auto itG = std::find_if(m_groups.begin(), m_groups.end(), [tag](const Group& g) {
 			return tag.group == g.group;
 		});
@@ -127,11 +200,36 @@ namespace emdl
 		return m_view;
 	}
 
+	const MemoryArenaSPtr& DataSet::memoryArena() const
+	{
+		return m_arena;
+	}
+
 	bool DataSet::empty() const
 	{
+		index();
 		return m_groups.empty();
 	}
 
+	void DataSet::materialize(ThreadPool& pool) const
+	{
+		// Items do not share any state, so all the items of a level are independent
+		std::vector<const DataSet*> level;
+		prepareElements(level);
+		while (!level.empty())
+		{
+			std::vector<std::vector<const DataSet*>> children(level.size());
+			pool.parallelFor(level.size(), [&](size_t i) {
+				level[i]->prepareElements(children[i]);
+			});
+
+			std::vector<const DataSet*> next;
+			for (const auto& items : children)
+				next.insert(next.end(), items.begin(), items.end());
+			level = std::move(next);
+		}
+	}
+
 	void DataSet::updateViewSize(size_t size)
 	{
 		m_view = BinaryView(m_view.data(), size);
@@ -140,6 +238,7 @@ namespace emdl
 
 	DataSet::const_iterator DataSet::begin() const
 	{
+		index();
 		if (m_groups.empty())
 			return const_iterator(this, m_groups.begin(), {});
 		return const_iterator(this, m_groups.begin(), m_groups.front().elements.begin());
@@ -147,6 +246,7 @@ namespace emdl
 
 	DataSet::const_iterator DataSet::end() const
 	{
+		index();
 		if (m_groups.empty())
 			return const_iterator(this, m_groups.end(), {});
 		return const_iterator(this, m_groups.end() - 1, m_groups.back().elements.end());
@@ -154,11 +254,13 @@ namespace emdl
 
 	const DataSet::Groups& DataSet::getGroups() const
 	{
+		index();
 		return m_groups;
 	}
 
 	const DataSet::TagElementStruct* DataSet::find(const Tag& tag) const
 	{
+		index();
 		auto itG = std::find_if(m_groups.begin(), m_groups.end(), [tag](const Group& g) {
 			return tag.group == g.group;
 		});
@@ -177,6 +279,7 @@ namespace emdl
 
 	DataSet::TagElementStruct& DataSet::edit(const Tag& tag)
 	{
+		index();
 		auto itG = std::lower_bound(m_groups.begin(), m_groups.end(), tag.group, [](const Group& g, uint16_t id) {
 			return g.group < id;
 		});
@@ -184,6 +287,7 @@ namespace emdl
 		{
 			Group group;
 			group.group = tag.group;
+			group.elements = TagElements(m_arena.get());
 
 			// Insert the group so that the list stays sorted
 			itG = m_groups.insert(itG, std::move(group));
@@ -211,8 +315,15 @@ namespace emdl
 	Element& DataSet::getElement(const TagElementStruct& tes)
 	{
 		m_modified = true;
+		getElement(tes, true); // Parse it if necessary
 
-		return const_cast<Element&>(const_cast<const DataSet*>(this)->getElement(tes, true));
+		// Copy the element if it is shared with another data set
+		auto& prepared = m_preparedElements[tes.preparedIndex];
+		prepared.modified = true;
+		prepared.escaped = true;
+		if (prepared.element.use_count() > 1)
+			prepared.element = makeElement(*prepared.element);
+		return *prepared.element;
 	}
 
 	const Element& DataSet::getElement(const TagElementStruct& tes) const
@@ -220,16 +331,34 @@ namespace emdl
 		return getElement(tes, false);
 	}
 
+	void DataSet::prepareElements(std::vector<const DataSet*>& items) const
+	{
+		index();
+		for (const auto& group : m_groups)
+		{
+			for (const auto& tes : group.elements)
+			{
+				const auto& element = getElement(tes);
+				element.value().decode();
+				if (!element.isDataSet())
+					continue;
+				for (const auto& item : element.asDataSet())
+					items.push_back(&item);
+			}
+		}
+	}
+
 	const Element& DataSet::getElement(const TagElementStruct& tes, bool modified) const
 	{
 		// We already have a value
 		if (tes.preparedIndex != TagElementStruct::npos)
-			return m_preparedElements[tes.preparedIndex].second;
+			return *m_preparedElements[tes.preparedIndex].element;
 
 		// Or we must parse it and add it to the list
+		auto element = makeElement(ElementReader{m_buffer, getView(tes), m_transferSyntax, m_arena}.readElement(*this));
 		tes.preparedIndex = static_cast<int>(m_preparedElements.size());
-		m_preparedElements.emplace_back(modified, ElementReader{m_buffer, getView(tes), m_transferSyntax}.readElement(*this));
-		return m_preparedElements.back().second;
+		m_preparedElements.emplace_back(modified, std::move(element));
+		return *m_preparedElements.back().element;
 	}
 
 	DataSet::PreparedElement& DataSet::getPreparedElement(const TagElementStruct& tes) const
@@ -240,7 +369,7 @@ namespace emdl
 
 		// Or we must add it to the list
 		tes.preparedIndex = static_cast<int>(m_preparedElements.size());
-		m_preparedElements.emplace_back(false, Element());
+		m_preparedElements.emplace_back(false, nullptr); // Assigned by the caller
 		return m_preparedElements.back();
 	}
 
@@ -254,7 +383,7 @@ namespace emdl
 		if (tes.preparedIndex == DataSet::TagElementStruct::npos)
 			return false;
 
-		return m_preparedElements[tes.preparedIndex].first;
+		return m_preparedElements[tes.preparedIndex].modified;
 	}
 
 	boost::optional<BinaryView> DataSet::getView(const Tag& tag) const
@@ -266,6 +395,23 @@ namespace emdl
 			return {};
 	}
 
+	boost::optional<BinaryView> DataSet::getUnmodifiedView(const Tag& tag) const
+	{
+		auto tes = find(tag);
+		if (tes && tes->size && !isModified(*tes))
+			return getView(*tes);
+		else
+			return {};
+	}
+
+	/*****************************************************************************/
+
+	FrozenDataSetSPtr freeze(DataSet dataSet, ThreadPool& pool)
+	{
+		dataSet.materialize(pool);
+		return std::make_shared<const DataSet>(std::move(dataSet));
+	}
+
 	/*****************************************************************************/
 
 	DataSet::iterator_value::iterator_value()
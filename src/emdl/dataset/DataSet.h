@@ -4,9 +4,10 @@
 #include <emdl/dataset/VRFinder.h>
 
 #include <emdl/BinaryValue.h>
+#include <emdl/MemoryArena.h>
+#include <emdl/ThreadPool.h>
 #include <emdl/TransferSyntaxes.h>
 
-#include <deque>
 #include <memory>
 #include <string>
 #include <vector>
@@ -24,8 +25,22 @@ namespace emdl
 	class EMDL_API DataSet
 	{
 	public:
-		explicit DataSet(TransferSyntax transferSyntax = TransferSyntax::ExplicitVRLittleEndian);
-		explicit DataSet(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax = TransferSyntax::ExplicitVRLittleEndian);
+		//! The structures of the data set (index and elements) are allocated in the arena if one is given. The values themselves are not.
+		explicit DataSet(TransferSyntax transferSyntax = TransferSyntax::ExplicitVRLittleEndian, const MemoryArenaSPtr& arena = {});
+		explicit DataSet(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax = TransferSyntax::ExplicitVRLittleEndian, const MemoryArenaSPtr& arena = {});
+
+		//! Copy the data set, sharing the values of the elements until they are modified.
+		//! The elements already accessed with the non const operator[] are copied, so that the references to them only modify this data set.
+		DataSet(const DataSet& other);
+		DataSet(DataSet&& other) = default;
+
+		DataSet& operator=(const DataSet& other);
+		DataSet& operator=(DataSet&& other);
+
+		//! Data set of the elements encoded in the view, only indexed when first accessed (used for the items of the sequences).
+		//! The first call to any function indexes it, const ones included (has, begin, empty...): they throw if the elements are malformed,
+		//! and they must not be called from several threads at once. materialize() and freeze() index everything beforehand.
+		static DataSet deferred(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena = {});
 
 		//! Test whether an element is in the data set.
 		bool has(const Tag& tag) const;
@@ -69,6 +84,24 @@ namespace emdl
 			set(tag, Element(std::move(value), vr));
 		}
 
+		//! Add an element to the data set using a list of numbers or strings, or assign it if already in the data set
+		template <class T, std::size_t N>
+		void set(const Tag& tag, const SmallVector<T, N>& value, VR vr = VR::Unknown)
+		{
+			if (vr == VR::Unknown)
+				vr = findVR(tag);
+			set(tag, Element(value, vr));
+		}
+
+		//! Add an element to the data set using a list of numbers or strings, or assign it if already in the data set
+		template <class T, std::size_t N>
+		void set(const Tag& tag, SmallVector<T, N>&& value, VR vr = VR::Unknown)
+		{
+			if (vr == VR::Unknown)
+				vr = findVR(tag);
+			set(tag, Element(std::move(value), vr));
+		}
+
 		//! Remove an element from the data set (does nothing if not present)
 		void remove(const Tag& tag);
 
@@ -90,9 +123,17 @@ namespace emdl
 		//! Return a view into the raw content of the data set
 		BinaryView view() const;
 
+		//! Arena used by the data set and the items of its sequences read from the buffer, if any
+		const MemoryArenaSPtr& memoryArena() const;
+
 		//! Test whether the data set is empty
 		bool empty() const;
 
+		//! Parse all the elements, and recursively the items of the sequences, as if each one was accessed.
+		//! The items of each level of the sequence tree are parsed in parallel, and encoded values are decoded.
+		//! Afterwards the const functions do not modify the data set anymore, until an element is added.
+		void materialize(ThreadPool& pool = ThreadPool::global()) const;
+
 		//! Used mainly to reduce the size of the view after parsing
 		void updateViewSize(size_t size);
 
@@ -105,7 +146,7 @@ namespace emdl
 
 			static const uint32_t npos; // Value for bad indices (unsigned -1)
 		};
-		using TagElements = std::vector<TagElementStruct>;
+		using TagElements = std::vector<TagElementStruct, ArenaAllocator<TagElementStruct>>;
 
 		// First level of indirection for faster search
 		struct Group
@@ -113,7 +154,7 @@ namespace emdl
 			uint16_t group = 0; // First half of the dicom tag
 			TagElements elements;
 		};
-		using Groups = std::vector<Group>;
+		using Groups = std::vector<Group, ArenaAllocator<Group>>;
 
 		// This is the class we get when deferencing an iterator
 		class EMDL_API iterator_value
@@ -185,12 +226,28 @@ namespace emdl
 		// Get the raw buffer corresponding to the element at this tag
 		boost::optional<BinaryView> getView(const Tag& tag) const;
 
+		// Get the raw buffer of the element at this tag, only if its value has not been modified or replaced since it was read
+		boost::optional<BinaryView> getUnmodifiedView(const Tag& tag) const;
+
 	private:
 		friend class iterator_value;
 		friend class const_iterator;
+		friend class DataSetBuilder;
 
-		using PreparedElement = std::pair<bool, Element>; // The bool tells if the element has been modified from the value in the buffer
-		using PreparedElements = std::deque<PreparedElement>; // Using a deque, so that pointers are never invalidated
+		// The element is shared by the copies of the data set, and copied before being modified (see getElement).
+		struct PreparedElement
+		{
+			PreparedElement(bool modified, std::shared_ptr<Element> element)
+				: modified(modified)
+				, element(std::move(element))
+			{
+			}
+
+			bool modified; // The element has been modified from the value in the buffer
+			bool escaped = false; // A mutable reference to the element was returned, so it is not shared with the copies of the data set
+			std::shared_ptr<Element> element;
+		};
+		using PreparedElements = std::vector<PreparedElement, ArenaAllocator<PreparedElement>>; // Elements are allocated separately, so references to them are never invalidated
 
 		const TagElementStruct* find(const Tag& tag) const; // Return null if is not present
 		TagElementStruct& edit(const Tag& tag); // Create the element if is not present
@@ -198,9 +255,20 @@ namespace emdl
 		boost::optional<Element&> write(const Tag& tag); // Does not create the element, just gives a write access to it if present
 		boost::optional<const Element&> read(const Tag& tag) const; // Gives a read only access to the element if present
 
+		void index() const; // Index the elements of the view, if it was deferred
+		void prepareElements(std::vector<const DataSet*>& items) const; // Parse all the elements, and add the items of their sequences to the list
 		const Element& getElement(const TagElementStruct& tes, bool modified) const; // Get the element (parse it from the buffer if necessary), and set the modified flag
 		PreparedElement& getPreparedElement(const TagElementStruct& tes) const; // Access to the prepared element (does not parse the view if we create the prepared element)
 
+		template <class... Args>
+		std::shared_ptr<Element> makeElement(Args&&... args) const // Allocate an element in the arena if there is one
+		{
+			return std::allocate_shared<Element>(ArenaAllocator<Element>(m_arena.get()), std::forward<Args>(args)...);
+		}
+
+		//! Memory of the containers below (declared first, so that it is released after them)
+		MemoryArenaSPtr m_arena;
+
 		//! Raw content of the data set
 		BinaryBufferSPtr m_buffer;
 
@@ -210,8 +278,11 @@ namespace emdl
 		//! Current transfer syntax.
 		TransferSyntax m_transferSyntax;
 
-		//! Top level of the data set
-		Groups m_groups;
+		//! Top level of the data set (mutable as it is filled on first access when deferred)
+		mutable Groups m_groups;
+
+		//! The elements of the view have not been indexed yet
+		mutable bool m_deferred = false;
 
 		//! Parsed or modified elements
 		mutable PreparedElements m_preparedElements;
@@ -220,4 +291,12 @@ namespace emdl
 		mutable bool m_modified = false;
 	};
 
+	//! Data set that cannot be modified anymore, and can be read from several threads at once
+	using FrozenDataSetSPtr = std::shared_ptr<const DataSet>;
+
+	//! Fully parse the data set and make it immutable: reading it does not modify it, so it can be shared by threads without copies or locks.
+	//! This relies on the materialization done here: before it, even the const accessors modify a data set, as they index its items,
+	//! parse its elements and decode their values in place (Value::decode). A data set that is not frozen or materialized is not thread safe.
+	EMDL_API FrozenDataSetSPtr freeze(DataSet dataSet, ThreadPool& pool = ThreadPool::global());
+
 } // namespace emdl
@@ -0,0 +1,111 @@
+#include <emdl/dataset/DataSetBuilder.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace emdl
+{
+	DataSetBuilder::DataSetBuilder(TransferSyntax transferSyntax, const MemoryArenaSPtr& arena)
+		: m_dataSet(transferSyntax, arena)
+	{
+	}
+
+	DataSetBuilder::DataSetBuilder(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena)
+		: m_dataSet(buffer, view, transferSyntax, arena)
+	{
+	}
+
+	void DataSetBuilder::reserve(size_t count)
+	{
+		m_sorted.reserve(count);
+	}
+
+	void DataSetBuilder::add(const Tag& tag, BinaryView view)
+	{
+		TagElementStruct tes;
+		tes.tag = tag;
+		tes.pos = view.data() - m_dataSet.m_view.data();
+		tes.size = view.size();
+		add(tes);
+	}
+
+	void DataSetBuilder::add(const Tag& tag, const Element& element)
+	{
+		add(tag, Element(element));
+	}
+
+	void DataSetBuilder::add(const Tag& tag, Element&& element)
+	{
+		TagElementStruct tes;
+		tes.tag = tag;
+		tes.preparedIndex = static_cast<uint32_t>(m_dataSet.m_preparedElements.size());
+		m_dataSet.m_preparedElements.emplace_back(true, m_dataSet.makeElement(std::move(element)));
+		add(tes);
+	}
+
+	void DataSetBuilder::add(const TagElementStruct& tes)
+	{
+		if (m_sorted.empty() || m_sorted.back().tag < tes.tag)
+			m_sorted.push_back(tes);
+		else
+			m_unsorted.push_back(tes);
+	}
+
+	size_t DataSetBuilder::size() const
+	{
+		return m_sorted.size() + m_unsorted.size();
+	}
+
+	DataSet DataSetBuilder::build()
+	{
+		const auto byTag = [](const TagElementStruct& lhs, const TagElementStruct& rhs) {
+			return lhs.tag < rhs.tag;
+		};
+
+		// A tag added out of order was always added after the same tag in the sorted list, so the merge keeps the order in which they were added
+		if (!m_unsorted.empty())
+		{
+			std::stable_sort(m_unsorted.begin(), m_unsorted.end(), byTag);
+			std::vector<TagElementStruct> merged;
+			merged.reserve(m_sorted.size() + m_unsorted.size());
+			std::merge(m_sorted.begin(), m_sorted.end(), m_unsorted.begin(), m_unsorted.end(), std::back_inserter(merged), byTag);
+			m_sorted = std::move(merged);
+			m_unsorted.clear();
+		}
+
+		// Create each group with its final size, keeping the last element of each tag
+		auto& groups = m_dataSet.m_groups;
+		size_t nbGroups = 0;
+		for (size_t i = 0; i < m_sorted.size(); ++i)
+		{
+			if (!i || m_sorted[i].tag.group != m_sorted[i - 1].tag.group)
+				++nbGroups;
+		}
+		groups.reserve(nbGroups);
+
+		const auto arena = m_dataSet.m_arena.get();
+		for (auto it = m_sorted.begin(); it != m_sorted.end();)
+		{
+			const auto end = std::find_if(it, m_sorted.end(), [it](const TagElementStruct& tes) {
+				return tes.tag.group != it->tag.group;
+			});
+
+			DataSet::Group group;
+			group.group = it->tag.group;
+			group.elements = DataSet::TagElements(arena);
+			group.elements.reserve(end - it);
+			for (; it != end; ++it)
+			{
+				if (std::next(it) != end && std::next(it)->tag == it->tag)
+					continue;
+				group.elements.push_back(*it);
+			}
+			groups.push_back(std::move(group));
+		}
+
+		m_dataSet.m_modified = !groups.empty();
+		m_sorted.clear();
+		return std::move(m_dataSet);
+	}
+
+} // namespace emdl
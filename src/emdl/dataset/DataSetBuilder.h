@@ -0,0 +1,57 @@
+#pragma once
+
+#include <emdl/dataset/DataSet.h>
+
+#include <vector>
+
+namespace emdl
+{
+	//! Build a data set from many elements at once.
+	//! The elements added in increasing tag order are appended to the index, the others are merged in a single pass by build().
+	//! If a tag is added several times, the last element wins (as with DataSet::set).
+	class EMDL_API DataSetBuilder
+	{
+	public:
+		explicit DataSetBuilder(TransferSyntax transferSyntax = TransferSyntax::ExplicitVRLittleEndian, const MemoryArenaSPtr& arena = {});
+
+		//! The elements added with a view must be inside this view of the buffer
+		DataSetBuilder(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena = {});
+
+		//! Reserve space for the expected number of elements
+		void reserve(size_t count);
+
+		//! Add an element using a pointer in the raw buffer
+		void add(const Tag& tag, BinaryView view);
+
+		//! Add an element
+		void add(const Tag& tag, const Element& element);
+
+		//! Add an element
+		void add(const Tag& tag, Element&& element);
+
+		//! Add an element using a value
+		template <class T>
+		void add(const Tag& tag, std::initializer_list<T> value, VR vr = VR::Unknown)
+		{
+			if (vr == VR::Unknown)
+				vr = findVR(tag);
+			add(tag, Element(value, vr));
+		}
+
+		//! Number of elements added (including the repeated tags)
+		size_t size() const;
+
+		//! Return the data set, after merging the elements added out of order. Can only be called once.
+		DataSet build();
+
+	private:
+		using TagElementStruct = DataSet::TagElementStruct;
+
+		void add(const TagElementStruct& tes);
+
+		DataSet m_dataSet;
+		std::vector<TagElementStruct> m_sorted; // In increasing tag order
+		std::vector<TagElementStruct> m_unsorted; // Added out of order, merged by build
+	};
+
+} // namespace emdl
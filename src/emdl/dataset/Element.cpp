@@ -1,5 +1,6 @@
 #include <emdl/dataset/Element.h>
 #include <emdl/dataset/DataSet.h>
+#include <emdl/dataset/DataSetBuilder.h>
 
 namespace
 {
@@ -55,12 +56,12 @@ namespace emdl
 
 	bool Element::empty() const
 	{
-		return applyVisitor(EmptyVisitor{});
+		return m_value.applyVisitor(EmptyVisitor{});
 	}
 
 	std::size_t Element::size() const
 	{
-		return applyVisitor(SizeVisitor{});
+		return m_value.applyVisitor(SizeVisitor{});
 	}
 
 	Value& Element::value()
@@ -147,4 +148,37 @@ namespace emdl
 	{
 		return m_value.asBinaries();
 	}
+
+	Element detach(const Element& element)
+	{
+		if (element.isDataSet())
+		{
+			Value::DataSets items;
+			for (const auto& item : element.asDataSet())
+			{
+				DataSetBuilder copy(item.transferSyntax());
+				for (const auto& it : item)
+					copy.add(it.tag(), detach(it.element()));
+				items.push_back(copy.build());
+			}
+			return Element(std::move(items), element.vr);
+		}
+
+		if (element.isBinary())
+		{
+			Value::Binaries binaries;
+			for (const auto& binary : element.asBinary())
+			{
+				const auto view = binary.view();
+				const auto data = static_cast<const uint8_t*>(view.data());
+				binaries.emplace_back(BinaryValue::vector_type(data, data + view.size()));
+			}
+			return Element(std::move(binaries), element.vr);
+		}
+
+		// Encoded numbers and strings are slices of the buffer
+		Element copy = element;
+		copy.value().decode();
+		return copy;
+	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <emdl/dataset/Value.h>
+#include <emdl/Exception.h>
 #include <emdl/VR.h>
 #include <emdl/Tag.h>
 
@@ -64,6 +65,22 @@ namespace emdl
 		{
 		}
 
+		//! Create an element with a rvalue list of numbers or strings
+		template <class T, std::size_t N>
+		Element(SmallVector<T, N>&& value, const VR& vr = VR::Invalid)
+			: vr(vr)
+			, m_value(std::move(value))
+		{
+		}
+
+		//! Create an element with a list of numbers or strings
+		template <class T, std::size_t N>
+		Element(const SmallVector<T, N>& value, const VR& vr = VR::Invalid)
+			: vr(vr)
+			, m_value(value)
+		{
+		}
+
 		//! Create an element with an initializer list of values
 		template <class T, std::enable_if_t<!std::is_same<T, VR>::value && !is_vector<T>::value, bool> = true>
 		Element(std::initializer_list<T> value, const VR& vr = VR::Invalid)
@@ -72,6 +89,20 @@ namespace emdl
 		{
 		}
 
+		//! Create an element of binary numbers kept in their encoded width
+		Element(EncodedNumbers numbers)
+			: vr(numbers.vr)
+			, m_value(std::move(numbers))
+		{
+		}
+
+		//! Create an element of strings kept as encoded in a buffer
+		Element(EncodedStrings strings)
+			: vr(strings.vr)
+			, m_value(std::move(strings))
+		{
+		}
+
 		// Assignement operators (as we declared custom constructors)
 		Element& operator=(const Element&) = default;
 		Element& operator=(Element&&) = default;
@@ -109,20 +140,61 @@ namespace emdl
 		Value::Binaries& asBinary();
 		const Value::Binaries& asBinary() const;
 
-		// Apply a visitor of elements
+		// Apply a visitor of elements. Encoded values are decoded first, so the visitor only sees the lists of Value::Types.
 		template <class Visitor>
 		typename Visitor::result_type applyVisitor(const Visitor& visitor) const
 		{
-			return boost::apply_visitor(visitor, m_value.value());
+			m_value.decode();
+			return boost::apply_visitor(DecodedVisitor<const Visitor>{visitor}, m_value.value());
 		}
 
 		template <class Visitor>
 		typename Visitor::result_type applyModifyingVisitor(Visitor& visitor)
 		{
-			return boost::apply_visitor(visitor, m_value.value());
+			m_value.decode();
+			return boost::apply_visitor(DecodedVisitor<Visitor>{visitor}, m_value.value());
 		}
 
 	private:
+		// Forward the decoded alternatives of the variant to the visitor, the encoded ones cannot be reached after Value::decode
+		template <class Visitor>
+		struct DecodedVisitor
+		{
+			using result_type = typename Visitor::result_type;
+
+			template <class T>
+			result_type operator()(T& value) const
+			{
+				return visitor(value);
+			}
+
+			result_type operator()(const EncodedNumbers&) const
+			{
+				throw Exception("{} Encoded numbers were not decoded before visiting", LOG_POSITION);
+			}
+
+			result_type operator()(EncodedNumbers& value) const
+			{
+				return (*this)(static_cast<const EncodedNumbers&>(value));
+			}
+
+			result_type operator()(const EncodedStrings&) const
+			{
+				throw Exception("{} Encoded strings were not decoded before visiting", LOG_POSITION);
+			}
+
+			result_type operator()(EncodedStrings& value) const
+			{
+				return (*this)(static_cast<const EncodedStrings&>(value));
+			}
+
+			Visitor& visitor;
+		};
+
 		Value m_value;
 	};
+
+	//! Copy an element so that it does not reference the buffer of its data set anymore: encoded values are decoded, binaries are copied.
+	//! The items of the copied sequences only hold prepared elements, so the copy is safe to read from several threads and the data set can be released.
+	EMDL_API Element detach(const Element& element);
 }
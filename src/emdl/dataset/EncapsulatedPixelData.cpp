@@ -0,0 +1,197 @@
+#include <emdl/dataset/EncapsulatedPixelData.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <cstring>
+#include <limits>
+
+namespace
+{
+	// Raw little endian copy of a list of integers
+	template <class T>
+	emdl::BinaryValue::vector_type toBytes(const std::vector<T>& values)
+	{
+		emdl::BinaryValue::vector_type bytes(values.size() * sizeof(T));
+		if (!values.empty())
+			std::memcpy(bytes.data(), values.data(), bytes.size());
+		return bytes;
+	}
+}
+
+namespace emdl
+{
+	uint64_t encapsulatedItemSize(const BinaryValue& fragment)
+	{
+		const uint64_t size = fragment.size();
+		return 8 + size + (size % 2); // Tag, length, value and padding
+	}
+
+	std::vector<uint64_t> computeFrameOffsets(const Frames& frames)
+	{
+		std::vector<uint64_t> offsets;
+		offsets.reserve(frames.size());
+
+		uint64_t offset = 0;
+		for (const auto& frame : frames)
+		{
+			offsets.push_back(offset);
+			for (const auto& fragment : frame)
+				offset += encapsulatedItemSize(fragment);
+		}
+
+		return offsets;
+	}
+
+	Value::Binaries encapsulateFrames(const Frames& frames, OffsetTableType type)
+	{
+		if (frames.empty())
+			throw Exception("{} Cannot encapsulate an empty list of frames", LOG_POSITION);
+
+		size_t nbFragments = 0;
+		for (const auto& frame : frames)
+		{
+			if (frame.empty())
+				throw Exception("{} Cannot encapsulate a frame without any fragment", LOG_POSITION);
+			nbFragments += frame.size();
+		}
+
+		Value::Binaries result;
+		result.reserve(nbFragments + 1);
+
+		// The first item is always the Basic Offset Table, even when empty
+		if (type == OffsetTableType::Basic || type == OffsetTableType::Automatic)
+		{
+			const auto offsets = computeFrameOffsets(frames);
+			std::vector<uint32_t> table;
+			table.reserve(offsets.size());
+			for (const auto offset : offsets)
+			{
+				if (offset > std::numeric_limits<uint32_t>::max())
+				{
+					if (type == OffsetTableType::Automatic)
+					{
+						table.clear();
+						break;
+					}
+					throw Exception("{} Frame offset {} does not fit in a Basic Offset Table", LOG_POSITION, offset);
+				}
+				table.push_back(static_cast<uint32_t>(offset));
+			}
+			result.emplace_back(toBytes(table));
+		}
+		else
+			result.emplace_back(BinaryValue::vector_type{});
+
+		for (const auto& frame : frames)
+			result.insert(result.end(), frame.begin(), frame.end());
+
+		return result;
+	}
+
+	Frames getEncapsulatedFrames(const DataSet& dataSet)
+	{
+		const auto pixelDataElt = dataSet[registry::PixelData];
+		if (!pixelDataElt || !pixelDataElt->isBinary())
+			throw Exception("{} Missing PixelData", LOG_POSITION);
+
+		// The first item is the Basic Offset Table
+		const auto& items = pixelDataElt->asBinary();
+		if (items.size() < 2)
+			throw Exception("{} PixelData is not encapsulated", LOG_POSITION);
+		const auto nbFragments = items.size() - 1;
+
+		const auto nbFramesElt = dataSet[registry::NumberOfFrames];
+		const size_t nbFrames = (nbFramesElt && !nbFramesElt->empty()) ? static_cast<size_t>(nbFramesElt->asInt()[0]) : 1;
+		if (!nbFrames)
+			throw Exception("{} Invalid NumberOfFrames", LOG_POSITION);
+
+		std::vector<uint64_t> offsets;
+		const auto extendedTable = dataSet[registry::ExtendedOffsetTable];
+		if (extendedTable && !extendedTable->empty())
+		{
+			const auto& table = extendedTable->asBinary().front();
+			offsets.resize(table.size() / sizeof(uint64_t));
+			if (!offsets.empty())
+				std::memcpy(offsets.data(), table.data(), offsets.size() * sizeof(uint64_t));
+		}
+		else if (!items.front().empty())
+		{
+			const auto& table = items.front();
+			std::vector<uint32_t> basicOffsets(table.size() / sizeof(uint32_t));
+			if (!basicOffsets.empty())
+				std::memcpy(basicOffsets.data(), table.data(), basicOffsets.size() * sizeof(uint32_t));
+			offsets.assign(basicOffsets.begin(), basicOffsets.end());
+		}
+
+		Frames frames;
+		if (offsets.empty())
+		{
+			if (nbFrames == 1)
+				frames.emplace_back(items.begin() + 1, items.end());
+			else if (nbFragments == nbFrames)
+			{
+				frames.reserve(nbFrames);
+				for (size_t i = 1; i < items.size(); ++i)
+					frames.push_back({items[i]});
+			}
+			else
+				throw Exception("{} Cannot find the frames of {} fragments without an offset table", LOG_POSITION, nbFragments);
+			return frames;
+		}
+
+		if (offsets.size() != nbFrames)
+			throw Exception("{} Offset table has {} entries, expected {}", LOG_POSITION, offsets.size(), nbFrames);
+		if (offsets.front() != 0)
+			throw Exception("{} Offset table does not start at 0", LOG_POSITION);
+
+		// Walk the fragments, starting a new frame each time the position reaches the next offset
+		frames.resize(nbFrames);
+		uint64_t position = 0;
+		size_t frameIndex = 0;
+		for (size_t i = 1; i < items.size(); ++i)
+		{
+			while (frameIndex + 1 < nbFrames && position >= offsets[frameIndex + 1])
+				++frameIndex;
+			frames[frameIndex].push_back(items[i]);
+			position += encapsulatedItemSize(items[i]); // Fragments set in memory can have an odd length, padded when written
+		}
+
+		return frames;
+	}
+
+	OffsetTableType setEncapsulatedPixelData(DataSet& dataSet, const Frames& frames, OffsetTableType type)
+	{
+		const auto offsets = computeFrameOffsets(frames);
+		if (type == OffsetTableType::Automatic)
+		{
+			const bool fitsBasic = offsets.empty() || offsets.back() <= std::numeric_limits<uint32_t>::max();
+			type = fitsBasic ? OffsetTableType::Basic : OffsetTableType::Extended;
+		}
+
+		if (type == OffsetTableType::Extended)
+		{
+			// PS3.5 A.4: when an Extended Offset Table is used, each frame is contained in exactly one fragment
+			std::vector<uint64_t> lengths;
+			lengths.reserve(frames.size());
+			for (const auto& frame : frames)
+			{
+				if (frame.size() != 1)
+					throw Exception("{} The Extended Offset Table requires exactly one fragment per frame", LOG_POSITION);
+				lengths.push_back(frame.front().size());
+			}
+
+			dataSet.set(registry::PixelData, Element(encapsulateFrames(frames, OffsetTableType::None), VR::OB));
+			dataSet.set(registry::ExtendedOffsetTable, Element(Value::Binaries{BinaryValue(toBytes(offsets))}, VR::OV));
+			dataSet.set(registry::ExtendedOffsetTableLengths, Element(Value::Binaries{BinaryValue(toBytes(lengths))}, VR::OV));
+		}
+		else
+		{
+			dataSet.set(registry::PixelData, Element(encapsulateFrames(frames, type), VR::OB));
+			dataSet.remove(registry::ExtendedOffsetTable);
+			dataSet.remove(registry::ExtendedOffsetTableLengths);
+		}
+
+		return type;
+	}
+
+} // namespace emdl
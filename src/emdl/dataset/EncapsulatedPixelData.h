@@ -0,0 +1,42 @@
+#pragma once
+
+#include <emdl/dataset/DataSet.h>
+
+#include <vector>
+
+namespace emdl
+{
+	//! Which offset table to generate when encapsulating frames
+	enum class OffsetTableType
+	{
+		None, // Empty Basic Offset Table
+		Basic, // Basic Offset Table in the first item, throws if an offset does not fit in 32 bits
+		Extended, // Empty Basic Offset Table, with the Extended Offset Table and Lengths elements
+		Automatic // Basic if the offsets fit in 32 bits, Extended otherwise
+	};
+
+	//! Fragments composing one compressed frame
+	using Fragments = Value::Binaries;
+
+	//! Compressed frames, each one being a list of fragments
+	using Frames = std::vector<Fragments>;
+
+	//! Size in bytes of a fragment item once written (header and padding included)
+	EMDL_API uint64_t encapsulatedItemSize(const BinaryValue& fragment);
+
+	//! Offset of the first fragment item of each frame, relative to the first fragment item following the Basic Offset Table
+	EMDL_API std::vector<uint64_t> computeFrameOffsets(const Frames& frames);
+
+	//! Build the content of a PixelData element from a list of frames, with a Basic Offset Table if asked.
+	//! With Automatic, the table is left empty when the offsets do not fit in 32 bits.
+	EMDL_API Value::Binaries encapsulateFrames(const Frames& frames, OffsetTableType type = OffsetTableType::Basic);
+
+	//! Group the fragments of the encapsulated PixelData of the data set by frame.
+	//! Uses the Extended Offset Table or the Basic Offset Table when present, else expects one fragment per frame.
+	EMDL_API Frames getEncapsulatedFrames(const DataSet& dataSet);
+
+	//! Set the encapsulated PixelData of the data set, along with the Extended Offset Table and Lengths if needed.
+	//! Returns the type of the offset table that was effectively generated (never Automatic).
+	EMDL_API OffsetTableType setEncapsulatedPixelData(DataSet& dataSet, const Frames& frames, OffsetTableType type = OffsetTableType::Automatic);
+
+} // namespace emdl
@@ -0,0 +1,123 @@
+#include <emdl/dataset/FunctionalGroups.h>
+#include <emdl/dataset/DataSetAccessors.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+	using namespace emdl;
+
+	const double missing = std::numeric_limits<double>::quiet_NaN();
+
+	// Data set containing the attribute in a functional groups item: the item of its functional group sequence, or the functional groups item itself
+	const DataSet* findContainer(const DataSet& item, const FrameAttribute& attribute)
+	{
+		if (attribute.sequence == Tag())
+			return item.has(attribute.tag) ? &item : nullptr;
+
+		const auto sequence = firstDataSet(item, attribute.sequence);
+		return sequence ? &*sequence : nullptr;
+	}
+
+	// Copy the values of the attribute to the row. Returns false if the attribute is missing or not numeric.
+	bool fillRow(const DataSet& container, const FrameAttribute& attribute, double* row)
+	{
+		const auto width = attribute.width;
+		std::fill_n(row, width, missing);
+		const auto element = container[attribute.tag];
+		if (!element)
+			return false;
+
+		if (element->isReal())
+		{
+			const auto& reals = element->asReal();
+			std::copy_n(reals.begin(), std::min(width, reals.size()), row);
+			return true;
+		}
+		if (element->isInt())
+		{
+			const auto& integers = element->asInt();
+			std::transform(integers.begin(), integers.begin() + std::min(width, integers.size()), row, [](Value::Integer value) {
+				return static_cast<double>(value);
+			});
+			return true;
+		}
+		return false;
+	}
+}
+
+namespace emdl
+{
+	ArrayView<const double> FrameColumn::frame(size_t index) const
+	{
+		const auto width = attribute.width;
+		if ((index + 1) * width > values.size())
+			throw Exception("{} No frame {} in the column", LOG_POSITION, index);
+		return {values.data() + index * width, width};
+	}
+
+	FrameColumns extractFrameColumns(const DataSet& dataSet, const std::vector<FrameAttribute>& attributes, ThreadPool& pool)
+	{
+		static const Value::DataSets noItems;
+		const auto perFrame = dataSet[registry::PerFrameFunctionalGroupsSequence];
+		const auto& items = perFrame && perFrame->isDataSet() ? perFrame->asDataSet() : noItems;
+
+		FrameColumns result;
+		if (!items.empty())
+			result.numberOfFrames = items.size();
+		else
+		{
+			const auto numberOfFrames = firstInt(dataSet, registry::NumberOfFrames);
+			result.numberOfFrames = numberOfFrames && *numberOfFrames > 0 ? static_cast<size_t>(*numberOfFrames) : 1;
+		}
+
+		// Values of the shared functional groups, used for the frames that do not have the attribute
+		const auto shared = firstDataSet(dataSet, registry::SharedFunctionalGroupsSequence);
+		std::vector<std::vector<double>> sharedRows;
+		std::vector<uint8_t> sharedPresent;
+		for (const auto& attribute : attributes)
+		{
+			std::vector<double> row(attribute.width, missing);
+			const auto container = shared ? findContainer(*shared, attribute) : nullptr;
+			sharedPresent.push_back(container && fillRow(*container, attribute, row.data()));
+			sharedRows.push_back(std::move(row));
+
+			FrameColumn column;
+			column.attribute = attribute;
+			column.values.resize(result.numberOfFrames * attribute.width);
+			column.present.resize(result.numberOfFrames);
+			result.columns.push_back(std::move(column));
+		}
+
+		// Each task fills a range of frames of all the columns, reading only its own items.
+		// A functional group sequence of the frame replaces the shared one, even if it does not contain the attribute.
+		const size_t nbRanges = std::min<size_t>(result.numberOfFrames, pool.size() * 4);
+		pool.parallelFor(nbRanges, [&](size_t range) {
+			const auto begin = range * result.numberOfFrames / nbRanges;
+			const auto end = (range + 1) * result.numberOfFrames / nbRanges;
+			for (size_t i = 0; i < attributes.size(); ++i)
+			{
+				const auto& attribute = attributes[i];
+				auto& column = result.columns[i];
+				for (size_t frame = begin; frame < end; ++frame)
+				{
+					const auto row = column.values.data() + frame * attribute.width;
+					const auto container = items.empty() ? nullptr : findContainer(items[frame], attribute);
+					if (container)
+						column.present[frame] = fillRow(*container, attribute, row);
+					else
+					{
+						std::copy(sharedRows[i].begin(), sharedRows[i].end(), row);
+						column.present[frame] = sharedPresent[i];
+					}
+				}
+			}
+		});
+
+		return result;
+	}
+
+} // namespace emdl
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <emdl/dataset/DataSet.h>
+#include <emdl/ArrayView.h>
+#include <emdl/ThreadPool.h>
+
+#include <vector>
+
+namespace emdl
+{
+	//! Numeric attribute of the functional groups, found in the first item of a functional group sequence:
+	//! {PlanePositionSequence, ImagePositionPatient, 3}. If sequence is Tag(), the attribute is directly in the functional groups item.
+	struct FrameAttribute
+	{
+		Tag sequence;
+		Tag tag;
+		size_t width = 1; //!< Number of values kept for each frame
+	};
+
+	//! Values of one attribute for all the frames, contiguous: the values of frame i are at [i * width, (i + 1) * width).
+	//! Integers are converted to doubles. Missing values are NaN.
+	struct EMDL_API FrameColumn
+	{
+		FrameAttribute attribute;
+		std::vector<double> values;
+		std::vector<uint8_t> present; //!< For each frame, 1 if the attribute is in its functional groups or in the shared ones
+
+		ArrayView<const double> frame(size_t index) const;
+	};
+
+	struct EMDL_API FrameColumns
+	{
+		size_t numberOfFrames = 0;
+		std::vector<FrameColumn> columns; //!< In the order of the attributes
+	};
+
+	//! Extract the attributes of each frame of an enhanced multi-frame data set, from the PerFrameFunctionalGroupsSequence,
+	//! or from the SharedFunctionalGroupsSequence if the frame does not have the functional group sequence. Ranges of items are processed in parallel.
+	//! Without PerFrameFunctionalGroupsSequence, there are NumberOfFrames frames using the shared values.
+	EMDL_API FrameColumns extractFrameColumns(const DataSet& dataSet, const std::vector<FrameAttribute>& attributes, ThreadPool& pool = ThreadPool::global());
+
+} // namespace emdl
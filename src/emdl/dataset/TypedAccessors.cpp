@@ -0,0 +1,261 @@
+#include <emdl/dataset/TypedAccessors.h>
+#include <emdl/dataset/reader/BaseReader.h>
+#include <emdl/Exception.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace emdl
+{
+	namespace details
+	{
+		namespace
+		{
+			template <class T>
+			struct TypeTag
+			{
+			};
+
+			// Value of the element in the buffer, if it was not modified and is encoded with the expected VR.
+			// Otherwise (modified, undefined length, UN or another VR in the file) the values are taken from the parsed element.
+			boost::optional<BinaryView> rawValue(const DataSet& dataSet, Tag tag, VR vr)
+			{
+				const auto view = dataSet.getUnmodifiedView(tag);
+				if (!view)
+					return {};
+
+				BaseReader reader{{}, *view, dataSet.transferSyntax()};
+				ElementHeader header;
+				if (!reader.readElementHeader(header) || header.length == 0xFFFFFFFF)
+					return {};
+				if (header.vr != VR::Unknown && header.vr != vr)
+					return {};
+				if (view->size() < reader.offset() + header.length)
+					return {};
+
+				return reader.getView(header.length);
+			}
+
+			// Copy the text of a number in a null terminated buffer, for strtoll and strtold
+			struct NumberBuffer
+			{
+				explicit NumberBuffer(boost::string_view str)
+				{
+					if (str.size() >= sizeof(text)) // IS and DS values have at most 12 and 16 characters
+						throw Exception("{} Number '{}' is too long", LOG_POSITION, str.to_string());
+					std::memcpy(text, str.data(), str.size());
+					text[str.size()] = 0;
+				}
+
+				// Test whether the number was parsed up to the end, ignoring the padding spaces
+				bool parsedUntil(const char* end) const
+				{
+					if (end == text)
+						return false;
+					while (*end == ' ')
+						++end;
+					return !*end;
+				}
+
+				char text[64];
+			};
+
+			template <class T>
+			T parseNumber(boost::string_view str, std::true_type /*isIntegral*/)
+			{
+				NumberBuffer buffer(str);
+				char* end = nullptr;
+				errno = 0;
+				const auto value = std::strtoll(buffer.text, &end, 10);
+				if (!buffer.parsedUntil(end))
+					throw Exception("{} Invalid integer '{}'", LOG_POSITION, buffer.text);
+				if (errno == ERANGE || value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max())
+					throw Exception("{} Integer '{}' is out of range", LOG_POSITION, buffer.text);
+				return static_cast<T>(value);
+			}
+
+			template <class T>
+			T parseNumber(boost::string_view str, std::false_type /*isIntegral*/)
+			{
+				NumberBuffer buffer(str);
+				char* end = nullptr;
+				const auto value = std::strtold(buffer.text, &end);
+				if (!buffer.parsedUntil(end))
+					throw Exception("{} Invalid decimal number '{}'", LOG_POSITION, buffer.text);
+				if (!(std::abs(value) <= std::numeric_limits<T>::max())) // Also rejects nan
+					throw Exception("{} Decimal number '{}' is out of range", LOG_POSITION, buffer.text);
+				return static_cast<T>(value);
+			}
+
+			// Numbers, either binary (US, SL, FD...) or as text (IS, DS)
+			template <class T, class C>
+			void decodeRaw(TypeTag<T>, VR vr, BinaryView raw, size_t maxCount, C& values)
+			{
+				if (vr == VR::IS || vr == VR::DS)
+				{
+					const auto strings = EncodedStrings{vr, BinaryValue({raw.data(), raw.size()})}.views();
+					const auto count = std::min(strings.size(), maxCount);
+					for (size_t i = 0; i < count; ++i)
+						values.push_back(parseNumber<T>(strings[i], std::is_integral<T>{}));
+					return;
+				}
+
+				const auto count = std::min(raw.size() / sizeof(T), maxCount);
+				for (size_t i = 0; i < count; ++i)
+				{
+					T value;
+					std::memcpy(&value, raw.data() + i * sizeof(T), sizeof(T));
+					values.push_back(value);
+				}
+			}
+
+			template <class C>
+			void decodeRaw(TypeTag<Tag>, VR, BinaryView raw, size_t maxCount, C& values)
+			{
+				const auto count = std::min(raw.size() / 4, maxCount);
+				for (size_t i = 0; i < count; ++i)
+				{
+					Tag value;
+					std::memcpy(&value.group, raw.data() + i * 4, 2);
+					std::memcpy(&value.element, raw.data() + i * 4 + 2, 2);
+					values.push_back(value);
+				}
+			}
+
+			template <class C>
+			void decodeRaw(TypeTag<std::string>, VR vr, BinaryView raw, size_t maxCount, C& values)
+			{
+				const auto strings = EncodedStrings{vr, BinaryValue({raw.data(), raw.size()})}.views();
+				const auto count = std::min(strings.size(), maxCount);
+				for (size_t i = 0; i < count; ++i)
+					values.push_back(strings[i].to_string());
+			}
+
+			template <class T, class List, class C>
+			void copyList(const List& list, size_t maxCount, C& values)
+			{
+				const auto count = std::min(list.size(), maxCount);
+				for (size_t i = 0; i < count; ++i)
+					values.push_back(static_cast<T>(list[i]));
+			}
+
+			template <class T, class C>
+			void convertElement(TypeTag<T>, Tag tag, const Element& element, size_t maxCount, C& values)
+			{
+				if (element.isInt())
+					copyList<T>(element.asInt(), maxCount, values);
+				else if (element.isReal())
+					copyList<T>(element.asReal(), maxCount, values);
+				else
+					throw Exception("{} Element {} does not contain numbers", LOG_POSITION, asString(tag));
+			}
+
+			template <class C>
+			void convertElement(TypeTag<Tag>, Tag tag, const Element& element, size_t maxCount, C& values)
+			{
+				if (!element.isString())
+					throw Exception("{} Element {} does not contain tags", LOG_POSITION, asString(tag));
+				const auto& strings = element.asString();
+				const auto count = std::min(strings.size(), maxCount);
+				for (size_t i = 0; i < count; ++i)
+					values.push_back(Tag(strings[i]));
+			}
+
+			template <class C>
+			void convertElement(TypeTag<std::string>, Tag tag, const Element& element, size_t maxCount, C& values)
+			{
+				if (!element.isString())
+					throw Exception("{} Element {} does not contain strings", LOG_POSITION, asString(tag));
+				copyList<std::string>(element.asString(), maxCount, values);
+			}
+
+			template <class T, class C>
+			void read(const DataSet& dataSet, Tag tag, VR vr, size_t maxCount, C& values)
+			{
+				if (const auto raw = rawValue(dataSet, tag, vr))
+					decodeRaw(TypeTag<T>{}, vr, *raw, maxCount, values);
+				else if (const auto element = dataSet[tag])
+				{
+					if (!element->empty())
+						convertElement(TypeTag<T>{}, tag, *element, maxCount, values);
+				}
+			}
+
+			template <class T>
+			Element makeElement(const T* values, size_t count, VR vr, std::true_type /*isIntegral*/)
+			{
+				return {Value::Integers(values, values + count), vr};
+			}
+
+			template <class T>
+			Element makeElement(const T* values, size_t count, VR vr, std::false_type /*isIntegral*/)
+			{
+				return {Value::Reals(values, values + count), vr};
+			}
+
+			template <class T>
+			Element makeElement(const T* values, size_t count, VR vr)
+			{
+				return makeElement(values, count, vr, std::is_integral<T>{});
+			}
+
+			Element makeElement(const Tag* values, size_t count, VR vr)
+			{
+				Value::Strings strings;
+				for (size_t i = 0; i < count; ++i)
+					strings.push_back(asString(values[i]));
+				return {std::move(strings), vr};
+			}
+
+			Element makeElement(const std::string* values, size_t count, VR vr)
+			{
+				return {Value::Strings(values, values + count), vr};
+			}
+		} // namespace
+
+		template <class T>
+		boost::optional<T> readFirstValue(const DataSet& dataSet, Tag tag, VR vr)
+		{
+			SmallVector<T, 1> values;
+			read<T>(dataSet, tag, vr, 1, values);
+			if (values.empty())
+				return {};
+			return std::move(values.front());
+		}
+
+		template <class T>
+		std::vector<T> readValues(const DataSet& dataSet, Tag tag, VR vr)
+		{
+			std::vector<T> values;
+			read<T>(dataSet, tag, vr, std::numeric_limits<size_t>::max(), values);
+			return values;
+		}
+
+		template <class T>
+		void writeValues(DataSet& dataSet, Tag tag, VR vr, const T* values, size_t count)
+		{
+			dataSet.set(tag, makeElement(values, count, vr));
+		}
+
+#define EMDL_TYPED_ACCESSORS(T)                                                          \
+	template boost::optional<T> readFirstValue<T>(const DataSet&, Tag, VR);              \
+	template std::vector<T> readValues<T>(const DataSet&, Tag, VR);                      \
+	template void writeValues<T>(DataSet&, Tag, VR, const T*, size_t);
+
+		// The value types of VRValueType
+		EMDL_TYPED_ACCESSORS(uint16_t)
+		EMDL_TYPED_ACCESSORS(int16_t)
+		EMDL_TYPED_ACCESSORS(uint32_t)
+		EMDL_TYPED_ACCESSORS(int32_t)
+		EMDL_TYPED_ACCESSORS(float)
+		EMDL_TYPED_ACCESSORS(double)
+		EMDL_TYPED_ACCESSORS(Tag)
+		EMDL_TYPED_ACCESSORS(std::string)
+
+#undef EMDL_TYPED_ACCESSORS
+	} // namespace details
+} // namespace emdl
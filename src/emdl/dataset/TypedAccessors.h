@@ -0,0 +1,69 @@
+#pragma once
+
+#include <emdl/dataset/DataSet.h>
+#include <emdl/tags.h>
+
+#include <type_traits>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace emdl
+{
+	namespace details
+	{
+		//! Decode the first value of an element, directly from the buffer if it was not modified. Empty if the element is absent or empty.
+		template <class T>
+		EMDL_API boost::optional<T> readFirstValue(const DataSet& dataSet, Tag tag, VR vr);
+
+		//! Decode all the values of an element, directly from the buffer if it was not modified.
+		template <class T>
+		EMDL_API std::vector<T> readValues(const DataSet& dataSet, Tag tag, VR vr);
+
+		//! Add an element created from the values, or replace it
+		template <class T>
+		EMDL_API void writeValues(DataSet& dataSet, Tag tag, VR vr, const T* values, size_t count);
+
+		template <class T>
+		void checkTypedTag()
+		{
+			static_assert(!std::is_void<typename T::type>::value, "No typed accessor for binary and sequence tags, use the functions of DataSetAccessors.h");
+		}
+	} // namespace details
+
+	//! Return the value of a single valued tag of the dictionary, or empty if the element is absent or empty.
+	//! Usage: get<tags::Rows>(dataSet) returns a boost::optional<uint16_t>.
+	template <class T>
+	boost::optional<typename T::type> get(const DataSet& dataSet)
+	{
+		details::checkTypedTag<T>();
+		static_assert(T::maxVM == 1, "This tag can have several values, use getList");
+		return details::readFirstValue<typename T::type>(dataSet, T::tag(), T::vr);
+	}
+
+	//! Return the values of a tag of the dictionary, or an empty list if the element is absent.
+	template <class T>
+	std::vector<typename T::type> getList(const DataSet& dataSet)
+	{
+		details::checkTypedTag<T>();
+		return details::readValues<typename T::type>(dataSet, T::tag(), T::vr);
+	}
+
+	//! Add the element of a tag of the dictionary from one value, or replace it.
+	template <class T>
+	void set(DataSet& dataSet, const typename T::type& value)
+	{
+		details::checkTypedTag<T>();
+		static_assert(T::minVM <= 1, "This tag needs several values, use setList");
+		details::writeValues(dataSet, T::tag(), T::vr, &value, 1);
+	}
+
+	//! Add the element of a tag of the dictionary from a list of values, or replace it.
+	template <class T>
+	void setList(DataSet& dataSet, const std::vector<typename T::type>& values)
+	{
+		details::checkTypedTag<T>();
+		details::writeValues(dataSet, T::tag(), T::vr, values.data(), values.size());
+	}
+
+} // namespace emdl
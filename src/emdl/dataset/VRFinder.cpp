@@ -228,8 +228,8 @@ namespace emdl
 	{
 		if (tag.element == 0) // Group length
 			return emdl::VR::UL;
-		if (tag.group % 2 == 1) // Private tag
-			return emdl::VR::UN;
+		if (tag.group % 2 == 1) // Private tag, the private creators are LO
+			return (tag.element >= 0x10 && tag.element <= 0xFF) ? emdl::VR::LO : emdl::VR::UN;
 
 		return publicDictionary(tag);
 	}
@@ -238,8 +238,8 @@ namespace emdl
 	{
 		if (tag.element == 0) // Group length
 			return emdl::VR::UL;
-		if (tag.group % 2 == 1) // Private tag
-			return emdl::VR::UN;
+		if (tag.group % 2 == 1) // Private tag, the private creators are LO
+			return (tag.element >= 0x10 && tag.element <= 0xFF) ? emdl::VR::LO : emdl::VR::UN;
 
 		TransferSyntax transferSyntax = dataSet.transferSyntax();
 		if (transferSyntax == emdl::TransferSyntax::ImplicitVRLittleEndian)
@@ -1,10 +1,176 @@
 #include <emdl/dataset/Value.h>
 #include <emdl/dataset/DataSet.h>
+#include <emdl/Exception.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	// Copy each number separately, as the data may not be aligned
+	template <class T, class List>
+	List widenNumbers(const emdl::BinaryValue& data)
+	{
+		const auto bytes = static_cast<const unsigned char*>(data.data());
+		List result(data.size() / sizeof(T));
+		for (std::size_t i = 0, nb = result.size(); i < nb; ++i)
+		{
+			T number;
+			std::memcpy(&number, bytes + i * sizeof(T), sizeof(T));
+			result[i] = static_cast<typename List::value_type>(number);
+		}
+		return result;
+	}
+
+	boost::string_view view(const emdl::BinaryValue& data)
+	{
+		return {static_cast<const char*>(data.data()), data.size()};
+	}
+
+	boost::string_view trimPadding(boost::string_view str)
+	{
+		static const boost::string_view padding("\0 ", 2);
+		const auto last = str.find_last_not_of(padding);
+		return last == boost::string_view::npos ? boost::string_view() : str.substr(0, last + 1);
+	}
+
+	// Text VRs have a single value, which can contain backslashes
+	bool isText(emdl::VR vr)
+	{
+		return vr == emdl::VR::LT || vr == emdl::VR::ST || vr == emdl::VR::UT;
+	}
+}
 
 namespace emdl
 {
+	std::size_t EncodedNumbers::width() const
+	{
+		switch (vr)
+		{
+		case VR::AT:
+		case VR::SS:
+		case VR::US:
+			return 2;
+
+		case VR::FL:
+		case VR::SL:
+		case VR::UL:
+			return 4;
+
+		case VR::FD:
+			return 8;
+
+		default:
+			throw Exception("{} {} is not a binary number VR", LOG_POSITION, asString(vr));
+		}
+	}
+
+	std::size_t EncodedNumbers::size() const
+	{
+		return data.size() / width();
+	}
+
+	bool EncodedNumbers::empty() const
+	{
+		return !size();
+	}
+
+	bool EncodedNumbers::isIntegers() const
+	{
+		return vr != VR::FD && vr != VR::FL;
+	}
+
+	Value::Integers EncodedNumbers::toIntegers() const
+	{
+		switch (vr)
+		{
+		case VR::SL:
+			return widenNumbers<std::int32_t, Value::Integers>(data);
+		case VR::SS:
+			return widenNumbers<std::int16_t, Value::Integers>(data);
+		case VR::UL:
+			return widenNumbers<std::uint32_t, Value::Integers>(data);
+		case VR::AT:
+		case VR::US:
+			return widenNumbers<std::uint16_t, Value::Integers>(data);
+		default:
+			throw Exception("{} Cannot read integers from {}", LOG_POSITION, asString(vr));
+		}
+	}
+
+	Value::Reals EncodedNumbers::toReals() const
+	{
+		switch (vr)
+		{
+		case VR::FD:
+			return widenNumbers<double, Value::Reals>(data);
+		case VR::FL:
+			return widenNumbers<float, Value::Reals>(data);
+		default:
+			throw Exception("{} Cannot read reals from {}", LOG_POSITION, asString(vr));
+		}
+	}
+
+	/*****************************************************************************/
+
+	std::size_t EncodedStrings::size() const
+	{
+		const auto str = trimPadding(view(data));
+		if (str.empty())
+			return 0;
+		if (isText(vr))
+			return 1;
+		return 1 + std::count(str.begin(), str.end(), '\\');
+	}
+
+	bool EncodedStrings::empty() const
+	{
+		return trimPadding(view(data)).empty();
+	}
+
+	SmallVector<boost::string_view, 4> EncodedStrings::views() const
+	{
+		SmallVector<boost::string_view, 4> result;
+		auto str = trimPadding(view(data));
+		if (str.empty())
+			return result;
+
+		if (isText(vr))
+		{
+			result.push_back(str);
+			return result;
+		}
+
+		while (true)
+		{
+			const auto end = str.find('\\');
+			result.push_back(trimPadding(str.substr(0, end)));
+			if (end == boost::string_view::npos)
+				break;
+			str.remove_prefix(end + 1);
+		}
+
+		return result;
+	}
+
+	Value::Strings EncodedStrings::toStrings() const
+	{
+		const auto items = views();
+		Value::Strings result;
+		result.reserve(items.size());
+		for (const auto& item : items)
+			result.emplace_back(item.data(), item.size());
+		return result;
+	}
+
+	/*****************************************************************************/
+
 	Value::Type Value::type() const
 	{
+		if (const auto numbers = boost::get<EncodedNumbers>(&m_value))
+			return numbers->isIntegers() ? Type::Integers : Type::Reals;
+		if (boost::get<EncodedStrings>(&m_value))
+			return Type::Strings;
 		return static_cast<Type>(m_value.which());
 	}
 
@@ -15,31 +181,37 @@ namespace emdl
 
 	Value::Integers& Value::asIntegers()
 	{
+		decode();
 		return boost::get<Integers>(m_value);
 	}
 
 	const Value::Integers& Value::asIntegers() const
 	{
+		decode();
 		return boost::get<Integers>(m_value);
 	}
 
 	Value::Reals& Value::asReals()
 	{
+		decode();
 		return boost::get<Reals>(m_value);
 	}
 
 	const Value::Reals& Value::asReals() const
 	{
+		decode();
 		return boost::get<Reals>(m_value);
 	}
 
 	Value::Strings& Value::asStrings()
 	{
+		decode();
 		return boost::get<Strings>(m_value);
 	}
 
 	const Value::Strings& Value::asStrings() const
 	{
+		decode();
 		return boost::get<Strings>(m_value);
 	}
 
@@ -63,6 +235,38 @@ namespace emdl
 		return boost::get<Binaries>(m_value);
 	}
 
+	boost::optional<EncodedNumbers> Value::encodedNumbers() const
+	{
+		if (const auto numbers = boost::get<EncodedNumbers>(&m_value))
+			return *numbers;
+		return {};
+	}
+
+	boost::optional<EncodedStrings> Value::encodedStrings() const
+	{
+		if (const auto strings = boost::get<EncodedStrings>(&m_value))
+			return *strings;
+		return {};
+	}
+
+	bool Value::isEncoded() const
+	{
+		return boost::get<EncodedNumbers>(&m_value) || boost::get<EncodedStrings>(&m_value);
+	}
+
+	void Value::decode() const
+	{
+		if (const auto numbers = boost::get<EncodedNumbers>(&m_value))
+		{
+			if (numbers->isIntegers())
+				m_value = numbers->toIntegers();
+			else
+				m_value = numbers->toReals();
+		}
+		else if (const auto strings = boost::get<EncodedStrings>(&m_value))
+			m_value = strings->toStrings();
+	}
+
 	Value::ValueVariant& Value::value()
 	{
 		return m_value;
@@ -4,7 +4,19 @@
 
 // DataSet.h is not included, to break the circular inclusion. It then needs to be included each time this file is included.
 #include <emdl/BinaryValue.h>
-
+#include <emdl/VR.h>
+
+// GCC 11 and later report a false -Wstringop-overread when a small vector storing its items inline is moved
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overread"
+#include <boost/container/small_vector.hpp>
+#pragma GCC diagnostic pop
+#else
+#include <boost/container/small_vector.hpp>
+#endif
+#include <boost/optional.hpp>
+#include <boost/utility/string_view.hpp>
 #include <boost/variant.hpp>
 
 namespace emdl
@@ -32,19 +44,20 @@ namespace
 		static constexpr bool value = is_one_of<F, T...>::value;
 	};
 
-	template <class T>
-	std::vector<int64_t> toInt64Vector(const std::vector<T>& vec)
+	template <class Result, class Container>
+	Result toInt64Vector(const Container& vec)
 	{
-		std::vector<int64_t> res;
+		Result res;
 		res.reserve(vec.size());
 		for (const auto v : vec)
 			res.push_back(v);
 		return res;
 	}
 
-	std::vector<std::string> toStringVector(const std::vector<const char*>& vec)
+	template <class Result, class Container>
+	Result toStringVector(const Container& vec)
 	{
-		std::vector<std::string> res;
+		Result res;
 		res.reserve(vec.size());
 		for (const auto v : vec)
 			res.push_back(v);
@@ -56,6 +69,82 @@ namespace emdl
 {
 	class DataSet;
 
+	//! Vector storing its first N items inline, without allocation
+	template <class T, std::size_t N>
+	using SmallVector = boost::container::small_vector<T, N>;
+
+	//! Type of the list storing values of type T in a Value. Most elements have a single value, so numbers and strings are stored inline.
+	template <class T>
+	struct ValueList
+	{
+		using type = std::vector<T>;
+	};
+
+	template <>
+	struct ValueList<std::int64_t>
+	{
+		using type = SmallVector<std::int64_t, 4>;
+	};
+
+	template <>
+	struct ValueList<double>
+	{
+		using type = SmallVector<double, 4>;
+	};
+
+	template <>
+	struct ValueList<std::string>
+	{
+		using type = SmallVector<std::string, 1>;
+	};
+
+	//! Binary numbers (AT, FD, FL, SL, SS, UL, US) kept in their encoded width, as read from a little endian buffer
+	struct EMDL_API EncodedNumbers
+	{
+		VR vr = VR::Invalid;
+		BinaryValue data; //!< Must be aligned for the type of the numbers to be viewed
+
+		std::size_t width() const; //!< Size in bytes of one number
+		std::size_t size() const; //!< Number of values
+		bool empty() const;
+		bool isIntegers() const; //!< Whether the numbers are widened to integers (or to reals)
+
+		ValueList<std::int64_t>::type toIntegers() const;
+		ValueList<double>::type toReals() const;
+
+		//! View of the numbers in their encoded type (uint16_t for US, float for FL...). Empty if T does not match the VR.
+		template <class T>
+		ArrayView<const T> view() const
+		{
+			if (vr != encodedVR(static_cast<T*>(nullptr)) || data.empty())
+				return {};
+			return {static_cast<const T*>(data.data()), size()};
+		}
+
+	private:
+		static constexpr VR encodedVR(const double*) { return VR::FD; }
+		static constexpr VR encodedVR(const float*) { return VR::FL; }
+		static constexpr VR encodedVR(const std::int32_t*) { return VR::SL; }
+		static constexpr VR encodedVR(const std::int16_t*) { return VR::SS; }
+		static constexpr VR encodedVR(const std::uint32_t*) { return VR::UL; }
+		static constexpr VR encodedVR(const std::uint16_t*) { return VR::US; }
+	};
+
+	//! Strings kept as encoded in a buffer (with their padding and backslash separators), as long as they are not modified
+	struct EMDL_API EncodedStrings
+	{
+		VR vr = VR::Invalid;
+		BinaryValue data;
+
+		std::size_t size() const; //!< Number of values
+		bool empty() const;
+
+		//! The values without their padding, referencing the data
+		SmallVector<boost::string_view, 4> views() const;
+
+		ValueList<std::string>::type toStrings() const;
+	};
+
 	//! The value of a DICOM element
 	class EMDL_API Value
 	{
@@ -77,11 +166,13 @@ namespace emdl
 		using String = std::string;
 
 		// List of values typedefs
-		using Integers = std::vector<Integer>;
-		using Reals = std::vector<Real>;
-		using Strings = std::vector<String>;
-		using DataSets = std::vector<DataSet>;
-		using Binaries = std::vector<BinaryValue>;
+		// Integers, Reals and Strings are small vectors, not std::vector: code expecting a std::vector must copy them,
+		// for example std::vector<Integer>(values.begin(), values.end())
+		using Integers = ValueList<Integer>::type;
+		using Reals = ValueList<Real>::type;
+		using Strings = ValueList<String>::type;
+		using DataSets = ValueList<DataSet>::type;
+		using Binaries = ValueList<BinaryValue>::type;
 
 		// Type of the variant used to store the value
 		using ValueVariant = boost::variant<
@@ -90,7 +181,9 @@ namespace emdl
 			Reals,
 			Strings,
 			DataSets,
-			Binaries>;
+			Binaries,
+			EncodedNumbers,
+			EncodedStrings>;
 
 		using Types = std::tuple<
 			Integer,
@@ -107,23 +200,49 @@ namespace emdl
 		//! Move another value
 		Value(Value&& value) = default;
 
+		//! Build a value from numbers in their encoded width. They are widened on the first call to asIntegers or asReals.
+		explicit Value(EncodedNumbers numbers)
+			: m_value(std::move(numbers))
+		{
+		}
+
+		//! Build a value from strings as encoded in a buffer. They are split on the first call to asStrings.
+		explicit Value(EncodedStrings strings)
+			: m_value(std::move(strings))
+		{
+		}
+
 		//! Build a value from an initializer list composed of one of the supported types
 		template <class T, std::enable_if_t<is_one_of<T, Types>::value, bool> = true>
 		Value(std::initializer_list<T> value)
-			: m_value(value)
+			: m_value(typename ValueList<T>::type(value))
 		{
 		}
 
 		//! Build a value from a vector of one of the supported types
 		template <class T, std::enable_if_t<is_one_of<T, Types>::value, bool> = true>
 		Value(const std::vector<T>& value)
-			: m_value(value)
+			: m_value(typename ValueList<T>::type(value.begin(), value.end()))
 		{
 		}
 
 		//! Build a value from a rvalue vector of one of the supported types
 		template <class T, std::enable_if_t<is_one_of<T, Types>::value, bool> = true>
 		Value(std::vector<T>&& value)
+			: m_value(toList(std::move(value), std::is_same<typename ValueList<T>::type, std::vector<T>>{}))
+		{
+		}
+
+		//! Build a value from a list of numbers or strings
+		template <class T, std::size_t N, std::enable_if_t<is_one_of<T, Types>::value, bool> = true>
+		Value(const SmallVector<T, N>& value)
+			: m_value(value)
+		{
+		}
+
+		//! Build a value from a rvalue list of numbers or strings
+		template <class T, std::size_t N, std::enable_if_t<is_one_of<T, Types>::value, bool> = true>
+		Value(SmallVector<T, N>&& value)
 			: m_value(std::move(value))
 		{
 		}
@@ -133,7 +252,7 @@ namespace emdl
 												&& !std::is_same<T, int64_t>::value,
 											bool> = true>
 		Value(const std::vector<T>& value)
-			: m_value(toInt64Vector(value))
+			: m_value(toInt64Vector<Integers>(value))
 		{
 		}
 
@@ -142,21 +261,21 @@ namespace emdl
 												&& !std::is_same<T, int64_t>::value,
 											bool> = true>
 		Value(std::initializer_list<T> value)
-			: m_value(toInt64Vector<T>(value))
+			: m_value(toInt64Vector<Integers>(value))
 		{
 		}
 
 		//! Build a value from a list of const char*
 		template <class T, std::enable_if_t<std::is_same<T, const char*>::value, bool> = true>
 		Value(const std::vector<T>& value)
-			: m_value(toStringVector(value))
+			: m_value(toStringVector<Strings>(value))
 		{
 		}
 
 		//! Build a value from an initializer list of const char*
 		template <class T, std::enable_if_t<std::is_same<T, const char*>::value, bool> = true>
 		Value(std::initializer_list<T> value)
-			: m_value(toStringVector(value))
+			: m_value(toStringVector<Strings>(value))
 		{
 		}
 
@@ -170,7 +289,7 @@ namespace emdl
 		template <class T, std::enable_if_t<is_one_of<T, Types>::value, Value&> = true>
 		Value& operator=(std::initializer_list<T> value)
 		{
-			m_value = value;
+			m_value = typename ValueList<T>::type(value);
 			return *this;
 		}
 
@@ -178,13 +297,29 @@ namespace emdl
 		template <class T, std::enable_if_t<is_one_of<T, Types>::value, bool> = true>
 		Value& operator=(const std::vector<T>& value)
 		{
-			m_value = value;
+			m_value = typename ValueList<T>::type(value.begin(), value.end());
 			return *this;
 		}
 
 		//! Copy a rvalue vector of one of the supported types
 		template <class T, std::enable_if_t<is_one_of<T, Types>::value, bool> = true>
 		Value& operator=(std::vector<T>&& value)
+		{
+			m_value = toList(std::move(value), std::is_same<typename ValueList<T>::type, std::vector<T>>{});
+			return *this;
+		}
+
+		//! Copy a list of numbers or strings
+		template <class T, std::size_t N, std::enable_if_t<is_one_of<T, Types>::value, bool> = true>
+		Value& operator=(const SmallVector<T, N>& value)
+		{
+			m_value = value;
+			return *this;
+		}
+
+		//! Copy a rvalue list of numbers or strings
+		template <class T, std::size_t N, std::enable_if_t<is_one_of<T, Types>::value, bool> = true>
+		Value& operator=(SmallVector<T, N>&& value)
 		{
 			m_value = std::move(value);
 			return *this;
@@ -196,7 +331,7 @@ namespace emdl
 											bool> = true>
 		Value& operator=(const std::vector<T>& value)
 		{
-			m_value = toInt64Vector(value);
+			m_value = toInt64Vector<Integers>(value);
 			return *this;
 		}
 
@@ -206,7 +341,7 @@ namespace emdl
 											bool> = true>
 		Value& operator=(std::initializer_list<T> value)
 		{
-			m_value = toInt64Vector<T>(value);
+			m_value = toInt64Vector<Integers>(value);
 			return *this;
 		}
 
@@ -214,7 +349,7 @@ namespace emdl
 		template <class T, std::enable_if_t<std::is_same<T, const char*>::value, bool> = true>
 		Value& operator=(const std::vector<T>& value)
 		{
-			m_value = toStringVector(value);
+			m_value = toStringVector<Strings>(value);
 			return *this;
 		}
 
@@ -222,11 +357,11 @@ namespace emdl
 		template <class T, std::enable_if_t<std::is_same<T, const char*>::value, bool> = true>
 		Value& operator=(std::initializer_list<T> value)
 		{
-			m_value = toStringVector(value);
+			m_value = toStringVector<Strings>(value);
 			return *this;
 		}
 
-		Type type() const; //!< Return the type store in the value.
+		Type type() const; //!< Return the type store in the value. Encoded numbers are reported as Integers or Reals, encoded strings as Strings.
 		bool empty() const; //!< Test whether the value is empty.
 
 		// These accessors throw a boost::bad_get exception if the incorrect type is asked
@@ -245,11 +380,26 @@ namespace emdl
 		Binaries& asBinaries();
 		const Binaries& asBinaries() const;
 
+		//! Numbers still in their encoded width, if they have not been widened yet.
+		//! Returned by value, as any accessor can decode the value in place: the copy shares the data, and keeps it alive.
+		boost::optional<EncodedNumbers> encodedNumbers() const;
+
+		//! Strings still as encoded in the buffer, if they have not been accessed as Strings yet.
+		//! Returned by value, as any accessor can decode the value in place: the copy shares the data, and keeps it alive.
+		boost::optional<EncodedStrings> encodedStrings() const;
+
+		//! Test whether the value holds encoded numbers or strings
+		bool isEncoded() const;
+
+		//! Convert encoded numbers to Integers or Reals, and encoded strings to Strings.
+		//! Done by the accessors, but not thread safe: call it before sharing the value between threads.
+		void decode() const;
+
 		// Access to the variant
 		ValueVariant& value();
 		const ValueVariant& value() const;
 
-		// Apply a visitor of values
+		// Apply a visitor of values. It also receives the EncodedNumbers and EncodedStrings, Element::applyVisitor decodes them first.
 		template <class Visitor>
 		typename Visitor::result_type applyVisitor(const Visitor& visitor) const
 		{
@@ -263,6 +413,19 @@ namespace emdl
 		}
 
 	private:
-		ValueVariant m_value;
+		// Move a vector into the list storing its type
+		template <class T>
+		static std::vector<T>&& toList(std::vector<T>&& value, std::true_type)
+		{
+			return std::move(value);
+		}
+
+		template <class T>
+		static typename ValueList<T>::type toList(std::vector<T>&& value, std::false_type)
+		{
+			return typename ValueList<T>::type(std::make_move_iterator(value.begin()), std::make_move_iterator(value.end()));
+		}
+
+		mutable ValueVariant m_value; // Mutable so that encoded values can be decoded on access
 	};
 }
@@ -1,5 +1,7 @@
 #include <emdl/dataset/reader/BaseReader.h>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 
 namespace emdl
@@ -81,42 +83,97 @@ namespace emdl
 		return value;
 	}
 
+	VR BaseReader::readExplicitVR()
+	{
+		if (m_view.size() < m_offset + 2)
+			throw Exception("Could not read from stream in BaseReader::readExplicitVR, offset: {}, view size: {}, asked: {}",
+							m_offset, m_view.size(), 2);
+		const auto data = m_view.data() + m_offset;
+		const auto vr = asVR(static_cast<char>(data[0]), static_cast<char>(data[1]));
+		if (vr == VR::Invalid)
+			throw Exception("{} Unknown VR at position {}", LOG_POSITION, m_offset);
+		m_offset += 2;
+		return vr;
+	}
+
 	uint32_t BaseReader::readLength(VR vr)
 	{
+		if (m_explicit && !hasLongLength(vr))
+		{
+			uint16_t length;
+			(*this) >> length;
+			return length;
+		}
+
 		if (m_explicit)
+			ignore(2);
+		uint32_t length = 0;
+		(*this) >> length;
+		return length;
+	}
+
+	bool BaseReader::readElementHeader(ElementHeader& header)
+	{
+		const auto data = m_view.data() + m_offset;
+		const auto available = m_view.size() - std::min(m_offset, m_view.size());
+		if (available < 8)
+			return false;
+
+		std::memcpy(&header.tag.group, data, 2);
+		std::memcpy(&header.tag.element, data + 2, 2);
+
+		// Items and delimiters have no VR, even in explicit transfer syntaxes
+		if (!m_explicit || header.tag.group == 0xFFFE)
 		{
-			switch (vr)
-			{
-			case VR::OB:
-			case VR::OD:
-			case VR::OF:
-			case VR::OL:
-			case VR::OW:
-			case VR::SQ:
-			case VR::UC:
-			case VR::UR:
-			case VR::UT:
-			case VR::UN:
+			header.vr = VR::Unknown;
+			std::memcpy(&header.length, data + 4, 4);
+			m_offset += 8;
+			return true;
+		}
+
+		header.vr = asVR(static_cast<char>(data[4]), static_cast<char>(data[5]));
+		if (header.vr == VR::Invalid)
+			throw Exception("{} Unknown VR at position {}", LOG_POSITION, m_offset + 4);
+		if (!hasLongLength(header.vr))
+		{
+			uint16_t length;
+			std::memcpy(&length, data + 6, 2);
+			header.length = length;
+			m_offset += 8;
+			return true;
+		}
+
+		if (available < 12)
+			return false;
+		std::memcpy(&header.length, data + 8, 4);
+		m_offset += 12;
+		return true;
+	}
+
+	bool BaseReader::skipUndefinedLength()
+	{
+		ElementHeader header;
+		while (readElementHeader(header))
+		{
+			if (header.tag.group == 0xFFFE && (header.tag.element == 0xE0DD || header.tag.element == 0xE00D)) // Sequence or item delimitation
+				return true;
+
+			if (header.length == 0xFFFFFFFF)
 			{
-				ignore(2);
-				uint32_t length = 0;
-				(*this) >> length;
-				return length;
+				if (!skipUndefinedLength())
+					return false;
 			}
-			default:
+			else if (m_view.size() - m_offset < header.length)
 			{
-				uint16_t length;
-				(*this) >> length;
-				return length;
-			}
+				m_offset = m_view.size();
+				return false;
 			}
+			else
+				m_offset += header.length;
 		}
-		else
-		{
-			uint32_t length = 0;
-			(*this) >> length;
-			return length;
-		}
+
+		m_offset = std::max(m_offset, m_view.size());
+		return false;
 	}
 
 	BinaryView BaseReader::getView(size_t size)
@@ -14,6 +14,14 @@ namespace emdl
 	using BinaryBufferSPtr = std::shared_ptr<BinaryBuffer>;
 	using BinaryView = ArrayView<const uint8_t>;
 
+	//! Tag, VR and length of an encoded element
+	struct ElementHeader
+	{
+		Tag tag;
+		VR vr = VR::Unknown; //!< Unknown for implicit transfer syntaxes, items and delimiters
+		uint32_t length = 0; //!< 0xFFFFFFFF for an undefined length
+	};
+
 	class EMDL_API BaseReader
 	{
 	public:
@@ -31,8 +39,17 @@ namespace emdl
 
 		Tag readTag(); //!< Read one tag
 		std::string readString(size_t size); //!< Read one string
+		VR readExplicitVR(); //!< Read the VR of an element in an explicit transfer syntax, without allocation. Throws if it is not recognized.
 		uint32_t readLength(VR vr); //!< Read the length of an element
 
+		//! Read the tag, VR and length of an element (or of an item), without allocation.
+		//! Returns false without moving if the view is too short for them, throws if the VR is not recognized.
+		bool readElementHeader(ElementHeader& header);
+
+		//! Jump over the content of a sequence, an item or pixel data of undefined length, up to and including its delimitation item.
+		//! Returns false if the view ended before the delimitation item.
+		bool skipUndefinedLength();
+
 		//! Read one value of a specific type
 		template <class T>
 		T read()
@@ -1,11 +1,22 @@
 #include <emdl/dataset/reader/DataSetReader.h>
+#include <emdl/dataset/DataSetBuilder.h>
 #include <emdl/Exception.h>
 #include <emdl/registry.h>
 
+#include <algorithm>
 #include <fstream>
 
 namespace emdl
 {
+	namespace
+	{
+		// Number of elements to reserve for a view: about one every 32 bytes, with a limit as large views are mostly pixel data
+		size_t expectedElements(BinaryView view)
+		{
+			return std::min<size_t>(view.size() / 32, 512);
+		}
+	} // namespace
+
 	BinaryBufferSPtr createBufferFromFile(const std::string& fileName)
 	{
 		std::ifstream in(fileName, std::ios_base::binary);
@@ -58,14 +69,14 @@ namespace emdl
 		return value == "DICM";
 	}
 
-	FileDataSets DataSetReader::readFile(const std::string& fileName, HaltConditionFunc func)
+	FileDataSets DataSetReader::readFile(const std::string& fileName, HaltConditionFunc func, const MemoryArenaSPtr& arena)
 	{
 		const auto buffer = createBufferFromFile(fileName);
 
-		return readFile(buffer, func);
+		return readFile(buffer, func, arena);
 	}
 
-	FileDataSets DataSetReader::readFile(const BinaryBufferSPtr& buffer, HaltConditionFunc func)
+	FileDataSets DataSetReader::readFile(const BinaryBufferSPtr& buffer, HaltConditionFunc func, const MemoryArenaSPtr& arena)
 	{
 		// File preamble and DICOM prefix
 		{
@@ -79,7 +90,8 @@ namespace emdl
 		// Read meta information
 		DataSetReader metaInfoReader(buffer,
 									 BinaryView{buffer->data() + 132, buffer->size() - 132},
-									 TransferSyntax::ExplicitVRLittleEndian);
+									 TransferSyntax::ExplicitVRLittleEndian,
+									 arena);
 		const auto metaInfoDataSet = metaInfoReader.readDataSet([](const Tag& tag) {
 			return (tag.group != 0x0002);
 		});
@@ -99,7 +111,7 @@ namespace emdl
 		// Read the remainder of the file
 		const auto start = metaInfoReader.offset() + 132;
 		const auto dataSetView = BinaryView(buffer->data() + start, buffer->size() - start);
-		DataSetReader dataSetReader(buffer, dataSetView, ts);
+		DataSetReader dataSetReader(buffer, dataSetView, ts, arena);
 		const auto dataSet = func ? dataSetReader.readDataSet(func) : dataSetReader.readDataSet();
 
 		return {metaInfoDataSet, dataSet};
@@ -107,34 +119,39 @@ namespace emdl
 
 	/*****************************************************************************/
 
-	DataSetReader::DataSetReader(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax)
+	DataSetReader::DataSetReader(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena)
 		: BaseReader(buffer, view, transferSyntax)
+		, m_arena(arena)
 	{
 	}
 
-	DataSetReader::DataSetReader(const BinaryBufferSPtr& buffer, TransferSyntax transferSyntax)
+	DataSetReader::DataSetReader(const BinaryBufferSPtr& buffer, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena)
 		: BaseReader(buffer, transferSyntax)
+		, m_arena(arena)
 	{
 	}
 
 	DataSet DataSetReader::readDataSet()
 	{
-		DataSet dataSet(buffer(), view(), transferSyntax());
+		DataSetBuilder builder(buffer(), view(), transferSyntax(), m_arena);
+		builder.reserve(expectedElements(view()));
 		while (!eof())
 		{
 			const auto start = offset();
 			const auto tag = readTag();
 			const auto elt = readElement();
-			dataSet.set(tag, BinaryView(view().data() + start, offset() - start));
+			builder.add(tag, BinaryView(view().data() + start, offset() - start));
 		}
 
+		auto dataSet = builder.build();
 		dataSet.updateViewSize(offset());
 		return dataSet;
 	}
 
 	DataSet DataSetReader::readDataSet(HaltConditionFunc haltFunc)
 	{
-		DataSet dataSet(buffer(), view(), transferSyntax());
+		DataSetBuilder builder(buffer(), view(), transferSyntax(), m_arena);
+		builder.reserve(expectedElements(view()));
 		while (!eof())
 		{
 			auto start = offset();
@@ -147,9 +164,10 @@ namespace emdl
 			}
 
 			const auto elt = readElement();
-			dataSet.set(tag, BinaryView(view().data() + start, offset() - start));
+			builder.add(tag, BinaryView(view().data() + start, offset() - start));
 		}
 
+		auto dataSet = builder.build();
 		dataSet.updateViewSize(offset());
 		return dataSet;
 	}
@@ -161,44 +179,18 @@ namespace emdl
 		elt.length = 0;
 
 		if (isExplicitTS())
-			elt.vr = asVR(readString(2));
+			elt.vr = readExplicitVR();
 
 		elt.length = readLength(elt.vr);
 
+		// The content of undefined length sequences is only scanned for the delimitation item, the items are indexed when the sequence is parsed.
+		// A sequence without delimitation item runs to the end of the view, as a truncated last element is accepted.
 		if (elt.length == 0xFFFFFFFF)
-		{ // Parse a sequence
-			while (!eof())
-			{
-				const auto tag = readTag();
-				if (tag == registry::Item)
-					ignoreItem();
-				else if (tag == registry::SequenceDelimitationItem)
-				{
-					ignore(4);
-					break;
-				}
-				else
-					throw Exception("{} Expected SequenceDelimitationItem, got: {} at position {}", LOG_POSITION, asString(tag), offset());
-			}
-		}
+			skipUndefinedLength();
 		else
 			ignore(elt.length);
 
 		return elt;
 	}
 
-	void DataSetReader::ignoreItem()
-	{
-		const auto itemLength = read<uint32_t>();
-		if (itemLength == 0xFFFFFFFF)
-		{
-			readDataSet([](const Tag& tag) {
-				return tag == registry::ItemDelimitationItem;
-			});
-			ignore(8);
-		}
-		else
-			ignore(itemLength);
-	}
-
 } // namespace emdl
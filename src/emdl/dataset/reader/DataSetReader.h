@@ -24,11 +24,12 @@ namespace emdl
 	public:
 		using HaltConditionFunc = std::function<bool(const Tag&)>;
 
-		DataSetReader(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax);
-		DataSetReader(const BinaryBufferSPtr& buffer, TransferSyntax transferSyntax);
+		//! The data sets read (and the items of their sequences) are allocated in the arena if one is given
+		DataSetReader(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena = {});
+		DataSetReader(const BinaryBufferSPtr& buffer, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena = {});
 
-		static FileDataSets readFile(const BinaryBufferSPtr& buffer, HaltConditionFunc func = {});
-		static FileDataSets readFile(const std::string& filePath, HaltConditionFunc func = {});
+		static FileDataSets readFile(const BinaryBufferSPtr& buffer, HaltConditionFunc func = {}, const MemoryArenaSPtr& arena = {});
+		static FileDataSets readFile(const std::string& filePath, HaltConditionFunc func = {}, const MemoryArenaSPtr& arena = {});
 
 		DataSet readDataSet();
 		DataSet readDataSet(HaltConditionFunc haltFunc);
@@ -40,7 +41,8 @@ namespace emdl
 			VR vr;
 		};
 		ElementInfo readElement();
-		void ignoreItem();
+
+		MemoryArenaSPtr m_arena;
 	};
 
 } // namespace emdl
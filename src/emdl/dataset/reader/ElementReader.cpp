@@ -1,14 +1,19 @@
 #include <emdl/dataset/reader/ElementReader.h>
-#include <emdl/dataset/reader/DataSetReader.h>
 #include <emdl/Exception.h>
 #include <emdl/registry.h>
 
 namespace
 {
-	emdl::Value::Strings splitString(const std::string& str)
+	emdl::Value::Strings splitString(std::string str)
 	{
 		const size_t nb = 1 + std::count(str.begin(), str.end(), '\\');
-		std::vector<std::string> result;
+		emdl::Value::Strings result;
+		if (nb == 1) // Most elements have a single value, which is stored without copying it
+		{
+			result.push_back(std::move(str));
+			return result;
+		}
+
 		result.reserve(nb);
 
 		size_t begin = 0, size = str.size();
@@ -31,28 +36,27 @@ namespace
 		return result;
 	}
 
-	void removePadding(std::string& str)
+	// Shorter lists of binary numbers are widened directly, as keeping a slice of the buffer costs more than it saves
+	const size_t minEncodedNumbers = 16;
+
+	bool isBinaryNumber(emdl::VR vr)
 	{
-		static const std::string padding = {'\0', ' '};
-		const auto last = str.find_last_not_of(padding);
-		if (last + 1 == str.size()) // No padding
-			return;
-		else if (last != std::string::npos)
-			str = str.substr(0, last + 1);
-		else // Empty string
-			str.clear();
+		using VR = emdl::VR;
+		return vr == VR::FD || vr == VR::FL || vr == VR::SL || vr == VR::SS || vr == VR::UL || vr == VR::US;
 	}
 }
 
 namespace emdl
 {
-	ElementReader::ElementReader(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax)
+	ElementReader::ElementReader(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena)
 		: BaseReader(buffer, view, transferSyntax)
+		, m_arena(arena)
 	{
 	}
 
-	ElementReader::ElementReader(const BinaryBufferSPtr& buffer, TransferSyntax transferSyntax)
+	ElementReader::ElementReader(const BinaryBufferSPtr& buffer, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena)
 		: BaseReader(buffer, transferSyntax)
+		, m_arena(arena)
 	{
 	}
 
@@ -62,6 +66,16 @@ namespace emdl
 
 		const auto length = readLength(vr);
 
+		if (isBinaryNumber(vr))
+		{
+			auto numbers = readEncodedNumbers(vr, length);
+			if (numbers.size() >= minEncodedNumbers)
+				return numbers;
+			if (numbers.isIntegers())
+				return {numbers.toIntegers(), vr};
+			return {numbers.toReals(), vr};
+		}
+
 		using VR = VR;
 		switch (vr)
 		{
@@ -77,9 +91,11 @@ namespace emdl
 		case VR::FL:
 			return {readReals(vr, length), vr};
 
+		case VR::AT:
+			return {readStrings(vr, length), vr};
+
 		case VR::AE:
 		case VR::AS:
-		case VR::AT:
 		case VR::CS:
 		case VR::DA:
 		case VR::DT:
@@ -93,7 +109,7 @@ namespace emdl
 		case VR::UI:
 		case VR::UR:
 		case VR::UT:
-			return {readStrings(vr, length), vr};
+			return readEncodedStrings(vr, length); // Only split when accessed
 
 		case VR::SQ:
 			return {readDataSets(vr, length), vr};
@@ -102,6 +118,7 @@ namespace emdl
 		case VR::OD:
 		case VR::OF:
 		case VR::OL:
+		case VR::OV:
 		case VR::OW:
 		case VR::UN:
 			return {readBinaries(vr, length), vr};
@@ -117,7 +134,7 @@ namespace emdl
 		Tag tag = readTag();
 		VR vr = VR::Unknown;
 		if (isExplicitTS())
-			vr = asVR(readString(2));
+			vr = readExplicitVR();
 		else
 			vr = findVR(tag, dataSet);
 		return vr;
@@ -141,37 +158,7 @@ namespace emdl
 			}
 		}
 		else
-		{
-			uint32_t nb = 0;
-			if (vr == VR::SL || vr == VR::UL)
-				nb = length / 4;
-			else if (vr == VR::AT || vr == VR::SS || vr == VR::US)
-				nb = length / 2;
-			else
-				throw Exception("Cannot read integers from {} at position {}", asString(vr), offset());
-
-			result.resize(nb);
-			if (vr == VR::SL)
-			{
-				for (unsigned int i = 0; i < nb; ++i)
-					result[i] = read<int32_t>();
-			}
-			else if (vr == VR::SS)
-			{
-				for (unsigned int i = 0; i < nb; ++i)
-					result[i] = read<int16_t>();
-			}
-			else if (vr == VR::UL)
-			{
-				for (unsigned int i = 0; i < nb; ++i)
-					result[i] = read<uint32_t>();
-			}
-			else if (vr == VR::AT || vr == VR::US)
-			{
-				for (unsigned int i = 0; i < nb; ++i)
-					result[i] = read<uint16_t>();
-			}
-		}
+			result = readEncodedNumbers(vr, length).toIntegers();
 
 		return result;
 	}
@@ -193,27 +180,7 @@ namespace emdl
 			}
 		}
 		else
-		{
-			uint32_t nb = 0;
-			if (vr == VR::FD)
-				nb = length / 8;
-			else if (vr == VR::FL)
-				nb = length / 4;
-			else
-				throw Exception("Cannot read reals from {} at position {}", asString(vr), offset());
-
-			result.resize(nb);
-			if (vr == VR::FD)
-			{
-				for (unsigned int i = 0; i < nb; ++i)
-					result[i] = read<double>();
-			}
-			else // vr == VR::FL
-			{
-				for (unsigned int i = 0; i < nb; ++i)
-					result[i] = read<float>();
-			}
-		}
+			result = readEncodedNumbers(vr, length).toReals();
 
 		return result;
 	}
@@ -236,20 +203,7 @@ namespace emdl
 			}
 		}
 		else
-		{
-			auto str = readString(length);
-			removePadding(str);
-			if (str.empty())
-				return {};
-
-			if (vr == VR::LT || vr == VR::ST || vr == VR::UT)
-				result = {str};
-			else
-				result = splitString(str);
-
-			for (auto& item : result)
-				removePadding(item);
-		}
+			result = readEncodedStrings(vr, length).toStrings();
 
 		return result;
 	}
@@ -295,29 +249,22 @@ namespace emdl
 	{
 		const auto itemLength = read<uint32_t>();
 
-		DataSet item;
-		if (itemLength != 0xffffffff)
-		{ // Explicit length item
-			const auto itemView = getView(itemLength);
-			auto itemReader = DataSetReader(buffer(), itemView, transferSyntax());
-			item = itemReader.readDataSet();
-		}
-		else
-		{ // Undefined length item
-			auto remaining = view().size() - offset();
-			auto itemView = BinaryView{view().data() + offset(), remaining};
-			auto itemReader = DataSetReader(buffer(), itemView, transferSyntax());
-			item = itemReader.readDataSet([](const Tag& tag) {
-				return tag == registry::ItemDelimitationItem;
-			});
-
-			auto const tag = itemReader.readTag();
-			if (tag != registry::ItemDelimitationItem)
-				throw Exception("{} Unexpected tag: {} at position {}", LOG_POSITION, asString(tag), offset());
-			ignore(itemReader.offset() + 4);
-		}
-
-		return item;
+		// Only the boundaries of the item are found here, its elements are indexed on first access
+		if (itemLength != 0xffffffff) // Explicit length item
+			return DataSet::deferred(buffer(), getView(itemLength), transferSyntax(), m_arena);
+
+		// Undefined length item
+		const auto start = offset();
+		if (!skipUndefinedLength())
+			throw Exception("{} Missing ItemDelimitationItem for the item at position {}", LOG_POSITION, start);
+		const auto end = offset() - 8;
+		setOffset(end);
+		const auto tag = readTag();
+		if (tag != registry::ItemDelimitationItem)
+			throw Exception("{} Unexpected tag: {} at position {}", LOG_POSITION, asString(tag), end);
+		ignore(4);
+
+		return DataSet::deferred(buffer(), BinaryView{view().data() + start, end - start}, transferSyntax(), m_arena);
 	}
 
 	Value::Binaries ElementReader::readBinaries(VR vr, uint32_t length)
@@ -329,11 +276,40 @@ namespace emdl
 		else if (length == 0xffffffff)
 			result = readEncapsulatedPixelData();
 		else
-			result.emplace_back(getView(length));
+			result.emplace_back(getView(length), buffer()); // Keep the buffer alive, so that the value can be used without the data set
 
 		return result;
 	}
 
+	EncodedNumbers ElementReader::readEncodedNumbers(VR vr, uint32_t length)
+	{
+		EncodedNumbers numbers;
+		numbers.vr = vr;
+		const auto width = numbers.width();
+		const auto view = getView(length);
+		const auto size = length / width * width;
+
+		// Without a buffer to keep alive, the view could outlive the memory it points into: the numbers are copied, like the other values
+		if (buffer() && reinterpret_cast<uintptr_t>(view.data()) % width == 0)
+			numbers.data.set({view.data(), size}, buffer());
+		else // Also copied to aligned memory, so that the numbers can be viewed in their type
+			numbers.data.set(BinaryValue::vector_type(view.data(), view.data() + size));
+
+		return numbers;
+	}
+
+	EncodedStrings ElementReader::readEncodedStrings(VR vr, uint32_t length)
+	{
+		EncodedStrings strings;
+		strings.vr = vr;
+		const auto view = getView(length);
+		if (buffer())
+			strings.data.set(view, buffer());
+		else // Nothing keeps the memory alive, the strings are copied
+			strings.data.set(BinaryValue::vector_type(view.begin(), view.end()));
+		return strings;
+	}
+
 	Value::Binaries ElementReader::readEncapsulatedPixelData()
 	{
 		Value::Binaries result;
@@ -344,7 +320,7 @@ namespace emdl
 			const auto itemLength = read<uint32_t>();
 
 			if (tag == registry::Item)
-				result.emplace_back(getView(itemLength));
+				result.emplace_back(getView(itemLength), buffer());
 			else if (tag == registry::SequenceDelimitationItem)
 				break;
 			else
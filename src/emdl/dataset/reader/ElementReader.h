@@ -13,8 +13,9 @@ namespace emdl
 	class EMDL_API ElementReader : public BaseReader
 	{
 	public:
-		ElementReader(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax);
-		ElementReader(const BinaryBufferSPtr& buffer, TransferSyntax transferSyntax);
+		//! The items of the sequences are allocated in the arena if one is given
+		ElementReader(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena = {});
+		ElementReader(const BinaryBufferSPtr& buffer, TransferSyntax transferSyntax, const MemoryArenaSPtr& arena = {});
 
 		//! Read an element (VR and value), try to guess the VR from the tag, the partially read data set, and its transfer syntax.
 		Element readElement(const DataSet& dataSet = DataSet{});
@@ -29,7 +30,16 @@ namespace emdl
 		Value::DataSets readDataSets(VR vr, uint32_t length);
 		Value::Binaries readBinaries(VR vr, uint32_t length);
 
+		//! Read binary numbers without converting them. A slice of the buffer is kept when it is aligned for their type.
+		EncodedNumbers readEncodedNumbers(VR vr, uint32_t length);
+
+		//! Read strings without splitting them, keeping a slice of the buffer
+		EncodedStrings readEncodedStrings(VR vr, uint32_t length);
+
 		DataSet readItem();
 		Value::Binaries readEncapsulatedPixelData();
+
+	private:
+		MemoryArenaSPtr m_arena;
 	};
 }
@@ -0,0 +1,247 @@
+#include <emdl/dataset/reader/EventParser.h>
+
+#include <emdl/dataset/VRFinder.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <cstring>
+
+namespace
+{
+	using namespace emdl;
+
+	const uint32_t undefinedLength = 0xFFFFFFFF;
+	const size_t noEnd = static_cast<size_t>(-1);
+
+	// Undefined length elements are sequences, except the encapsulated pixel data
+	bool isSequence(const ElementEvent& event)
+	{
+		if (event.vr == VR::SQ)
+			return true;
+		return event.length == undefinedLength && event.tag != registry::PixelData && event.vr != VR::OB && event.vr != VR::OW;
+	}
+
+	// Transfer syntax of the UID in the meta information, without creating a string
+	TransferSyntax findTransferSyntax(BinaryView uid)
+	{
+		auto size = uid.size();
+		while (size && (uid.data()[size - 1] == '\0' || uid.data()[size - 1] == ' '))
+			--size;
+
+		for (int i = static_cast<int>(TransferSyntax::ImplicitVRLittleEndian); i <= static_cast<int>(TransferSyntax::RLELossless); ++i)
+		{
+			const auto transferSyntax = static_cast<TransferSyntax>(i);
+			const auto& str = getTransferSyntaxUID(transferSyntax);
+			if (str.size() == size && !std::memcmp(str.data(), uid.data(), size))
+				return transferSyntax;
+		}
+		return TransferSyntax::Unknown;
+	}
+}
+
+namespace emdl
+{
+	ParseAction DataSetHandler::element(const ElementEvent&)
+	{
+		return ParseAction::Continue;
+	}
+
+	ParseAction DataSetHandler::startSequence(const ElementEvent&)
+	{
+		return ParseAction::Continue;
+	}
+
+	ParseAction DataSetHandler::endSequence(const ElementEvent&)
+	{
+		return ParseAction::Continue;
+	}
+
+	ParseAction DataSetHandler::startItem(NestingPath, uint32_t)
+	{
+		return ParseAction::Continue;
+	}
+
+	ParseAction DataSetHandler::endItem(NestingPath)
+	{
+		return ParseAction::Continue;
+	}
+
+	/*****************************************************************************/
+
+	const size_t EventParser::maxDepth;
+
+	EventParser::EventParser(BinaryView view, TransferSyntax transferSyntax)
+		: BaseReader(nullptr, view, transferSyntax)
+	{
+	}
+
+	bool EventParser::parse(DataSetHandler& handler)
+	{
+		setOffset(0);
+		m_depth = 0;
+		return parseDataSet(handler, view().size());
+	}
+
+	bool EventParser::parseFile(BinaryView file, DataSetHandler& handler)
+	{
+		if (file.size() < 132 || std::memcmp(file.data() + 128, "DICM", 4))
+			throw Exception("{} Not a DICOM file", LOG_POSITION);
+
+		// Meta information, always in explicit VR little endian
+		EventParser metaInfoParser(BinaryView(file.data() + 132, file.size() - 132), TransferSyntax::ExplicitVRLittleEndian);
+		metaInfoParser.m_metaInformation = true;
+		if (!metaInfoParser.parse(handler))
+			return false;
+
+		const auto transferSyntax = findTransferSyntax(metaInfoParser.m_transferSyntaxUID);
+		if (transferSyntax == TransferSyntax::Unknown)
+			throw Exception("{} Missing or unknown Transfer Syntax UID", LOG_POSITION);
+		if (transferSyntax == TransferSyntax::DeflatedExplicitVRLittleEndian)
+			throw Exception("{} Deflated transfer syntax not supported", LOG_POSITION);
+
+		const auto start = 132 + metaInfoParser.offset();
+		return EventParser(BinaryView(file.data() + start, file.size() - start), transferSyntax).parse(handler);
+	}
+
+	// Parse the elements until end, or until the ItemDelimitationItem if end is noEnd. Returns false if stopped.
+	bool EventParser::parseDataSet(DataSetHandler& handler, size_t end)
+	{
+		while (end == noEnd || offset() < end)
+		{
+			const auto start = offset();
+			ElementHeader header;
+			readHeader(header);
+
+			// A delimiter is tolerated at the end of a defined length item
+			if (header.tag == registry::ItemDelimitationItem)
+			{
+				if (end != noEnd && offset() != end)
+					throw Exception("{} Unexpected ItemDelimitationItem at position {}", LOG_POSITION, start);
+				return true;
+			}
+			if (header.tag.group == 0xFFFE)
+				throw Exception("{} Unexpected tag {} at position {}", LOG_POSITION, asString(header.tag), start);
+
+			// The meta information ends at the first element of another group
+			if (m_metaInformation && header.tag.group != 0x0002)
+			{
+				setOffset(start);
+				return true;
+			}
+
+			ElementEvent event;
+			event.tag = header.tag;
+			event.vr = isExplicitTS() ? header.vr : findVR(header.tag);
+			event.length = header.length;
+			event.offset = start;
+			event.path = path();
+
+			if (isSequence(event))
+			{
+				const auto action = handler.startSequence(event);
+				if (action == ParseAction::Stop)
+					return false;
+
+				const auto valueStart = offset();
+				if (action == ParseAction::Skip)
+				{
+					skip(header.length);
+					continue;
+				}
+				if (!parseSequence(handler, event))
+					return false;
+
+				event.value = BinaryView(view().data() + valueStart, offset() - valueStart);
+				if (handler.endSequence(event) == ParseAction::Stop)
+					return false;
+			}
+			else
+			{
+				const auto valueStart = offset();
+				skip(header.length);
+				event.value = BinaryView(view().data() + valueStart, offset() - valueStart);
+				if (m_metaInformation && header.tag == registry::TransferSyntaxUID)
+					m_transferSyntaxUID = event.value;
+				if (handler.element(event) == ParseAction::Stop)
+					return false;
+			}
+		}
+
+		if (offset() != end)
+			throw Exception("{} Element exceeding the end of its item, at position {}", LOG_POSITION, offset());
+		return true;
+	}
+
+	// Parse the items of the sequence of the event, whose header was just read. Returns false if stopped.
+	bool EventParser::parseSequence(DataSetHandler& handler, ElementEvent& event)
+	{
+		if (m_depth == maxDepth)
+			throw Exception("{} Sequences nested deeper than {} levels", LOG_POSITION, maxDepth);
+
+		if (event.length != undefinedLength && offset() + event.length > view().size())
+			throw Exception("{} Sequence {} exceeding the data, at position {}", LOG_POSITION, asString(event.tag), offset());
+		const auto end = event.length == undefinedLength ? noEnd : offset() + event.length;
+
+		for (uint32_t index = 0; end == noEnd || offset() < end; ++index)
+		{
+			const auto start = offset();
+			ElementHeader header;
+			readHeader(header);
+			if (header.tag == registry::SequenceDelimitationItem)
+			{
+				if (end != noEnd && offset() != end)
+					throw Exception("{} Unexpected SequenceDelimitationItem at position {}", LOG_POSITION, start);
+				return true;
+			}
+			if (header.tag != registry::Item)
+				throw Exception("{} Expected an item, got {} at position {}", LOG_POSITION, asString(header.tag), start);
+
+			m_path[m_depth++] = {event.tag, index};
+			const auto action = handler.startItem(path(), header.length);
+			if (action == ParseAction::Stop)
+				return false;
+
+			if (action == ParseAction::Skip)
+				skip(header.length);
+			else
+			{
+				if (header.length != undefinedLength && offset() + header.length > view().size())
+					throw Exception("{} Item exceeding the data, at position {}", LOG_POSITION, start);
+				if (!parseDataSet(handler, header.length == undefinedLength ? noEnd : offset() + header.length))
+					return false;
+				if (handler.endItem(path()) == ParseAction::Stop)
+					return false;
+			}
+			--m_depth;
+		}
+
+		if (offset() != end)
+			throw Exception("{} Item exceeding the end of its sequence, at position {}", LOG_POSITION, offset());
+		return true;
+	}
+
+	void EventParser::readHeader(ElementHeader& header)
+	{
+		if (!readElementHeader(header))
+			throw Exception("{} Truncated element at position {}", LOG_POSITION, offset());
+	}
+
+	void EventParser::skip(uint32_t length)
+	{
+		if (length == undefinedLength)
+		{
+			if (!skipUndefinedLength())
+				throw Exception("{} Missing delimitation item, at position {}", LOG_POSITION, offset());
+			return;
+		}
+		if (offset() + length > view().size())
+			throw Exception("{} Value exceeding the data, at position {}", LOG_POSITION, offset());
+		ignore(length);
+	}
+
+	NestingPath EventParser::path() const
+	{
+		return NestingPath(m_path.data(), m_depth);
+	}
+
+} // namespace emdl
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <emdl/dataset/reader/BaseReader.h>
+
+#include <array>
+
+namespace emdl
+{
+	//! Level of the nesting of an element: the sequence containing it, and the index of the item in this sequence
+	struct SequenceLevel
+	{
+		Tag sequence;
+		uint32_t item = 0;
+	};
+
+	//! Levels from the top level data set to the current item, empty at the top level
+	using NestingPath = ArrayView<const SequenceLevel>;
+
+	//! Element reported by EventParser. The views point inside the parsed view and are only valid during the callback.
+	struct ElementEvent
+	{
+		Tag tag;
+		VR vr = VR::Unknown; //!< For implicit transfer syntaxes, the VR of the dictionary
+		uint32_t length = 0; //!< As encoded, 0xFFFFFFFF for an undefined length
+		size_t offset = 0; //!< Start of the element in the parsed view
+		BinaryView value; //!< Encoded value, including the delimitation item for an undefined length. Empty for startSequence.
+		NestingPath path;
+	};
+
+	enum class ParseAction : uint8_t
+	{
+		Continue,
+		Skip, //!< Do not visit the content of the sequence or of the item that just started
+		Stop
+	};
+
+	//! Receives the events of EventParser. The default implementations continue the parsing.
+	class EMDL_API DataSetHandler
+	{
+	public:
+		virtual ~DataSetHandler() = default;
+
+		//! Any element that is not a sequence, including the encapsulated pixel data
+		virtual ParseAction element(const ElementEvent& event);
+
+		//! If skipped, the items are not visited and endSequence is not called
+		virtual ParseAction startSequence(const ElementEvent& event);
+		virtual ParseAction endSequence(const ElementEvent& event);
+
+		//! The path ends with the level of this item. If skipped, its elements are not visited and endItem is not called.
+		virtual ParseAction startItem(NestingPath path, uint32_t length);
+		virtual ParseAction endItem(NestingPath path);
+	};
+
+	//! Event driven parser of an encoded data set: each element is reported once, in the order of the buffer.
+	//! No DataSet is built and nothing is allocated, the values are given as views. Throws if the data is malformed or truncated.
+	class EMDL_API EventParser : public BaseReader
+	{
+	public:
+		static const size_t maxDepth = 32; //!< Maximum nesting of sequences
+
+		EventParser(BinaryView view, TransferSyntax transferSyntax);
+
+		//! Parse the whole view. Returns false if the handler stopped the parsing.
+		bool parse(DataSetHandler& handler);
+
+		//! Parse a DICOM file in memory: the meta information (group 0002), then the data set using the transfer syntax of the meta information.
+		//! Returns false if the handler stopped the parsing.
+		static bool parseFile(BinaryView file, DataSetHandler& handler);
+
+	private:
+		bool parseDataSet(DataSetHandler& handler, size_t end);
+		bool parseSequence(DataSetHandler& handler, ElementEvent& event);
+		void readHeader(ElementHeader& header);
+		void skip(uint32_t length);
+		NestingPath path() const;
+
+		std::array<SequenceLevel, maxDepth> m_path;
+		size_t m_depth = 0;
+
+		bool m_metaInformation = false; // Stop after the group 0002
+		BinaryView m_transferSyntaxUID;
+	};
+
+} // namespace emdl
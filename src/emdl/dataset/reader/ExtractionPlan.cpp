@@ -0,0 +1,249 @@
+#include <emdl/dataset/reader/ExtractionPlan.h>
+
+#include <emdl/dataset/reader/DataSetReader.h>
+#include <emdl/dataset/reader/ElementReader.h>
+#include <emdl/dataset/DataSetAccessors.h>
+#include <emdl/dataset/VRFinder.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	const uint32_t undefinedLength = 0xFFFFFFFF;
+	const size_t noEnd = static_cast<size_t>(-1);
+}
+
+namespace emdl
+{
+	//! Scan of the encoded data set, only parsing the elements of the plan
+	struct ExtractionPlan::Scan : public BaseReader
+	{
+		Scan(const ExtractionPlan& plan, const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax, ExtractionResult& result)
+			: BaseReader(buffer, view, transferSyntax)
+			, plan(plan)
+			, result(result)
+		{
+		}
+
+		// Test whether the view has this number of bytes left, else the scan stops
+		bool available(size_t size)
+		{
+			if (offset() + size <= view().size())
+				return true;
+			truncated = true;
+			return false;
+		}
+
+		const Node* findChild(const Node& node, Tag tag) const
+		{
+			const auto it = std::lower_bound(node.children.begin(), node.children.end(), tag, [this](size_t child, Tag value) {
+				return plan.m_nodes[child].tag < value;
+			});
+			if (it == node.children.end() || plan.m_nodes[*it].tag != tag)
+				return nullptr;
+			return &plan.m_nodes[*it];
+		}
+
+		// Scan the elements of a data set until end, or until the ItemDelimitationItem if end is noEnd.
+		// Returns false if the view ended. A data set of known end is left as soon as its needed elements are passed.
+		bool dataSet(const Node& node, size_t end)
+		{
+			const bool delimited = end == noEnd;
+			const auto lastTag = node.children.empty() ? Tag() : plan.m_nodes[node.children.back()].tag;
+			while (delimited || offset() < end)
+			{
+				const auto start = offset();
+				ElementHeader header;
+				if (!readElementHeader(header))
+				{
+					truncated = true;
+					return false;
+				}
+				const auto tag = header.tag;
+				const auto length = header.length;
+				if (tag == registry::ItemDelimitationItem)
+					return true;
+
+				const auto child = findChild(node, tag);
+				if (!child)
+				{
+					if (!delimited && lastTag < tag)
+					{
+						// Leaving an item early says nothing about the elements after its sequence
+						if (&node == &plan.m_nodes.front())
+							passedLastTag = true;
+						return true;
+					}
+					if (!skip(length))
+						return false;
+					continue;
+				}
+
+				if (!child->children.empty() && (length == undefinedLength || header.vr == VR::SQ || (!isExplicitTS() && findVR(tag) == VR::SQ)))
+				{
+					if (!sequence(*child, length))
+						return false;
+				}
+				else if (!skip(length))
+					return false;
+
+				if (!child->pathIndexes.empty())
+				{
+					const BinaryView elementView(view().data() + start, offset() - start);
+					const auto element = ElementReader(buffer(), elementView, transferSyntax()).readElement();
+					for (const auto index : child->pathIndexes)
+						result.values[index].push_back(element);
+				}
+			}
+			return true;
+		}
+
+		// Scan the items of a sequence (or the fragments of encapsulated pixel data, node having no children)
+		bool sequence(const Node& node, uint32_t length)
+		{
+			if (length != undefinedLength && !available(length))
+				return false;
+			const auto end = length == undefinedLength ? noEnd : offset() + length;
+			while (end == noEnd || offset() < end)
+			{
+				ElementHeader header;
+				if (!readElementHeader(header))
+				{
+					truncated = true;
+					return false;
+				}
+				const auto itemLength = header.length;
+				if (header.tag == registry::SequenceDelimitationItem)
+					return true;
+				if (header.tag != registry::Item)
+					throw Exception("{} Expected an item, got {} at position {}", LOG_POSITION, asString(header.tag), offset());
+
+				if (itemLength == undefinedLength)
+				{
+					if (!dataSet(node, noEnd))
+						return false;
+				}
+				else
+				{
+					if (!available(itemLength))
+						return false;
+					const auto itemEnd = offset() + itemLength;
+					if (!node.children.empty() && !dataSet(node, itemEnd))
+						return false;
+					setOffset(itemEnd);
+				}
+			}
+			return true;
+		}
+
+		bool skip(uint32_t length)
+		{
+			if (length == undefinedLength)
+				return sequence(Node(), length);
+			if (!available(length))
+				return false;
+			ignore(length);
+			return true;
+		}
+
+		using BaseReader::setOffset;
+
+		const ExtractionPlan& plan;
+		ExtractionResult& result;
+		bool truncated = false, passedLastTag = false;
+	};
+
+	ExtractionPlan::ExtractionPlan(const std::vector<TagPath>& paths)
+		: m_paths(paths)
+		, m_nodes(1)
+	{
+		for (size_t index = 0; index < m_paths.size(); ++index)
+		{
+			const auto& path = m_paths[index];
+			if (path.empty())
+				throw Exception("{} Empty tag path in an extraction plan", LOG_POSITION);
+
+			size_t node = 0;
+			for (const auto tag : path)
+			{
+				auto& children = m_nodes[node].children;
+				const auto it = std::find_if(children.begin(), children.end(), [this, tag](size_t child) {
+					return m_nodes[child].tag == tag;
+				});
+				if (it != children.end())
+				{
+					node = *it;
+					continue;
+				}
+
+				Node child;
+				child.tag = tag;
+				m_nodes.push_back(child);
+				m_nodes[node].children.push_back(m_nodes.size() - 1);
+				node = m_nodes.size() - 1;
+			}
+			m_nodes[node].pathIndexes.push_back(index);
+		}
+
+		for (auto& node : m_nodes)
+		{
+			std::sort(node.children.begin(), node.children.end(), [this](size_t lhs, size_t rhs) {
+				return m_nodes[lhs].tag < m_nodes[rhs].tag;
+			});
+		}
+	}
+
+	size_t ExtractionPlan::size() const
+	{
+		return m_paths.size();
+	}
+
+	const TagPath& ExtractionPlan::path(size_t index) const
+	{
+		return m_paths.at(index);
+	}
+
+	Tag ExtractionPlan::lastTag() const
+	{
+		const auto& children = m_nodes.front().children;
+		return children.empty() ? Tag() : m_nodes[children.back()].tag;
+	}
+
+	ExtractionResult ExtractionPlan::extract(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax) const
+	{
+		ExtractionResult result;
+		result.values.resize(m_paths.size());
+
+		Scan scan(*this, buffer, view, transferSyntax, result);
+		scan.dataSet(m_nodes.front(), view.size());
+		result.complete = scan.passedLastTag;
+		return result;
+	}
+
+	ExtractionResult ExtractionPlan::extractFile(const BinaryBufferSPtr& buffer) const
+	{
+		if (buffer->size() < 132 || std::memcmp(buffer->data() + 128, "DICM", 4))
+			throw Exception("{} Not a DICOM file", LOG_POSITION);
+
+		DataSetReader metaInfoReader(buffer, BinaryView{buffer->data() + 132, buffer->size() - 132}, TransferSyntax::ExplicitVRLittleEndian);
+		const auto metaInfoDataSet = metaInfoReader.readDataSet([](const Tag& tag) {
+			return tag.group != 0x0002;
+		});
+
+		const auto transferSyntaxUID = firstString(metaInfoDataSet, registry::TransferSyntaxUID);
+		if (!transferSyntaxUID || transferSyntaxUID->empty())
+			throw Exception("{} Missing Transfer Syntax UID", LOG_POSITION);
+		const auto transferSyntax = getTransferSyntax(*transferSyntaxUID);
+		if (transferSyntax == TransferSyntax::Unknown || transferSyntax == TransferSyntax::DeflatedExplicitVRLittleEndian)
+			throw Exception("{} Transfer syntax not supported: {}", LOG_POSITION, *transferSyntaxUID);
+
+		const auto start = std::min(metaInfoReader.offset() + 132, buffer->size()); // The meta information can be cut by a prefix
+		auto result = extract(buffer, BinaryView(buffer->data() + start, buffer->size() - start), transferSyntax);
+		result.transferSyntaxUID = *transferSyntaxUID;
+		return result;
+	}
+
+} // namespace emdl
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <emdl/dataset/reader/BaseReader.h>
+#include <emdl/dataset/DataSet.h>
+
+#include <string>
+#include <vector>
+
+namespace emdl
+{
+	//! Tags from the top level data set to an element, the previous ones being sequences.
+	//! All the items of the sequences are visited: {ReferencedSeriesSequence, ReferencedInstanceSequence, ReferencedSOPInstanceUID}
+	using TagPath = std::vector<Tag>;
+
+	struct EMDL_API ExtractionResult
+	{
+		std::vector<std::vector<Element>> values; //!< For each path of the plan, one element per occurrence, in the order of the file
+		std::string transferSyntaxUID; //!< Only set by ExtractionPlan::extractFile
+		bool complete = false; //!< The scan went past the last top level tag of the plan. False if the data set (or the view of a part of it) ended first.
+	};
+
+	//! Compiled list of tag paths, extracted in a single scan of the encoded data set.
+	//! Only the elements of the paths are parsed, the scan descends only into the sequences of the paths and stops after the last top level tag.
+	class EMDL_API ExtractionPlan
+	{
+	public:
+		explicit ExtractionPlan(const std::vector<TagPath>& paths);
+
+		//! Number of paths
+		size_t size() const;
+
+		const TagPath& path(size_t index) const;
+
+		//! Last top level tag of the paths, the scan stops after it
+		Tag lastTag() const;
+
+		//! Extract the values from an encoded data set (without the meta information)
+		ExtractionResult extract(const BinaryBufferSPtr& buffer, BinaryView view, TransferSyntax transferSyntax) const;
+
+		//! Extract the values from a DICOM file in memory, or the start of it. Throws if it is not a DICOM file.
+		ExtractionResult extractFile(const BinaryBufferSPtr& buffer) const;
+
+	private:
+		struct Scan;
+
+		struct Node
+		{
+			Tag tag;
+			std::vector<size_t> pathIndexes; // Paths ending at this node
+			std::vector<size_t> children; // Indexes in m_nodes, sorted by tag
+		};
+
+		std::vector<TagPath> m_paths;
+		std::vector<Node> m_nodes; // The first one is the top level data set
+	};
+
+} // namespace emdl
@@ -0,0 +1,404 @@
+#include <emdl/dataset/reader/IngestPipeline.h>
+
+#include <emdl/dataset/reader/DataSetReader.h>
+#include <emdl/dataset/DataSetAccessors.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#include <boost/filesystem.hpp>
+
+namespace
+{
+	using namespace emdl;
+	namespace fs = boost::filesystem;
+
+	int64_t now()
+	{
+		using namespace std::chrono;
+		return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+	}
+
+	// Queue blocking the producers when full and the consumers when empty
+	template <class T>
+	class BoundedQueue
+	{
+	public:
+		explicit BoundedQueue(size_t capacity)
+			: m_capacity(std::max<size_t>(capacity, 1))
+		{
+		}
+
+		//! Returns false if the queue was aborted
+		bool push(T value)
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_notFull.wait(lock, [this] { return m_aborted || m_items.size() < m_capacity; });
+			if (m_aborted)
+				return false;
+			m_items.push_back(std::move(value));
+			m_notEmpty.notify_one();
+			return true;
+		}
+
+		//! Returns false when the queue is closed and empty, or aborted
+		bool pop(T& value)
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_notEmpty.wait(lock, [this] { return m_aborted || m_closed || !m_items.empty(); });
+			if (m_aborted || m_items.empty())
+				return false;
+			value = std::move(m_items.front());
+			m_items.pop_front();
+			m_notFull.notify_one();
+			return true;
+		}
+
+		//! No more items will be pushed, the remaining ones can still be popped
+		void close()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_closed = true;
+			m_notEmpty.notify_all();
+		}
+
+		//! Wake all the threads, the pending items are dropped
+		void abort()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_aborted = true;
+			m_items.clear();
+			m_notEmpty.notify_all();
+			m_notFull.notify_all();
+		}
+
+	private:
+		const size_t m_capacity;
+		std::deque<T> m_items;
+		std::mutex m_mutex;
+		std::condition_variable m_notEmpty, m_notFull;
+		bool m_closed = false, m_aborted = false;
+	};
+
+	// Record, or error on a file or directory
+	struct Item
+	{
+		IngestRecord record;
+		std::string error;
+	};
+
+	std::string errorMessage(const std::exception& e)
+	{
+		const std::string message = e.what();
+		return message.empty() ? "Unknown error" : message;
+	}
+
+	// Read the start of the file, growing it until the parse function returns true (it got everything it needs) or the whole file is read.
+	// Returns false if the file has no DICM prefix.
+	template <class ParseFunc>
+	bool readHeader(const std::string& path, size_t prefixSize, uint64_t& fileSize, uint64_t& bytesRead, ParseFunc parse)
+	{
+		std::ifstream in(path, std::ios::binary);
+		if (!in)
+			throw Exception("{} Cannot open {}", LOG_POSITION, path);
+		in.seekg(0, std::ios::end);
+		fileSize = static_cast<uint64_t>(in.tellg());
+		in.seekg(0, std::ios::beg);
+		if (fileSize < 132)
+			return false;
+
+		auto buffer = std::make_shared<BinaryBuffer>();
+		auto size = static_cast<size_t>(std::min<uint64_t>(std::max<size_t>(prefixSize, 132), fileSize));
+		while (true)
+		{
+			const auto previous = buffer->size();
+			buffer->resize(size);
+			in.read(reinterpret_cast<char*>(buffer->data() + previous), size - previous);
+			if (static_cast<size_t>(in.gcount()) != size - previous)
+				throw Exception("{} Cannot read {}", LOG_POSITION, path);
+			bytesRead += size - previous;
+
+			// Preamble check on the first read
+			if (!previous && std::memcmp(buffer->data() + 128, "DICM", 4))
+				return false;
+
+			// The prefix may have cut an element, the parsing is then retried with a larger one
+			const auto wholeFile = size == fileSize;
+			try
+			{
+				if (parse(buffer) || wholeFile)
+					return true;
+			}
+			catch (const std::exception&)
+			{
+				if (wholeFile)
+					throw;
+			}
+
+			size = static_cast<size_t>(std::min<uint64_t>(static_cast<uint64_t>(size) * 4, fileSize));
+		}
+	}
+
+	// Only the projected attributes are parsed, and copied so that the buffer can be released
+	void project(const FileDataSets& header, const std::vector<Tag>& tags, Tag lastTag, IngestRecord& record)
+	{
+		const auto transferSyntax = firstString(header.metaInformation, registry::TransferSyntaxUID);
+		if (transferSyntax)
+			record.transferSyntaxUID = *transferSyntax;
+
+		const auto& dataSet = header.dataSet;
+		if (tags.empty())
+		{
+			for (const auto& it : dataSet)
+			{
+				if (!(lastTag < it.tag()))
+					record.dataSet.set(it.tag(), detach(it.element()));
+			}
+		}
+		else
+		{
+			for (const auto tag : tags)
+			{
+				const auto element = dataSet[tag];
+				if (element)
+					record.dataSet.set(tag, detach(*element));
+			}
+		}
+	}
+}
+
+namespace emdl
+{
+	double IngestStatistics::filesPerSecond() const
+	{
+		return seconds > 0 ? dicomFiles / seconds : 0;
+	}
+
+	double IngestStatistics::megabytesPerSecond() const
+	{
+		return seconds > 0 ? bytesRead / (1024.0 * 1024.0) / seconds : 0;
+	}
+
+	IngestPipeline::IngestPipeline(IngestOptions options)
+		: m_options(std::move(options))
+		, m_lastTag(0x7FE0, 0x000F) // Just before PixelData
+	{
+		std::sort(m_options.tags.begin(), m_options.tags.end());
+		m_options.tags.erase(std::unique(m_options.tags.begin(), m_options.tags.end()), m_options.tags.end());
+		if (!m_options.tags.empty())
+			m_lastTag = m_options.tags.back();
+	}
+
+	IngestStatistics IngestPipeline::statistics() const
+	{
+		IngestStatistics statistics;
+		statistics.files = m_files;
+		statistics.dicomFiles = m_dicomFiles;
+		statistics.skippedFiles = m_skippedFiles;
+		statistics.errors = m_errors;
+		statistics.bytesRead = m_bytesRead;
+		const int64_t start = m_startTime, end = m_endTime;
+		if (start)
+			statistics.seconds = ((end ? end : now()) - start) / 1e6;
+		return statistics;
+	}
+
+	IngestStatistics IngestPipeline::run(const std::vector<std::string>& roots, const Consumer& consumer, const ErrorHandler& onError)
+	{
+		m_files = m_dicomFiles = m_skippedFiles = m_errors = m_bytesRead = 0;
+		m_endTime = 0;
+		m_startTime = now();
+
+		BoundedQueue<std::string> paths(m_options.queueSize * 4);
+		BoundedQueue<Item> items(m_options.queueSize);
+		std::atomic_bool aborted{false};
+
+		// Directories waiting to be listed, and those being listed
+		std::vector<std::string> directories(roots.rbegin(), roots.rend());
+		size_t pendingDirectories = directories.size();
+		std::mutex walkMutex;
+		std::condition_variable walkCondition;
+
+		const auto walk = [&]() {
+			while (true)
+			{
+				std::string path;
+				{
+					std::unique_lock<std::mutex> lock(walkMutex);
+					walkCondition.wait(lock, [&] { return aborted || !directories.empty() || !pendingDirectories; });
+					if (aborted || directories.empty())
+						return;
+					path = std::move(directories.back());
+					directories.pop_back();
+				}
+
+				const auto reportError = [&](const std::string& errorPath, const std::string& error) {
+					Item item;
+					item.record.path = errorPath;
+					item.error = error;
+					items.push(std::move(item));
+				};
+				const auto addFile = [&](const std::string& filePath) {
+					++m_files;
+					return paths.push(filePath);
+				};
+
+				boost::system::error_code error;
+				const auto status = m_options.followSymlinks ? fs::status(path, error) : fs::symlink_status(path, error);
+				if (error)
+					reportError(path, error.message());
+				else if (fs::is_regular_file(status))
+					addFile(path); // A root can be a file
+				else if (fs::is_directory(status))
+				{
+					std::vector<std::string> subdirectories;
+					fs::directory_iterator it(path, error), end;
+					for (; !error && it != end && !aborted; it.increment(error))
+					{
+						boost::system::error_code entryError;
+						const auto entryStatus = m_options.followSymlinks ? it->status(entryError) : it->symlink_status(entryError);
+						if (entryError)
+							reportError(it->path().string(), entryError.message());
+						else if (fs::is_directory(entryStatus))
+							subdirectories.push_back(it->path().string());
+						else if (fs::is_regular_file(entryStatus) && !addFile(it->path().string()))
+							break;
+					}
+					if (error)
+						reportError(path, error.message());
+
+					std::lock_guard<std::mutex> lock(walkMutex);
+					pendingDirectories += subdirectories.size();
+					directories.insert(directories.end(), subdirectories.begin(), subdirectories.end());
+				}
+
+				std::lock_guard<std::mutex> lock(walkMutex);
+				--pendingDirectories;
+				walkCondition.notify_all();
+			}
+		};
+
+		const auto parse = [&]() {
+			std::string path;
+			while (paths.pop(path))
+			{
+				Item item;
+				item.record.path = path;
+				try
+				{
+					uint64_t bytesRead = 0;
+					bool dicom = false;
+					if (m_options.plan)
+					{
+						ExtractionResult result;
+						dicom = readHeader(path, m_options.prefixSize, item.record.fileSize, bytesRead, [&](const BinaryBufferSPtr& buffer) {
+							result = m_options.plan->extractFile(buffer);
+							return result.complete;
+						});
+						item.record.transferSyntaxUID = std::move(result.transferSyntaxUID);
+						item.record.values = std::move(result.values);
+					}
+					else
+					{
+						FileDataSets header;
+						dicom = readHeader(path, m_options.prefixSize, item.record.fileSize, bytesRead, [&](const BinaryBufferSPtr& buffer) {
+							// The elements before the halt are complete
+							bool halted = false;
+							header = FileDataSets();
+							header = DataSetReader::readFile(buffer, [&halted, this](const Tag& tag) {
+								halted = m_lastTag < tag;
+								return halted;
+							});
+							return halted;
+						});
+						project(header, m_options.tags, m_lastTag, item.record);
+					}
+					m_bytesRead += bytesRead;
+					if (!dicom)
+					{
+						++m_skippedFiles;
+						continue;
+					}
+				}
+				catch (const std::exception& e)
+				{
+					item.error = errorMessage(e);
+				}
+
+				if (!items.push(std::move(item)))
+					return;
+			}
+		};
+
+		const auto nbParseThreads = m_options.nbParseThreads ? m_options.nbParseThreads : std::max(std::thread::hardware_concurrency(), 1u);
+		const auto nbWalkThreads = std::max(m_options.nbWalkThreads, 1u);
+		std::atomic<unsigned int> activeWalkers{nbWalkThreads}, activeParsers{nbParseThreads};
+
+		std::vector<std::thread> threads;
+		for (unsigned int i = 0; i < nbWalkThreads; ++i)
+		{
+			threads.emplace_back([&]() {
+				walk();
+				if (!--activeWalkers)
+					paths.close();
+			});
+		}
+		for (unsigned int i = 0; i < nbParseThreads; ++i)
+		{
+			threads.emplace_back([&]() {
+				parse();
+				if (!--activeParsers)
+					items.close();
+			});
+		}
+
+		std::exception_ptr exception;
+		try
+		{
+			Item item;
+			while (items.pop(item))
+			{
+				if (!item.error.empty())
+				{
+					++m_errors;
+					if (onError)
+						onError(item.record.path, item.error);
+				}
+				else
+				{
+					++m_dicomFiles;
+					consumer(std::move(item.record));
+				}
+			}
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+			{
+				std::lock_guard<std::mutex> lock(walkMutex);
+				aborted = true;
+				walkCondition.notify_all();
+			}
+			paths.abort();
+			items.abort();
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+		m_endTime = now();
+		if (exception)
+			std::rethrow_exception(exception);
+
+		return statistics();
+	}
+
+} // namespace emdl
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <emdl/dataset/reader/ExtractionPlan.h>
+#include <emdl/dataset/DataSet.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace emdl
+{
+	struct EMDL_API IngestOptions
+	{
+		//! Top level attributes to keep. The parsing stops after the last one. If empty, all the attributes before PixelData are kept.
+		std::vector<Tag> tags;
+
+		//! If set, the values of its paths (which can go into sequences) are extracted in IngestRecord::values, and the tags are ignored
+		std::shared_ptr<const ExtractionPlan> plan;
+
+		unsigned int nbParseThreads = 0; //!< Threads reading and parsing the files, the number of hardware threads if 0
+		unsigned int nbWalkThreads = 2; //!< Threads listing the directories
+		size_t queueSize = 256; //!< Maximum number of records waiting for the consumer (and 4 times as many paths waiting to be parsed)
+		size_t prefixSize = 16 * 1024; //!< Bytes read at once from the start of each file, grown only if the header is larger
+		bool followSymlinks = false;
+	};
+
+	//! Attributes of a DICOM file
+	struct EMDL_API IngestRecord
+	{
+		std::string path;
+		uint64_t fileSize = 0;
+		std::string transferSyntaxUID;
+		DataSet dataSet; //!< Parsed attributes kept by IngestOptions::tags
+		std::vector<std::vector<Element>> values; //!< Values of the paths of IngestOptions::plan, see ExtractionResult::values
+	};
+
+	struct EMDL_API IngestStatistics
+	{
+		uint64_t files = 0; //!< Files found by the directory walk
+		uint64_t dicomFiles = 0; //!< Records given to the consumer
+		uint64_t skippedFiles = 0; //!< Files without the DICM prefix
+		uint64_t errors = 0; //!< Files or directories that could not be read
+		uint64_t bytesRead = 0;
+		double seconds = 0;
+
+		double filesPerSecond() const;
+		double megabytesPerSecond() const;
+	};
+
+	//! Parallel reading of the headers of all the DICOM files found under directories.
+	//! Each file is read with a single prefix read (checking the preamble and parsing the header), and only the attributes of the projection are kept.
+	//! The queues between the directory walk, the parsing and the consumer are bounded, so the memory stays flat whatever the number of files.
+	class EMDL_API IngestPipeline
+	{
+	public:
+		using Consumer = std::function<void(IngestRecord&& record)>;
+		using ErrorHandler = std::function<void(const std::string& path, const std::string& error)>;
+
+		explicit IngestPipeline(IngestOptions options = {});
+
+		//! Walk the roots (directories or files), calling the consumer for each DICOM file, in no particular order.
+		//! The consumer and the error handler are called on the calling thread, so they do not need to be thread safe.
+		//! If the consumer throws, the pipeline stops and the exception is rethrown.
+		IngestStatistics run(const std::vector<std::string>& roots, const Consumer& consumer, const ErrorHandler& onError = {});
+
+		//! Statistics of the current or last run, can be called from the consumer to report the progress
+		IngestStatistics statistics() const;
+
+	private:
+		IngestOptions m_options;
+		Tag m_lastTag;
+
+		std::atomic<uint64_t> m_files{0}, m_dicomFiles{0}, m_skippedFiles{0}, m_errors{0}, m_bytesRead{0};
+		std::atomic<int64_t> m_startTime{0}, m_endTime{0}; // Steady clock, in microseconds
+	};
+
+} // namespace emdl
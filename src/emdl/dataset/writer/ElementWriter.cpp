@@ -47,7 +47,7 @@ namespace
 	bool needLargeLength(emdl::VR vr)
 	{
 		using VR = emdl::VR;
-		return vr == VR::OB || vr == VR::OD || vr == VR::OF || vr == VR::OL || vr == VR::OW || vr == VR::SQ || vr == VR::UC || vr == VR::UR || vr == VR::UT || vr == VR::UN;
+		return vr == VR::OB || vr == VR::OD || vr == VR::OF || vr == VR::OL || vr == VR::OV || vr == VR::OW || vr == VR::SQ || vr == VR::UC || vr == VR::UR || vr == VR::UT || vr == VR::UN;
 	}
 }
 
@@ -147,7 +147,7 @@ namespace emdl
 
 		case VR::SS:
 			for (const auto item : value)
-				write<int32_t>(static_cast<int32_t>(item));
+				write<int16_t>(static_cast<int16_t>(item));
 			break;
 
 		case VR::UL:
@@ -213,6 +213,30 @@ namespace emdl
 			throw Exception("Cannot write {} as reals", asString(m_vr));
 	}
 
+	void ElementWriter::WriterVisitor::operator()(const EncodedNumbers& value) const
+	{
+		if (value.vr == m_vr) // Already in the right encoding
+		{
+			m_stream.write(static_cast<const char*>(value.data.data()), value.size() * value.width());
+			TEST_STREAM
+		}
+		else if (value.isIntegers())
+			(*this)(value.toIntegers());
+		else
+			(*this)(value.toReals());
+	}
+
+	void ElementWriter::WriterVisitor::operator()(const EncodedStrings& value) const
+	{
+		if (value.vr == m_vr) // Already encoded, with its padding
+		{
+			m_stream.write(static_cast<const char*>(value.data.data()), value.data.size());
+			TEST_STREAM
+		}
+		else
+			(*this)(value.toStrings());
+	}
+
 	void ElementWriter::WriterVisitor::operator()(const Value::Strings& value) const
 	{
 		if (m_vr == VR::AT)
@@ -296,11 +320,13 @@ namespace emdl
 		{
 			writeTag(registry::Item);
 			const uint32_t length = static_cast<uint32_t>(fragment.size());
-			write(length);
+			write<uint32_t>(length + (length % 2)); // Items must have an even length
 
 			if (length)
 			{
 				m_stream.write(static_cast<const char*>(fragment.data()), length);
+				if (length % 2 == 1)
+					m_stream.put('\0');
 				TEST_STREAM
 			}
 		}
@@ -30,6 +30,8 @@ namespace emdl
 			void operator()(const Value::Strings& value) const;
 			void operator()(const Value::DataSets& value) const;
 			void operator()(const Value::Binaries& value) const;
+			void operator()(const EncodedNumbers& value) const;
+			void operator()(const EncodedStrings& value) const;
 
 		private:
 			void writeEncapsulatedPixelData(const Value::Binaries& value) const;
@@ -0,0 +1,360 @@
+#include <emdl/deidentification/Deidentifier.h>
+
+#include <emdl/dataset/reader/DataSetReader.h>
+#include <emdl/dataset/reader/ElementReader.h>
+#include <emdl/dataset/writer/DataSetWriter.h>
+#include <emdl/dataset/DataSetAccessors.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <algorithm>
+#include <fstream>
+
+namespace
+{
+	using namespace emdl;
+	using emdl::deidentification::Action;
+
+	// Reads the items of a UN element, encoded as a sequence in implicit VR little endian (PS3.5 6.2.2)
+	class UNSequenceReader : public ElementReader
+	{
+	public:
+		using ElementReader::ElementReader;
+
+		Value::DataSets readItems(uint32_t length)
+		{
+			return readDataSets(VR::SQ, length);
+		}
+	};
+
+	// Test whether the element is a sequence whose VR is not known: UN (or implicit VR) of undefined length, or UN with a sequence in the dictionary
+	bool isUNSequence(Tag tag, const ElementHeader& header)
+	{
+		if (header.vr == VR::Unknown) // Implicit VR, the sequences of the dictionary are parsed as such
+			return header.length == 0xFFFFFFFF && findVR(tag) != VR::SQ;
+		return header.vr == VR::UN && (header.length == 0xFFFFFFFF || findVR(tag) == VR::SQ);
+	}
+
+	// Test whether the element is a sequence without parsing it (the pixel data must stay untouched)
+	bool isSequence(const DataSet& dataSet, const DataSet::TagElementStruct& tes)
+	{
+		if (dataSet.isModified(tes))
+			return dataSet.getElement(tes).vr == VR::SQ;
+
+		BaseReader reader{{}, dataSet.getView(tes), dataSet.transferSyntax()};
+		ElementHeader header;
+		if (!reader.readElementHeader(header))
+			return false;
+		if (header.vr == VR::SQ || (header.vr == VR::Unknown && findVR(tes.tag) == VR::SQ))
+			return true;
+		return isUNSequence(tes.tag, header);
+	}
+
+	// Items of a UN sequence that has not been modified, or empty if the element is not one
+	boost::optional<Value::DataSets> readUNSequence(const DataSet& dataSet, Tag tag)
+	{
+		const auto view = dataSet.getUnmodifiedView(tag);
+		if (!view)
+			return {};
+
+		BaseReader reader{{}, *view, dataSet.transferSyntax()};
+		ElementHeader header;
+		if (!reader.readElementHeader(header) || !isUNSequence(tag, header))
+			return {};
+
+		const auto value = reader.getView(view->size() - reader.offset());
+		return UNSequenceReader({}, value, TransferSyntax::ImplicitVRLittleEndian).readItems(header.length);
+	}
+
+	Element dummyElement(VR vr)
+	{
+		switch (vr)
+		{
+		case VR::AS:
+			return Element({std::string("000Y")}, vr);
+		case VR::DA:
+			return Element({std::string("00010101")}, vr);
+		case VR::DT:
+			return Element({std::string("00010101000000")}, vr);
+		case VR::TM:
+			return Element({std::string("000000")}, vr);
+		case VR::DS:
+		case VR::IS:
+			return Element({std::string("0")}, vr);
+		case VR::UI: // Replaced by mapUID
+		case VR::UR:
+		case VR::SQ:
+			return Element(vr);
+		default:
+			break;
+		}
+
+		switch (vrType(vr))
+		{
+		case VRType::String:
+			return Element({std::string("ANONYMOUS")}, vr);
+		case VRType::Int:
+			return Element(Value::Integers{0}, vr);
+		case VRType::Real:
+			return Element(Value::Reals{0.0}, vr);
+		default:
+			return Element(vr);
+		}
+	}
+}
+
+namespace emdl
+{
+	namespace deidentification
+	{
+		Deidentifier::Deidentifier(Profile profile, UidGenerator generator, UIDMode mode)
+			: m_profile(std::move(profile))
+		{
+			if (mode == UIDMode::Hash)
+			{
+				if (!generator.hasKey())
+					throw Exception("{} The UID generator needs a secret key to hash the UIDs", LOG_POSITION);
+				m_mapper = [generator](const std::string& uid) {
+					return generator.remap(uid);
+				};
+				return;
+			}
+
+			m_mapper = [this, generator](const std::string& uid) {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				auto it = m_uids.find(uid);
+				if (it == m_uids.end())
+					it = m_uids.emplace(uid, generator.generate()).first;
+				return it->second;
+			};
+		}
+
+		Deidentifier::Deidentifier(Profile profile, UIDMapper mapper)
+			: m_profile(std::move(profile))
+			, m_mapper(std::move(mapper))
+		{
+			if (!m_mapper)
+				throw Exception("{} Empty UID mapper", LOG_POSITION);
+		}
+
+		void Deidentifier::apply(DataSet& dataSet) const
+		{
+			applyToDataSet(dataSet);
+
+			dataSet.set(registry::PatientIdentityRemoved, {std::string("YES")}, VR::CS);
+			dataSet.set(registry::DeidentificationMethod, {m_profile.description()}, VR::LO);
+			const auto temporal = m_profile.options().retainLongitudinalTemporal ? "UNMODIFIED" : "REMOVED";
+			dataSet.set(registry::LongitudinalTemporalInformationModified, {std::string(temporal)}, VR::CS);
+		}
+
+		void Deidentifier::apply(const std::string& inputPath, const std::string& outputPath) const
+		{
+			auto file = DataSetReader::readFile(inputPath);
+			apply(file.dataSet);
+
+			std::ofstream out(outputPath, std::ios_base::binary);
+			if (!out)
+				throw Exception("{} Cannot open file '{}'", LOG_POSITION, outputPath);
+
+			// The file meta information is created from the data set, the original one can contain identifying elements
+			DataSetWriter::writeFile(out, file.dataSet);
+			if (!out)
+				throw Exception("{} Cannot write file '{}'", LOG_POSITION, outputPath);
+		}
+
+		std::string Deidentifier::mapUID(const std::string& uid) const
+		{
+			return m_mapper(uid);
+		}
+
+		void Deidentifier::clearUIDs()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_uids.clear();
+		}
+
+		const Profile& Deidentifier::profile() const
+		{
+			return m_profile;
+		}
+
+		bool Deidentifier::applyToDataSet(DataSet& dataSet) const
+		{
+			// Decide everything first, as removing elements invalidates the structures we iterate on
+			std::vector<std::pair<Tag, Action>> actions;
+			std::vector<uint16_t> privateGroups;
+			for (const auto& group : dataSet.getGroups())
+			{
+				if (group.group & 1)
+				{
+					privateGroups.push_back(group.group);
+					continue;
+				}
+
+				for (const auto& tes : group.elements)
+				{
+					const auto action = m_profile.action(tes.tag);
+					if (action != Action::Keep || isSequence(dataSet, tes))
+						actions.emplace_back(tes.tag, action);
+				}
+			}
+
+			bool modified = false;
+			for (const auto& action : actions)
+				modified |= applyAction(dataSet, action.first, action.second);
+			for (const auto group : privateGroups)
+				modified |= applyToPrivateGroup(dataSet, group);
+
+			return modified;
+		}
+
+		bool Deidentifier::applyToPrivateGroup(DataSet& dataSet, uint16_t group) const
+		{
+			const auto& groups = dataSet.getGroups();
+			const auto itG = std::find_if(groups.begin(), groups.end(), [group](const DataSet::Group& g) {
+				return g.group == group;
+			});
+			if (itG == groups.end())
+				return false;
+
+			std::vector<std::pair<Tag, Action>> actions;
+			bool keptBlocks[256] = {};
+			for (const auto& tes : itG->elements)
+			{
+				const auto element = tes.tag.element;
+				if (element < 0x10) // Group length and reserved elements
+					actions.emplace_back(tes.tag, Action::Remove);
+				else if (element >= 0x100) // Private creators are handled once we know which blocks are kept
+				{
+					const auto action = m_profile.privateAction(registry::getPrivateTag(dataSet, tes.tag));
+					if (action != Action::Remove)
+						keptBlocks[element >> 8] = true;
+					if (action != Action::Keep)
+						actions.emplace_back(tes.tag, action);
+				}
+			}
+
+			for (const auto& tes : itG->elements)
+			{
+				const auto element = tes.tag.element;
+				if (element >= 0x10 && element < 0x100 && !keptBlocks[element])
+					actions.emplace_back(tes.tag, Action::Remove);
+			}
+
+			for (const auto& action : actions)
+				applyAction(dataSet, action.first, action.second);
+			return !actions.empty();
+		}
+
+		bool Deidentifier::applyAction(DataSet& dataSet, Tag tag, Action action) const
+		{
+			if (action == Action::Remove)
+			{
+				dataSet.remove(tag);
+				return true;
+			}
+
+			// Read access does not mark the element as modified
+			const auto& constDataSet = dataSet;
+
+			// The UN sequences are parsed as such, so that their items are de-identified too. They are removed if their items cannot be read.
+			if (action == Action::Keep)
+			{
+				boost::optional<Value::DataSets> items;
+				try
+				{
+					items = readUNSequence(constDataSet, tag);
+				}
+				catch (const Exception&)
+				{
+					dataSet.remove(tag);
+					return true;
+				}
+
+				if (items)
+				{
+					bool modified = false;
+					for (auto& item : *items)
+						modified |= applyToDataSet(item);
+					if (modified) // The items do not keep a reference to the buffer, they were read without it
+						dataSet.set(tag, detach(Element(std::move(*items), VR::SQ)));
+					return modified;
+				}
+			}
+
+			const auto element = constDataSet[tag];
+			if (!element)
+				return false;
+			const auto vr = element->vr;
+
+			switch (action)
+			{
+			case Action::Keep:
+			{
+				if (!element->isDataSet())
+					return false;
+
+				auto items = element->asDataSet();
+				bool modified = false;
+				for (auto& item : items)
+					modified |= applyToDataSet(item);
+				if (modified)
+					dataSet.set(tag, Element(std::move(items), VR::SQ));
+				return modified;
+			}
+
+			case Action::Empty:
+				if (element->empty())
+					return false;
+				dataSet.set(tag, Element(vr));
+				return true;
+
+			case Action::Dummy:
+				if (vr == VR::UI)
+					return applyAction(dataSet, tag, Action::ReplaceUID);
+				dataSet.set(tag, dummyElement(vr));
+				return true;
+
+			case Action::ReplaceUID:
+			{
+				if (!element->isString()) // The value cannot be replaced, and must not be kept
+				{
+					dataSet.remove(tag);
+					return true;
+				}
+
+				auto uids = element->asString();
+				for (auto& uid : uids)
+				{
+					if (!uid.empty())
+						uid = mapUID(uid);
+				}
+				dataSet.set(tag, Element(std::move(uids), vr));
+				return true;
+			}
+
+			default:
+				return false;
+			}
+		}
+
+		std::vector<std::string> deidentifyFiles(const Deidentifier& deidentifier, const std::vector<FileJob>& jobs, ThreadPool& pool)
+		{
+			std::vector<std::string> errors(jobs.size());
+			pool.parallelFor(jobs.size(), [&](size_t i) {
+				try
+				{
+					deidentifier.apply(jobs[i].input, jobs[i].output);
+				}
+				catch (const std::exception& e)
+				{
+					errors[i] = e.what();
+					if (errors[i].empty())
+						errors[i] = "Unknown error";
+				}
+			});
+			return errors;
+		}
+
+	} // namespace deidentification
+} // namespace emdl
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <emdl/deidentification/Profile.h>
+#include <emdl/dataset/DataSet.h>
+#include <emdl/IdGenerator.h>
+#include <emdl/ThreadPool.h>
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace emdl
+{
+	namespace deidentification
+	{
+		//! How the UIDs are replaced when using a UidGenerator
+		enum class UIDMode
+		{
+			Random, // New UIDs, kept in memory so that a UID is replaced the same way in all the files processed by this object (until clearUIDs)
+			Hash // UidGenerator::remap, consistent across batches and processes without keeping anything in memory (needs a generator with a key)
+		};
+
+		//! Apply a compiled profile to data sets and files
+		class EMDL_API Deidentifier
+		{
+		public:
+			//! Return the UID replacing the given one. Must be thread safe.
+			using UIDMapper = std::function<std::string(const std::string&)>;
+
+			//! The replacement UIDs are created by the generator. Throws in Hash mode if the generator has no key.
+			Deidentifier(Profile profile, UidGenerator generator, UIDMode mode = UIDMode::Random);
+
+			//! Use an external mapping of the UIDs
+			Deidentifier(Profile profile, UIDMapper mapper);
+
+			Deidentifier(const Deidentifier&) = delete;
+			Deidentifier& operator=(const Deidentifier&) = delete;
+
+			//! De-identify the data set in place, recursing into sequences.
+			//! Only the affected elements are modified: the others keep pointing into the original buffer and are copied as is when writing.
+			void apply(DataSet& dataSet) const;
+
+			//! Read, de-identify and write a file. The unmodified elements, including the pixel data, are copied from the input buffer.
+			void apply(const std::string& inputPath, const std::string& outputPath) const;
+
+			//! Return the UID replacing this one
+			std::string mapUID(const std::string& uid) const;
+
+			//! Forget the UIDs replaced in Random mode, which are kept until then: call it between unrelated batches of files.
+			//! The UIDs replaced afterwards get new replacements, even if they were already seen.
+			void clearUIDs();
+
+			const Profile& profile() const;
+
+		private:
+			bool applyToDataSet(DataSet& dataSet) const; // Returns true if the data set was modified
+			bool applyToPrivateGroup(DataSet& dataSet, uint16_t group) const;
+			bool applyAction(DataSet& dataSet, Tag tag, Action action) const;
+
+			Profile m_profile;
+			UIDMapper m_mapper;
+
+			mutable std::mutex m_mutex;
+			mutable std::unordered_map<std::string, std::string> m_uids;
+		};
+
+		//! Input and output paths of a file to de-identify
+		struct EMDL_API FileJob
+		{
+			std::string input, output;
+		};
+
+		//! De-identify the files in parallel.
+		//! Returns the error message of each file, empty for those that succeeded.
+		EMDL_API std::vector<std::string> deidentifyFiles(const Deidentifier& deidentifier, const std::vector<FileJob>& jobs,
+														  ThreadPool& pool = ThreadPool::global());
+
+	} // namespace deidentification
+} // namespace emdl
@@ -0,0 +1,392 @@
+#include <emdl/deidentification/Profile.h>
+
+#include <emdl/registry.h>
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+	using emdl::Tag;
+	namespace reg = emdl::registry;
+
+	struct TagCode
+	{
+		Tag tag;
+		const char* code;
+	};
+
+	// Attributes of PS3.15 Table E.1-1 with their Basic Profile code
+	const std::vector<TagCode>& getBasicProfile()
+	{
+		// clang-format off
+		static const std::vector<TagCode> profile = {
+			{reg::AccessionNumber, "Z"},
+			{reg::AcquisitionComments, "X"},
+			{reg::AcquisitionContextSequence, "X"},
+			{reg::AcquisitionDate, "X/Z"},
+			{reg::AcquisitionDateTime, "X/D"},
+			{reg::AcquisitionDeviceProcessingDescription, "X/D"},
+			{reg::AcquisitionProtocolDescription, "X"},
+			{reg::AcquisitionTime, "X/Z"},
+			{reg::ActualHumanPerformersSequence, "X"},
+			{reg::AdditionalPatientHistory, "X"},
+			{reg::AdmissionID, "X"},
+			{reg::AdmittingDate, "X"},
+			{reg::AdmittingDiagnosesCodeSequence, "X"},
+			{reg::AdmittingDiagnosesDescription, "X"},
+			{reg::AdmittingTime, "X"},
+			{reg::AffectedSOPInstanceUID, "X"},
+			{reg::Allergies, "X"},
+			{reg::Arbitrary, "X"},
+			{reg::AuthorObserverSequence, "X"},
+			{reg::BranchOfService, "X"},
+			{reg::CassetteID, "X"},
+			{reg::ConcatenationUID, "U"},
+			{reg::ConfidentialityConstraintOnPatientDataDescription, "X"},
+			{reg::ContentCreatorName, "Z"},
+			{reg::ContentCreatorIdentificationCodeSequence, "X"},
+			{reg::ContentDate, "Z/D"},
+			{reg::ContentTime, "Z/D"},
+			{reg::ContextGroupExtensionCreatorUID, "U"},
+			{reg::ContrastBolusAgent, "Z/D"},
+			{reg::ContributionDescription, "X"},
+			{reg::CountryOfResidence, "X"},
+			{reg::CreatorVersionUID, "U"},
+			{reg::CurrentPatientLocation, "X"},
+			{reg::CurveDate, "X"},
+			{reg::CurveTime, "X"},
+			{reg::CustodialOrganizationSequence, "X"},
+			{reg::DataSetTrailingPadding, "X"},
+			{reg::DerivationDescription, "X"},
+			{reg::DetectorID, "X"},
+			{reg::DeviceSerialNumber, "X/Z/D"},
+			{reg::DeviceUID, "U"},
+			{reg::DigitalSignatureUID, "X"},
+			{reg::DimensionOrganizationUID, "U"},
+			{reg::DischargeDiagnosisDescription, "X"},
+			{reg::DistributionAddress, "X"},
+			{reg::DistributionName, "X"},
+			{reg::DoseReferenceUID, "U"},
+			{reg::EthnicGroup, "X"},
+			{reg::FailedSOPInstanceUIDList, "U"},
+			{reg::FiducialUID, "U"},
+			{reg::FillerOrderNumberImagingServiceRequest, "Z"},
+			{reg::FrameComments, "X"},
+			{reg::FrameOfReferenceUID, "U"},
+			{reg::GantryID, "X"},
+			{reg::GeneratorID, "X"},
+			{reg::GraphicAnnotationSequence, "D"},
+			{reg::HumanPerformerName, "X"},
+			{reg::HumanPerformerOrganization, "X"},
+			{reg::IconImageSequence, "X"},
+			{reg::IdentifyingComments, "X"},
+			{reg::ImageComments, "X"},
+			{reg::ImagePresentationComments, "X"},
+			{reg::ImagingServiceRequestComments, "X"},
+			{reg::Impressions, "X"},
+			{reg::InstanceCreatorUID, "U"},
+			{reg::InstitutionAddress, "X"},
+			{reg::InstitutionCodeSequence, "X/Z/D"},
+			{reg::InstitutionName, "X/Z/D"},
+			{reg::InstitutionalDepartmentName, "X"},
+			{reg::InsurancePlanIdentification, "X"},
+			{reg::IntendedRecipientsOfResultsIdentificationSequence, "X"},
+			{reg::InterpretationApproverSequence, "X"},
+			{reg::InterpretationAuthor, "X"},
+			{reg::InterpretationDiagnosisDescription, "X"},
+			{reg::InterpretationIDIssuer, "X"},
+			{reg::InterpretationRecorder, "X"},
+			{reg::InterpretationText, "X"},
+			{reg::InterpretationTranscriber, "X"},
+			{reg::IrradiationEventUID, "U"},
+			{reg::IssuerOfAdmissionID, "X"},
+			{reg::IssuerOfPatientID, "X"},
+			{reg::IssuerOfServiceEpisodeID, "X"},
+			{reg::LargePaletteColorLookupTableUID, "U"},
+			{reg::MAC, "X"},
+			{reg::MedicalAlerts, "X"},
+			{reg::MedicalRecordLocator, "X"},
+			{reg::MilitaryRank, "X"},
+			{reg::ModifiedAttributesSequence, "X"},
+			{reg::ModifiedImageDescription, "X"},
+			{reg::ModifyingDeviceID, "X"},
+			{reg::ModifyingDeviceManufacturer, "X"},
+			{reg::NameOfPhysiciansReadingStudy, "X"},
+			{reg::NamesOfIntendedRecipientsOfResults, "X"},
+			{reg::Occupation, "X"},
+			{reg::OperatorIdentificationSequence, "X"},
+			{reg::OperatorsName, "X/Z/D"},
+			{reg::OriginalAttributesSequence, "X"},
+			{reg::OrderCallbackPhoneNumber, "X"},
+			{reg::OrderEnteredBy, "X"},
+			{reg::OrderEntererLocation, "X"},
+			{reg::OtherPatientIDs, "X"},
+			{reg::OtherPatientIDsSequence, "X"},
+			{reg::OtherPatientNames, "X"},
+			{reg::PaletteColorLookupTableUID, "U"},
+			{reg::ParticipantSequence, "X"},
+			{reg::PatientAddress, "X"},
+			{reg::PatientComments, "X"},
+			{reg::PatientID, "Z"},
+			{reg::PatientSexNeutered, "X/Z"},
+			{reg::PatientState, "X"},
+			{reg::PatientTransportArrangements, "X"},
+			{reg::PatientAge, "X"},
+			{reg::PatientBirthDate, "Z"},
+			{reg::PatientBirthName, "X"},
+			{reg::PatientBirthTime, "X"},
+			{reg::PatientInstitutionResidence, "X"},
+			{reg::PatientInsurancePlanCodeSequence, "X"},
+			{reg::PatientMotherBirthName, "X"},
+			{reg::PatientName, "Z"},
+			{reg::PatientPrimaryLanguageCodeSequence, "X"},
+			{reg::PatientPrimaryLanguageModifierCodeSequence, "X"},
+			{reg::PatientReligiousPreference, "X"},
+			{reg::PatientSex, "Z"},
+			{reg::PatientSize, "X"},
+			{reg::PatientTelephoneNumbers, "X"},
+			{reg::PatientWeight, "X"},
+			{reg::PerformedLocation, "X"},
+			{reg::PerformedProcedureStepDescription, "X"},
+			{reg::PerformedProcedureStepID, "X"},
+			{reg::PerformedProcedureStepStartDate, "X"},
+			{reg::PerformedProcedureStepStartTime, "X"},
+			{reg::PerformedStationAETitle, "X"},
+			{reg::PerformedStationGeographicLocationCodeSequence, "X"},
+			{reg::PerformedStationName, "X"},
+			{reg::PerformedStationNameCodeSequence, "X"},
+			{reg::PerformingPhysicianIdentificationSequence, "X"},
+			{reg::PerformingPhysicianName, "X"},
+			{reg::PersonAddress, "X"},
+			{reg::PersonIdentificationCodeSequence, "D"},
+			{reg::PersonName, "D"},
+			{reg::PersonTelephoneNumbers, "X"},
+			{reg::PhysicianApprovingInterpretation, "X"},
+			{reg::PhysiciansReadingStudyIdentificationSequence, "X"},
+			{reg::PhysiciansOfRecord, "X"},
+			{reg::PhysiciansOfRecordIdentificationSequence, "X"},
+			{reg::PlacerOrderNumberImagingServiceRequest, "Z"},
+			{reg::PlateID, "X"},
+			{reg::PreMedication, "X"},
+			{reg::PregnancyStatus, "X"},
+			{reg::ProtocolName, "X/D"},
+			{reg::ReasonForTheImagingServiceRequest, "X"},
+			{reg::ReasonForStudy, "X"},
+			{reg::ReferencedDigitalSignatureSequence, "X"},
+			{reg::ReferencedFrameOfReferenceUID, "U"},
+			{reg::ReferencedGeneralPurposeScheduledProcedureStepTransactionUID, "U"},
+			{reg::ReferencedImageSequence, "X/Z/U*"},
+			{reg::ReferencedPatientAliasSequence, "X"},
+			{reg::ReferencedPatientSequence, "X"},
+			{reg::ReferencedPerformedProcedureStepSequence, "X/Z/D"},
+			{reg::ReferencedSOPInstanceMACSequence, "X"},
+			{reg::ReferencedSOPInstanceUID, "U"},
+			{reg::ReferencedSOPInstanceUIDInFile, "U"},
+			{reg::ReferencedStudySequence, "X/Z"},
+			{reg::ReferringPhysicianAddress, "X"},
+			{reg::ReferringPhysicianIdentificationSequence, "X"},
+			{reg::ReferringPhysicianName, "Z"},
+			{reg::ReferringPhysicianTelephoneNumbers, "X"},
+			{reg::RegionOfResidence, "X"},
+			{reg::RelatedFrameOfReferenceUID, "U"},
+			{reg::RequestAttributesSequence, "X"},
+			{reg::RequestedContrastAgent, "X"},
+			{reg::RequestedProcedureComments, "X"},
+			{reg::RequestedProcedureDescription, "X/Z"},
+			{reg::RequestedProcedureID, "X"},
+			{reg::RequestedProcedureLocation, "X"},
+			{reg::RequestedSOPInstanceUID, "U"},
+			{reg::RequestingPhysician, "X"},
+			{reg::RequestingService, "X"},
+			{reg::ResponsibleOrganization, "X"},
+			{reg::ResponsiblePerson, "X"},
+			{reg::ResultsComments, "X"},
+			{reg::ResultsDistributionListSequence, "X"},
+			{reg::ResultsIDIssuer, "X"},
+			{reg::ReviewerName, "X/Z"},
+			{reg::ScheduledHumanPerformersSequence, "X"},
+			{reg::ScheduledPatientInstitutionResidence, "X"},
+			{reg::ScheduledPerformingPhysicianIdentificationSequence, "X"},
+			{reg::ScheduledPerformingPhysicianName, "X"},
+			{reg::ScheduledProcedureStepEndDate, "X"},
+			{reg::ScheduledProcedureStepEndTime, "X"},
+			{reg::ScheduledProcedureStepDescription, "X"},
+			{reg::ScheduledProcedureStepLocation, "X"},
+			{reg::ScheduledProcedureStepStartDate, "X"},
+			{reg::ScheduledProcedureStepStartTime, "X"},
+			{reg::ScheduledStationAETitle, "X"},
+			{reg::ScheduledStationGeographicLocationCodeSequence, "X"},
+			{reg::ScheduledStationName, "X"},
+			{reg::ScheduledStationNameCodeSequence, "X"},
+			{reg::ScheduledStudyLocation, "X"},
+			{reg::ScheduledStudyLocationAETitle, "X"},
+			{reg::SeriesDate, "X/D"},
+			{reg::SeriesDescription, "X"},
+			{reg::SeriesInstanceUID, "U"},
+			{reg::SeriesTime, "X/D"},
+			{reg::ServiceEpisodeDescription, "X"},
+			{reg::ServiceEpisodeID, "X"},
+			{reg::SmokingStatus, "X"},
+			{reg::SOPInstanceUID, "U"},
+			{reg::SourceImageSequence, "X/Z/U*"},
+			{reg::SpecialNeeds, "X"},
+			{reg::StationName, "X/Z/D"},
+			{reg::StorageMediaFileSetUID, "U"},
+			{reg::StudyComments, "X"},
+			{reg::StudyDate, "Z"},
+			{reg::StudyDescription, "X"},
+			{reg::StudyID, "Z"},
+			{reg::StudyIDIssuer, "X"},
+			{reg::StudyInstanceUID, "U"},
+			{reg::StudyTime, "Z"},
+			{reg::SynchronizationFrameOfReferenceUID, "U"},
+			{reg::TemplateExtensionCreatorUID, "U"},
+			{reg::TemplateExtensionOrganizationUID, "U"},
+			{reg::TextComments, "X"},
+			{reg::TextString, "X"},
+			{reg::TimezoneOffsetFromUTC, "X"},
+			{reg::TopicAuthor, "X"},
+			{reg::TopicKeywords, "X"},
+			{reg::TopicSubject, "X"},
+			{reg::TopicTitle, "X"},
+			{reg::TransactionUID, "U"},
+			{reg::UID, "U"},
+			{reg::VerifyingObserverIdentificationCodeSequence, "Z"},
+			{reg::VerifyingObserverName, "D"},
+			{reg::VerifyingObserverSequence, "D"},
+			{reg::VerifyingOrganization, "X"},
+			{reg::VisitComments, "X"},
+		};
+		// clang-format on
+
+		return profile;
+	}
+
+	const std::vector<Tag> deviceIdentity = {
+		reg::CassetteID, reg::DetectorID, reg::DeviceSerialNumber, reg::DeviceUID, reg::GantryID, reg::GeneratorID,
+		reg::ModifyingDeviceID, reg::ModifyingDeviceManufacturer, reg::PerformedStationAETitle, reg::PerformedStationName,
+		reg::PlateID, reg::ScheduledStationAETitle, reg::ScheduledStationName, reg::StationName};
+
+	const std::vector<Tag> institutionIdentity = {
+		reg::InstitutionAddress, reg::InstitutionCodeSequence, reg::InstitutionName, reg::InstitutionalDepartmentName};
+
+	const std::vector<Tag> patientCharacteristics = {
+		reg::AdditionalPatientHistory, reg::Allergies, reg::EthnicGroup, reg::MedicalAlerts, reg::PatientAge,
+		reg::PatientSex, reg::PatientSexNeutered, reg::PatientSize, reg::PatientState, reg::PatientWeight,
+		reg::PregnancyStatus, reg::SmokingStatus, reg::SpecialNeeds};
+
+	const std::vector<Tag> longitudinalTemporal = {
+		reg::AcquisitionDate, reg::AcquisitionDateTime, reg::AcquisitionTime, reg::AdmittingDate, reg::AdmittingTime,
+		reg::ContentDate, reg::ContentTime, reg::CurveDate, reg::CurveTime, reg::PerformedProcedureStepStartDate,
+		reg::PerformedProcedureStepStartTime, reg::ScheduledProcedureStepEndDate, reg::ScheduledProcedureStepEndTime,
+		reg::ScheduledProcedureStepStartDate, reg::ScheduledProcedureStepStartTime, reg::SeriesDate, reg::SeriesTime,
+		reg::StudyDate, reg::StudyTime, reg::TimezoneOffsetFromUTC};
+}
+
+namespace emdl
+{
+	namespace deidentification
+	{
+		Action actionFromCode(const char* code)
+		{
+			if (!code || !*code || !std::strcmp(code, "K"))
+				return Action::Keep;
+			if (std::strstr(code, "U*")) // Sequence containing UIDs to replace
+				return Action::Keep;
+			if (std::strchr(code, 'U'))
+				return Action::ReplaceUID;
+			if (std::strchr(code, 'D')) // Dummy is valid whenever the element is required (type 1)
+				return Action::Dummy;
+			if (std::strchr(code, 'Z') || std::strchr(code, 'C'))
+				return Action::Empty;
+			return Action::Remove;
+		}
+
+		Action actionFromPrivateCode(const char* code)
+		{
+			if (!code)
+				return Action::Remove;
+			if (!std::strcmp(code, "K") || !std::strcmp(code, "KB") || !std::strcmp(code, "F"))
+				return Action::Keep;
+			if (!std::strcmp(code, "Z"))
+				return Action::Empty;
+			return Action::Remove; // X, R and unknown codes
+		}
+
+		Profile::Profile(const Options& options)
+			: m_options(options)
+		{
+			const auto& profile = getBasicProfile();
+			m_actions.reserve(profile.size());
+			for (const auto& tc : profile)
+				m_actions.emplace(tc.tag, actionFromCode(tc.code));
+
+			m_description = "Basic Application Confidentiality Profile";
+			const auto retain = [this](const std::vector<Tag>& tags, const char* name) {
+				for (const auto tag : tags)
+					m_actions[tag] = Action::Keep;
+				m_description += ", ";
+				m_description += name;
+			};
+
+			if (options.retainUIDs)
+			{
+				for (auto& it : m_actions)
+				{
+					if (it.second == Action::ReplaceUID)
+						it.second = Action::Keep;
+				}
+				m_description += ", Retain UIDs";
+			}
+			if (options.retainDeviceIdentity)
+				retain(deviceIdentity, "Retain Device Identity");
+			if (options.retainInstitutionIdentity)
+				retain(institutionIdentity, "Retain Institution Identity");
+			if (options.retainPatientCharacteristics)
+				retain(patientCharacteristics, "Retain Patient Characteristics");
+			if (options.retainLongitudinalTemporal)
+				retain(longitudinalTemporal, "Retain Longitudinal Temporal Information Full Dates");
+			if (options.retainSafePrivate)
+				m_description += ", Retain Safe Private";
+		}
+
+		void Profile::setAction(Tag tag, Action action)
+		{
+			m_actions[tag] = action;
+		}
+
+		Action Profile::action(Tag tag) const
+		{
+			const auto it = m_actions.find(tag);
+			if (it != m_actions.end())
+				return it->second;
+
+			// Repeating groups: curve data (50xx,xxxx), overlay data (60xx,3000) and overlay comments (60xx,4000)
+			if ((tag.group & 0xFF00) == 0x5000)
+				return Action::Remove;
+			if ((tag.group & 0xFF00) == 0x6000 && (tag.element == 0x3000 || tag.element == 0x4000))
+				return Action::Remove;
+
+			return Action::Keep;
+		}
+
+		Action Profile::privateAction(const PrivateDictionaryEntry* entry) const
+		{
+			if (!m_options.retainSafePrivate || !entry)
+				return Action::Remove;
+			return actionFromPrivateCode(entry->code);
+		}
+
+		const Options& Profile::options() const
+		{
+			return m_options;
+		}
+
+		const std::string& Profile::description() const
+		{
+			return m_description;
+		}
+
+	} // namespace deidentification
+} // namespace emdl
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <emdl/PrivateDictionary.h>
+#include <emdl/Tag.h>
+
+#include <string>
+
+#include <boost/container/flat_map.hpp>
+
+namespace emdl
+{
+	namespace deidentification
+	{
+		//! What is done to an element during the de-identification
+		enum class Action : uint8_t
+		{
+			Keep, // Copied unchanged (sequences are still inspected)
+			Remove, // X: the element is removed
+			Empty, // Z: the element is replaced by an empty value
+			Dummy, // D: the value is replaced by a dummy value of the same VR
+			ReplaceUID // U: each UID is replaced, consistently in all the processed files
+		};
+
+		//! Convert a code of PS3.15 Table E.1-1 (X, Z, D, U, K, C and their combinations like X/Z/D) to an action.
+		//! Combined codes use the least destructive action valid for all IODs, "U*" sequences are kept and inspected.
+		EMDL_API Action actionFromCode(const char* code);
+
+		//! Convert the code of a private dictionary entry (K, KB, F, Z, X, R) to an action
+		EMDL_API Action actionFromPrivateCode(const char* code);
+
+		//! Options of the Basic Application Level Confidentiality Profile
+		struct EMDL_API Options
+		{
+			bool retainUIDs = false; // Keep the UIDs of the instances
+			bool retainDeviceIdentity = false; // Keep serial numbers, station names and device identifiers
+			bool retainInstitutionIdentity = false; // Keep the name and address of the institution
+			bool retainPatientCharacteristics = false; // Keep age, sex, size, weight and the other physical characteristics
+			bool retainLongitudinalTemporal = false; // Keep the dates and times
+			bool retainSafePrivate = false; // Keep the private elements marked as safe in the private dictionary, remove the others
+		};
+
+		//! Action of each element, compiled once from the basic profile and its options
+		class EMDL_API Profile
+		{
+		public:
+			explicit Profile(const Options& options = {});
+
+			//! Override the action of a public tag
+			void setAction(Tag tag, Action action);
+
+			//! Action for a public tag, Keep if the profile does not list it.
+			//! Overlay comments and data and curve data are handled by their group.
+			Action action(Tag tag) const;
+
+			//! Action for a private element, given its dictionary entry (null if it is not in the dictionary)
+			Action privateAction(const PrivateDictionaryEntry* entry) const;
+
+			const Options& options() const;
+
+			//! Value written in DeidentificationMethod
+			const std::string& description() const;
+
+		private:
+			Options m_options;
+			boost::container::flat_map<Tag, Action> m_actions;
+			std::string m_description;
+		};
+
+	} // namespace deidentification
+} // namespace emdl
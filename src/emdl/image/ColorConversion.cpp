@@ -0,0 +1,441 @@
+#include <emdl/image/ColorConversion.h>
+#include <emdl/image/Simd.h>
+#include <emdl/Exception.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+	using namespace emdl;
+	using namespace emdl::simd;
+
+	// Pixels converted at a time, through planar buffers on the stack
+	const size_t chunkSize = 512;
+
+	// YBR_FULL to RGB coefficients (fractional parts in Q15), see PS3.3 C.7.6.3.1.2
+	const int16_t crToR = 13173; // 1.402 - 1
+	const int16_t cbToG = 11277; // 0.344136
+	const int16_t crToG = 23401; // 0.714136
+	const int16_t cbToB = 25297; // 1.772 - 1
+
+	// Rounded Q15 multiplication, as done by pmulhrsw
+	inline int32_t mulQ15(int32_t a, int16_t b)
+	{
+		return (a * b + 0x4000) >> 15;
+	}
+
+	inline uint8_t clamp8(int32_t value)
+	{
+		return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+	}
+
+	/*****************************************************************************/
+	// Scalar kernels
+
+	void interleave3Scalar(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			out[i * 3] = r[i];
+			out[i * 3 + 1] = g[i];
+			out[i * 3 + 2] = b[i];
+		}
+	}
+
+	void deinterleave3Scalar(const uint8_t* in, uint8_t* r, uint8_t* g, uint8_t* b, size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			r[i] = in[i * 3];
+			g[i] = in[i * 3 + 1];
+			b[i] = in[i * 3 + 2];
+		}
+	}
+
+	// In place conversion of planar YBR_FULL to planar RGB
+	void ybrToRGBScalar(uint8_t* y, uint8_t* cb, uint8_t* cr, size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			const int32_t luma = y[i], blue = cb[i] - 128, red = cr[i] - 128;
+			y[i] = clamp8(luma + red + mulQ15(red, crToR));
+			cb[i] = clamp8(luma - mulQ15(blue, cbToG) - mulQ15(red, crToG));
+			cr[i] = clamp8(luma + blue + mulQ15(blue, cbToB));
+		}
+	}
+
+	void inverseRCTScalar(const int32_t* y, const int32_t* cb, const int32_t* cr, uint8_t* r, uint8_t* g, uint8_t* b, size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			const int32_t green = y[i] - ((cb[i] + cr[i]) >> 2);
+			r[i] = clamp8(cr[i] + green + 128);
+			g[i] = clamp8(green + 128);
+			b[i] = clamp8(cb[i] + green + 128);
+		}
+	}
+
+	void inverseICTScalar(const int32_t* y, const int32_t* cb, const int32_t* cr, uint8_t* r, uint8_t* g, uint8_t* b, size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			const float luma = static_cast<float>(y[i]) + 128.0f, blue = static_cast<float>(cb[i]), red = static_cast<float>(cr[i]);
+			r[i] = clamp8(static_cast<int32_t>(std::nearbyint(luma + red * 1.402f)));
+			g[i] = clamp8(static_cast<int32_t>(std::nearbyint(luma - blue * 0.344136f - red * 0.714136f)));
+			b[i] = clamp8(static_cast<int32_t>(std::nearbyint(luma + blue * 1.772f)));
+		}
+	}
+
+	/*****************************************************************************/
+
+#ifdef EMDL_AVX2
+	// pshufb masks moving 16 pixels between 3 planes and 48 interleaved bytes: masks[k][c] selects the bytes of plane c in the k-th 16 bytes
+	struct ShuffleMasks
+	{
+		alignas(16) int8_t interleave[3][3][16];
+		alignas(16) int8_t deinterleave[3][3][16];
+
+		ShuffleMasks()
+		{
+			for (int k = 0; k < 3; ++k)
+			{
+				for (int c = 0; c < 3; ++c)
+				{
+					for (int t = 0; t < 16; ++t)
+					{
+						const int j = 16 * k + t; // Interleaved byte
+						interleave[k][c][t] = static_cast<int8_t>((j % 3 == c) ? j / 3 : -1);
+						const int i = 3 * t + c; // Interleaved byte of the sample t of plane c
+						deinterleave[k][c][t] = static_cast<int8_t>((i / 16 == k) ? i % 16 : -1);
+					}
+				}
+			}
+		}
+	};
+
+	const ShuffleMasks& shuffleMasks()
+	{
+		static const ShuffleMasks masks;
+		return masks;
+	}
+
+	inline __m128i loadMask(const int8_t* mask)
+	{
+		return _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+	}
+
+	EMDL_TARGET_AVX2 void interleave3AVX2(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, size_t n)
+	{
+		const auto& masks = shuffleMasks();
+		size_t i = 0;
+		for (; i + 16 <= n; i += 16)
+		{
+			const __m128i planes[3] = {_mm_loadu_si128(reinterpret_cast<const __m128i*>(r + i)),
+									   _mm_loadu_si128(reinterpret_cast<const __m128i*>(g + i)),
+									   _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i))};
+			for (int k = 0; k < 3; ++k)
+			{
+				const auto bytes = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(planes[0], loadMask(masks.interleave[k][0])),
+															 _mm_shuffle_epi8(planes[1], loadMask(masks.interleave[k][1]))),
+												_mm_shuffle_epi8(planes[2], loadMask(masks.interleave[k][2])));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 3 + k * 16), bytes);
+			}
+		}
+		interleave3Scalar(r + i, g + i, b + i, out + i * 3, n - i);
+	}
+
+	EMDL_TARGET_AVX2 void deinterleave3AVX2(const uint8_t* in, uint8_t* r, uint8_t* g, uint8_t* b, size_t n)
+	{
+		const auto& masks = shuffleMasks();
+		uint8_t* planes[3] = {r, g, b};
+		size_t i = 0;
+		for (; i + 16 <= n; i += 16)
+		{
+			const __m128i bytes[3] = {_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 3)),
+									  _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 3 + 16)),
+									  _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 3 + 32))};
+			for (int c = 0; c < 3; ++c)
+			{
+				const auto plane = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(bytes[0], loadMask(masks.deinterleave[0][c])),
+															 _mm_shuffle_epi8(bytes[1], loadMask(masks.deinterleave[1][c]))),
+												_mm_shuffle_epi8(bytes[2], loadMask(masks.deinterleave[2][c])));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(planes[c] + i), plane);
+			}
+		}
+		deinterleave3Scalar(in + i * 3, r + i, g + i, b + i, n - i);
+	}
+
+	// Narrow 16 values of 16 bits to unsigned 8 bits with saturation, and store them
+	EMDL_TARGET_AVX2 inline void store16(uint8_t* out, __m256i values)
+	{
+		const auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(values, values), 0xd8);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(packed));
+	}
+
+	EMDL_TARGET_AVX2 inline __m256i load16(const uint8_t* in)
+	{
+		return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+	}
+
+	EMDL_TARGET_AVX2 void ybrToRGBAVX2(uint8_t* y, uint8_t* cb, uint8_t* cr, size_t n)
+	{
+		const auto offset = _mm256_set1_epi16(128);
+		const auto vcrToR = _mm256_set1_epi16(crToR), vcbToG = _mm256_set1_epi16(cbToG);
+		const auto vcrToG = _mm256_set1_epi16(crToG), vcbToB = _mm256_set1_epi16(cbToB);
+		size_t i = 0;
+		for (; i + 16 <= n; i += 16)
+		{
+			const auto luma = load16(y + i);
+			const auto blue = _mm256_sub_epi16(load16(cb + i), offset);
+			const auto red = _mm256_sub_epi16(load16(cr + i), offset);
+			const auto r = _mm256_add_epi16(_mm256_add_epi16(luma, red), _mm256_mulhrs_epi16(red, vcrToR));
+			const auto g = _mm256_sub_epi16(_mm256_sub_epi16(luma, _mm256_mulhrs_epi16(blue, vcbToG)), _mm256_mulhrs_epi16(red, vcrToG));
+			const auto b = _mm256_add_epi16(_mm256_add_epi16(luma, blue), _mm256_mulhrs_epi16(blue, vcbToB));
+			store16(y + i, r);
+			store16(cb + i, g);
+			store16(cr + i, b);
+		}
+		ybrToRGBScalar(y + i, cb + i, cr + i, n - i);
+	}
+
+	// Narrow 8 values of 32 bits to unsigned 8 bits with saturation, and store them
+	EMDL_TARGET_AVX2 inline void store8(uint8_t* out, __m256i values)
+	{
+		const auto words = _mm_packs_epi32(_mm256_castsi256_si128(values), _mm256_extracti128_si256(values, 1));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(words, words));
+	}
+
+	EMDL_TARGET_AVX2 void inverseRCTAVX2(const int32_t* y, const int32_t* cb, const int32_t* cr, uint8_t* r, uint8_t* g, uint8_t* b, size_t n)
+	{
+		const auto offset = _mm256_set1_epi32(128);
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8)
+		{
+			const auto luma = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i));
+			const auto blue = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cb + i));
+			const auto red = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cr + i));
+			const auto green = _mm256_add_epi32(_mm256_sub_epi32(luma, _mm256_srai_epi32(_mm256_add_epi32(blue, red), 2)), offset);
+			store8(r + i, _mm256_add_epi32(red, green));
+			store8(g + i, green);
+			store8(b + i, _mm256_add_epi32(blue, green));
+		}
+		inverseRCTScalar(y + i, cb + i, cr + i, r + i, g + i, b + i, n - i);
+	}
+
+	EMDL_TARGET_AVX2 void inverseICTAVX2(const int32_t* y, const int32_t* cb, const int32_t* cr, uint8_t* r, uint8_t* g, uint8_t* b, size_t n)
+	{
+		const auto offset = _mm256_set1_ps(128.0f);
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8)
+		{
+			const auto luma = _mm256_add_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i))), offset);
+			const auto blue = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(cb + i)));
+			const auto red = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(cr + i)));
+			const auto vr = _mm256_add_ps(luma, _mm256_mul_ps(red, _mm256_set1_ps(1.402f)));
+			const auto vg = _mm256_sub_ps(_mm256_sub_ps(luma, _mm256_mul_ps(blue, _mm256_set1_ps(0.344136f))), _mm256_mul_ps(red, _mm256_set1_ps(0.714136f)));
+			const auto vb = _mm256_add_ps(luma, _mm256_mul_ps(blue, _mm256_set1_ps(1.772f)));
+			store8(r + i, _mm256_cvtps_epi32(vr));
+			store8(g + i, _mm256_cvtps_epi32(vg));
+			store8(b + i, _mm256_cvtps_epi32(vb));
+		}
+		inverseICTScalar(y + i, cb + i, cr + i, r + i, g + i, b + i, n - i);
+	}
+#endif
+
+	/*****************************************************************************/
+
+	bool useAVX2()
+	{
+		return getInstructionSet() == InstructionSet::AVX2;
+	}
+
+	void interleave3(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, size_t n)
+	{
+#ifdef EMDL_AVX2
+		if (useAVX2())
+			return interleave3AVX2(r, g, b, out, n);
+#endif
+		interleave3Scalar(r, g, b, out, n);
+	}
+
+	void deinterleave3(const uint8_t* in, uint8_t* r, uint8_t* g, uint8_t* b, size_t n)
+	{
+#ifdef EMDL_AVX2
+		if (useAVX2())
+			return deinterleave3AVX2(in, r, g, b, n);
+#endif
+		deinterleave3Scalar(in, r, g, b, n);
+	}
+
+	void ybrToRGB(uint8_t* y, uint8_t* cb, uint8_t* cr, size_t n)
+	{
+#ifdef EMDL_AVX2
+		if (useAVX2())
+			return ybrToRGBAVX2(y, cb, cr, n);
+#endif
+		ybrToRGBScalar(y, cb, cr, n);
+	}
+
+	// Read chunkSize pixels (or less) of a frame into planes
+	void loadChunk(const uint8_t* frame, const codec::ImageInfo& info, size_t start, size_t n, uint8_t* planes[3])
+	{
+		const size_t nbPixels = static_cast<size_t>(info.rows) * info.columns;
+		if (info.photometricInterpretation == "YBR_FULL_422")
+		{
+			// Y1 Y2 Cb Cr for each pair of pixels, the chunks start on even pixels
+			const uint8_t* src = frame + start * 2;
+			for (size_t i = 0; i < n; i += 2)
+			{
+				planes[0][i] = src[i * 2];
+				planes[1][i] = src[i * 2 + 2];
+				planes[2][i] = src[i * 2 + 3];
+				if (i + 1 < n)
+				{
+					planes[0][i + 1] = src[i * 2 + 1];
+					planes[1][i + 1] = src[i * 2 + 2];
+					planes[2][i + 1] = src[i * 2 + 3];
+				}
+			}
+		}
+		else if (info.planarConfiguration == 1)
+		{
+			for (size_t c = 0; c < 3; ++c)
+				std::memcpy(planes[c], frame + c * nbPixels + start, n);
+		}
+		else
+			deinterleave3(frame + start * 3, planes[0], planes[1], planes[2], n);
+	}
+
+	template <class Kernel>
+	void generic(const uint8_t* input, uint8_t* output, size_t nbPixels, size_t nbSamples, size_t bytesPerSample, Kernel kernel)
+	{
+		for (size_t p = 0; p < nbPixels; ++p)
+		{
+			for (size_t s = 0; s < nbSamples; ++s)
+				kernel(input, output, (p * nbSamples + s) * bytesPerSample, (s * nbPixels + p) * bytesPerSample);
+		}
+	}
+
+	template <class Kernel>
+	void componentsToRGB(const int32_t* y, const int32_t* cb, const int32_t* cr, size_t nbPixels, ArrayView<uint8_t> output, Kernel kernel)
+	{
+		if (output.size() < nbPixels * 3)
+			throw Exception("{} Output buffer too small: {} bytes for {} RGB pixels", LOG_POSITION, output.size(), nbPixels);
+
+		uint8_t buffers[3][chunkSize];
+		for (size_t start = 0; start < nbPixels; start += chunkSize)
+		{
+			const size_t n = std::min(chunkSize, nbPixels - start);
+			kernel(y + start, cb + start, cr + start, buffers[0], buffers[1], buffers[2], n);
+			interleave3(buffers[0], buffers[1], buffers[2], output.begin() + start * 3, n);
+		}
+	}
+}
+
+namespace emdl
+{
+	namespace image
+	{
+		void planarToInterleaved(const uint8_t* input, uint8_t* output, size_t nbPixels, size_t nbSamples, size_t bytesPerSample)
+		{
+			if (nbSamples == 3 && bytesPerSample == 1)
+				return interleave3(input, input + nbPixels, input + 2 * nbPixels, output, nbPixels);
+			generic(input, output, nbPixels, nbSamples, bytesPerSample, [bytesPerSample](const uint8_t* in, uint8_t* out, size_t interleaved, size_t planar) {
+				std::memcpy(out + interleaved, in + planar, bytesPerSample);
+			});
+		}
+
+		void interleavedToPlanar(const uint8_t* input, uint8_t* output, size_t nbPixels, size_t nbSamples, size_t bytesPerSample)
+		{
+			if (nbSamples == 3 && bytesPerSample == 1)
+				return deinterleave3(input, output, output + nbPixels, output + 2 * nbPixels, nbPixels);
+			generic(input, output, nbPixels, nbSamples, bytesPerSample, [bytesPerSample](const uint8_t* in, uint8_t* out, size_t interleaved, size_t planar) {
+				std::memcpy(out + planar, in + interleaved, bytesPerSample);
+			});
+		}
+
+		size_t nativeFrameSize(const codec::ImageInfo& info)
+		{
+			if (info.photometricInterpretation == "YBR_FULL_422")
+				return static_cast<size_t>(info.rows) * info.columns * 2 * (info.bitsAllocated / 8);
+			return info.frameSize();
+		}
+
+		void convertToRGB(BinaryValue::view_type frame, const codec::ImageInfo& info, ArrayView<uint8_t> output)
+		{
+			const auto& photometric = info.photometricInterpretation;
+			const bool isYBR = (photometric == "YBR_FULL" || photometric == "YBR_FULL_422");
+			if (!isYBR && photometric != "RGB" && photometric != "YBR_ICT" && photometric != "YBR_RCT")
+				throw Exception("{} Cannot convert {} to RGB", LOG_POSITION, photometric);
+			if (info.samplesPerPixel != 3 || info.bitsAllocated != 8)
+				throw Exception("{} Only 8 bits frames with 3 samples per pixel can be converted to RGB", LOG_POSITION);
+			if (photometric == "YBR_FULL_422" && info.columns % 2 == 1) // The chroma samples are shared by pairs of pixels of a row
+				throw Exception("{} YBR_FULL_422 frames must have an even number of columns, not {}", LOG_POSITION, info.columns);
+
+			const size_t nbPixels = static_cast<size_t>(info.rows) * info.columns;
+			if (frame.size() < nativeFrameSize(info))
+				throw Exception("{} Frame too small: {} bytes instead of {}", LOG_POSITION, frame.size(), nativeFrameSize(info));
+			if (output.size() < nbPixels * 3)
+				throw Exception("{} Output buffer too small: {} bytes for {} RGB pixels", LOG_POSITION, output.size(), nbPixels);
+
+			const auto input = static_cast<const uint8_t*>(frame.data());
+			if (!isYBR)
+			{
+				if (info.planarConfiguration == 1)
+					planarToInterleaved(input, output.begin(), nbPixels, 3, 1);
+				else
+					std::memcpy(output.begin(), input, nbPixels * 3);
+				return;
+			}
+
+			uint8_t buffers[3][chunkSize];
+			uint8_t* planes[3] = {buffers[0], buffers[1], buffers[2]};
+			for (size_t start = 0; start < nbPixels; start += chunkSize)
+			{
+				const size_t n = std::min(chunkSize, nbPixels - start);
+				loadChunk(input, info, start, n, planes);
+				ybrToRGB(planes[0], planes[1], planes[2], n);
+				interleave3(planes[0], planes[1], planes[2], output.begin() + start * 3, n);
+			}
+		}
+
+		void convertFramesToRGB(BinaryValue::view_type input, size_t inputStride, const codec::ImageInfo& info, ArrayView<uint8_t> output, ThreadPool& pool)
+		{
+			const size_t frameSize = nativeFrameSize(info);
+			if (!inputStride)
+				inputStride = frameSize;
+			const size_t outputStride = alignSize(static_cast<size_t>(info.rows) * info.columns * 3);
+
+			if (info.numberOfFrames && input.size() < (info.numberOfFrames - 1) * inputStride + frameSize)
+				throw Exception("{} Input buffer too small for {} frames", LOG_POSITION, info.numberOfFrames);
+			if (output.size() < info.numberOfFrames * outputStride)
+				throw Exception("{} Output buffer too small: {} bytes for {} frames of {} bytes", LOG_POSITION, output.size(), info.numberOfFrames, outputStride);
+
+			const auto data = static_cast<const uint8_t*>(input.data());
+			pool.parallelFor(info.numberOfFrames, [&](size_t i) {
+				convertToRGB({data + i * inputStride, frameSize}, info, {output.begin() + i * outputStride, outputStride});
+			});
+		}
+
+		void inverseRCT(const int32_t* y, const int32_t* cb, const int32_t* cr, size_t nbPixels, ArrayView<uint8_t> output)
+		{
+#ifdef EMDL_AVX2
+			if (useAVX2())
+				return componentsToRGB(y, cb, cr, nbPixels, output, inverseRCTAVX2);
+#endif
+			componentsToRGB(y, cb, cr, nbPixels, output, inverseRCTScalar);
+		}
+
+		void inverseICT(const int32_t* y, const int32_t* cb, const int32_t* cr, size_t nbPixels, ArrayView<uint8_t> output)
+		{
+#ifdef EMDL_AVX2
+			if (useAVX2())
+				return componentsToRGB(y, cb, cr, nbPixels, output, inverseICTAVX2);
+#endif
+			componentsToRGB(y, cb, cr, nbPixels, output, inverseICTScalar);
+		}
+
+	} // namespace image
+} // namespace emdl
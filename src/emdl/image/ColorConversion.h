@@ -0,0 +1,38 @@
+#pragma once
+
+#include <emdl/codec/Codec.h>
+#include <emdl/ThreadPool.h>
+
+namespace emdl
+{
+	namespace image
+	{
+		//! Reorder the samples of a frame from planar (RRR...GGG...BBB...) to interleaved (RGBRGB...).
+		//! input and output hold nbPixels * nbSamples samples of bytesPerSample bytes, and must not overlap.
+		EMDL_API void planarToInterleaved(const uint8_t* input, uint8_t* output, size_t nbPixels, size_t nbSamples, size_t bytesPerSample);
+
+		//! Reorder the samples of a frame from interleaved to planar
+		EMDL_API void interleavedToPlanar(const uint8_t* input, uint8_t* output, size_t nbPixels, size_t nbSamples, size_t bytesPerSample);
+
+		//! Size in bytes of one native frame with this photometric interpretation (YBR_FULL_422 has 2 samples per pixel)
+		EMDL_API size_t nativeFrameSize(const codec::ImageInfo& info);
+
+		//! Convert one 8 bits color frame to interleaved RGB, following info.photometricInterpretation and info.planarConfiguration.
+		//! Supports RGB, YBR_FULL and YBR_FULL_422 (chroma replicated on both pixels).
+		//! YBR_ICT and YBR_RCT frames are already RGB once decoded, and are only reshuffled.
+		EMDL_API void convertToRGB(BinaryValue::view_type frame, const codec::ImageInfo& info, ArrayView<uint8_t> output);
+
+		//! Convert in parallel the info.numberOfFrames frames of input, frame i starting at i * inputStride (nativeFrameSize(info) if 0).
+		//! RGB frame i is written at output + i * alignSize(rows * columns * 3).
+		EMDL_API void convertFramesToRGB(BinaryValue::view_type input, size_t inputStride, const codec::ImageInfo& info, ArrayView<uint8_t> output,
+										 ThreadPool& pool = ThreadPool::global());
+
+		//! Inverse JPEG 2000 reversible color transform of 8 bits components decoded without it, writing interleaved RGB.
+		//! The three components hold nbPixels values, the level shift of 128 is added back.
+		EMDL_API void inverseRCT(const int32_t* y, const int32_t* cb, const int32_t* cr, size_t nbPixels, ArrayView<uint8_t> output);
+
+		//! Inverse JPEG 2000 irreversible color transform of 8 bits components decoded without it, writing interleaved RGB
+		EMDL_API void inverseICT(const int32_t* y, const int32_t* cb, const int32_t* cr, size_t nbPixels, ArrayView<uint8_t> output);
+
+	} // namespace image
+} // namespace emdl
@@ -0,0 +1,422 @@
+#include <emdl/image/PaletteColor.h>
+#include <emdl/image/Samples.h>
+#include <emdl/image/Simd.h>
+#include <emdl/dataset/DataSetAccessors.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+namespace
+{
+	using namespace emdl;
+	using namespace emdl::image;
+	using namespace emdl::simd;
+
+	// Words of an OW element, which may not be aligned in the source buffer
+	std::vector<uint16_t> readWords(const DataSet& dataSet, Tag tag)
+	{
+		const auto binary = firstBinary(dataSet, tag);
+		if (!binary)
+			return {};
+		std::vector<uint16_t> words(binary->size() / 2);
+		if (!words.empty())
+			std::memcpy(words.data(), binary->data(), words.size() * 2);
+		return words;
+	}
+
+	// Indirect segments give byte offsets from the start of the segmented data, so the segments are always read from the whole data
+	void expandSegments(const uint16_t* data, size_t size, size_t start, size_t maxSegments, size_t maxEntries, std::vector<uint16_t>& lut, int depth)
+	{
+		if (depth > 8)
+			throw Exception("{} Too many nested indirect segments in a segmented LUT", LOG_POSITION);
+
+		const auto reserveEntries = [&](size_t length) {
+			if (lut.size() + length > maxEntries)
+				throw Exception("{} Segmented LUT expands to more than {} entries", LOG_POSITION, maxEntries);
+		};
+
+		size_t pos = start, nbSegments = 0;
+		while (pos + 1 < size && nbSegments < maxSegments)
+		{
+			const auto opcode = data[pos];
+			const size_t length = data[pos + 1];
+			pos += 2;
+
+			switch (opcode)
+			{
+			case 0: // Discrete: the entries follow
+				if (pos + length > size)
+					throw Exception("{} Discrete segment goes past the end of the LUT data", LOG_POSITION);
+				reserveEntries(length);
+				lut.insert(lut.end(), data + pos, data + pos + length);
+				pos += length;
+				break;
+			case 1: // Linear: from the last entry to the given value
+			{
+				if (lut.empty() || pos >= size)
+					throw Exception("{} Invalid linear segment in a segmented LUT", LOG_POSITION);
+				reserveEntries(length);
+				const double y0 = lut.back(), y1 = data[pos++];
+				for (size_t i = 1; i <= length; ++i)
+					lut.push_back(static_cast<uint16_t>(y0 + (y1 - y0) * i / length + 0.5));
+				break;
+			}
+			case 2: // Indirect: copy length segments found at a byte offset (least significant word first)
+			{
+				if (lut.empty() || pos + 1 >= size)
+					throw Exception("{} Invalid indirect segment in a segmented LUT", LOG_POSITION);
+				const size_t offset = (data[pos] | (static_cast<size_t>(data[pos + 1]) << 16)) / 2;
+				pos += 2;
+				if (offset >= size)
+					throw Exception("{} Indirect segment offset goes past the end of the LUT data", LOG_POSITION);
+				expandSegments(data, size, offset, length, maxEntries, lut, depth + 1);
+				break;
+			}
+			default:
+				throw Exception("{} Unknown segment type {} in a segmented LUT", LOG_POSITION, opcode);
+			}
+			++nbSegments;
+		}
+	}
+
+	struct Descriptor
+	{
+		size_t nbEntries;
+		int32_t firstMapped;
+		uint16_t bitsPerEntry;
+	};
+
+	Descriptor readDescriptor(const DataSet& dataSet, Tag tag, SampleType type)
+	{
+		const auto& values = intList(dataSet, tag);
+		if (values.size() != 3)
+			throw Exception("{} Invalid palette color LUT descriptor {}", LOG_POSITION, asString(tag));
+
+		Descriptor descriptor;
+		descriptor.nbEntries = static_cast<uint16_t>(values[0]);
+		if (!descriptor.nbEntries)
+			descriptor.nbEntries = 65536;
+		// The first mapped value follows the pixel representation, even when written as US
+		if (type == SampleType::Int8 || type == SampleType::Int16)
+			descriptor.firstMapped = static_cast<int16_t>(values[1]);
+		else
+			descriptor.firstMapped = static_cast<uint16_t>(values[1]);
+		descriptor.bitsPerEntry = static_cast<uint16_t>(values[2]);
+		if (descriptor.bitsPerEntry != 8 && descriptor.bitsPerEntry != 16)
+			throw Exception("{} Unsupported palette color LUT entry size: {} bits", LOG_POSITION, descriptor.bitsPerEntry);
+		return descriptor;
+	}
+
+	std::vector<uint16_t> readLUT(const DataSet& dataSet, Tag dataTag, Tag segmentedTag, const Descriptor& descriptor)
+	{
+		std::vector<uint16_t> lut;
+		if (dataSet.has(dataTag))
+		{
+			const auto binary = firstBinary(dataSet, dataTag);
+			if (binary && descriptor.bitsPerEntry == 8 && binary->size() == descriptor.nbEntries)
+			{
+				// 8 bits entries packed in bytes
+				const auto bytes = static_cast<const uint8_t*>(binary->data());
+				lut.assign(bytes, bytes + binary->size());
+			}
+			else
+			{
+				lut = readWords(dataSet, dataTag);
+				// Some writers put 8 bits entries in the most significant byte of the words
+				if (descriptor.bitsPerEntry == 8 && std::any_of(lut.begin(), lut.end(), [](uint16_t v) { return v > 0xff; }))
+				{
+					for (auto& value : lut)
+						value >>= 8;
+				}
+			}
+		}
+		else if (dataSet.has(segmentedTag))
+		{
+			const auto words = readWords(dataSet, segmentedTag);
+			lut = expandSegmentedLUT({words.data(), words.size()}, descriptor.nbEntries);
+		}
+		else
+			throw Exception("{} Missing palette color LUT data {}", LOG_POSITION, asString(dataTag));
+
+		if (lut.empty())
+			throw Exception("{} Empty palette color LUT data {}", LOG_POSITION, asString(dataTag));
+		lut.resize(descriptor.nbEntries, lut.back());
+		return lut;
+	}
+
+	/*****************************************************************************/
+
+	template <class T>
+	void applyScalar(const T* in, uint8_t* out, size_t n, const uint32_t* table, int32_t first, int32_t last, bool withAlpha)
+	{
+		const size_t step = withAlpha ? 4 : 3;
+		for (size_t i = 0; i < n; ++i)
+		{
+			const int32_t index = std::min(std::max(static_cast<int32_t>(in[i]) - first, 0), last);
+			std::memcpy(out + i * step, table + index, step);
+		}
+	}
+
+#ifdef EMDL_AVX2
+	template <class T>
+	EMDL_TARGET_AVX2 void applyAVX2(const T* in, uint8_t* out, size_t n, const uint32_t* table, int32_t first, int32_t last, bool withAlpha)
+	{
+		const auto vfirst = _mm256_set1_epi32(first), vlast = _mm256_set1_epi32(last), zero = _mm256_setzero_si256();
+		// Drop the alpha byte of each entry, leaving 12 bytes of RGB in each 128 bits lane
+		const auto toRGB = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+											0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8)
+		{
+			const auto index = _mm256_min_epi32(_mm256_max_epi32(_mm256_sub_epi32(load8(in + i), vfirst), zero), vlast);
+			const auto rgba = _mm256_i32gather_epi32(reinterpret_cast<const int*>(table), index, 4);
+			if (withAlpha)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 4), rgba);
+			else
+			{
+				const auto rgb = _mm256_shuffle_epi8(rgba, toRGB);
+				const auto high = _mm256_extracti128_si256(rgb, 1);
+				uint8_t* dest = out + i * 3;
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm256_castsi256_si128(rgb)); // The last 4 bytes are overwritten below
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dest + 12), high);
+				const int32_t tail = _mm_cvtsi128_si32(_mm_srli_si128(high, 8));
+				std::memcpy(dest + 20, &tail, 4);
+			}
+		}
+		applyScalar(in + i, out + i * (withAlpha ? 4 : 3), n - i, table, first, last, withAlpha);
+	}
+#endif
+
+	template <class T>
+	void applyDispatch(const T* in, uint8_t* out, size_t n, const uint32_t* table, int32_t first, int32_t last, bool withAlpha)
+	{
+#ifdef EMDL_AVX2
+		if (getInstructionSet() == InstructionSet::AVX2)
+			return applyAVX2(in, out, n, table, first, last, withAlpha);
+#endif
+		applyScalar(in, out, n, table, first, last, withAlpha);
+	}
+
+	template <class T>
+	void apply16(const T* in, uint16_t* out, size_t n, const PaletteLUT& lut, bool withAlpha)
+	{
+		const int32_t first = lut.firstMapped(), last = static_cast<int32_t>(lut.size()) - 1;
+		const uint16_t scale = (lut.bitsPerEntry() == 8) ? 257 : 1;
+		const size_t step = withAlpha ? 4 : 3;
+		for (size_t i = 0; i < n; ++i)
+		{
+			const int32_t index = std::min(std::max(static_cast<int32_t>(in[i]) - first, 0), last);
+			uint16_t* dest = out + i * step;
+			dest[0] = lut.red()[index] * scale;
+			dest[1] = lut.green()[index] * scale;
+			dest[2] = lut.blue()[index] * scale;
+			if (withAlpha)
+				dest[3] = lut.hasAlpha() ? lut.alpha()[index] * scale : 0xffff;
+		}
+	}
+
+	/*****************************************************************************/
+
+	// FNV-1a, identifying the palettes without UID
+	void hashBytes(uint64_t& hash, const void* data, size_t size)
+	{
+		const auto bytes = static_cast<const uint8_t*>(data);
+		for (size_t i = 0; i < size; ++i)
+			hash = (hash ^ bytes[i]) * 1099511628211ull;
+	}
+
+	std::string paletteKey(const DataSet& dataSet, SampleType type)
+	{
+		const auto uid = firstString(dataSet, registry::PaletteColorLookupTableUID);
+		if (uid && !uid->empty())
+			return fmt::format("{}:{}", static_cast<int>(type), *uid);
+
+		uint64_t hash = 14695981039346656037ull;
+		for (const auto tag : {registry::RedPaletteColorLookupTableDescriptor, registry::GreenPaletteColorLookupTableDescriptor,
+							   registry::BluePaletteColorLookupTableDescriptor, registry::AlphaPaletteColorLookupTableDescriptor})
+		{
+			const auto& values = intList(dataSet, tag);
+			hashBytes(hash, values.data(), values.size() * sizeof(Value::Integer));
+		}
+		for (const auto tag : {registry::RedPaletteColorLookupTableData, registry::GreenPaletteColorLookupTableData,
+							   registry::BluePaletteColorLookupTableData, registry::AlphaPaletteColorLookupTableData,
+							   registry::SegmentedRedPaletteColorLookupTableData, registry::SegmentedGreenPaletteColorLookupTableData,
+							   registry::SegmentedBluePaletteColorLookupTableData, registry::SegmentedAlphaPaletteColorLookupTableData})
+		{
+			const auto binary = firstBinary(dataSet, tag);
+			hashBytes(hash, &tag, sizeof(tag));
+			if (binary)
+				hashBytes(hash, binary->data(), binary->size());
+		}
+		return fmt::format("{}:#{:016x}", static_cast<int>(type), hash);
+	}
+
+}
+
+namespace emdl
+{
+	namespace image
+	{
+		std::vector<uint16_t> expandSegmentedLUT(ArrayView<const uint16_t> data, size_t maxEntries)
+		{
+			std::vector<uint16_t> lut;
+			expandSegments(data.data(), data.size(), 0, static_cast<size_t>(-1), maxEntries, lut, 0);
+			return lut;
+		}
+
+		/*****************************************************************************/
+
+		PaletteLUT::PaletteLUT(const DataSet& dataSet, SampleType type)
+		{
+			const auto descriptor = readDescriptor(dataSet, registry::RedPaletteColorLookupTableDescriptor, type);
+			m_firstMapped = descriptor.firstMapped;
+			m_bitsPerEntry = descriptor.bitsPerEntry;
+
+			m_red = readLUT(dataSet, registry::RedPaletteColorLookupTableData, registry::SegmentedRedPaletteColorLookupTableData, descriptor);
+			m_green = readLUT(dataSet, registry::GreenPaletteColorLookupTableData, registry::SegmentedGreenPaletteColorLookupTableData,
+							  readDescriptor(dataSet, registry::GreenPaletteColorLookupTableDescriptor, type));
+			m_blue = readLUT(dataSet, registry::BluePaletteColorLookupTableData, registry::SegmentedBluePaletteColorLookupTableData,
+							 readDescriptor(dataSet, registry::BluePaletteColorLookupTableDescriptor, type));
+			if (dataSet.has(registry::AlphaPaletteColorLookupTableDescriptor))
+				m_alpha = readLUT(dataSet, registry::AlphaPaletteColorLookupTableData, registry::SegmentedAlphaPaletteColorLookupTableData,
+								  readDescriptor(dataSet, registry::AlphaPaletteColorLookupTableDescriptor, type));
+
+			// The three LUTs share the same descriptor values, except for the alpha one which may be shorter
+			m_green.resize(m_red.size(), m_green.back());
+			m_blue.resize(m_red.size(), m_blue.back());
+			if (!m_alpha.empty())
+				m_alpha.resize(m_red.size(), m_alpha.back());
+
+			const int shift = (m_bitsPerEntry == 16) ? 8 : 0;
+			m_rgba8.resize(m_red.size());
+			for (size_t i = 0; i < m_red.size(); ++i)
+			{
+				const uint32_t r = std::min<uint32_t>(m_red[i] >> shift, 0xff);
+				const uint32_t g = std::min<uint32_t>(m_green[i] >> shift, 0xff);
+				const uint32_t b = std::min<uint32_t>(m_blue[i] >> shift, 0xff);
+				const uint32_t a = m_alpha.empty() ? 0xff : std::min<uint32_t>(m_alpha[i] >> shift, 0xff);
+				m_rgba8[i] = r | (g << 8) | (b << 16) | (a << 24);
+			}
+		}
+
+		size_t PaletteLUT::size() const
+		{
+			return m_red.size();
+		}
+
+		int32_t PaletteLUT::firstMapped() const
+		{
+			return m_firstMapped;
+		}
+
+		uint16_t PaletteLUT::bitsPerEntry() const
+		{
+			return m_bitsPerEntry;
+		}
+
+		bool PaletteLUT::hasAlpha() const
+		{
+			return !m_alpha.empty();
+		}
+
+		const std::vector<uint16_t>& PaletteLUT::red() const
+		{
+			return m_red;
+		}
+
+		const std::vector<uint16_t>& PaletteLUT::green() const
+		{
+			return m_green;
+		}
+
+		const std::vector<uint16_t>& PaletteLUT::blue() const
+		{
+			return m_blue;
+		}
+
+		const std::vector<uint16_t>& PaletteLUT::alpha() const
+		{
+			return m_alpha;
+		}
+
+		void PaletteLUT::apply(BinaryValue::view_type input, SampleType type, ArrayView<uint8_t> output, bool withAlpha, uint16_t bitsStored) const
+		{
+			const int32_t last = static_cast<int32_t>(m_rgba8.size()) - 1;
+			const size_t step = withAlpha ? 4 : 3;
+			details::visitSamples(input, type, bitsStored, output.size(), step, [&](auto in, size_t n, size_t first) {
+				applyDispatch(in, output.begin() + first * step, n, m_rgba8.data(), m_firstMapped, last, withAlpha);
+			});
+		}
+
+		void PaletteLUT::apply(BinaryValue::view_type input, SampleType type, ArrayView<uint16_t> output, bool withAlpha, uint16_t bitsStored) const
+		{
+			const size_t step = withAlpha ? 4 : 3;
+			details::visitSamples(input, type, bitsStored, output.size(), step, [&](auto in, size_t n, size_t first) {
+				apply16(in, output.begin() + first * step, n, *this, withAlpha);
+			});
+		}
+
+		/*****************************************************************************/
+
+		PaletteCache::PaletteCache(size_t capacity)
+			: m_capacity(std::max<size_t>(capacity, 1))
+		{
+		}
+
+		PaletteLUTSPtr PaletteCache::get(const DataSet& dataSet, SampleType type)
+		{
+			const auto key = paletteKey(dataSet, type);
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (const auto lut = find(key))
+					return lut;
+			}
+
+			// Expand outside of the lock, two threads may do it for the same palette but only one is kept
+			auto lut = std::make_shared<const PaletteLUT>(dataSet, type);
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (const auto cached = find(key))
+				return cached;
+			if (m_palettes.size() >= m_capacity)
+				m_palettes.pop_front();
+			m_palettes.emplace_back(key, lut);
+			return lut;
+		}
+
+		void PaletteCache::clear()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_palettes.clear();
+		}
+
+		PaletteCache& PaletteCache::global()
+		{
+			static PaletteCache cache;
+			return cache;
+		}
+
+		PaletteLUTSPtr PaletteCache::find(const std::string& key)
+		{
+			const auto it = std::find_if(m_palettes.begin(), m_palettes.end(), [&key](const Entry& entry) {
+				return entry.first == key;
+			});
+			if (it == m_palettes.end())
+				return {};
+
+			// Move it to the end, so that the least recently used palette is the first one
+			auto lut = it->second;
+			m_palettes.erase(it);
+			m_palettes.emplace_back(key, lut);
+			return lut;
+		}
+
+		PaletteLUTSPtr getPaletteLUT(const DataSet& dataSet, SampleType type, PaletteCache& cache)
+		{
+			return cache.get(dataSet, type);
+		}
+
+	} // namespace image
+} // namespace emdl
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <emdl/image/Windowing.h>
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace emdl
+{
+	namespace image
+	{
+		//! Expand a segmented palette color LUT (discrete, linear and indirect segments) into its entries.
+		//! Throws if it expands to more than maxEntries (the number of entries of the descriptor).
+		EMDL_API std::vector<uint16_t> expandSegmentedLUT(ArrayView<const uint16_t> data, size_t maxEntries = 65536);
+
+		//! Red, green, blue and optionally alpha LUTs of a PALETTE COLOR image, expanded once
+		class EMDL_API PaletteLUT
+		{
+		public:
+			//! Read and expand the LUTs of the data set (plain or segmented), throws if they are missing or invalid.
+			//! The type of the samples is used to interpret the first mapped value.
+			PaletteLUT(const DataSet& dataSet, SampleType type);
+
+			//! Number of entries of each LUT
+			size_t size() const;
+
+			//! Stored value mapped to the first entry
+			int32_t firstMapped() const;
+
+			//! Bits of each entry, 8 or 16
+			uint16_t bitsPerEntry() const;
+
+			//! Test whether an alpha LUT is present
+			bool hasAlpha() const;
+
+			const std::vector<uint16_t>& red() const;
+			const std::vector<uint16_t>& green() const;
+			const std::vector<uint16_t>& blue() const;
+			const std::vector<uint16_t>& alpha() const; // Empty if hasAlpha() is false
+
+			//! Map the stored values of input (a native frame) to interleaved 8 bits RGB, or RGBA if withAlpha is true.
+			//! Values outside of the LUT use the first or last entry. 16 bits entries are reduced to their most significant byte.
+			//! Only the low bitsStored bits of the samples are used, as in rescale (0 for all of them).
+			void apply(BinaryValue::view_type input, SampleType type, ArrayView<uint8_t> output, bool withAlpha = false, uint16_t bitsStored = 0) const;
+
+			//! Map the stored values of input to interleaved 16 bits RGB or RGBA, 8 bits entries being scaled to the full range
+			void apply(BinaryValue::view_type input, SampleType type, ArrayView<uint16_t> output, bool withAlpha = false, uint16_t bitsStored = 0) const;
+
+		private:
+			std::vector<uint16_t> m_red, m_green, m_blue, m_alpha;
+			std::vector<uint32_t> m_rgba8; // Packed 8 bits entries, red in the lowest byte
+			int32_t m_firstMapped = 0;
+			uint16_t m_bitsPerEntry = 16;
+		};
+
+		using PaletteLUTSPtr = std::shared_ptr<const PaletteLUT>;
+
+		//! Expanded LUTs of the palettes used recently, shared between the images using the same palette.
+		//! The palette is identified by PaletteColorLookupTableUID when present, by the content of the LUTs otherwise.
+		class EMDL_API PaletteCache
+		{
+		public:
+			//! Keep at most capacity palettes, the least recently used one being dropped first
+			explicit PaletteCache(size_t capacity = 16);
+
+			PaletteCache(const PaletteCache&) = delete;
+			PaletteCache& operator=(const PaletteCache&) = delete;
+
+			//! Return the expanded LUTs of the data set, expanding them only if the palette is not in the cache. Thread safe.
+			PaletteLUTSPtr get(const DataSet& dataSet, SampleType type);
+
+			//! Drop all the palettes
+			void clear();
+
+			//! Cache shared by the library, used by default
+			static PaletteCache& global();
+
+		private:
+			using Entry = std::pair<std::string, PaletteLUTSPtr>;
+
+			PaletteLUTSPtr find(const std::string& key); // Empty if not found. Must be called with the mutex locked.
+
+			size_t m_capacity;
+			std::mutex m_mutex;
+			std::deque<Entry> m_palettes; // Least recently used first
+		};
+
+		//! Return the expanded LUTs of the data set, sharing them with the previous calls for the same palette
+		EMDL_API PaletteLUTSPtr getPaletteLUT(const DataSet& dataSet, SampleType type, PaletteCache& cache = PaletteCache::global());
+
+	} // namespace image
+} // namespace emdl
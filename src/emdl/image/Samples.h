@@ -0,0 +1,67 @@
+#pragma once
+
+#include <emdl/image/Windowing.h>
+#include <emdl/Exception.h>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace emdl
+{
+	namespace image
+	{
+		namespace details
+		{
+			//! Keep the low bitsStored bits of a sample, sign extended for the signed types
+			template <class T>
+			T storedValue(T sample, int bitsStored)
+			{
+				const int shift = 32 - bitsStored;
+				if (std::is_signed<T>::value)
+					return static_cast<T>(static_cast<int32_t>(static_cast<uint32_t>(sample) << shift) >> shift);
+				return static_cast<T>(static_cast<uint32_t>(sample) & ((1u << bitsStored) - 1));
+			}
+
+			//! Call func(samples, count, first) with the input reinterpreted following the sample type, first being the index of the first sample.
+			//! When bitsStored is less than the size of the samples, the other bits (such as overlays) are cleared
+			//! on copies of the samples, and func is called on consecutive blocks of them.
+			//! Throws if the output cannot hold step values per sample.
+			template <class Func>
+			void visitSamples(BinaryValue::view_type input, SampleType type, uint16_t bitsStored, size_t outputSize, size_t step, Func func)
+			{
+				const size_t nbSamples = input.size() / getSampleSize(type);
+				if (outputSize < nbSamples * step)
+					throw Exception("{} Output buffer too small: {} values for {} samples", LOG_POSITION, outputSize, nbSamples);
+
+				const auto visit = [&](const auto* samples) {
+					using T = std::remove_const_t<std::remove_pointer_t<decltype(samples)>>;
+					if (!bitsStored || bitsStored >= 8 * sizeof(T))
+						return func(samples, nbSamples, size_t(0));
+
+					const size_t blockSize = 2048;
+					T block[blockSize];
+					for (size_t first = 0; first < nbSamples; first += blockSize)
+					{
+						const auto n = std::min(blockSize, nbSamples - first);
+						for (size_t i = 0; i < n; ++i)
+							block[i] = storedValue(samples[first + i], bitsStored);
+						func(static_cast<const T*>(block), n, first);
+					}
+				};
+
+				switch (type)
+				{
+				case SampleType::UInt8:
+					return visit(static_cast<const uint8_t*>(input.data()));
+				case SampleType::Int8:
+					return visit(static_cast<const int8_t*>(input.data()));
+				case SampleType::UInt16:
+					return visit(static_cast<const uint16_t*>(input.data()));
+				case SampleType::Int16:
+				default:
+					return visit(static_cast<const int16_t*>(input.data()));
+				}
+			}
+		} // namespace details
+	} // namespace image
+} // namespace emdl
@@ -0,0 +1,47 @@
+#include <emdl/image/Simd.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+	using emdl::simd::InstructionSet;
+
+	std::atomic<InstructionSet>& currentInstructionSet()
+	{
+		static std::atomic<InstructionSet> instructionSet{emdl::simd::detectInstructionSet()};
+		return instructionSet;
+	}
+}
+
+namespace emdl
+{
+	namespace simd
+	{
+		InstructionSet detectInstructionSet()
+		{
+#if defined(EMDL_AVX2) && (defined(__GNUC__) || defined(__clang__))
+			if (__builtin_cpu_supports("avx2"))
+				return InstructionSet::AVX2;
+			return InstructionSet::SSE2;
+#elif defined(EMDL_AVX2)
+			return InstructionSet::AVX2;
+#elif defined(EMDL_SSE2)
+			return InstructionSet::SSE2;
+#else
+			return InstructionSet::Scalar;
+#endif
+		}
+
+		InstructionSet getInstructionSet()
+		{
+			return currentInstructionSet().load(std::memory_order_relaxed);
+		}
+
+		void setInstructionSet(InstructionSet instructionSet)
+		{
+			currentInstructionSet().store(std::min(instructionSet, detectInstructionSet()), std::memory_order_relaxed);
+		}
+
+	} // namespace simd
+} // namespace emdl
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <emdl/emdl_api.h>
+
+#include <cstdint>
+#include <cstring>
+
+// SSE2 is part of every x86-64 target, AVX2 kernels are compiled with a target attribute and selected at runtime
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define EMDL_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(EMDL_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define EMDL_AVX2 1
+#define EMDL_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(EMDL_SSE2) && defined(__AVX2__)
+#define EMDL_AVX2 1
+#define EMDL_TARGET_AVX2
+#include <immintrin.h>
+#endif
+
+namespace emdl
+{
+	namespace simd
+	{
+		//! Instruction sets used by the image kernels, from the least to the most capable
+		enum class InstructionSet
+		{
+			Scalar,
+			SSE2,
+			AVX2
+		};
+
+		//! Best instruction set supported by both the build and the processor
+		EMDL_API InstructionSet detectInstructionSet();
+
+		//! Instruction set currently used by the kernels
+		EMDL_API InstructionSet getInstructionSet();
+
+		//! Limit the instruction set used by the kernels (to compare implementations), capped by detectInstructionSet()
+		EMDL_API void setInstructionSet(InstructionSet instructionSet);
+
+#ifdef EMDL_SSE2
+		// Load 4 samples as 32 bits integers
+		inline __m128i load4(const uint8_t* p)
+		{
+			int32_t v;
+			std::memcpy(&v, p, 4);
+			const auto zero = _mm_setzero_si128();
+			return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(v), zero), zero);
+		}
+
+		inline __m128i load4(const int8_t* p)
+		{
+			int32_t v;
+			std::memcpy(&v, p, 4);
+			auto x = _mm_cvtsi32_si128(v);
+			x = _mm_unpacklo_epi8(x, x);
+			return _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 24);
+		}
+
+		inline __m128i load4(const uint16_t* p)
+		{
+			return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128());
+		}
+
+		inline __m128i load4(const int16_t* p)
+		{
+			const auto x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+			return _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+		}
+#endif
+
+#ifdef EMDL_AVX2
+		// Load 8 samples as 32 bits integers
+		EMDL_TARGET_AVX2 inline __m256i load8(const uint8_t* p)
+		{
+			return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+		}
+
+		EMDL_TARGET_AVX2 inline __m256i load8(const int8_t* p)
+		{
+			return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+		}
+
+		EMDL_TARGET_AVX2 inline __m256i load8(const uint16_t* p)
+		{
+			return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+		}
+
+		EMDL_TARGET_AVX2 inline __m256i load8(const int16_t* p)
+		{
+			return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+		}
+#endif
+
+	} // namespace simd
+} // namespace emdl
@@ -0,0 +1,398 @@
+#include <emdl/image/Windowing.h>
+#include <emdl/image/Samples.h>
+#include <emdl/image/Simd.h>
+#include <emdl/dataset/DataSetAccessors.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+	using namespace emdl;
+	using namespace emdl::image;
+	using namespace emdl::simd;
+
+	// Samples equal to or between lo and hi are replaced by value
+	struct PaddingMask
+	{
+		bool enabled = false;
+		int32_t lo = 0, hi = 0;
+		int32_t value = 0;
+	};
+
+	PaddingMask toMask(const boost::optional<PixelPadding>& padding)
+	{
+		PaddingMask mask;
+		if (padding)
+		{
+			mask.enabled = true;
+			mask.lo = std::min(padding->value, padding->rangeLimit);
+			mask.hi = std::max(padding->value, padding->rangeLimit);
+			mask.value = padding->output;
+		}
+		return mask;
+	}
+
+	/*****************************************************************************/
+	// Scalar kernels, also used for the end of the buffers
+
+	template <class T>
+	void rescaleScalar(const T* in, float* out, size_t n, float a, float b)
+	{
+		for (size_t i = 0; i < n; ++i)
+			out[i] = in[i] * a + b;
+	}
+
+	template <class T>
+	void rescaleScalar(const T* in, int32_t* out, size_t n, float a, float b)
+	{
+		for (size_t i = 0; i < n; ++i)
+			out[i] = static_cast<int32_t>(std::nearbyint(in[i] * a + b));
+	}
+
+	template <class T>
+	void windowScalar(const T* in, uint8_t* out, size_t n, float a, float b, const PaddingMask& mask)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			const int32_t x = in[i];
+			if (mask.enabled && x >= mask.lo && x <= mask.hi)
+				out[i] = static_cast<uint8_t>(mask.value);
+			else
+				out[i] = static_cast<uint8_t>(std::min(std::max(x * a + b, 0.0f), 255.0f) + 0.5f);
+		}
+	}
+
+	/*****************************************************************************/
+
+#ifdef EMDL_SSE2
+	template <class T>
+	void rescaleSSE2(const T* in, float* out, size_t n, float a, float b)
+	{
+		const auto va = _mm_set1_ps(a), vb = _mm_set1_ps(b);
+		size_t i = 0;
+		for (; i + 4 <= n; i += 4)
+			_mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(load4(in + i)), va), vb));
+		rescaleScalar(in + i, out + i, n - i, a, b);
+	}
+
+	template <class T>
+	void rescaleSSE2(const T* in, int32_t* out, size_t n, float a, float b)
+	{
+		const auto va = _mm_set1_ps(a), vb = _mm_set1_ps(b);
+		size_t i = 0;
+		for (; i + 4 <= n; i += 4)
+		{
+			const auto y = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(load4(in + i)), va), vb);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_cvtps_epi32(y));
+		}
+		rescaleScalar(in + i, out + i, n - i, a, b);
+	}
+
+	// Window 4 samples, returned as 32 bits integers
+	template <class T>
+	inline __m128i window4(const T* in, __m128 a, __m128 b, const PaddingMask& mask, __m128i lo, __m128i hi, __m128i padValue)
+	{
+		const auto x = load4(in);
+		auto y = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(x), a), b);
+		y = _mm_min_ps(_mm_max_ps(y, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+		auto result = _mm_cvttps_epi32(_mm_add_ps(y, _mm_set1_ps(0.5f)));
+		if (mask.enabled)
+		{
+			const auto outside = _mm_or_si128(_mm_cmplt_epi32(x, lo), _mm_cmpgt_epi32(x, hi));
+			result = _mm_or_si128(_mm_and_si128(outside, result), _mm_andnot_si128(outside, padValue));
+		}
+		return result;
+	}
+
+	template <class T>
+	void windowSSE2(const T* in, uint8_t* out, size_t n, float a, float b, const PaddingMask& mask)
+	{
+		const auto va = _mm_set1_ps(a), vb = _mm_set1_ps(b);
+		const auto lo = _mm_set1_epi32(mask.lo), hi = _mm_set1_epi32(mask.hi), padValue = _mm_set1_epi32(mask.value);
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8)
+		{
+			const auto y0 = window4(in + i, va, vb, mask, lo, hi, padValue);
+			const auto y1 = window4(in + i + 4, va, vb, mask, lo, hi, padValue);
+			const auto y16 = _mm_packs_epi32(y0, y1);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(y16, y16));
+		}
+		windowScalar(in + i, out + i, n - i, a, b, mask);
+	}
+#endif
+
+	/*****************************************************************************/
+
+#ifdef EMDL_AVX2
+	template <class T>
+	EMDL_TARGET_AVX2 void rescaleAVX2(const T* in, float* out, size_t n, float a, float b)
+	{
+		const auto va = _mm256_set1_ps(a), vb = _mm256_set1_ps(b);
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8)
+			_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(load8(in + i)), va), vb));
+		rescaleScalar(in + i, out + i, n - i, a, b);
+	}
+
+	template <class T>
+	EMDL_TARGET_AVX2 void rescaleAVX2(const T* in, int32_t* out, size_t n, float a, float b)
+	{
+		const auto va = _mm256_set1_ps(a), vb = _mm256_set1_ps(b);
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8)
+		{
+			const auto y = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(load8(in + i)), va), vb);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_cvtps_epi32(y));
+		}
+		rescaleScalar(in + i, out + i, n - i, a, b);
+	}
+
+	// Window 8 samples, returned as 32 bits integers
+	template <class T>
+	EMDL_TARGET_AVX2 inline __m256i window8(const T* in, __m256 a, __m256 b, const PaddingMask& mask, __m256i lo, __m256i hi, __m256i padValue)
+	{
+		const auto x = load8(in);
+		auto y = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(x), a), b);
+		y = _mm256_min_ps(_mm256_max_ps(y, _mm256_setzero_ps()), _mm256_set1_ps(255.0f));
+		const auto result = _mm256_cvttps_epi32(_mm256_add_ps(y, _mm256_set1_ps(0.5f)));
+		if (!mask.enabled)
+			return result;
+		const auto outside = _mm256_or_si256(_mm256_cmpgt_epi32(lo, x), _mm256_cmpgt_epi32(x, hi));
+		return _mm256_blendv_epi8(padValue, result, outside);
+	}
+
+	template <class T>
+	EMDL_TARGET_AVX2 void windowAVX2(const T* in, uint8_t* out, size_t n, float a, float b, const PaddingMask& mask)
+	{
+		const auto va = _mm256_set1_ps(a), vb = _mm256_set1_ps(b);
+		const auto lo = _mm256_set1_epi32(mask.lo), hi = _mm256_set1_epi32(mask.hi), padValue = _mm256_set1_epi32(mask.value);
+		size_t i = 0;
+		for (; i + 16 <= n; i += 16)
+		{
+			const auto y0 = window8(in + i, va, vb, mask, lo, hi, padValue);
+			const auto y1 = window8(in + i + 8, va, vb, mask, lo, hi, padValue);
+			// Packing works inside 128 bits lanes, restore the order of the samples before narrowing to 8 bits
+			const auto y16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(y0, y1), 0xd8);
+			const auto y8 = _mm_packus_epi16(_mm256_castsi256_si128(y16), _mm256_extracti128_si256(y16, 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), y8);
+		}
+		windowScalar(in + i, out + i, n - i, a, b, mask);
+	}
+#endif
+
+	/*****************************************************************************/
+
+	template <class T>
+	void rescaleDispatch(const T* in, float* out, size_t n, float a, float b)
+	{
+		switch (simd::getInstructionSet())
+		{
+#ifdef EMDL_AVX2
+		case simd::InstructionSet::AVX2:
+			return rescaleAVX2(in, out, n, a, b);
+#endif
+#ifdef EMDL_SSE2
+		case simd::InstructionSet::SSE2:
+			return rescaleSSE2(in, out, n, a, b);
+#endif
+		default:
+			return rescaleScalar(in, out, n, a, b);
+		}
+	}
+
+	template <class T>
+	void rescaleDispatch(const T* in, int32_t* out, size_t n, float a, float b)
+	{
+		switch (simd::getInstructionSet())
+		{
+#ifdef EMDL_AVX2
+		case simd::InstructionSet::AVX2:
+			return rescaleAVX2(in, out, n, a, b);
+#endif
+#ifdef EMDL_SSE2
+		case simd::InstructionSet::SSE2:
+			return rescaleSSE2(in, out, n, a, b);
+#endif
+		default:
+			return rescaleScalar(in, out, n, a, b);
+		}
+	}
+
+	template <class T>
+	void windowDispatch(const T* in, uint8_t* out, size_t n, float a, float b, const PaddingMask& mask)
+	{
+		switch (simd::getInstructionSet())
+		{
+#ifdef EMDL_AVX2
+		case simd::InstructionSet::AVX2:
+			return windowAVX2(in, out, n, a, b, mask);
+#endif
+#ifdef EMDL_SSE2
+		case simd::InstructionSet::SSE2:
+			return windowSSE2(in, out, n, a, b, mask);
+#endif
+		default:
+			return windowScalar(in, out, n, a, b, mask);
+		}
+	}
+
+	// The sigmoid is computed once for each possible stored value
+	template <class T>
+	void sigmoidLUT(const T* in, uint8_t* out, size_t n, const Rescale& rescale, const Window& window, const PaddingMask& mask)
+	{
+		using Unsigned = typename std::make_unsigned<T>::type;
+		std::vector<uint8_t> lut(size_t(1) << (8 * sizeof(T)));
+		for (size_t i = 0; i < lut.size(); ++i)
+		{
+			const int32_t x = static_cast<T>(static_cast<Unsigned>(i));
+			if (mask.enabled && x >= mask.lo && x <= mask.hi)
+				lut[i] = static_cast<uint8_t>(mask.value);
+			else
+			{
+				const double value = x * rescale.slope + rescale.intercept;
+				lut[i] = static_cast<uint8_t>(255.0 / (1.0 + std::exp(-4.0 * (value - window.center) / window.width)) + 0.5);
+			}
+		}
+
+		for (size_t i = 0; i < n; ++i)
+			out[i] = lut[static_cast<Unsigned>(in[i])];
+	}
+
+	template <class T>
+	void applyVOI(const T* in, uint8_t* out, size_t n, const Rescale& rescale, const Window& window, const PaddingMask& mask)
+	{
+		// Both the modality and the linear VOI LUT are affine functions, merged into y = x * a + b before clamping
+		double a, b;
+		switch (window.function)
+		{
+		case VOIFunction::Linear:
+		{
+			const double range = std::max(window.width - 1.0, 1e-6);
+			a = rescale.slope * 255.0 / range;
+			b = (rescale.intercept - (window.center - 0.5)) * 255.0 / range + 127.5;
+			break;
+		}
+		case VOIFunction::LinearExact:
+			a = rescale.slope * 255.0 / window.width;
+			b = (rescale.intercept - window.center) * 255.0 / window.width + 127.5;
+			break;
+		case VOIFunction::Sigmoid:
+		default:
+			return sigmoidLUT(in, out, n, rescale, window, mask);
+		}
+
+		windowDispatch(in, out, n, static_cast<float>(a), static_cast<float>(b), mask);
+	}
+
+	// Stored value of a padding attribute, which may have been written as US for signed data
+	int32_t toStoredValue(Value::Integer value, SampleType type)
+	{
+		switch (type)
+		{
+		case SampleType::Int8:
+			return static_cast<int8_t>(value);
+		case SampleType::Int16:
+			return static_cast<int16_t>(value);
+		default:
+			return static_cast<int32_t>(value);
+		}
+	}
+}
+
+namespace emdl
+{
+	namespace image
+	{
+		SampleType getSampleType(uint16_t bitsAllocated, uint16_t pixelRepresentation)
+		{
+			if (bitsAllocated == 8)
+				return pixelRepresentation ? SampleType::Int8 : SampleType::UInt8;
+			if (bitsAllocated == 16)
+				return pixelRepresentation ? SampleType::Int16 : SampleType::UInt16;
+			throw Exception("{} Unsupported BitsAllocated: {}", LOG_POSITION, bitsAllocated);
+		}
+
+		size_t getSampleSize(SampleType type)
+		{
+			return (type == SampleType::UInt8 || type == SampleType::Int8) ? 1 : 2;
+		}
+
+		Rescale Rescale::fromDataSet(const DataSet& dataSet)
+		{
+			Rescale rescale;
+			const auto slope = firstReal(dataSet, registry::RescaleSlope);
+			if (slope)
+				rescale.slope = *slope;
+			const auto intercept = firstReal(dataSet, registry::RescaleIntercept);
+			if (intercept)
+				rescale.intercept = *intercept;
+			return rescale;
+		}
+
+		boost::optional<Window> Window::fromDataSet(const DataSet& dataSet, size_t index)
+		{
+			const auto& centers = realList(dataSet, registry::WindowCenter);
+			const auto& widths = realList(dataSet, registry::WindowWidth);
+			if (index >= centers.size() || index >= widths.size())
+				return boost::none;
+
+			Window window;
+			window.center = centers[index];
+			window.width = widths[index];
+
+			const auto function = firstString(dataSet, registry::VOILUTFunction);
+			if (function && *function == "LINEAR_EXACT")
+				window.function = VOIFunction::LinearExact;
+			else if (function && *function == "SIGMOID")
+				window.function = VOIFunction::Sigmoid;
+			return window;
+		}
+
+		boost::optional<PixelPadding> PixelPadding::fromDataSet(const DataSet& dataSet, SampleType type)
+		{
+			const auto value = firstInt(dataSet, registry::PixelPaddingValue);
+			if (!value)
+				return boost::none;
+
+			PixelPadding padding;
+			padding.value = toStoredValue(*value, type);
+			const auto rangeLimit = firstInt(dataSet, registry::PixelPaddingRangeLimit);
+			padding.rangeLimit = rangeLimit ? toStoredValue(*rangeLimit, type) : padding.value;
+			return padding;
+		}
+
+		void rescale(BinaryValue::view_type input, SampleType type, const Rescale& rescale, ArrayView<float> output, uint16_t bitsStored)
+		{
+			const auto a = static_cast<float>(rescale.slope), b = static_cast<float>(rescale.intercept);
+			details::visitSamples(input, type, bitsStored, output.size(), 1, [&](auto in, size_t n, size_t first) {
+				rescaleDispatch(in, output.begin() + first, n, a, b);
+			});
+		}
+
+		void rescale(BinaryValue::view_type input, SampleType type, const Rescale& rescale, ArrayView<int32_t> output, uint16_t bitsStored)
+		{
+			const auto a = static_cast<float>(rescale.slope), b = static_cast<float>(rescale.intercept);
+			details::visitSamples(input, type, bitsStored, output.size(), 1, [&](auto in, size_t n, size_t first) {
+				rescaleDispatch(in, output.begin() + first, n, a, b);
+			});
+		}
+
+		void applyWindow(BinaryValue::view_type input, SampleType type, const Rescale& rescale, const Window& window, ArrayView<uint8_t> output,
+						 const boost::optional<PixelPadding>& padding, uint16_t bitsStored)
+		{
+			if (window.width < (window.function == VOIFunction::Linear ? 1.0 : std::numeric_limits<double>::min()))
+				throw Exception("{} Invalid window width: {}", LOG_POSITION, window.width);
+
+			const auto mask = toMask(padding);
+			details::visitSamples(input, type, bitsStored, output.size(), 1, [&](auto in, size_t n, size_t first) {
+				applyVOI(in, output.begin() + first, n, rescale, window, mask);
+			});
+		}
+
+	} // namespace image
+} // namespace emdl
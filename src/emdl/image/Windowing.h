@@ -0,0 +1,81 @@
+#pragma once
+
+#include <emdl/dataset/DataSet.h>
+#include <emdl/BinaryValue.h>
+
+#include <boost/optional.hpp>
+
+namespace emdl
+{
+	namespace image
+	{
+		//! Type of the stored samples of native pixel data
+		enum class SampleType
+		{
+			UInt8,
+			Int8,
+			UInt16,
+			Int16
+		};
+
+		//! Sample type corresponding to BitsAllocated and PixelRepresentation, throws if not supported
+		EMDL_API SampleType getSampleType(uint16_t bitsAllocated, uint16_t pixelRepresentation);
+
+		//! Size in bytes of one sample
+		EMDL_API size_t getSampleSize(SampleType type);
+
+		//! Modality LUT described by RescaleSlope and RescaleIntercept
+		struct EMDL_API Rescale
+		{
+			double slope = 1.0;
+			double intercept = 0.0;
+
+			//! Read the rescale attributes of the data set, using the identity when they are missing
+			static Rescale fromDataSet(const DataSet& dataSet);
+		};
+
+		//! Function of the VOI LUT, as in VOILUTFunction
+		enum class VOIFunction
+		{
+			Linear,
+			LinearExact,
+			Sigmoid
+		};
+
+		//! VOI LUT described by WindowCenter and WindowWidth
+		struct EMDL_API Window
+		{
+			double center = 0.0;
+			double width = 1.0;
+			VOIFunction function = VOIFunction::Linear;
+
+			//! Read one of the windows of the data set, if there are that many
+			static boost::optional<Window> fromDataSet(const DataSet& dataSet, size_t index = 0);
+		};
+
+		//! Stored values between value and rangeLimit (inclusive) are not part of the image, and are written as output
+		struct EMDL_API PixelPadding
+		{
+			int32_t value = 0;
+			int32_t rangeLimit = 0;
+			uint8_t output = 0;
+
+			//! Read PixelPaddingValue and PixelPaddingRangeLimit, interpreted with the sample type of the pixel data
+			static boost::optional<PixelPadding> fromDataSet(const DataSet& dataSet, SampleType type);
+		};
+
+		//! Apply the modality LUT to the samples of input (a native frame, typically the view of the PixelData).
+		//! With a bitsStored (BitsStored) less than the size of the samples, only their low bits are used, sign extended for the signed types:
+		//! the other bits, such as embedded overlays, are ignored. 0 uses all the bits.
+		EMDL_API void rescale(BinaryValue::view_type input, SampleType type, const Rescale& rescale, ArrayView<float> output, uint16_t bitsStored = 0);
+
+		//! Apply the modality LUT to the samples of input, rounding the result to the nearest integer
+		EMDL_API void rescale(BinaryValue::view_type input, SampleType type, const Rescale& rescale, ArrayView<int32_t> output, uint16_t bitsStored = 0);
+
+		//! Apply the modality LUT then the VOI LUT to the samples of input, writing values from 0 to 255.
+		//! Padding pixels are compared on the stored values, before the modality LUT. bitsStored is used as in rescale.
+		EMDL_API void applyWindow(BinaryValue::view_type input, SampleType type, const Rescale& rescale, const Window& window, ArrayView<uint8_t> output,
+								  const boost::optional<PixelPadding>& padding = boost::none, uint16_t bitsStored = 0);
+
+	} // namespace image
+} // namespace emdl
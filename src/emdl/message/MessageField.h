@@ -69,6 +69,7 @@ namespace emdl
 				const auto elt = dataSet[tag];
 				if (!elt)
 					throw Exception("No such tag {}", asString(tag));
+				elt->value().decode();
 				return boost::get<T>(elt->value().value());
 			}
 
@@ -77,6 +78,7 @@ namespace emdl
 			{
 				if (!dataSet[tag])
 					dataSet.set(tag);
+				dataSet[tag]->value().decode();
 				return boost::get<T>(dataSet[tag]->value().value());
 			}
 		}
@@ -87,7 +89,7 @@ namespace emdl
 		{
 		public:
 			using value_type = T;
-			using variant_type = std::vector<T>;
+			using variant_type = typename ValueList<T>::type;
 
 			explicit Field(const BaseField::BaseInitField& init)
 				: BaseField(init)
@@ -105,13 +107,13 @@ namespace emdl
 			}
 		};
 
-		// Templated base class for vector fields
-		template <class T>
-		class Field<std::vector<T>> : public BaseField
+		// Templated base class for list fields
+		template <class T, std::size_t N>
+		class Field<SmallVector<T, N>> : public BaseField
 		{
 		public:
-			using value_type = std::vector<T>;
-			using variant_type = std::vector<T>;
+			using value_type = SmallVector<T, N>;
+			using variant_type = SmallVector<T, N>;
 
 			explicit Field(const BaseField::BaseInitField& init)
 				: BaseField(init)
@@ -4284,6 +4284,8 @@ namespace emdl
 				{"60xx1500", {"Overlay Label", "OverlayLabel", "LO", "1"}},
 				{"60xx3000", {"Overlay Data", "OverlayData", "OB or OW", "1"}},
 				{"60xx4000", {"Overlay Comments", "OverlayComments", "LT", "1"}},
+				{Tag{0x7fe0, 0x0001}, {"Extended Offset Table", "ExtendedOffsetTable", "OV", "1"}},
+				{Tag{0x7fe0, 0x0002}, {"Extended Offset Table Lengths", "ExtendedOffsetTableLengths", "OV", "1"}},
 				{Tag{0x7fe0, 0x0008}, {"Float Pixel Data", "FloatPixelData", "OF", "1"}},
 				{Tag{0x7fe0, 0x0009}, {"Double Float Pixel Data", "DoubleFloatPixelData", "OD", "1"}},
 				{Tag{0x7fe0, 0x0010}, {"Pixel Data", "PixelData", "OB or OW", "1"}},
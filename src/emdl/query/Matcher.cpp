@@ -0,0 +1,339 @@
+#include <emdl/query/Matcher.h>
+
+#include <emdl/types/DateTimeParser.h>
+#include <emdl/registry.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+	using namespace emdl;
+	using namespace emdl::query;
+
+	const std::string dtLowerTemplate = "00000101000000";
+	const std::string dtUpperTemplate = "99991231235959.999999";
+	const std::string tmUpperTemplate = "235959.999999";
+
+	bool isDateTimeVR(VR vr)
+	{
+		return vr == VR::DA || vr == VR::TM || vr == VR::DT;
+	}
+
+	bool isDigits(const std::string& str)
+	{
+		return std::all_of(str.begin(), str.end(), [](char c) { return c >= '0' && c <= '9'; });
+	}
+
+	// Position of the separator of a range, or npos. In a DT value, "-HHMM" at the end of a bound is a time zone offset.
+	size_t findRangeSeparator(const std::string& value, VR vr)
+	{
+		for (size_t pos = value.find('-'); pos != std::string::npos; pos = value.find('-', pos + 1))
+		{
+			if (vr != VR::DT || pos == 0)
+				return pos;
+
+			const auto next = value.find('-', pos + 1);
+			const auto length = (next == std::string::npos ? value.size() : next) - pos - 1;
+			const bool timeZone = length == 4 && isDigits(value.substr(pos + 1, 4));
+			if (!timeZone)
+				return pos;
+		}
+		return std::string::npos;
+	}
+
+	// Complete a partial value with the end of a template, keeping the time zone offset of a DT value at the end
+	std::string complete(const std::string& value, const std::string& completion)
+	{
+		auto body = value;
+		std::string timeZone;
+		const auto pos = value.find_last_of("+-");
+		if (pos != std::string::npos && pos >= 4)
+		{
+			body = value.substr(0, pos);
+			timeZone = value.substr(pos);
+		}
+
+		if (body.size() < completion.size())
+			body += completion.substr(body.size());
+		return body + timeZone;
+	}
+
+	// Encode a DA, TM or DT value so that it can be compared as an integer, returns false if it is not valid
+	bool encode(VR vr, const std::string& value, int64_t& encoded)
+	{
+		const ArrayView<const char> view(value.data(), value.size());
+		switch (vr)
+		{
+		case VR::DA:
+		{
+			types::Date date;
+			if (types::parseDate(view, date) != types::ParseResult::Ok)
+				return false;
+			encoded = types::encodeDate(date);
+			return true;
+		}
+
+		case VR::TM:
+		{
+			types::Time time;
+			if (types::parseTime(view, time) != types::ParseResult::Ok)
+				return false;
+			encoded = types::encodeTime(time);
+			return true;
+		}
+
+		case VR::DT:
+		{
+			types::DateTime dateTime;
+			if (types::parseDateTime(view, dateTime) != types::ParseResult::Ok)
+				return false;
+			encoded = types::encodeDateTime(dateTime);
+			return true;
+		}
+
+		default:
+			return false;
+		}
+	}
+
+	bool inRange(const MatchKey& key, const std::string& value)
+	{
+		if (value.empty())
+			return false;
+
+		// Fast path for the usual YYYYMMDD form, ordered like the strings
+		if (key.vr == VR::DA && value.size() == 8 && (key.lower.empty() || key.lower.size() == 8) && (key.upper.empty() || key.upper.size() == 8))
+			return (key.lower.empty() || key.lower <= value) && (key.upper.empty() || value <= key.upper);
+
+		int64_t encoded;
+		if (!encode(key.vr, value, encoded))
+			return false; // Invalid values do not match
+		return key.lowerValue <= encoded && encoded <= key.upperValue;
+	}
+
+	bool matchValue(const MatchKey& key, const std::string& rawValue)
+	{
+		// The values of the key are already compiled with matchedValue, only PN values need to be converted
+		std::string converted;
+		const auto& value = (key.vr == VR::PN) ? (converted = matchedValue(key.vr, rawValue)) : rawValue;
+
+		switch (key.type)
+		{
+		case MatchType::SingleValue:
+		case MatchType::UIDList:
+			return std::find(key.values.begin(), key.values.end(), value) != key.values.end();
+
+		case MatchType::Wildcard:
+			return std::any_of(key.values.begin(), key.values.end(), [&value](const std::string& pattern) {
+				return matchWildcard(pattern, value);
+			});
+
+		case MatchType::Range:
+			return inRange(key, value);
+
+		default:
+			return false;
+		}
+	}
+}
+
+namespace emdl
+{
+	namespace query
+	{
+		MatchKey compileKey(Tag tag, const Element& element)
+		{
+			MatchKey key;
+			key.tag = tag;
+			key.vr = element.vr;
+
+			if (element.isDataSet())
+			{
+				const auto& items = element.asDataSet();
+				if (!items.empty())
+					key.items = compileKeys(items.front());
+
+				const bool universal = std::all_of(key.items.begin(), key.items.end(), [](const MatchKey& item) {
+					return item.type == MatchType::Universal;
+				});
+				if (!universal)
+					key.type = MatchType::Sequence;
+				return key;
+			}
+
+			if (element.isString())
+				key.values.assign(element.asString().begin(), element.asString().end());
+			else if (element.isInt())
+			{
+				for (const auto value : element.asInt())
+					key.values.push_back(std::to_string(value));
+			}
+			else
+				return key; // Reals and binary values are only returned
+
+			key.values.erase(std::remove(key.values.begin(), key.values.end(), std::string()), key.values.end());
+			if (key.values.empty())
+				return key;
+			for (auto& value : key.values)
+				value = matchedValue(key.vr, std::move(value));
+
+			if (isDateTimeVR(key.vr) && key.values.size() == 1)
+			{
+				const auto& value = key.values.front();
+				const auto pos = findRangeSeparator(value, key.vr);
+				if (pos != std::string::npos)
+				{
+					key.type = MatchType::Range;
+					key.lower = value.substr(0, pos);
+					key.upper = value.substr(pos + 1);
+
+					// Partial bounds include everything they cover
+					if (key.vr == VR::DT)
+					{
+						if (!key.lower.empty())
+							key.lower = complete(key.lower, dtLowerTemplate);
+						if (!key.upper.empty())
+							key.upper = complete(key.upper, dtUpperTemplate);
+					}
+					else if (key.vr == VR::TM && !key.upper.empty())
+						key.upper = complete(key.upper, tmUpperTemplate);
+
+					// Invalid bounds match nothing
+					key.lowerValue = std::numeric_limits<int64_t>::min();
+					key.upperValue = std::numeric_limits<int64_t>::max();
+					if ((!key.lower.empty() && !encode(key.vr, key.lower, key.lowerValue))
+						|| (!key.upper.empty() && !encode(key.vr, key.upper, key.upperValue)))
+					{
+						key.lowerValue = std::numeric_limits<int64_t>::max();
+						key.upperValue = std::numeric_limits<int64_t>::min();
+					}
+
+					key.values.clear();
+					return key;
+				}
+			}
+
+			if (key.vr == VR::UI)
+			{
+				key.type = key.values.size() > 1 ? MatchType::UIDList : MatchType::SingleValue;
+				return key;
+			}
+
+			const bool wildcard = !isDateTimeVR(key.vr) && std::any_of(key.values.begin(), key.values.end(), [](const std::string& value) {
+				return value.find_first_of("*?") != std::string::npos;
+			});
+			if (!wildcard)
+				key.type = MatchType::SingleValue;
+			else if (key.values.size() == 1 && key.values.front() == "*")
+				key.type = MatchType::Universal;
+			else
+				key.type = MatchType::Wildcard;
+
+			return key;
+		}
+
+		std::vector<MatchKey> compileKeys(const DataSet& identifier)
+		{
+			std::vector<MatchKey> keys;
+			for (const auto& it : identifier)
+			{
+				const auto tag = it.tag();
+				if (tag == registry::QueryRetrieveLevel || tag == registry::SpecificCharacterSet)
+					continue;
+				keys.push_back(compileKey(tag, it.element()));
+			}
+			return keys;
+		}
+
+		std::string matchedValue(VR vr, std::string value)
+		{
+			if (vr == VR::PN)
+			{
+				std::transform(value.begin(), value.end(), value.begin(), [](char c) {
+					return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+				});
+			}
+			return value;
+		}
+
+		bool matchWildcard(const std::string& pattern, const std::string& value)
+		{
+			size_t p = 0, v = 0;
+			size_t star = std::string::npos, starValue = 0;
+			while (v < value.size())
+			{
+				if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == value[v]))
+				{
+					++p;
+					++v;
+				}
+				else if (p < pattern.size() && pattern[p] == '*')
+				{
+					star = p++;
+					starValue = v;
+				}
+				else if (star != std::string::npos)
+				{
+					// Let the last star absorb one more character
+					p = star + 1;
+					v = ++starValue;
+				}
+				else
+					return false;
+			}
+
+			while (p < pattern.size() && pattern[p] == '*')
+				++p;
+			return p == pattern.size();
+		}
+
+		bool matches(const MatchKey& key, const Element* element)
+		{
+			if (key.type == MatchType::Universal)
+				return true;
+			if (!element || element->empty())
+				return false;
+
+			if (key.type == MatchType::Sequence)
+			{
+				if (!element->isDataSet())
+					return false;
+				const auto& items = element->asDataSet();
+				return std::any_of(items.begin(), items.end(), [&key](const DataSet& item) {
+					return matches(key.items, item);
+				});
+			}
+
+			if (element->isString())
+			{
+				const auto& values = element->asString();
+				return std::any_of(values.begin(), values.end(), [&key](const std::string& value) {
+					return matchValue(key, value);
+				});
+			}
+
+			if (element->isInt())
+			{
+				const auto& values = element->asInt();
+				return std::any_of(values.begin(), values.end(), [&key](Value::Integer value) {
+					return matchValue(key, std::to_string(value));
+				});
+			}
+
+			return false;
+		}
+
+		bool matches(const std::vector<MatchKey>& keys, const DataSet& dataSet)
+		{
+			for (const auto& key : keys)
+			{
+				const auto element = dataSet[key.tag];
+				if (!matches(key, element ? &*element : nullptr))
+					return false;
+			}
+			return true;
+		}
+
+	} // namespace query
+} // namespace emdl
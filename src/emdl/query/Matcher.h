@@ -0,0 +1,55 @@
+#pragma once
+
+#include <emdl/dataset/DataSet.h>
+
+#include <string>
+#include <vector>
+
+namespace emdl
+{
+	namespace query
+	{
+		//! Matching of a key attribute, PS3.4 C.2.2.2
+		enum class MatchType : uint8_t
+		{
+			Universal, // Empty value (or "*"): everything matches
+			SingleValue, // Equality with one of the values
+			Wildcard, // Pattern with * and ?
+			UIDList, // Equality with one of the UIDs
+			Range, // DA, TM or DT range "lower-upper", one of the bounds can be missing
+			Sequence // All the keys of the item must match one item of the sequence
+		};
+
+		//! Key attribute of a query, compiled once for all the candidates
+		struct EMDL_API MatchKey
+		{
+			Tag tag;
+			VR vr = VR::Unknown;
+			MatchType type = MatchType::Universal;
+			std::vector<std::string> values; // SingleValue, Wildcard and UIDList
+			std::string lower, upper; // Range, empty for a missing bound
+			int64_t lowerValue = 0, upperValue = 0; // Range, bounds encoded with encodeDate, encodeTime or encodeDateTime
+			std::vector<MatchKey> items; // Keys of the sequence item
+		};
+
+		//! Compile a key attribute
+		EMDL_API MatchKey compileKey(Tag tag, const Element& element);
+
+		//! Compile the key attributes of an identifier, except QueryRetrieveLevel and SpecificCharacterSet
+		EMDL_API std::vector<MatchKey> compileKeys(const DataSet& identifier);
+
+		//! Value as it is compared by the matching: PN values are matched case-insensitively, so their ASCII letters are upper cased
+		EMDL_API std::string matchedValue(VR vr, std::string value);
+
+		//! Test whether value matches the pattern, where * matches any sequence of characters and ? any single character
+		EMDL_API bool matchWildcard(const std::string& pattern, const std::string& value);
+
+		//! Test whether the element of a candidate (null if it does not have it) matches the key.
+		//! A multi-valued element matches if one of its values does.
+		EMDL_API bool matches(const MatchKey& key, const Element* element);
+
+		//! Test whether the data set matches all the keys
+		EMDL_API bool matches(const std::vector<MatchKey>& keys, const DataSet& dataSet);
+
+	} // namespace query
+} // namespace emdl
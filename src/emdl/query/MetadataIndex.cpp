@@ -0,0 +1,1003 @@
+#include <emdl/query/MetadataIndex.h>
+
+#include <emdl/dataset/DataSetAccessors.h>
+#include <emdl/dataset/DataSetBuilder.h>
+#include <emdl/dataset/reader/DataSetReader.h>
+#include <emdl/query/Matcher.h>
+#include <emdl/types/DateTimeParser.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <fmt/format.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+	using namespace emdl;
+	using namespace emdl::query;
+	namespace fs = boost::filesystem;
+
+	const char schemaMagic[8] = {'E', 'M', 'D', 'L', 'I', 'D', 'X', '1'};
+	const uint32_t schemaVersion = 2;
+	const uint64_t pendingRowsLimit = 4096;
+	const size_t internedStringsLimit = 1 << 16;
+
+	const char* schemaFileName = "schema.bin";
+	const char* heapFileName = "strings.dat";
+	const char* offsetsFileName = "strings.idx";
+	const char* pathsFileName = "paths.col";
+	const char* pathsHeapFileName = "paths.dat";
+
+	// Serialized column definition
+	struct ColumnRecord
+	{
+		uint16_t group, element;
+		uint8_t type, index;
+		uint8_t padding[2];
+	};
+
+	// Header of a bitmap index entry, followed by the words of the bitmap
+	struct BitmapEntry
+	{
+		int64_t value;
+		uint64_t count;
+	};
+
+	std::string filePath(const std::string& directory, const std::string& name)
+	{
+		return (fs::path(directory) / name).string();
+	}
+
+	std::string columnFileName(Tag tag)
+	{
+		return fmt::format("{:04x}{:04x}.col", tag.group, tag.element);
+	}
+
+	std::string indexFileName(const ColumnDefinition& column)
+	{
+		return fmt::format("{:04x}{:04x}.{}", column.tag.group, column.tag.element, column.index == IndexKind::Bitmap ? "bitmap" : "sorted");
+	}
+
+	size_t columnWidth(ColumnType type)
+	{
+		return type == ColumnType::Int ? sizeof(int64_t) : sizeof(uint32_t);
+	}
+
+	uint64_t fileSize(const std::string& path)
+	{
+		boost::system::error_code error;
+		const auto size = fs::file_size(path, error);
+		return error ? 0 : size;
+	}
+
+	void appendToFile(const std::string& path, const void* data, size_t size)
+	{
+		if (!size)
+			return;
+		std::ofstream out(path, std::ios::binary | std::ios::app);
+		out.write(static_cast<const char*>(data), size);
+		if (!out)
+			throw Exception("{} Cannot write to {}", LOG_POSITION, path);
+	}
+
+	std::vector<char> readWholeFile(const std::string& path)
+	{
+		std::vector<char> data(fileSize(path));
+		if (data.empty())
+			return data;
+		std::ifstream in(path, std::ios::binary);
+		in.read(data.data(), data.size());
+		if (!in)
+			throw Exception("{} Cannot read {}", LOG_POSITION, path);
+		return data;
+	}
+
+	template <class T>
+	void appendRaw(std::vector<char>& out, T value)
+	{
+		const auto size = out.size();
+		out.resize(size + sizeof(T));
+		std::memcpy(out.data() + size, &value, sizeof(T));
+	}
+
+	template <class T>
+	T readRaw(const char* data, uint64_t position)
+	{
+		T value;
+		std::memcpy(&value, data + position * sizeof(T), sizeof(T));
+		return value;
+	}
+
+	// Read one value of a file, without loading the whole file
+	template <class T>
+	T readRaw(const std::string& path, uint64_t position)
+	{
+		T value;
+		std::ifstream in(path, std::ios::binary);
+		in.seekg(position * sizeof(T));
+		in.read(reinterpret_cast<char*>(&value), sizeof(T));
+		if (!in)
+			throw Exception("{} Cannot read {}", LOG_POSITION, path);
+		return value;
+	}
+
+	void writeSchema(const std::string& path, const IndexSchema& schema)
+	{
+		std::vector<char> data(schemaMagic, schemaMagic + sizeof(schemaMagic));
+		appendRaw(data, schemaVersion);
+		appendRaw(data, static_cast<uint32_t>(schema.columns.size()));
+		for (const auto& column : schema.columns)
+		{
+			ColumnRecord record = {};
+			record.group = column.tag.group;
+			record.element = column.tag.element;
+			record.type = static_cast<uint8_t>(column.type);
+			record.index = static_cast<uint8_t>(column.index);
+			appendRaw(data, record);
+		}
+		appendToFile(path, data.data(), data.size());
+	}
+
+	IndexSchema readSchema(const std::string& path)
+	{
+		const auto data = readWholeFile(path);
+		const auto headerSize = sizeof(schemaMagic) + 2 * sizeof(uint32_t);
+		if (data.size() < headerSize || std::memcmp(data.data(), schemaMagic, sizeof(schemaMagic)))
+			throw Exception("{} {} is not the schema of a metadata index", LOG_POSITION, path);
+
+		uint32_t version, nbColumns;
+		std::memcpy(&version, data.data() + sizeof(schemaMagic), sizeof(uint32_t));
+		std::memcpy(&nbColumns, data.data() + sizeof(schemaMagic) + sizeof(uint32_t), sizeof(uint32_t));
+		if (version != schemaVersion)
+			throw Exception("{} Unsupported metadata index version {}", LOG_POSITION, version);
+		if (data.size() != headerSize + nbColumns * sizeof(ColumnRecord))
+			throw Exception("{} Truncated metadata index schema {}", LOG_POSITION, path);
+
+		IndexSchema schema;
+		for (uint32_t i = 0; i < nbColumns; ++i)
+		{
+			ColumnRecord record;
+			std::memcpy(&record, data.data() + headerSize + i * sizeof(ColumnRecord), sizeof(ColumnRecord));
+			schema.columns.push_back({Tag(record.group, record.element), static_cast<ColumnType>(record.type), static_cast<IndexKind>(record.index)});
+		}
+		return schema;
+	}
+
+	// First value of an element as a string, empty if missing
+	std::string firstValue(const boost::optional<const Element&>& element)
+	{
+		if (!element || element->empty())
+			return {};
+		if (element->isString())
+			return element->asString().front();
+		if (element->isInt())
+			return std::to_string(element->asInt().front());
+		return {};
+	}
+
+	bool parseInt(const std::string& str, int64_t& value)
+	{
+		if (str.empty())
+			return false;
+		char* end = nullptr;
+		errno = 0;
+		value = std::strtoll(str.c_str(), &end, 10);
+		return errno == 0 && end == str.c_str() + str.size();
+	}
+
+	// YYYYMMDD as an integer, 0 if missing or invalid
+	int32_t dateValue(const std::string& str)
+	{
+		types::Date date;
+		if (types::parseDate({str.data(), str.size()}, date) != types::ParseResult::Ok)
+			return 0;
+		return date.year() * 10000 + date.month() * 100 + date.day();
+	}
+
+	std::string dateString(int64_t value)
+	{
+		return fmt::format("{:08d}", value);
+	}
+
+	// Tag identifying the entities of a query level
+	Tag levelKey(QueryLevel level)
+	{
+		switch (level)
+		{
+		case QueryLevel::Patient: return registry::PatientID;
+		case QueryLevel::Study: return registry::StudyInstanceUID;
+		case QueryLevel::Series: return registry::SeriesInstanceUID;
+		default: return registry::SOPInstanceUID;
+		}
+	}
+
+	// Index of the lowest bit set in a non zero word
+	unsigned int lowestBit(uint64_t word)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<unsigned int>(__builtin_ctzll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+		unsigned long index;
+		_BitScanForward64(&index, word);
+		return index;
+#else
+		unsigned int index = 0;
+		for (; !(word & 1); word >>= 1)
+			++index;
+		return index;
+#endif
+	}
+
+	// Mapping of a whole file, empty if the file is missing or empty
+	struct Mapping
+	{
+		boost::interprocess::file_mapping file;
+		boost::interprocess::mapped_region region;
+	};
+}
+
+namespace emdl
+{
+	namespace query
+	{
+		boost::optional<size_t> IndexSchema::find(Tag tag) const
+		{
+			const auto it = std::find_if(columns.begin(), columns.end(), [tag](const ColumnDefinition& column) {
+				return column.tag == tag;
+			});
+			if (it == columns.end())
+				return {};
+			return static_cast<size_t>(it - columns.begin());
+		}
+
+		IndexSchema IndexSchema::defaultSchema()
+		{
+			IndexSchema schema;
+			schema.columns = {
+				{registry::PatientID, ColumnType::String, IndexKind::Sorted},
+				{registry::PatientName, ColumnType::String, IndexKind::None},
+				{registry::PatientBirthDate, ColumnType::Date, IndexKind::None},
+				{registry::PatientSex, ColumnType::String, IndexKind::None},
+				{registry::StudyInstanceUID, ColumnType::String, IndexKind::Sorted},
+				{registry::StudyDate, ColumnType::Date, IndexKind::Sorted},
+				{registry::StudyTime, ColumnType::String, IndexKind::None},
+				{registry::AccessionNumber, ColumnType::String, IndexKind::Sorted},
+				{registry::StudyDescription, ColumnType::String, IndexKind::None},
+				{registry::SeriesInstanceUID, ColumnType::String, IndexKind::Sorted},
+				{registry::Modality, ColumnType::String, IndexKind::Bitmap},
+				{registry::SeriesNumber, ColumnType::Int, IndexKind::None},
+				{registry::SOPInstanceUID, ColumnType::String, IndexKind::Sorted},
+				{registry::SOPClassUID, ColumnType::String, IndexKind::Bitmap},
+				{registry::InstanceNumber, ColumnType::Int, IndexKind::None}};
+			return schema;
+		}
+
+		/*****************************************************************************/
+
+		IndexWriter::IndexWriter(const std::string& directory, const IndexSchema& schema)
+			: m_directory(directory)
+		{
+			fs::create_directories(directory);
+			const auto schemaPath = filePath(directory, schemaFileName);
+			if (fs::exists(schemaPath))
+				m_schema = readSchema(schemaPath);
+			else
+			{
+				if (schema.columns.empty())
+					throw Exception("{} The schema of a metadata index needs at least one column", LOG_POSITION);
+				writeSchema(schemaPath, schema);
+				m_schema = schema;
+			}
+
+			// Drop what an interrupted flush may have left after the last complete string.
+			// The strings are not loaded: those appended from now on get new identifiers.
+			const auto offsetsPath = filePath(directory, offsetsFileName);
+			const auto heapPath = filePath(directory, heapFileName);
+			const auto heapSize = fileSize(heapPath);
+			auto nbStrings = fileSize(offsetsPath) / sizeof(uint64_t);
+			while (nbStrings && readRaw<uint64_t>(offsetsPath, nbStrings - 1) > heapSize)
+				--nbStrings;
+
+			m_heapSize = nbStrings ? readRaw<uint64_t>(offsetsPath, nbStrings - 1) : 0;
+			m_nbStrings = nbStrings;
+			if (!m_nbStrings)
+			{
+				m_pendingOffsets.push_back(0); // The empty string
+				m_nbStrings = 1;
+			}
+			if (fs::exists(offsetsPath))
+			{
+				fs::resize_file(offsetsPath, nbStrings * sizeof(uint64_t));
+				fs::resize_file(heapPath, m_heapSize);
+			}
+
+			// The rows are those present in all the columns
+			std::vector<std::pair<std::string, size_t>> columnFiles;
+			for (const auto& column : m_schema.columns)
+				columnFiles.emplace_back(filePath(directory, columnFileName(column.tag)), columnWidth(column.type));
+			const auto pathsPath = filePath(directory, pathsFileName);
+			columnFiles.emplace_back(pathsPath, sizeof(uint64_t));
+
+			m_rows = std::numeric_limits<uint64_t>::max();
+			for (const auto& file : columnFiles)
+				m_rows = std::min(m_rows, fileSize(file.first) / file.second);
+			for (const auto& file : columnFiles)
+			{
+				if (fs::exists(file.first))
+					fs::resize_file(file.first, m_rows * file.second);
+			}
+
+			// The paths column holds the end of each path in their heap
+			const auto pathsHeapPath = filePath(directory, pathsHeapFileName);
+			m_pathsSize = m_rows ? readRaw<uint64_t>(pathsPath, m_rows - 1) : 0;
+			if (fs::exists(pathsHeapPath))
+				fs::resize_file(pathsHeapPath, m_pathsSize);
+
+			m_pendingColumns.resize(columnFiles.size());
+		}
+
+		IndexWriter::~IndexWriter()
+		{
+			try
+			{
+				flush();
+			}
+			catch (const std::exception&)
+			{
+			}
+		}
+
+		uint32_t IndexWriter::intern(const std::string& str)
+		{
+			if (str.empty())
+				return 0;
+			const auto it = m_strings.find(str);
+			if (it != m_strings.end())
+				return it->second;
+
+			// Values that are repeated (modalities, study UIDs of consecutive instances) are found in the recent strings,
+			// unique ones (SOP instance UIDs) must not accumulate
+			if (m_strings.size() >= internedStringsLimit)
+				m_strings.clear();
+			if (m_nbStrings > std::numeric_limits<uint32_t>::max())
+				throw Exception("{} Too many strings in the metadata index {}", LOG_POSITION, m_directory);
+			const auto id = static_cast<uint32_t>(m_nbStrings++);
+			m_strings.emplace(str, id);
+			m_pendingHeap.insert(m_pendingHeap.end(), str.begin(), str.end());
+			m_heapSize += str.size();
+			m_pendingOffsets.push_back(m_heapSize);
+			return id;
+		}
+
+		void IndexWriter::append(const DataSet& dataSet, const std::string& filePath)
+		{
+			for (size_t i = 0; i < m_schema.columns.size(); ++i)
+			{
+				const auto& column = m_schema.columns[i];
+				auto& out = m_pendingColumns[i];
+				const auto element = dataSet[column.tag];
+				switch (column.type)
+				{
+				case ColumnType::Int:
+				{
+					int64_t value = 0;
+					if (element && element->isInt() && !element->empty())
+						value = element->asInt().front();
+					else if (!parseInt(firstValue(element), value))
+						value = 0;
+					appendRaw(out, value);
+					break;
+				}
+
+				case ColumnType::Date:
+					appendRaw(out, dateValue(firstValue(element)));
+					break;
+
+				default:
+					appendRaw(out, intern(firstValue(element)));
+					break;
+				}
+			}
+			m_pendingPaths.insert(m_pendingPaths.end(), filePath.begin(), filePath.end());
+			m_pathsSize += filePath.size();
+			appendRaw(m_pendingColumns.back(), m_pathsSize);
+
+			++m_rows;
+			if (++m_pendingRows >= pendingRowsLimit)
+				flush();
+		}
+
+		void IndexWriter::appendFile(const std::string& filePath)
+		{
+			// Stop after the last column, before reading the bulk data
+			auto lastTag = m_schema.columns.front().tag;
+			for (const auto& column : m_schema.columns)
+			{
+				if (lastTag < column.tag)
+					lastTag = column.tag;
+			}
+
+			const auto dataSets = DataSetReader::readFile(filePath, [lastTag](const Tag& tag) {
+				return lastTag < tag;
+			});
+			append(dataSets.dataSet, filePath);
+		}
+
+		void IndexWriter::flush()
+		{
+			// The strings and paths are written first, so that the rows never refer to missing ones
+			appendToFile(filePath(m_directory, heapFileName), m_pendingHeap.data(), m_pendingHeap.size());
+			appendToFile(filePath(m_directory, offsetsFileName), m_pendingOffsets.data(), m_pendingOffsets.size() * sizeof(uint64_t));
+			appendToFile(filePath(m_directory, pathsHeapFileName), m_pendingPaths.data(), m_pendingPaths.size());
+			m_pendingHeap.clear();
+			m_pendingOffsets.clear();
+			m_pendingPaths.clear();
+
+			for (size_t i = 0; i < m_pendingColumns.size(); ++i)
+			{
+				const auto name = i < m_schema.columns.size() ? columnFileName(m_schema.columns[i].tag) : std::string(pathsFileName);
+				appendToFile(filePath(m_directory, name), m_pendingColumns[i].data(), m_pendingColumns[i].size());
+				m_pendingColumns[i].clear();
+			}
+			m_pendingRows = 0;
+		}
+
+		void IndexWriter::buildIndexes()
+		{
+			flush();
+
+			// Interned strings, to sort the rows by value
+			const auto heap = readWholeFile(filePath(m_directory, heapFileName));
+			const auto offsets = readWholeFile(filePath(m_directory, offsetsFileName));
+			const auto stringAt = [&heap, &offsets](uint32_t id) {
+				const auto begin = id ? readRaw<uint64_t>(offsets.data(), id - 1) : 0;
+				const auto end = readRaw<uint64_t>(offsets.data(), id);
+				return std::make_pair(heap.data() + begin, static_cast<size_t>(end - begin));
+			};
+
+			for (const auto& column : m_schema.columns)
+			{
+				if (column.index == IndexKind::None)
+					continue;
+
+				const auto data = readWholeFile(filePath(m_directory, columnFileName(column.tag)));
+				std::vector<int64_t> values(m_rows);
+				for (uint64_t row = 0; row < m_rows; ++row)
+				{
+					if (column.type == ColumnType::Int)
+						values[row] = readRaw<int64_t>(data.data(), row);
+					else if (column.type == ColumnType::Date)
+						values[row] = readRaw<int32_t>(data.data(), row);
+					else
+						values[row] = readRaw<uint32_t>(data.data(), row);
+				}
+
+				std::vector<char> out;
+				appendRaw(out, m_rows);
+				if (column.index == IndexKind::Sorted)
+				{
+					if (m_rows > std::numeric_limits<uint32_t>::max())
+						throw Exception("{} Too many rows in the metadata index {} for a sorted index: {}", LOG_POSITION, m_directory, m_rows);
+					std::vector<uint32_t> rows(m_rows);
+					for (uint64_t row = 0; row < m_rows; ++row)
+						rows[row] = static_cast<uint32_t>(row);
+
+					if (column.type == ColumnType::String)
+					{
+						// Ids are ordered by first appearance, not by value
+						std::vector<uint32_t> ids(values.size());
+						std::transform(values.begin(), values.end(), ids.begin(), [](int64_t value) { return static_cast<uint32_t>(value); });
+						std::stable_sort(rows.begin(), rows.end(), [&](uint32_t a, uint32_t b) {
+							if (ids[a] == ids[b])
+								return false;
+							const auto lhs = stringAt(ids[a]), rhs = stringAt(ids[b]);
+							const auto result = std::memcmp(lhs.first, rhs.first, std::min(lhs.second, rhs.second));
+							return result ? result < 0 : lhs.second < rhs.second;
+						});
+					}
+					else
+						std::stable_sort(rows.begin(), rows.end(), [&values](uint32_t a, uint32_t b) { return values[a] < values[b]; });
+
+					out.insert(out.end(), reinterpret_cast<const char*>(rows.data()), reinterpret_cast<const char*>(rows.data() + rows.size()));
+				}
+				else
+				{
+					// Equal strings can have several identifiers (see intern): each one is replaced by the first identifier of its value
+					if (column.type == ColumnType::String)
+					{
+						std::unordered_map<int64_t, int64_t> firstIds;
+						std::unordered_map<std::string, int64_t> valueIds;
+						for (auto& value : values)
+						{
+							auto it = firstIds.find(value);
+							if (it == firstIds.end())
+							{
+								const auto str = stringAt(static_cast<uint32_t>(value));
+								const auto first = valueIds.emplace(std::string(str.first, str.second), value).first->second;
+								it = firstIds.emplace(value, first).first;
+							}
+							value = it->second;
+						}
+					}
+
+					std::vector<int64_t> distinct(values);
+					std::sort(distinct.begin(), distinct.end());
+					distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+
+					// The bitmaps of all the values are filled in a single pass over the rows
+					const auto nbWords = (m_rows + 63) / 64;
+					std::vector<uint64_t> words(distinct.size() * nbWords);
+					std::vector<uint64_t> counts(distinct.size());
+					for (uint64_t row = 0; row < m_rows; ++row)
+					{
+						const auto index = std::lower_bound(distinct.begin(), distinct.end(), values[row]) - distinct.begin();
+						words[index * nbWords + row / 64] |= uint64_t(1) << (row % 64);
+						++counts[index];
+					}
+
+					appendRaw(out, static_cast<uint64_t>(distinct.size()));
+					for (size_t i = 0; i < distinct.size(); ++i)
+					{
+						appendRaw(out, BitmapEntry{distinct[i], counts[i]});
+						const auto begin = reinterpret_cast<const char*>(words.data() + i * nbWords);
+						out.insert(out.end(), begin, begin + nbWords * sizeof(uint64_t));
+					}
+				}
+
+				// Replace the file, readers keep their mapping of the previous one
+				const auto path = filePath(m_directory, indexFileName(column));
+				const auto tempPath = path + ".tmp";
+				fs::remove(tempPath);
+				appendToFile(tempPath, out.data(), out.size());
+				fs::rename(tempPath, path);
+			}
+		}
+
+		uint64_t IndexWriter::size() const
+		{
+			return m_rows;
+		}
+
+		const IndexSchema& IndexWriter::schema() const
+		{
+			return m_schema;
+		}
+
+		/*****************************************************************************/
+
+		struct IndexReader::MappedFile
+		{
+			explicit MappedFile(const std::string& path)
+			{
+				if (!fileSize(path))
+					return;
+				mapping.file = boost::interprocess::file_mapping(path.c_str(), boost::interprocess::read_only);
+				mapping.region = boost::interprocess::mapped_region(mapping.file, boost::interprocess::read_only);
+				data = static_cast<const char*>(mapping.region.get_address());
+				size = mapping.region.get_size();
+			}
+
+			Mapping mapping;
+			const char* data = nullptr;
+			uint64_t size = 0;
+		};
+
+		struct IndexReader::Predicate
+		{
+			size_t column = 0;
+			const MatchKey* key = nullptr;
+			bool native = false; // Evaluated on the stored values, else through matches()
+			std::vector<int64_t> values; // SingleValue of Int and Date columns
+			int64_t lower = 1, upper = std::numeric_limits<int64_t>::max(); // Range of Date columns
+		};
+
+		IndexReader::IndexReader(const std::string& directory)
+			: m_directory(directory)
+			, m_schema(readSchema(filePath(directory, schemaFileName)))
+		{
+			refresh();
+		}
+
+		IndexReader::~IndexReader() = default;
+
+		void IndexReader::refresh()
+		{
+			// Mapped in the reverse order of IndexWriter::flush: the strings and paths mapped afterwards include all those the rows refer to
+			m_columns.clear();
+			m_indexes.clear();
+			m_rows = std::numeric_limits<uint64_t>::max();
+			for (const auto& column : m_schema.columns)
+			{
+				m_columns.emplace_back(new MappedFile(filePath(m_directory, columnFileName(column.tag))));
+				m_rows = std::min(m_rows, m_columns.back()->size / columnWidth(column.type));
+				m_indexes.emplace_back(column.index != IndexKind::None ? new MappedFile(filePath(m_directory, indexFileName(column))) : nullptr);
+			}
+			m_columns.emplace_back(new MappedFile(filePath(m_directory, pathsFileName)));
+			m_rows = std::min(m_rows, m_columns.back()->size / sizeof(uint64_t));
+
+			m_offsets.reset(new MappedFile(filePath(m_directory, offsetsFileName)));
+			m_heap.reset(new MappedFile(filePath(m_directory, heapFileName)));
+			m_paths.reset(new MappedFile(filePath(m_directory, pathsHeapFileName)));
+
+			// Ignore the strings being written
+			m_nbStrings = m_offsets->size / sizeof(uint64_t);
+			while (m_nbStrings && readRaw<uint64_t>(m_offsets->data, m_nbStrings - 1) > m_heap->size)
+				--m_nbStrings;
+		}
+
+		uint64_t IndexReader::size() const
+		{
+			return m_rows;
+		}
+
+		const IndexSchema& IndexReader::schema() const
+		{
+			return m_schema;
+		}
+
+		std::pair<const char*, size_t> IndexReader::stringRef(uint32_t id) const
+		{
+			if (!id || id >= m_nbStrings)
+				return {"", 0};
+			const auto begin = readRaw<uint64_t>(m_offsets->data, id - 1);
+			const auto end = readRaw<uint64_t>(m_offsets->data, id);
+			return {m_heap->data + begin, static_cast<size_t>(end - begin)};
+		}
+
+		int IndexReader::compareString(uint32_t id, const std::string& value) const
+		{
+			const auto str = stringRef(id);
+			const auto result = std::memcmp(str.first, value.data(), std::min(str.second, value.size()));
+			if (result)
+				return result;
+			return str.second < value.size() ? -1 : (str.second > value.size() ? 1 : 0);
+		}
+
+		int64_t IndexReader::valueAt(size_t column, uint64_t row) const
+		{
+			const auto data = m_columns[column]->data;
+			if (column == m_schema.columns.size())
+				return static_cast<int64_t>(readRaw<uint64_t>(data, row));
+
+			switch (m_schema.columns[column].type)
+			{
+			case ColumnType::Int: return readRaw<int64_t>(data, row);
+			case ColumnType::Date: return readRaw<int32_t>(data, row);
+			default: return readRaw<uint32_t>(data, row);
+			}
+		}
+
+		std::string IndexReader::getString(uint64_t row, Tag tag) const
+		{
+			const auto column = m_schema.find(tag);
+			if (!column || m_schema.columns[*column].type != ColumnType::String)
+				throw Exception("{} {} is not a string column of the metadata index", LOG_POSITION, emdl::asString(tag));
+			if (row >= m_rows)
+				throw Exception("{} Row {} out of range", LOG_POSITION, row);
+			const auto str = stringRef(static_cast<uint32_t>(valueAt(*column, row)));
+			return std::string(str.first, str.second);
+		}
+
+		int64_t IndexReader::getInt(uint64_t row, Tag tag) const
+		{
+			const auto column = m_schema.find(tag);
+			if (!column || m_schema.columns[*column].type == ColumnType::String)
+				throw Exception("{} {} is not an integer or date column of the metadata index", LOG_POSITION, emdl::asString(tag));
+			if (row >= m_rows)
+				throw Exception("{} Row {} out of range", LOG_POSITION, row);
+			return valueAt(*column, row);
+		}
+
+		std::string IndexReader::path(uint64_t row) const
+		{
+			if (row >= m_rows)
+				throw Exception("{} Row {} out of range", LOG_POSITION, row);
+			const auto paths = m_schema.columns.size();
+			const auto begin = row ? static_cast<uint64_t>(valueAt(paths, row - 1)) : 0;
+			const auto end = static_cast<uint64_t>(valueAt(paths, row));
+			if (begin > end || end > m_paths->size)
+				throw Exception("{} Invalid path of row {}", LOG_POSITION, row);
+			return std::string(m_paths->data + begin, m_paths->data + end);
+		}
+
+		bool IndexReader::testValue(const Predicate& predicate, int64_t value) const
+		{
+			if (!value)
+				return false; // Missing values only match universal keys
+
+			const auto& key = *predicate.key;
+			const auto type = m_schema.columns[predicate.column].type;
+			if (type == ColumnType::String)
+			{
+				const auto id = static_cast<uint32_t>(value);
+				switch (key.type)
+				{
+				case MatchType::SingleValue:
+				case MatchType::UIDList:
+					return std::any_of(key.values.begin(), key.values.end(), [&](const std::string& keyValue) {
+						return compareString(id, keyValue) == 0;
+					});
+
+				default:
+				{
+					const auto str = stringRef(id);
+					const Element element({std::string(str.first, str.second)}, key.vr);
+					return matches(key, &element);
+				}
+				}
+			}
+
+			if (predicate.native)
+			{
+				if (key.type == MatchType::Range)
+					return predicate.lower <= value && value <= predicate.upper;
+				return std::find(predicate.values.begin(), predicate.values.end(), value) != predicate.values.end();
+			}
+
+			const Element element({type == ColumnType::Date ? dateString(value) : std::to_string(value)}, key.vr);
+			return matches(key, &element);
+		}
+
+		bool IndexReader::indexCandidates(const Predicate& predicate, std::vector<uint64_t>* rows, uint64_t& count, uint64_t& indexedRows) const
+		{
+			const auto& column = m_schema.columns[predicate.column];
+			const auto& file = m_indexes[predicate.column];
+			if (!file || file->size < sizeof(uint64_t))
+				return false;
+			indexedRows = readRaw<uint64_t>(file->data, 0);
+			const auto& key = *predicate.key;
+			count = 0;
+
+			if (column.index == IndexKind::Bitmap)
+			{
+				const auto nbWords = (indexedRows + 63) / 64;
+				const auto entrySize = sizeof(BitmapEntry) + nbWords * sizeof(uint64_t);
+				const auto nbEntries = readRaw<uint64_t>(file->data + sizeof(uint64_t), 0);
+				const auto entries = file->data + 2 * sizeof(uint64_t);
+
+				// Each distinct value is tested once
+				for (uint64_t i = 0; i < nbEntries; ++i)
+				{
+					const auto entry = readRaw<BitmapEntry>(entries + i * entrySize, 0);
+					if (!testValue(predicate, entry.value))
+						continue;
+					count += entry.count;
+					if (!rows)
+						continue;
+
+					const auto words = entries + i * entrySize + sizeof(BitmapEntry);
+					for (uint64_t w = 0; w < nbWords; ++w)
+					{
+						for (auto word = readRaw<uint64_t>(words, w); word; word &= word - 1)
+							rows->push_back(w * 64 + lowestBit(word));
+					}
+				}
+				return true;
+			}
+
+			// Sorted index: ranges of rows for equality, prefix and date or integer ranges
+			const auto begin = reinterpret_cast<const uint32_t*>(file->data + sizeof(uint64_t));
+			const auto end = begin + std::min<uint64_t>(indexedRows, (file->size - sizeof(uint64_t)) / sizeof(uint32_t));
+			std::vector<std::pair<const uint32_t*, const uint32_t*>> ranges;
+
+			if (column.type == ColumnType::String)
+			{
+				const auto id = [this, &predicate](uint32_t row) { return static_cast<uint32_t>(valueAt(predicate.column, row)); };
+				if (key.type == MatchType::SingleValue || key.type == MatchType::UIDList)
+				{
+					for (const auto& value : key.values)
+					{
+						const auto first = std::lower_bound(begin, end, value, [&](uint32_t row, const std::string& v) { return compareString(id(row), v) < 0; });
+						const auto last = std::upper_bound(first, end, value, [&](const std::string& v, uint32_t row) { return compareString(id(row), v) > 0; });
+						ranges.emplace_back(first, last);
+					}
+				}
+				else if (key.type == MatchType::Wildcard)
+				{
+					for (const auto& pattern : key.values)
+					{
+						const auto prefix = pattern.substr(0, pattern.find_first_of("*?"));
+						if (prefix.empty())
+							return false;
+						const auto first = std::lower_bound(begin, end, prefix, [&](uint32_t row, const std::string& v) { return compareString(id(row), v) < 0; });
+						const auto last = std::partition_point(first, end, [&](uint32_t row) {
+							const auto str = stringRef(id(row));
+							return str.second >= prefix.size() && !std::memcmp(str.first, prefix.data(), prefix.size());
+						});
+						ranges.emplace_back(first, last);
+					}
+				}
+				else
+					return false;
+			}
+			else
+			{
+				if (!predicate.native)
+					return false;
+				const auto value = [this, &predicate](uint32_t row) { return valueAt(predicate.column, row); };
+				if (key.type == MatchType::Range)
+				{
+					const auto first = std::lower_bound(begin, end, predicate.lower, [&](uint32_t row, int64_t v) { return value(row) < v; });
+					const auto last = std::upper_bound(first, end, predicate.upper, [&](int64_t v, uint32_t row) { return v < value(row); });
+					ranges.emplace_back(first, last);
+				}
+				else
+				{
+					for (const auto v : predicate.values)
+					{
+						const auto first = std::lower_bound(begin, end, v, [&](uint32_t row, int64_t x) { return value(row) < x; });
+						const auto last = std::upper_bound(first, end, v, [&](int64_t x, uint32_t row) { return x < value(row); });
+						ranges.emplace_back(first, last);
+					}
+				}
+			}
+
+			for (const auto& range : ranges)
+			{
+				count += range.second - range.first;
+				if (rows)
+					rows->insert(rows->end(), range.first, range.second);
+			}
+			if (rows)
+			{
+				std::sort(rows->begin(), rows->end());
+				rows->erase(std::unique(rows->begin(), rows->end()), rows->end());
+			}
+			return true;
+		}
+
+		std::vector<uint64_t> IndexReader::find(const DataSet& identifier) const
+		{
+			const auto levelValue = firstString(identifier, registry::QueryRetrieveLevel);
+			if (!levelValue)
+				throw Exception("{} Missing query retrieve level", LOG_POSITION);
+			const auto level = asQueryLevel(*levelValue);
+
+			const auto keys = compileKeys(identifier);
+			std::vector<Predicate> predicates;
+			for (const auto& key : keys)
+			{
+				const auto column = m_schema.find(key.tag);
+				if (!column || key.type == MatchType::Universal || key.type == MatchType::Sequence)
+					continue;
+
+				Predicate predicate;
+				predicate.column = *column;
+				predicate.key = &key;
+				const auto type = m_schema.columns[*column].type;
+				if (type == ColumnType::Date && key.type == MatchType::Range && key.vr == VR::DA)
+				{
+					const auto lower = key.lower.empty() ? 1 : dateValue(key.lower);
+					const auto upper = key.upper.empty() ? std::numeric_limits<int32_t>::max() : dateValue(key.upper);
+					predicate.native = lower && upper;
+					predicate.lower = lower;
+					predicate.upper = upper;
+				}
+				else if (type != ColumnType::String && key.type == MatchType::SingleValue)
+				{
+					predicate.native = std::all_of(key.values.begin(), key.values.end(), [&](const std::string& value) {
+						int64_t number = 0;
+						if (type == ColumnType::Date)
+							number = dateValue(value);
+						else if (!parseInt(value, number))
+							return false;
+						predicate.values.push_back(number);
+						return number != 0;
+					});
+				}
+				predicates.push_back(std::move(predicate));
+			}
+
+			// Use the index giving the fewest candidates, and scan the rows appended after it was built
+			const Predicate* best = nullptr;
+			uint64_t bestCount = std::numeric_limits<uint64_t>::max(), indexedRows = 0;
+			for (const auto& predicate : predicates)
+			{
+				uint64_t count = 0, rows = 0;
+				if (indexCandidates(predicate, nullptr, count, rows) && count < bestCount)
+				{
+					best = &predicate;
+					bestCount = count;
+				}
+			}
+
+			std::vector<uint64_t> candidates;
+			if (best)
+			{
+				uint64_t count = 0;
+				indexCandidates(*best, &candidates, count, indexedRows);
+				candidates.erase(std::lower_bound(candidates.begin(), candidates.end(), m_rows), candidates.end());
+			}
+			for (auto row = std::min(indexedRows, m_rows); row < m_rows; ++row)
+				candidates.push_back(row);
+
+			// One row per entity of the level. Equal strings can have different identifiers, so they are compared by value.
+			const auto keyColumn = m_schema.find(levelKey(level));
+			const bool stringKey = keyColumn && m_schema.columns[*keyColumn].type == ColumnType::String;
+			std::unordered_set<int64_t> entities;
+			std::unordered_set<std::string> stringEntities;
+			std::vector<uint64_t> result;
+			for (const auto row : candidates)
+			{
+				const bool match = std::all_of(predicates.begin(), predicates.end(), [&](const Predicate& predicate) {
+					return testValue(predicate, valueAt(predicate.column, row));
+				});
+				if (!match)
+					continue;
+				if (stringKey)
+				{
+					const auto str = stringRef(static_cast<uint32_t>(valueAt(*keyColumn, row)));
+					if (!stringEntities.emplace(str.first, str.second).second)
+						continue;
+				}
+				else if (keyColumn && !entities.insert(valueAt(*keyColumn, row)).second)
+					continue;
+				result.push_back(row);
+			}
+			return result;
+		}
+
+		DataSet IndexReader::response(uint64_t row, const DataSet& identifier) const
+		{
+			if (row >= m_rows)
+				throw Exception("{} Row {} out of range", LOG_POSITION, row);
+
+			DataSetBuilder response;
+			const auto levelValue = firstString(identifier, registry::QueryRetrieveLevel);
+			if (levelValue)
+				response.add(registry::QueryRetrieveLevel, {*levelValue}, VR::CS);
+
+			for (const auto& it : identifier)
+			{
+				const auto tag = it.tag();
+				if (tag == registry::QueryRetrieveLevel || tag == registry::SpecificCharacterSet)
+					continue;
+
+				const auto vr = it.element().vr != VR::Unknown ? it.element().vr : findVR(tag);
+				Element element(vr);
+				const auto column = m_schema.find(tag);
+				const auto value = column ? valueAt(*column, row) : 0;
+				if (value)
+				{
+					switch (m_schema.columns[*column].type)
+					{
+					case ColumnType::Int:
+						if (element.isInt())
+							element = Element(Value::Integers{static_cast<Value::Integer>(value)}, vr);
+						else
+							element = Element({std::to_string(value)}, vr);
+						break;
+
+					case ColumnType::Date:
+						element = Element({dateString(value)}, vr);
+						break;
+
+					default:
+					{
+						const auto str = stringRef(static_cast<uint32_t>(value));
+						element = Element({std::string(str.first, str.second)}, vr);
+						break;
+					}
+					}
+				}
+				response.add(tag, std::move(element));
+			}
+			return response.build();
+		}
+
+	} // namespace query
+} // namespace emdl
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <emdl/query/QueryModel.h>
+#include <emdl/dataset/DataSet.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace emdl
+{
+	namespace query
+	{
+		//! Storage of a column of a metadata index
+		enum class ColumnType : uint8_t
+		{
+			Int, // 64 bits integer
+			Date, // 32 bits YYYYMMDD, 0 if missing
+			String // 32 bits identifier of the string in the heap of strings, 0 for an empty string
+		};
+
+		//! Secondary index of a column, rebuilt by IndexWriter::buildIndexes
+		enum class IndexKind : uint8_t
+		{
+			None,
+			Sorted, // Rows sorted by value, for equality, prefix and range lookups
+			Bitmap // One bitmap of rows per value, for columns with few distinct values
+		};
+
+		struct EMDL_API ColumnDefinition
+		{
+			Tag tag;
+			ColumnType type = ColumnType::String;
+			IndexKind index = IndexKind::None;
+		};
+
+		//! Columns of a metadata index, one row per instance
+		struct EMDL_API IndexSchema
+		{
+			std::vector<ColumnDefinition> columns;
+
+			//! Position of the column of this tag, or empty
+			boost::optional<size_t> find(Tag tag) const;
+
+			//! Patient, study, series and instance keys. PatientID, StudyInstanceUID, StudyDate, AccessionNumber, SeriesInstanceUID
+			//! and SOPInstanceUID have a sorted index, Modality and SOPClassUID a bitmap index.
+			static IndexSchema defaultSchema();
+		};
+
+		//! Append rows to a metadata index, stored in a directory. Not thread safe.
+		//! The columns are written in fixed width files, the strings being stored in a heap shared by all the columns, and the paths in their own heap.
+		//! Only the recent strings are interned, so equal values can have different identifiers, and the memory used does not grow with the rows.
+		class EMDL_API IndexWriter
+		{
+		public:
+			//! Create the index in the directory, or open it to append rows if it already exists (the schema is then read from the directory)
+			explicit IndexWriter(const std::string& directory, const IndexSchema& schema = IndexSchema::defaultSchema());
+
+			//! Write the pending rows
+			~IndexWriter();
+
+			IndexWriter(const IndexWriter&) = delete;
+			IndexWriter& operator=(const IndexWriter&) = delete;
+
+			//! Append a row with the attributes of the data set, and the path of the file it comes from
+			void append(const DataSet& dataSet, const std::string& filePath);
+
+			//! Read the header of the file, stopping before the first element after the last column, and append it
+			void appendFile(const std::string& filePath);
+
+			//! Write the pending rows to the files, making them visible to IndexReader::refresh
+			void flush();
+
+			//! Write the pending rows, then rebuild the secondary indexes over all the rows
+			void buildIndexes();
+
+			//! Number of rows, including the pending ones
+			uint64_t size() const;
+
+			const IndexSchema& schema() const;
+
+		private:
+			uint32_t intern(const std::string& str);
+
+			std::string m_directory;
+			IndexSchema m_schema;
+			uint64_t m_rows = 0;
+
+			std::unordered_map<std::string, uint32_t> m_strings; // Recently interned strings
+			uint64_t m_nbStrings = 0;
+			std::vector<char> m_pendingHeap;
+			std::vector<uint64_t> m_pendingOffsets;
+			uint64_t m_heapSize = 0;
+
+			std::vector<char> m_pendingPaths;
+			uint64_t m_pathsSize = 0;
+
+			std::vector<std::vector<char>> m_pendingColumns; // One per column, then the paths
+			uint64_t m_pendingRows = 0;
+		};
+
+		//! Read only access to a metadata index, through memory mapped files.
+		//! Several readers can be used at the same time as a writer: they see the rows written before their last refresh.
+		class EMDL_API IndexReader
+		{
+		public:
+			explicit IndexReader(const std::string& directory);
+			~IndexReader();
+
+			IndexReader(const IndexReader&) = delete;
+			IndexReader& operator=(const IndexReader&) = delete;
+
+			//! Map the files again, to see the rows written since the last call
+			void refresh();
+
+			//! Number of rows
+			uint64_t size() const;
+
+			const IndexSchema& schema() const;
+
+			//! Value of a String column, empty if missing
+			std::string getString(uint64_t row, Tag tag) const;
+
+			//! Value of an Int or Date column (YYYYMMDD), 0 if missing
+			int64_t getInt(uint64_t row, Tag tag) const;
+
+			//! Path of the file of the row
+			std::string path(uint64_t row) const;
+
+			//! Rows matching all the keys of the identifier (using the Matcher semantics), keeping only one row per entity of its QueryRetrieveLevel.
+			//! Keys without a column are ignored. The secondary indexes are used when possible, the rows appended after their last build are scanned.
+			std::vector<uint64_t> find(const DataSet& identifier) const;
+
+			//! Response to the identifier for a row returned by find: the keys that have a column are filled, the others are empty
+			DataSet response(uint64_t row, const DataSet& identifier) const;
+
+		private:
+			struct MappedFile;
+			struct Predicate;
+
+			std::pair<const char*, size_t> stringRef(uint32_t id) const;
+			int compareString(uint32_t id, const std::string& value) const;
+			int64_t valueAt(size_t column, uint64_t row) const; // Int, Date or string identifier, the paths being the last column
+			bool testValue(const Predicate& predicate, int64_t value) const;
+
+			// Count the rows of the index matching the predicate, and fill them if rows is not null. Returns false if the index cannot be used.
+			bool indexCandidates(const Predicate& predicate, std::vector<uint64_t>* rows, uint64_t& count, uint64_t& indexedRows) const;
+
+			std::string m_directory;
+			IndexSchema m_schema;
+			uint64_t m_rows = 0, m_nbStrings = 0;
+			std::vector<std::unique_ptr<MappedFile>> m_columns, m_indexes; // Columns then paths, and the index of each column
+			std::unique_ptr<MappedFile> m_heap, m_offsets, m_paths;
+		};
+
+	} // namespace query
+} // namespace emdl
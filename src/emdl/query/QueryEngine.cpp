@@ -0,0 +1,558 @@
+#include <emdl/query/QueryEngine.h>
+
+#include <emdl/dataset/DataSetAccessors.h>
+#include <emdl/dataset/DataSetBuilder.h>
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+
+namespace
+{
+	using namespace emdl;
+	using namespace emdl::query;
+
+	const uint32_t npos = static_cast<uint32_t>(-1);
+	const int PatientLevel = 0, StudyLevel = 1, SeriesLevel = 2, ImageLevel = 3;
+
+	// String values of an element, as used in the indexes
+	std::vector<std::string> indexValues(const Element& element)
+	{
+		std::vector<std::string> values;
+		if (element.isString())
+			values.assign(element.asString().begin(), element.asString().end());
+		else if (element.isInt())
+		{
+			for (const auto value : element.asInt())
+				values.push_back(std::to_string(value));
+		}
+		values.erase(std::remove(values.begin(), values.end(), std::string()), values.end());
+		for (auto& value : values) // Looked up with the values of the compiled keys
+			value = matchedValue(element.vr, std::move(value));
+		return values;
+	}
+
+	using Index = std::map<std::string, std::vector<uint32_t>>;
+	using IndexRange = std::pair<Index::const_iterator, Index::const_iterator>;
+
+	// Entries of the index that can match the key, false if the index cannot be used for this key
+	bool indexRanges(const Index& index, const MatchKey& key, std::vector<IndexRange>& ranges)
+	{
+		switch (key.type)
+		{
+		case MatchType::SingleValue:
+		case MatchType::UIDList:
+			for (const auto& value : key.values)
+				ranges.push_back(index.equal_range(value));
+			return true;
+
+		case MatchType::Wildcard:
+			for (const auto& pattern : key.values)
+			{
+				const auto prefix = pattern.substr(0, pattern.find_first_of("*?"));
+				if (prefix.empty())
+					return false;
+
+				// The values starting with the prefix are before the prefix with its last character incremented
+				auto next = prefix;
+				while (!next.empty() && static_cast<unsigned char>(next.back()) == 0xFF)
+					next.pop_back();
+				auto end = index.end();
+				if (!next.empty())
+				{
+					++next.back();
+					end = index.lower_bound(next);
+				}
+				ranges.emplace_back(index.lower_bound(prefix), end);
+			}
+			return true;
+
+		case MatchType::Range:
+		{
+			// Only the YYYYMMDD dates are ordered like the strings of the index
+			const auto isPlainDate = [](const std::string& bound) {
+				return bound.empty() || bound.size() == 8;
+			};
+			if (key.vr != VR::DA || !isPlainDate(key.lower) || !isPlainDate(key.upper))
+				return false;
+
+			const auto begin = key.lower.empty() ? index.begin() : index.lower_bound(key.lower);
+			const auto end = key.upper.empty() ? index.end() : index.upper_bound(key.upper);
+			ranges.emplace_back(begin, end);
+			return true;
+		}
+
+		default:
+			return false;
+		}
+	}
+}
+
+namespace emdl
+{
+	namespace query
+	{
+		QueryCursor::QueryCursor(const QueryEngine& engine, QueryLevel level, const std::atomic_bool* cancelFlag)
+			: m_engine(&engine)
+			, m_level(level)
+			, m_cancelFlag(cancelFlag)
+		{
+		}
+
+		boost::optional<DataSet> QueryCursor::next()
+		{
+			std::shared_lock<std::shared_timed_mutex> lock(m_engine->m_mutex);
+			const auto level = static_cast<int>(m_level);
+			const auto& records = m_engine->m_levels[level].records;
+
+			while (m_position < m_end)
+			{
+				if (m_cancelFlag && *m_cancelFlag)
+				{
+					m_canceled = true;
+					m_position = m_end;
+					return {};
+				}
+
+				const auto id = m_scanAll ? static_cast<uint32_t>(m_position) : m_candidates[m_position];
+				++m_position;
+				if (records[id].removed)
+					continue;
+
+				const bool match = std::all_of(m_keys.begin(), m_keys.end(), [&](const LevelKey& key) {
+					if (key.level < 0)
+						return true;
+					const auto element = m_engine->ancestor(level, id, key.level).attributes[key.key.tag];
+					return matches(key.key, element ? &*element : nullptr);
+				});
+				if (!match)
+					continue;
+
+				DataSetBuilder response;
+				response.reserve(m_keys.size() + 1);
+				response.add(registry::QueryRetrieveLevel, {asString(m_level)}, VR::CS);
+				for (const auto& key : m_keys)
+				{
+					const auto vr = key.key.vr != VR::Unknown ? key.key.vr : findVR(key.key.tag);
+					if (key.level < 0)
+					{
+						response.add(key.key.tag, Element(vr));
+						continue;
+					}
+
+					const auto element = m_engine->ancestor(level, id, key.level).attributes[key.key.tag];
+					response.add(key.key.tag, element ? *element : Element(vr));
+				}
+				return response.build();
+			}
+
+			return {};
+		}
+
+		bool QueryCursor::canceled() const
+		{
+			return m_canceled;
+		}
+
+		bool QueryCursor::hasUnsupportedKeys() const
+		{
+			return m_unsupportedKeys;
+		}
+
+		/*****************************************************************************/
+
+		QueryEngine::QueryEngine(QueryModel model)
+			: m_model(std::move(model))
+		{
+			for (const auto tag : m_model.indexedTags)
+			{
+				const auto level = m_model.levelOf(tag);
+				if (!level)
+					throw Exception("{} Indexed tag {} is not in the query model", LOG_POSITION, emdl::asString(tag));
+				m_levels[static_cast<int>(*level)].indexes.emplace_back(tag, Index());
+			}
+		}
+
+		void QueryEngine::add(const DataSet& instance)
+		{
+			const auto getKey = [&instance](Tag tag, bool required) {
+				const auto value = firstString(instance, tag);
+				if (required && (!value || value->empty()))
+					throw Exception("{} Missing {} in the instance to add", LOG_POSITION, emdl::asString(tag));
+				return value ? *value : std::string();
+			};
+			const auto patientKey = getKey(registry::PatientID, false);
+			const auto studyKey = getKey(registry::StudyInstanceUID, true);
+			const auto seriesKey = getKey(registry::SeriesInstanceUID, true);
+			const auto imageKey = getKey(registry::SOPInstanceUID, true);
+
+			std::unique_lock<std::shared_timed_mutex> lock(m_mutex);
+
+			// Already known instance: update its attributes if it stays in the same series, otherwise move it
+			auto& images = m_levels[ImageLevel];
+			const auto it = images.ids.find(imageKey);
+			if (it != images.ids.end())
+			{
+				const auto id = it->second;
+				auto& record = images.records[id];
+				const auto& series = m_levels[SeriesLevel].records[record.parent];
+				const auto& study = m_levels[StudyLevel].records[series.parent];
+				if (series.key == seriesKey && study.key == studyKey && m_levels[PatientLevel].records[study.parent].key == patientKey)
+				{
+					removeFromIndexes(ImageLevel, id);
+					record.attributes = DataSet();
+					for (const auto tag : m_model.levelTags[ImageLevel])
+					{
+						const auto element = instance[tag];
+						if (element)
+							record.attributes.set(tag, detach(*element));
+					}
+					addToIndexes(ImageLevel, id);
+					updateStudyLists(series.parent);
+					return;
+				}
+
+				removeInstance(id);
+			}
+
+			const auto patient = findOrCreate(PatientLevel, patientKey, instance, npos);
+			const auto study = findOrCreate(StudyLevel, studyKey, instance, patient);
+			const auto series = findOrCreate(SeriesLevel, seriesKey, instance, study);
+			findOrCreate(ImageLevel, imageKey, instance, series);
+
+			const auto modality = firstString(instance, registry::Modality);
+			if (modality)
+				addUnique(StudyLevel, study, registry::ModalitiesInStudy, *modality);
+			const auto sopClass = firstString(instance, registry::SOPClassUID);
+			if (sopClass)
+				addUnique(StudyLevel, study, registry::SOPClassesInStudy, *sopClass);
+			updateCounts(series);
+		}
+
+		bool QueryEngine::remove(const std::string& sopInstanceUID)
+		{
+			std::unique_lock<std::shared_timed_mutex> lock(m_mutex);
+
+			const auto it = m_levels[ImageLevel].ids.find(sopInstanceUID);
+			if (it == m_levels[ImageLevel].ids.end())
+				return false;
+
+			removeInstance(it->second);
+			return true;
+		}
+
+		void QueryEngine::removeInstance(uint32_t imageId)
+		{
+			// Remove the instance, then its ancestors which have no children anymore
+			int level = ImageLevel;
+			auto id = imageId;
+			while (true)
+			{
+				auto& lvl = m_levels[level];
+				auto& record = lvl.records[id];
+				removeFromIndexes(level, id);
+				lvl.ids.erase(record.key);
+				--lvl.size;
+
+				// Only the slot of the record is kept, so that the ids of the others stay valid
+				const auto parentId = record.parent;
+				record = Record();
+				record.removed = true;
+
+				if (level == PatientLevel)
+					break;
+
+				auto& parent = m_levels[level - 1].records[parentId];
+				parent.children.erase(std::remove(parent.children.begin(), parent.children.end(), id), parent.children.end());
+				id = parentId;
+				--level;
+				if (!parent.children.empty())
+					break;
+			}
+
+			// Everything was removed up to the patient
+			if (m_levels[level].records[id].removed)
+				return;
+
+			// Update the computed attributes of the remaining ancestors, through one of their series
+			auto seriesId = id;
+			for (int l = level; l < SeriesLevel; ++l)
+				seriesId = m_levels[l].records[seriesId].children.front();
+			updateCounts(seriesId);
+			if (level >= StudyLevel)
+				updateStudyLists(level == StudyLevel ? id : m_levels[SeriesLevel].records[id].parent);
+		}
+
+		size_t QueryEngine::size(QueryLevel level) const
+		{
+			std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+			return m_levels[static_cast<int>(level)].size;
+		}
+
+		QueryCursor QueryEngine::find(const DataSet& identifier, const std::atomic_bool* cancelFlag) const
+		{
+			const auto levelValue = firstString(identifier, registry::QueryRetrieveLevel);
+			if (!levelValue)
+				throw Exception("{} Missing query retrieve level", LOG_POSITION);
+			const auto queryLevel = asQueryLevel(*levelValue);
+			const auto level = static_cast<int>(queryLevel);
+
+			QueryCursor cursor(*this, queryLevel, cancelFlag);
+			for (auto& key : compileKeys(identifier))
+			{
+				QueryCursor::LevelKey levelKey;
+				const auto keyLevel = m_model.levelOf(key.tag);
+				if (keyLevel && static_cast<int>(*keyLevel) <= level)
+					levelKey.level = static_cast<int>(*keyLevel);
+				else
+					cursor.m_unsupportedKeys = true;
+				levelKey.key = std::move(key);
+				cursor.m_keys.push_back(std::move(levelKey));
+			}
+
+			std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+
+			// Use the index giving the fewest candidates, trying the exact values first as they are cheap to count
+			std::vector<const QueryCursor::LevelKey*> indexKeys;
+			for (const auto& key : cursor.m_keys)
+			{
+				if (key.level >= 0)
+					indexKeys.push_back(&key);
+			}
+			std::stable_partition(indexKeys.begin(), indexKeys.end(), [](const QueryCursor::LevelKey* key) {
+				return key->key.type == MatchType::SingleValue || key->key.type == MatchType::UIDList;
+			});
+
+			std::vector<IndexRange> bestRanges;
+			size_t bestCount = std::numeric_limits<size_t>::max();
+			int bestLevel = -1;
+			for (const auto keyPtr : indexKeys)
+			{
+				const auto& key = *keyPtr;
+
+				for (const auto& index : m_levels[key.level].indexes)
+				{
+					std::vector<IndexRange> ranges;
+					if (index.first != key.key.tag || !indexRanges(index.second, key.key, ranges))
+						continue;
+
+					// Stop counting as soon as this index is not better
+					size_t count = 0;
+					for (const auto& range : ranges)
+					{
+						for (auto it = range.first; it != range.second && count < bestCount; ++it)
+							count += it->second.size();
+					}
+
+					if (count < bestCount)
+					{
+						bestCount = count;
+						bestRanges = std::move(ranges);
+						bestLevel = key.level;
+					}
+				}
+			}
+
+			if (bestLevel < 0)
+			{
+				cursor.m_scanAll = true;
+				cursor.m_end = m_levels[level].records.size();
+				return cursor;
+			}
+
+			std::vector<uint32_t> candidates;
+			candidates.reserve(bestCount);
+			for (const auto& range : bestRanges)
+			{
+				for (auto it = range.first; it != range.second; ++it)
+					candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+			}
+			std::sort(candidates.begin(), candidates.end());
+			candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+			// Go down to the entities of the query level
+			for (int l = bestLevel; l < level; ++l)
+			{
+				std::vector<uint32_t> children;
+				for (const auto id : candidates)
+				{
+					const auto& record = m_levels[l].records[id];
+					children.insert(children.end(), record.children.begin(), record.children.end());
+				}
+				candidates = std::move(children);
+			}
+
+			cursor.m_end = candidates.size();
+			cursor.m_candidates = std::move(candidates);
+			return cursor;
+		}
+
+		uint32_t QueryEngine::findOrCreate(int level, const std::string& key, const DataSet& instance, uint32_t parent)
+		{
+			auto& lvl = m_levels[level];
+			const auto it = lvl.ids.find(key);
+			if (it != lvl.ids.end())
+				return it->second;
+
+			const auto id = static_cast<uint32_t>(lvl.records.size());
+			lvl.records.emplace_back();
+			auto& record = lvl.records.back();
+			record.key = key;
+			record.parent = parent;
+			for (const auto tag : m_model.levelTags[level])
+			{
+				const auto element = instance[tag];
+				if (element)
+					record.attributes.set(tag, detach(*element));
+			}
+
+			lvl.ids.emplace(key, id);
+			++lvl.size;
+			if (parent != npos)
+				m_levels[level - 1].records[parent].children.push_back(id);
+			addToIndexes(level, id);
+			return id;
+		}
+
+		void QueryEngine::addToIndexes(int level, uint32_t id)
+		{
+			auto& lvl = m_levels[level];
+			const auto& attributes = lvl.records[id].attributes;
+			for (auto& index : lvl.indexes)
+			{
+				const auto element = attributes[index.first];
+				if (!element)
+					continue;
+				for (const auto& value : indexValues(*element))
+					index.second[value].push_back(id);
+			}
+		}
+
+		void QueryEngine::removeFromIndexes(int level, uint32_t id)
+		{
+			auto& lvl = m_levels[level];
+			const auto& attributes = lvl.records[id].attributes;
+			for (auto& index : lvl.indexes)
+			{
+				const auto element = attributes[index.first];
+				if (!element)
+					continue;
+				for (const auto& value : indexValues(*element))
+				{
+					const auto it = index.second.find(value);
+					if (it == index.second.end())
+						continue;
+					auto& ids = it->second;
+					ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+					if (ids.empty())
+						index.second.erase(it);
+				}
+			}
+		}
+
+		void QueryEngine::updateCounts(uint32_t seriesId)
+		{
+			if (seriesId == npos)
+				return;
+
+			const auto count = [](const Record& record) {
+				return Element({std::to_string(record.children.size())}, VR::IS);
+			};
+
+			const auto& series = m_levels[SeriesLevel].records[seriesId];
+			setAttribute(SeriesLevel, seriesId, registry::NumberOfSeriesRelatedInstances, count(series));
+
+			const auto studyId = series.parent;
+			const auto& study = m_levels[StudyLevel].records[studyId];
+			size_t studyInstances = 0;
+			for (const auto id : study.children)
+				studyInstances += m_levels[SeriesLevel].records[id].children.size();
+			setAttribute(StudyLevel, studyId, registry::NumberOfStudyRelatedSeries, count(study));
+			setAttribute(StudyLevel, studyId, registry::NumberOfStudyRelatedInstances, Element({std::to_string(studyInstances)}, VR::IS));
+
+			const auto patientId = study.parent;
+			const auto& patient = m_levels[PatientLevel].records[patientId];
+			size_t patientSeries = 0, patientInstances = 0;
+			for (const auto id : patient.children)
+			{
+				const auto& otherStudy = m_levels[StudyLevel].records[id];
+				patientSeries += otherStudy.children.size();
+				for (const auto seriesChild : otherStudy.children)
+					patientInstances += m_levels[SeriesLevel].records[seriesChild].children.size();
+			}
+			setAttribute(PatientLevel, patientId, registry::NumberOfPatientRelatedStudies, count(patient));
+			setAttribute(PatientLevel, patientId, registry::NumberOfPatientRelatedSeries, Element({std::to_string(patientSeries)}, VR::IS));
+			setAttribute(PatientLevel, patientId, registry::NumberOfPatientRelatedInstances, Element({std::to_string(patientInstances)}, VR::IS));
+		}
+
+		void QueryEngine::updateStudyLists(uint32_t studyId)
+		{
+			const auto& study = m_levels[StudyLevel].records[studyId];
+			if (study.removed)
+				return;
+
+			Value::Strings modalities, sopClasses;
+			const auto addTo = [](Value::Strings& list, const boost::optional<const Value::String&>& value) {
+				if (value && std::find(list.begin(), list.end(), *value) == list.end())
+					list.push_back(*value);
+			};
+
+			for (const auto seriesId : study.children)
+			{
+				const auto& series = m_levels[SeriesLevel].records[seriesId];
+				addTo(modalities, firstString(series.attributes, registry::Modality));
+				for (const auto imageId : series.children)
+					addTo(sopClasses, firstString(m_levels[ImageLevel].records[imageId].attributes, registry::SOPClassUID));
+			}
+
+			setAttribute(StudyLevel, studyId, registry::ModalitiesInStudy, Element(std::move(modalities), VR::CS));
+			setAttribute(StudyLevel, studyId, registry::SOPClassesInStudy, Element(std::move(sopClasses), VR::UI));
+		}
+
+		void QueryEngine::addUnique(int level, uint32_t id, Tag tag, const std::string& value)
+		{
+			const auto& attributes = m_levels[level].records[id].attributes;
+			const auto element = attributes[tag];
+			Value::Strings values;
+			if (element && element->isString())
+				values = element->asString();
+			if (std::find(values.begin(), values.end(), value) != values.end())
+				return;
+
+			values.push_back(value);
+			setAttribute(level, id, tag, Element(std::move(values), findVR(tag)));
+		}
+
+		bool QueryEngine::setAttribute(int level, uint32_t id, Tag tag, Element element)
+		{
+			const auto tagLevel = m_model.levelOf(tag);
+			if (!tagLevel || static_cast<int>(*tagLevel) != level)
+				return false;
+
+			const auto& indexes = m_levels[level].indexes;
+			const bool indexed = std::any_of(indexes.begin(), indexes.end(), [tag](const std::pair<Tag, Index>& index) {
+				return index.first == tag;
+			});
+
+			if (indexed)
+				removeFromIndexes(level, id);
+			m_levels[level].records[id].attributes.set(tag, detach(element));
+			if (indexed)
+				addToIndexes(level, id);
+			return true;
+		}
+
+		const QueryEngine::Record& QueryEngine::ancestor(int level, uint32_t id, int ancestorLevel) const
+		{
+			while (level > ancestorLevel)
+			{
+				id = m_levels[level].records[id].parent;
+				--level;
+			}
+			return m_levels[level].records[id];
+		}
+
+	} // namespace query
+} // namespace emdl
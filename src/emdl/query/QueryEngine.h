@@ -0,0 +1,118 @@
+#pragma once
+
+#include <emdl/query/Matcher.h>
+#include <emdl/query/QueryModel.h>
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace emdl
+{
+	namespace query
+	{
+		class QueryEngine;
+
+		//! Lazy iteration over the matches of a query. The engine must outlive the cursor.
+		//! Instances added after the creation of the cursor are not returned.
+		class EMDL_API QueryCursor
+		{
+		public:
+			//! Return the next match (the key attributes of the identifier, filled with the values of the entity), or nothing when done or canceled
+			boost::optional<DataSet> next();
+
+			//! Test whether the scan was stopped by the cancel flag
+			bool canceled() const;
+
+			//! Test whether the identifier has keys the model does not keep. They are returned empty and do not restrict the matches.
+			//! The responses should then use the status PendingWarningOptionalKeysNotSupported.
+			bool hasUnsupportedKeys() const;
+
+		private:
+			friend class QueryEngine;
+			QueryCursor(const QueryEngine& engine, QueryLevel level, const std::atomic_bool* cancelFlag);
+
+			struct LevelKey
+			{
+				MatchKey key;
+				int level = -1; // Level of the entity holding the attribute, -1 if not supported
+			};
+
+			const QueryEngine* m_engine;
+			QueryLevel m_level;
+			const std::atomic_bool* m_cancelFlag;
+			std::vector<LevelKey> m_keys;
+			std::vector<uint32_t> m_candidates; // Candidates found with an index, all the entities if m_scanAll
+			bool m_scanAll = false;
+			size_t m_position = 0, m_end = 0;
+			bool m_canceled = false, m_unsupportedKeys = false;
+		};
+
+		//! In-memory database of the patients, studies, series and instances, answering C-FIND queries
+		class EMDL_API QueryEngine
+		{
+		public:
+			explicit QueryEngine(QueryModel model = QueryModel::defaultModel());
+
+			QueryEngine(const QueryEngine&) = delete;
+			QueryEngine& operator=(const QueryEngine&) = delete;
+
+			//! Add the attributes of an instance to its patient, study and series, creating them if needed.
+			//! The entities are identified by PatientID, StudyInstanceUID, SeriesInstanceUID and SOPInstanceUID, which must be present.
+			//! The attributes of the model are copied, so the data set can be released afterwards.
+			//! Adding an instance again replaces its attributes, and moves it if its series, study or patient changed.
+			//! Updates the counts of related entities, ModalitiesInStudy and SOPClassesInStudy.
+			void add(const DataSet& instance);
+
+			//! Remove an instance, and its series, study and patient if they become empty. Returns false if it is not in the engine.
+			bool remove(const std::string& sopInstanceUID);
+
+			//! Number of entities at this level
+			size_t size(QueryLevel level) const;
+
+			//! Start a query, the level being given by the QueryRetrieveLevel of the identifier.
+			//! The matches are computed as the cursor advances, and the scan stops when *cancelFlag becomes true (C-CANCEL).
+			//! Both relational and hierarchical queries are supported: keys of the upper levels restrict the matches.
+			QueryCursor find(const DataSet& identifier, const std::atomic_bool* cancelFlag = nullptr) const;
+
+		private:
+			friend class QueryCursor;
+
+			struct Record
+			{
+				std::string key; // PatientID, or the UID of the entity
+				DataSet attributes;
+				uint32_t parent = static_cast<uint32_t>(-1);
+				std::vector<uint32_t> children;
+				bool removed = false;
+			};
+
+			using Index = std::map<std::string, std::vector<uint32_t>>;
+
+			struct Level
+			{
+				std::deque<Record> records; // Never erased, so the ids stay valid: the removed ones are emptied
+				std::unordered_map<std::string, uint32_t> ids; // Unique key of the level
+				std::vector<std::pair<Tag, Index>> indexes;
+				size_t size = 0; // Records not removed
+			};
+
+			uint32_t findOrCreate(int level, const std::string& key, const DataSet& instance, uint32_t parent);
+			void removeInstance(uint32_t imageId);
+			void addToIndexes(int level, uint32_t id);
+			void removeFromIndexes(int level, uint32_t id);
+			void updateCounts(uint32_t seriesId);
+			void updateStudyLists(uint32_t studyId);
+			void addUnique(int level, uint32_t id, Tag tag, const std::string& value);
+			bool setAttribute(int level, uint32_t id, Tag tag, Element element); // Only if the model keeps the tag at this level
+			const Record& ancestor(int level, uint32_t id, int ancestorLevel) const;
+
+			QueryModel m_model;
+			Level m_levels[4];
+			mutable std::shared_timed_mutex m_mutex;
+		};
+
+	} // namespace query
+} // namespace emdl
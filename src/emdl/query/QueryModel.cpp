@@ -0,0 +1,84 @@
+#include <emdl/query/QueryModel.h>
+
+#include <emdl/Exception.h>
+#include <emdl/registry.h>
+
+#include <algorithm>
+
+namespace emdl
+{
+	namespace query
+	{
+		QueryLevel asQueryLevel(const std::string& level)
+		{
+			if (level == "PATIENT")
+				return QueryLevel::Patient;
+			if (level == "STUDY")
+				return QueryLevel::Study;
+			if (level == "SERIES")
+				return QueryLevel::Series;
+			if (level == "IMAGE")
+				return QueryLevel::Image;
+			throw Exception("{} Invalid query retrieve level '{}'", LOG_POSITION, level);
+		}
+
+		std::string asString(QueryLevel level)
+		{
+			switch (level)
+			{
+			case QueryLevel::Patient:
+				return "PATIENT";
+			case QueryLevel::Study:
+				return "STUDY";
+			case QueryLevel::Series:
+				return "SERIES";
+			case QueryLevel::Image:
+			default:
+				return "IMAGE";
+			}
+		}
+
+		boost::optional<QueryLevel> QueryModel::levelOf(Tag tag) const
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				const auto& tags = levelTags[i];
+				if (std::find(tags.begin(), tags.end(), tag) != tags.end())
+					return static_cast<QueryLevel>(i);
+			}
+			return {};
+		}
+
+		QueryModel QueryModel::defaultModel()
+		{
+			namespace reg = registry;
+
+			QueryModel model;
+			model.levelTags[static_cast<int>(QueryLevel::Patient)] = {
+				reg::PatientName, reg::PatientID, reg::IssuerOfPatientID, reg::OtherPatientIDsSequence, reg::PatientBirthDate,
+				reg::PatientBirthTime, reg::PatientSex, reg::EthnicGroup, reg::PatientComments, reg::NumberOfPatientRelatedStudies,
+				reg::NumberOfPatientRelatedSeries, reg::NumberOfPatientRelatedInstances};
+
+			model.levelTags[static_cast<int>(QueryLevel::Study)] = {
+				reg::StudyDate, reg::StudyTime, reg::AccessionNumber, reg::StudyID, reg::StudyInstanceUID,
+				reg::ReferringPhysicianName, reg::StudyDescription, reg::ModalitiesInStudy, reg::SOPClassesInStudy, reg::PatientAge,
+				reg::PatientSize, reg::PatientWeight, reg::NumberOfStudyRelatedSeries, reg::NumberOfStudyRelatedInstances};
+
+			model.levelTags[static_cast<int>(QueryLevel::Series)] = {
+				reg::Modality, reg::SeriesNumber, reg::SeriesInstanceUID, reg::SeriesDescription, reg::SeriesDate,
+				reg::SeriesTime, reg::BodyPartExamined, reg::Laterality, reg::InstitutionName, reg::PerformedProcedureStepStartDate,
+				reg::RequestAttributesSequence, reg::NumberOfSeriesRelatedInstances};
+
+			model.levelTags[static_cast<int>(QueryLevel::Image)] = {
+				reg::SOPInstanceUID, reg::SOPClassUID, reg::InstanceNumber, reg::ContentDate, reg::ContentTime,
+				reg::AcquisitionDate, reg::ImageType, reg::Rows, reg::Columns, reg::NumberOfFrames};
+
+			model.indexedTags = {
+				reg::PatientID, reg::PatientName, reg::StudyInstanceUID, reg::StudyDate, reg::AccessionNumber,
+				reg::SeriesInstanceUID, reg::Modality, reg::SOPInstanceUID};
+
+			return model;
+		}
+
+	} // namespace query
+} // namespace emdl
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <emdl/Tag.h>
+
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace emdl
+{
+	namespace query
+	{
+		//! Level of a query, from QueryRetrieveLevel
+		enum class QueryLevel : uint8_t
+		{
+			Patient,
+			Study,
+			Series,
+			Image
+		};
+
+		//! Convert the value of QueryRetrieveLevel (PATIENT, STUDY, SERIES, IMAGE), throws for other values
+		EMDL_API QueryLevel asQueryLevel(const std::string& level);
+
+		//! Return the value of QueryRetrieveLevel for this level
+		EMDL_API std::string asString(QueryLevel level);
+
+		//! Attributes kept by a QueryEngine for each level, and those having an index
+		struct EMDL_API QueryModel
+		{
+			std::vector<Tag> levelTags[4]; // Indexed by QueryLevel
+			std::vector<Tag> indexedTags; // Must be in one of the levels
+
+			//! Level of a tag, empty if the model does not keep it
+			boost::optional<QueryLevel> levelOf(Tag tag) const;
+
+			//! Attributes of PS3.4 C.6.1.1 (Patient Root and Study Root models) and the common optional keys.
+			//! PatientID, PatientName, StudyInstanceUID, StudyDate, AccessionNumber, SeriesInstanceUID, Modality and SOPInstanceUID are indexed.
+			static QueryModel defaultModel();
+		};
+
+	} // namespace query
+} // namespace emdl
@@ -4286,6 +4286,8 @@ namespace emdl
 		const std::string OverlayLabel{"60xx1500"};
 		const std::string OverlayData{"60xx3000"};
 		const std::string OverlayComments{"60xx4000"};
+		const Tag ExtendedOffsetTable{0x7fe0, 0x0001};
+		const Tag ExtendedOffsetTableLengths{0x7fe0, 0x0002};
 		const Tag FloatPixelData{0x7fe0, 0x0008};
 		const Tag DoubleFloatPixelData{0x7fe0, 0x0009};
 		const Tag PixelData{0x7fe0, 0x0010};
@@ -0,0 +1,4242 @@
+#pragma once
+
+#include <emdl/Tag.h>
+#include <emdl/VR.h>
+
+#include <cstdint>
+#include <string>
+
+namespace emdl
+{
+	//! C++ type of one value of a VR. Void for the binary and sequence VRs, that have no typed accessors.
+	template <VR ValueVR>
+	struct VRValueType
+	{
+		using type = void;
+	};
+
+	// clang-format off
+	template <> struct VRValueType<VR::AE> { using type = std::string; };
+	template <> struct VRValueType<VR::AS> { using type = std::string; };
+	template <> struct VRValueType<VR::AT> { using type = Tag; };
+	template <> struct VRValueType<VR::CS> { using type = std::string; };
+	template <> struct VRValueType<VR::DA> { using type = std::string; };
+	template <> struct VRValueType<VR::DS> { using type = double; };
+	template <> struct VRValueType<VR::DT> { using type = std::string; };
+	template <> struct VRValueType<VR::FL> { using type = float; };
+	template <> struct VRValueType<VR::FD> { using type = double; };
+	template <> struct VRValueType<VR::IS> { using type = int32_t; };
+	template <> struct VRValueType<VR::LO> { using type = std::string; };
+	template <> struct VRValueType<VR::LT> { using type = std::string; };
+	template <> struct VRValueType<VR::PN> { using type = std::string; };
+	template <> struct VRValueType<VR::SH> { using type = std::string; };
+	template <> struct VRValueType<VR::SL> { using type = int32_t; };
+	template <> struct VRValueType<VR::SS> { using type = int16_t; };
+	template <> struct VRValueType<VR::ST> { using type = std::string; };
+	template <> struct VRValueType<VR::TM> { using type = std::string; };
+	template <> struct VRValueType<VR::UC> { using type = std::string; };
+	template <> struct VRValueType<VR::UI> { using type = std::string; };
+	template <> struct VRValueType<VR::UL> { using type = uint32_t; };
+	template <> struct VRValueType<VR::UR> { using type = std::string; };
+	template <> struct VRValueType<VR::US> { using type = uint16_t; };
+	template <> struct VRValueType<VR::UT> { using type = std::string; };
+	// clang-format on
+
+	//! Compile-time description of a tag of the public dictionary: its VR, its value multiplicity and the C++ type of its values
+	template <uint16_t GroupNumber, uint16_t ElementNumber, VR ValueVR, unsigned MinVM, unsigned MaxVM>
+	struct TagTraits
+	{
+		using type = typename VRValueType<ValueVR>::type;
+
+		static constexpr Tag tag() { return {GroupNumber, ElementNumber}; }
+
+		static constexpr VR vr = ValueVR;
+		static constexpr unsigned minVM = MinVM;
+		static constexpr unsigned maxVM = MaxVM; //!< 0 if the number of values is not bounded
+	};
+
+	template <uint16_t GroupNumber, uint16_t ElementNumber, VR ValueVR, unsigned MinVM, unsigned MaxVM>
+	constexpr VR TagTraits<GroupNumber, ElementNumber, ValueVR, MinVM, MaxVM>::vr;
+
+	template <uint16_t GroupNumber, uint16_t ElementNumber, VR ValueVR, unsigned MinVM, unsigned MaxVM>
+	constexpr unsigned TagTraits<GroupNumber, ElementNumber, ValueVR, MinVM, MaxVM>::minVM;
+
+	template <uint16_t GroupNumber, uint16_t ElementNumber, VR ValueVR, unsigned MinVM, unsigned MaxVM>
+	constexpr unsigned TagTraits<GroupNumber, ElementNumber, ValueVR, MinVM, MaxVM>::maxVM;
+
+	//! Traits of the tags of the public dictionary that have a single VR, generated from it (same names as in the registry).
+	//! Tags whose VR depends on the data set (US or SS, OB or OW) and the repeating groups are not listed.
+	namespace tags
+	{
+		struct CommandGroupLength : TagTraits<0x0000, 0x0000, VR::UL, 1, 1> {};
+		struct AffectedSOPClassUID : TagTraits<0x0000, 0x0002, VR::UI, 1, 1> {};
+		struct RequestedSOPClassUID : TagTraits<0x0000, 0x0003, VR::UI, 1, 1> {};
+		struct CommandField : TagTraits<0x0000, 0x0100, VR::US, 1, 1> {};
+		struct MessageID : TagTraits<0x0000, 0x0110, VR::US, 1, 1> {};
+		struct MessageIDBeingRespondedTo : TagTraits<0x0000, 0x0120, VR::US, 1, 1> {};
+		struct MoveDestination : TagTraits<0x0000, 0x0600, VR::AE, 1, 1> {};
+		struct Priority : TagTraits<0x0000, 0x0700, VR::US, 1, 1> {};
+		struct CommandDataSetType : TagTraits<0x0000, 0x0800, VR::US, 1, 1> {};
+		struct Status : TagTraits<0x0000, 0x0900, VR::US, 1, 1> {};
+		struct OffendingElement : TagTraits<0x0000, 0x0901, VR::AT, 1, 0> {};
+		struct ErrorComment : TagTraits<0x0000, 0x0902, VR::LO, 1, 1> {};
+		struct ErrorID : TagTraits<0x0000, 0x0903, VR::US, 1, 1> {};
+		struct AffectedSOPInstanceUID : TagTraits<0x0000, 0x1000, VR::UI, 1, 1> {};
+		struct RequestedSOPInstanceUID : TagTraits<0x0000, 0x1001, VR::UI, 1, 1> {};
+		struct EventTypeID : TagTraits<0x0000, 0x1002, VR::US, 1, 1> {};
+		struct AttributeIdentifierList : TagTraits<0x0000, 0x1005, VR::AT, 1, 0> {};
+		struct ActionTypeID : TagTraits<0x0000, 0x1008, VR::US, 1, 1> {};
+		struct NumberOfRemainingSuboperations : TagTraits<0x0000, 0x1020, VR::US, 1, 1> {};
+		struct NumberOfCompletedSuboperations : TagTraits<0x0000, 0x1021, VR::US, 1, 1> {};
+		struct NumberOfFailedSuboperations : TagTraits<0x0000, 0x1022, VR::US, 1, 1> {};
+		struct NumberOfWarningSuboperations : TagTraits<0x0000, 0x1023, VR::US, 1, 1> {};
+		struct MoveOriginatorApplicationEntityTitle : TagTraits<0x0000, 0x1030, VR::AE, 1, 1> {};
+		struct MoveOriginatorMessageID : TagTraits<0x0000, 0x1031, VR::US, 1, 1> {};
+		struct FileMetaInformationGroupLength : TagTraits<0x0002, 0x0000, VR::UL, 1, 1> {};
+		struct FileMetaInformationVersion : TagTraits<0x0002, 0x0001, VR::OB, 1, 1> {};
+		struct MediaStorageSOPClassUID : TagTraits<0x0002, 0x0002, VR::UI, 1, 1> {};
+		struct MediaStorageSOPInstanceUID : TagTraits<0x0002, 0x0003, VR::UI, 1, 1> {};
+		struct TransferSyntaxUID : TagTraits<0x0002, 0x0010, VR::UI, 1, 1> {};
+		struct ImplementationClassUID : TagTraits<0x0002, 0x0012, VR::UI, 1, 1> {};
+		struct ImplementationVersionName : TagTraits<0x0002, 0x0013, VR::SH, 1, 1> {};
+		struct SourceApplicationEntityTitle : TagTraits<0x0002, 0x0016, VR::AE, 1, 1> {};
+		struct SendingApplicationEntityTitle : TagTraits<0x0002, 0x0017, VR::AE, 1, 1> {};
+		struct ReceivingApplicationEntityTitle : TagTraits<0x0002, 0x0018, VR::AE, 1, 1> {};
+		struct PrivateInformationCreatorUID : TagTraits<0x0002, 0x0100, VR::UI, 1, 1> {};
+		struct PrivateInformation : TagTraits<0x0002, 0x0102, VR::OB, 1, 1> {};
+		struct FileSetID : TagTraits<0x0004, 0x1130, VR::CS, 1, 1> {};
+		struct FileSetDescriptorFileID : TagTraits<0x0004, 0x1141, VR::CS, 1, 8> {};
+		struct SpecificCharacterSetOfFileSetDescriptorFile : TagTraits<0x0004, 0x1142, VR::CS, 1, 1> {};
+		struct OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity : TagTraits<0x0004, 0x1200, VR::UL, 1, 1> {};
+		struct OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity : TagTraits<0x0004, 0x1202, VR::UL, 1, 1> {};
+		struct FileSetConsistencyFlag : TagTraits<0x0004, 0x1212, VR::US, 1, 1> {};
+		struct DirectoryRecordSequence : TagTraits<0x0004, 0x1220, VR::SQ, 1, 1> {};
+		struct OffsetOfTheNextDirectoryRecord : TagTraits<0x0004, 0x1400, VR::UL, 1, 1> {};
+		struct RecordInUseFlag : TagTraits<0x0004, 0x1410, VR::US, 1, 1> {};
+		struct OffsetOfReferencedLowerLevelDirectoryEntity : TagTraits<0x0004, 0x1420, VR::UL, 1, 1> {};
+		struct DirectoryRecordType : TagTraits<0x0004, 0x1430, VR::CS, 1, 1> {};
+		struct PrivateRecordUID : TagTraits<0x0004, 0x1432, VR::UI, 1, 1> {};
+		struct ReferencedFileID : TagTraits<0x0004, 0x1500, VR::CS, 1, 8> {};
+		struct MRDRDirectoryRecordOffset : TagTraits<0x0004, 0x1504, VR::UL, 1, 1> {};
+		struct ReferencedSOPClassUIDInFile : TagTraits<0x0004, 0x1510, VR::UI, 1, 1> {};
+		struct ReferencedSOPInstanceUIDInFile : TagTraits<0x0004, 0x1511, VR::UI, 1, 1> {};
+		struct ReferencedTransferSyntaxUIDInFile : TagTraits<0x0004, 0x1512, VR::UI, 1, 1> {};
+		struct ReferencedRelatedGeneralSOPClassUIDInFile : TagTraits<0x0004, 0x151a, VR::UI, 1, 0> {};
+		struct NumberOfReferences : TagTraits<0x0004, 0x1600, VR::UL, 1, 1> {};
+		struct LengthToEnd : TagTraits<0x0008, 0x0001, VR::UL, 1, 1> {};
+		struct SpecificCharacterSet : TagTraits<0x0008, 0x0005, VR::CS, 1, 0> {};
+		struct LanguageCodeSequence : TagTraits<0x0008, 0x0006, VR::SQ, 1, 1> {};
+		struct ImageType : TagTraits<0x0008, 0x0008, VR::CS, 2, 0> {};
+		struct RecognitionCode : TagTraits<0x0008, 0x0010, VR::SH, 1, 1> {};
+		struct InstanceCreationDate : TagTraits<0x0008, 0x0012, VR::DA, 1, 1> {};
+		struct InstanceCreationTime : TagTraits<0x0008, 0x0013, VR::TM, 1, 1> {};
+		struct InstanceCreatorUID : TagTraits<0x0008, 0x0014, VR::UI, 1, 1> {};
+		struct InstanceCoercionDateTime : TagTraits<0x0008, 0x0015, VR::DT, 1, 1> {};
+		struct SOPClassUID : TagTraits<0x0008, 0x0016, VR::UI, 1, 1> {};
+		struct SOPInstanceUID : TagTraits<0x0008, 0x0018, VR::UI, 1, 1> {};
+		struct RelatedGeneralSOPClassUID : TagTraits<0x0008, 0x001a, VR::UI, 1, 0> {};
+		struct OriginalSpecializedSOPClassUID : TagTraits<0x0008, 0x001b, VR::UI, 1, 1> {};
+		struct StudyDate : TagTraits<0x0008, 0x0020, VR::DA, 1, 1> {};
+		struct SeriesDate : TagTraits<0x0008, 0x0021, VR::DA, 1, 1> {};
+		struct AcquisitionDate : TagTraits<0x0008, 0x0022, VR::DA, 1, 1> {};
+		struct ContentDate : TagTraits<0x0008, 0x0023, VR::DA, 1, 1> {};
+		struct OverlayDate : TagTraits<0x0008, 0x0024, VR::DA, 1, 1> {};
+		struct CurveDate : TagTraits<0x0008, 0x0025, VR::DA, 1, 1> {};
+		struct AcquisitionDateTime : TagTraits<0x0008, 0x002a, VR::DT, 1, 1> {};
+		struct StudyTime : TagTraits<0x0008, 0x0030, VR::TM, 1, 1> {};
+		struct SeriesTime : TagTraits<0x0008, 0x0031, VR::TM, 1, 1> {};
+		struct AcquisitionTime : TagTraits<0x0008, 0x0032, VR::TM, 1, 1> {};
+		struct ContentTime : TagTraits<0x0008, 0x0033, VR::TM, 1, 1> {};
+		struct OverlayTime : TagTraits<0x0008, 0x0034, VR::TM, 1, 1> {};
+		struct CurveTime : TagTraits<0x0008, 0x0035, VR::TM, 1, 1> {};
+		struct DataSetType : TagTraits<0x0008, 0x0040, VR::US, 1, 1> {};
+		struct DataSetSubtype : TagTraits<0x0008, 0x0041, VR::LO, 1, 1> {};
+		struct NuclearMedicineSeriesType : TagTraits<0x0008, 0x0042, VR::CS, 1, 1> {};
+		struct AccessionNumber : TagTraits<0x0008, 0x0050, VR::SH, 1, 1> {};
+		struct IssuerOfAccessionNumberSequence : TagTraits<0x0008, 0x0051, VR::SQ, 1, 1> {};
+		struct QueryRetrieveLevel : TagTraits<0x0008, 0x0052, VR::CS, 1, 1> {};
+		struct QueryRetrieveView : TagTraits<0x0008, 0x0053, VR::CS, 1, 1> {};
+		struct RetrieveAETitle : TagTraits<0x0008, 0x0054, VR::AE, 1, 0> {};
+		struct StationAETitle : TagTraits<0x0008, 0x0055, VR::AE, 1, 1> {};
+		struct InstanceAvailability : TagTraits<0x0008, 0x0056, VR::CS, 1, 1> {};
+		struct FailedSOPInstanceUIDList : TagTraits<0x0008, 0x0058, VR::UI, 1, 0> {};
+		struct Modality : TagTraits<0x0008, 0x0060, VR::CS, 1, 1> {};
+		struct ModalitiesInStudy : TagTraits<0x0008, 0x0061, VR::CS, 1, 0> {};
+		struct SOPClassesInStudy : TagTraits<0x0008, 0x0062, VR::UI, 1, 0> {};
+		struct ConversionType : TagTraits<0x0008, 0x0064, VR::CS, 1, 1> {};
+		struct PresentationIntentType : TagTraits<0x0008, 0x0068, VR::CS, 1, 1> {};
+		struct Manufacturer : TagTraits<0x0008, 0x0070, VR::LO, 1, 1> {};
+		struct InstitutionName : TagTraits<0x0008, 0x0080, VR::LO, 1, 1> {};
+		struct InstitutionAddress : TagTraits<0x0008, 0x0081, VR::ST, 1, 1> {};
+		struct InstitutionCodeSequence : TagTraits<0x0008, 0x0082, VR::SQ, 1, 1> {};
+		struct ReferringPhysicianName : TagTraits<0x0008, 0x0090, VR::PN, 1, 1> {};
+		struct ReferringPhysicianAddress : TagTraits<0x0008, 0x0092, VR::ST, 1, 1> {};
+		struct ReferringPhysicianTelephoneNumbers : TagTraits<0x0008, 0x0094, VR::SH, 1, 0> {};
+		struct ReferringPhysicianIdentificationSequence : TagTraits<0x0008, 0x0096, VR::SQ, 1, 1> {};
+		struct ConsultingPhysicianName : TagTraits<0x0008, 0x009c, VR::PN, 1, 0> {};
+		struct ConsultingPhysicianIdentificationSequence : TagTraits<0x0008, 0x009d, VR::SQ, 1, 1> {};
+		struct CodeValue : TagTraits<0x0008, 0x0100, VR::SH, 1, 1> {};
+		struct ExtendedCodeValue : TagTraits<0x0008, 0x0101, VR::LO, 1, 1> {};
+		struct CodingSchemeDesignator : TagTraits<0x0008, 0x0102, VR::SH, 1, 1> {};
+		struct CodingSchemeVersion : TagTraits<0x0008, 0x0103, VR::SH, 1, 1> {};
+		struct CodeMeaning : TagTraits<0x0008, 0x0104, VR::LO, 1, 1> {};
+		struct MappingResource : TagTraits<0x0008, 0x0105, VR::CS, 1, 1> {};
+		struct ContextGroupVersion : TagTraits<0x0008, 0x0106, VR::DT, 1, 1> {};
+		struct ContextGroupLocalVersion : TagTraits<0x0008, 0x0107, VR::DT, 1, 1> {};
+		struct ExtendedCodeMeaning : TagTraits<0x0008, 0x0108, VR::LT, 1, 1> {};
+		struct CodingSchemeResourcesSequence : TagTraits<0x0008, 0x0109, VR::SQ, 1, 1> {};
+		struct CodingSchemeURLType : TagTraits<0x0008, 0x010a, VR::CS, 1, 1> {};
+		struct ContextGroupExtensionFlag : TagTraits<0x0008, 0x010b, VR::CS, 1, 1> {};
+		struct CodingSchemeUID : TagTraits<0x0008, 0x010c, VR::UI, 1, 1> {};
+		struct ContextGroupExtensionCreatorUID : TagTraits<0x0008, 0x010d, VR::UI, 1, 1> {};
+		struct CodingSchemeURL : TagTraits<0x0008, 0x010e, VR::UR, 1, 1> {};
+		struct ContextIdentifier : TagTraits<0x0008, 0x010f, VR::CS, 1, 1> {};
+		struct CodingSchemeIdentificationSequence : TagTraits<0x0008, 0x0110, VR::SQ, 1, 1> {};
+		struct CodingSchemeRegistry : TagTraits<0x0008, 0x0112, VR::LO, 1, 1> {};
+		struct CodingSchemeExternalID : TagTraits<0x0008, 0x0114, VR::ST, 1, 1> {};
+		struct CodingSchemeName : TagTraits<0x0008, 0x0115, VR::ST, 1, 1> {};
+		struct CodingSchemeResponsibleOrganization : TagTraits<0x0008, 0x0116, VR::ST, 1, 1> {};
+		struct ContextUID : TagTraits<0x0008, 0x0117, VR::UI, 1, 1> {};
+		struct MappingResourceUID : TagTraits<0x0008, 0x0118, VR::UI, 1, 1> {};
+		struct LongCodeValue : TagTraits<0x0008, 0x0119, VR::UC, 1, 1> {};
+		struct URNCodeValue : TagTraits<0x0008, 0x0120, VR::UR, 1, 1> {};
+		struct EquivalentCodeSequence : TagTraits<0x0008, 0x0121, VR::SQ, 1, 1> {};
+		struct MappingResourceName : TagTraits<0x0008, 0x0122, VR::LO, 1, 1> {};
+		struct ContextGroupIdentificationSequence : TagTraits<0x0008, 0x0123, VR::SQ, 1, 1> {};
+		struct MappingResourceIdentificationSequence : TagTraits<0x0008, 0x0124, VR::SQ, 1, 1> {};
+		struct TimezoneOffsetFromUTC : TagTraits<0x0008, 0x0201, VR::SH, 1, 1> {};
+		struct ResponsibleGroupCodeSequence : TagTraits<0x0008, 0x0220, VR::SQ, 1, 1> {};
+		struct EquipmentModality : TagTraits<0x0008, 0x0221, VR::CS, 1, 1> {};
+		struct ManufacturerRelatedModelGroup : TagTraits<0x0008, 0x0222, VR::LO, 1, 1> {};
+		struct PrivateDataElementCharacteristicsSequence : TagTraits<0x0008, 0x0300, VR::SQ, 1, 1> {};
+		struct PrivateGroupReference : TagTraits<0x0008, 0x0301, VR::US, 1, 1> {};
+		struct PrivateCreatorReference : TagTraits<0x0008, 0x0302, VR::LO, 1, 1> {};
+		struct BlockIdentifyingInformationStatus : TagTraits<0x0008, 0x0303, VR::CS, 1, 1> {};
+		struct NonidentifyingPrivateElements : TagTraits<0x0008, 0x0304, VR::US, 1, 0> {};
+		struct IdentifyingPrivateElements : TagTraits<0x0008, 0x0306, VR::US, 1, 0> {};
+		struct DeidentificationActionSequence : TagTraits<0x0008, 0x0305, VR::SQ, 1, 1> {};
+		struct DeidentificationAction : TagTraits<0x0008, 0x0307, VR::CS, 1, 1> {};
+		struct PrivateDataElement : TagTraits<0x0008, 0x0308, VR::US, 1, 1> {};
+		struct PrivateDataElementValueMultiplicity : TagTraits<0x0008, 0x0309, VR::UL, 1, 3> {};
+		struct PrivateDataElementValueRepresentation : TagTraits<0x0008, 0x030a, VR::CS, 1, 1> {};
+		struct PrivateDataElementNumberOfItems : TagTraits<0x0008, 0x030b, VR::UL, 1, 2> {};
+		struct PrivateDataElementName : TagTraits<0x0008, 0x030c, VR::UC, 1, 1> {};
+		struct PrivateDataElementKeyword : TagTraits<0x0008, 0x030d, VR::UC, 1, 1> {};
+		struct PrivateDataElementDescription : TagTraits<0x0008, 0x030e, VR::UT, 1, 1> {};
+		struct PrivateDataElementEncoding : TagTraits<0x0008, 0x030f, VR::UT, 1, 1> {};
+		struct PrivateDataElementDefinitionSequence : TagTraits<0x0008, 0x0310, VR::SQ, 1, 1> {};
+		struct NetworkID : TagTraits<0x0008, 0x1000, VR::AE, 1, 1> {};
+		struct StationName : TagTraits<0x0008, 0x1010, VR::SH, 1, 1> {};
+		struct StudyDescription : TagTraits<0x0008, 0x1030, VR::LO, 1, 1> {};
+		struct ProcedureCodeSequence : TagTraits<0x0008, 0x1032, VR::SQ, 1, 1> {};
+		struct SeriesDescription : TagTraits<0x0008, 0x103e, VR::LO, 1, 1> {};
+		struct SeriesDescriptionCodeSequence : TagTraits<0x0008, 0x103f, VR::SQ, 1, 1> {};
+		struct InstitutionalDepartmentName : TagTraits<0x0008, 0x1040, VR::LO, 1, 1> {};
+		struct PhysiciansOfRecord : TagTraits<0x0008, 0x1048, VR::PN, 1, 0> {};
+		struct PhysiciansOfRecordIdentificationSequence : TagTraits<0x0008, 0x1049, VR::SQ, 1, 1> {};
+		struct PerformingPhysicianName : TagTraits<0x0008, 0x1050, VR::PN, 1, 0> {};
+		struct PerformingPhysicianIdentificationSequence : TagTraits<0x0008, 0x1052, VR::SQ, 1, 1> {};
+		struct NameOfPhysiciansReadingStudy : TagTraits<0x0008, 0x1060, VR::PN, 1, 0> {};
+		struct PhysiciansReadingStudyIdentificationSequence : TagTraits<0x0008, 0x1062, VR::SQ, 1, 1> {};
+		struct OperatorsName : TagTraits<0x0008, 0x1070, VR::PN, 1, 0> {};
+		struct OperatorIdentificationSequence : TagTraits<0x0008, 0x1072, VR::SQ, 1, 1> {};
+		struct AdmittingDiagnosesDescription : TagTraits<0x0008, 0x1080, VR::LO, 1, 0> {};
+		struct AdmittingDiagnosesCodeSequence : TagTraits<0x0008, 0x1084, VR::SQ, 1, 1> {};
+		struct ManufacturerModelName : TagTraits<0x0008, 0x1090, VR::LO, 1, 1> {};
+		struct ReferencedResultsSequence : TagTraits<0x0008, 0x1100, VR::SQ, 1, 1> {};
+		struct ReferencedStudySequence : TagTraits<0x0008, 0x1110, VR::SQ, 1, 1> {};
+		struct ReferencedPerformedProcedureStepSequence : TagTraits<0x0008, 0x1111, VR::SQ, 1, 1> {};
+		struct ReferencedSeriesSequence : TagTraits<0x0008, 0x1115, VR::SQ, 1, 1> {};
+		struct ReferencedPatientSequence : TagTraits<0x0008, 0x1120, VR::SQ, 1, 1> {};
+		struct ReferencedVisitSequence : TagTraits<0x0008, 0x1125, VR::SQ, 1, 1> {};
+		struct ReferencedOverlaySequence : TagTraits<0x0008, 0x1130, VR::SQ, 1, 1> {};
+		struct ReferencedStereometricInstanceSequence : TagTraits<0x0008, 0x1134, VR::SQ, 1, 1> {};
+		struct ReferencedWaveformSequence : TagTraits<0x0008, 0x113a, VR::SQ, 1, 1> {};
+		struct ReferencedImageSequence : TagTraits<0x0008, 0x1140, VR::SQ, 1, 1> {};
+		struct ReferencedCurveSequence : TagTraits<0x0008, 0x1145, VR::SQ, 1, 1> {};
+		struct ReferencedInstanceSequence : TagTraits<0x0008, 0x114a, VR::SQ, 1, 1> {};
+		struct ReferencedRealWorldValueMappingInstanceSequence : TagTraits<0x0008, 0x114b, VR::SQ, 1, 1> {};
+		struct ReferencedSOPClassUID : TagTraits<0x0008, 0x1150, VR::UI, 1, 1> {};
+		struct ReferencedSOPInstanceUID : TagTraits<0x0008, 0x1155, VR::UI, 1, 1> {};
+		struct SOPClassesSupported : TagTraits<0x0008, 0x115a, VR::UI, 1, 0> {};
+		struct ReferencedFrameNumber : TagTraits<0x0008, 0x1160, VR::IS, 1, 0> {};
+		struct SimpleFrameList : TagTraits<0x0008, 0x1161, VR::UL, 1, 0> {};
+		struct CalculatedFrameList : TagTraits<0x0008, 0x1162, VR::UL, 3, 0> {};
+		struct TimeRange : TagTraits<0x0008, 0x1163, VR::FD, 2, 2> {};
+		struct FrameExtractionSequence : TagTraits<0x0008, 0x1164, VR::SQ, 1, 1> {};
+		struct MultiFrameSourceSOPInstanceUID : TagTraits<0x0008, 0x1167, VR::UI, 1, 1> {};
+		struct RetrieveURL : TagTraits<0x0008, 0x1190, VR::UR, 1, 1> {};
+		struct TransactionUID : TagTraits<0x0008, 0x1195, VR::UI, 1, 1> {};
+		struct WarningReason : TagTraits<0x0008, 0x1196, VR::US, 1, 1> {};
+		struct FailureReason : TagTraits<0x0008, 0x1197, VR::US, 1, 1> {};
+		struct FailedSOPSequence : TagTraits<0x0008, 0x1198, VR::SQ, 1, 1> {};
+		struct ReferencedSOPSequence : TagTraits<0x0008, 0x1199, VR::SQ, 1, 1> {};
+		struct OtherFailuresSequence : TagTraits<0x0008, 0x119a, VR::SQ, 1, 1> {};
+		struct StudiesContainingOtherReferencedInstancesSequence : TagTraits<0x0008, 0x1200, VR::SQ, 1, 1> {};
+		struct RelatedSeriesSequence : TagTraits<0x0008, 0x1250, VR::SQ, 1, 1> {};
+		struct LossyImageCompressionRetired : TagTraits<0x0008, 0x2110, VR::CS, 1, 1> {};
+		struct DerivationDescription : TagTraits<0x0008, 0x2111, VR::ST, 1, 1> {};
+		struct SourceImageSequence : TagTraits<0x0008, 0x2112, VR::SQ, 1, 1> {};
+		struct StageName : TagTraits<0x0008, 0x2120, VR::SH, 1, 1> {};
+		struct StageNumber : TagTraits<0x0008, 0x2122, VR::IS, 1, 1> {};
+		struct NumberOfStages : TagTraits<0x0008, 0x2124, VR::IS, 1, 1> {};
+		struct ViewName : TagTraits<0x0008, 0x2127, VR::SH, 1, 1> {};
+		struct ViewNumber : TagTraits<0x0008, 0x2128, VR::IS, 1, 1> {};
+		struct NumberOfEventTimers : TagTraits<0x0008, 0x2129, VR::IS, 1, 1> {};
+		struct NumberOfViewsInStage : TagTraits<0x0008, 0x212a, VR::IS, 1, 1> {};
+		struct EventElapsedTimes : TagTraits<0x0008, 0x2130, VR::DS, 1, 0> {};
+		struct EventTimerNames : TagTraits<0x0008, 0x2132, VR::LO, 1, 0> {};
+		struct EventTimerSequence : TagTraits<0x0008, 0x2133, VR::SQ, 1, 1> {};
+		struct EventTimeOffset : TagTraits<0x0008, 0x2134, VR::FD, 1, 1> {};
+		struct EventCodeSequence : TagTraits<0x0008, 0x2135, VR::SQ, 1, 1> {};
+		struct StartTrim : TagTraits<0x0008, 0x2142, VR::IS, 1, 1> {};
+		struct StopTrim : TagTraits<0x0008, 0x2143, VR::IS, 1, 1> {};
+		struct RecommendedDisplayFrameRate : TagTraits<0x0008, 0x2144, VR::IS, 1, 1> {};
+		struct TransducerPosition : TagTraits<0x0008, 0x2200, VR::CS, 1, 1> {};
+		struct TransducerOrientation : TagTraits<0x0008, 0x2204, VR::CS, 1, 1> {};
+		struct AnatomicStructure : TagTraits<0x0008, 0x2208, VR::CS, 1, 1> {};
+		struct AnatomicRegionSequence : TagTraits<0x0008, 0x2218, VR::SQ, 1, 1> {};
+		struct AnatomicRegionModifierSequence : TagTraits<0x0008, 0x2220, VR::SQ, 1, 1> {};
+		struct PrimaryAnatomicStructureSequence : TagTraits<0x0008, 0x2228, VR::SQ, 1, 1> {};
+		struct AnatomicStructureSpaceOrRegionSequence : TagTraits<0x0008, 0x2229, VR::SQ, 1, 1> {};
+		struct PrimaryAnatomicStructureModifierSequence : TagTraits<0x0008, 0x2230, VR::SQ, 1, 1> {};
+		struct TransducerPositionSequence : TagTraits<0x0008, 0x2240, VR::SQ, 1, 1> {};
+		struct TransducerPositionModifierSequence : TagTraits<0x0008, 0x2242, VR::SQ, 1, 1> {};
+		struct TransducerOrientationSequence : TagTraits<0x0008, 0x2244, VR::SQ, 1, 1> {};
+		struct TransducerOrientationModifierSequence : TagTraits<0x0008, 0x2246, VR::SQ, 1, 1> {};
+		struct AnatomicStructureSpaceOrRegionCodeSequenceTrial : TagTraits<0x0008, 0x2251, VR::SQ, 1, 1> {};
+		struct AnatomicPortalOfEntranceCodeSequenceTrial : TagTraits<0x0008, 0x2253, VR::SQ, 1, 1> {};
+		struct AnatomicApproachDirectionCodeSequenceTrial : TagTraits<0x0008, 0x2255, VR::SQ, 1, 1> {};
+		struct AnatomicPerspectiveDescriptionTrial : TagTraits<0x0008, 0x2256, VR::ST, 1, 1> {};
+		struct AnatomicPerspectiveCodeSequenceTrial : TagTraits<0x0008, 0x2257, VR::SQ, 1, 1> {};
+		struct AnatomicLocationOfExaminingInstrumentDescriptionTrial : TagTraits<0x0008, 0x2258, VR::ST, 1, 1> {};
+		struct AnatomicLocationOfExaminingInstrumentCodeSequenceTrial : TagTraits<0x0008, 0x2259, VR::SQ, 1, 1> {};
+		struct AnatomicStructureSpaceOrRegionModifierCodeSequenceTrial : TagTraits<0x0008, 0x225a, VR::SQ, 1, 1> {};
+		struct OnAxisBackgroundAnatomicStructureCodeSequenceTrial : TagTraits<0x0008, 0x225c, VR::SQ, 1, 1> {};
+		struct AlternateRepresentationSequence : TagTraits<0x0008, 0x3001, VR::SQ, 1, 1> {};
+		struct IrradiationEventUID : TagTraits<0x0008, 0x3010, VR::UI, 1, 0> {};
+		struct SourceIrradiationEventSequence : TagTraits<0x0008, 0x3011, VR::SQ, 1, 1> {};
+		struct RadiopharmaceuticalAdministrationEventUID : TagTraits<0x0008, 0x3012, VR::UI, 1, 1> {};
+		struct IdentifyingComments : TagTraits<0x0008, 0x4000, VR::LT, 1, 1> {};
+		struct FrameType : TagTraits<0x0008, 0x9007, VR::CS, 4, 4> {};
+		struct ReferencedImageEvidenceSequence : TagTraits<0x0008, 0x9092, VR::SQ, 1, 1> {};
+		struct ReferencedRawDataSequence : TagTraits<0x0008, 0x9121, VR::SQ, 1, 1> {};
+		struct CreatorVersionUID : TagTraits<0x0008, 0x9123, VR::UI, 1, 1> {};
+		struct DerivationImageSequence : TagTraits<0x0008, 0x9124, VR::SQ, 1, 1> {};
+		struct SourceImageEvidenceSequence : TagTraits<0x0008, 0x9154, VR::SQ, 1, 1> {};
+		struct PixelPresentation : TagTraits<0x0008, 0x9205, VR::CS, 1, 1> {};
+		struct VolumetricProperties : TagTraits<0x0008, 0x9206, VR::CS, 1, 1> {};
+		struct VolumeBasedCalculationTechnique : TagTraits<0x0008, 0x9207, VR::CS, 1, 1> {};
+		struct ComplexImageComponent : TagTraits<0x0008, 0x9208, VR::CS, 1, 1> {};
+		struct AcquisitionContrast : TagTraits<0x0008, 0x9209, VR::CS, 1, 1> {};
+		struct DerivationCodeSequence : TagTraits<0x0008, 0x9215, VR::SQ, 1, 1> {};
+		struct ReferencedPresentationStateSequence : TagTraits<0x0008, 0x9237, VR::SQ, 1, 1> {};
+		struct ReferencedOtherPlaneSequence : TagTraits<0x0008, 0x9410, VR::SQ, 1, 1> {};
+		struct FrameDisplaySequence : TagTraits<0x0008, 0x9458, VR::SQ, 1, 1> {};
+		struct RecommendedDisplayFrameRateInFloat : TagTraits<0x0008, 0x9459, VR::FL, 1, 1> {};
+		struct SkipFrameRangeFlag : TagTraits<0x0008, 0x9460, VR::CS, 1, 1> {};
+		struct PatientName : TagTraits<0x0010, 0x0010, VR::PN, 1, 1> {};
+		struct PatientID : TagTraits<0x0010, 0x0020, VR::LO, 1, 1> {};
+		struct IssuerOfPatientID : TagTraits<0x0010, 0x0021, VR::LO, 1, 1> {};
+		struct TypeOfPatientID : TagTraits<0x0010, 0x0022, VR::CS, 1, 1> {};
+		struct IssuerOfPatientIDQualifiersSequence : TagTraits<0x0010, 0x0024, VR::SQ, 1, 1> {};
+		struct SourcePatientGroupIdentificationSequence : TagTraits<0x0010, 0x0026, VR::SQ, 1, 1> {};
+		struct GroupOfPatientsIdentificationSequence : TagTraits<0x0010, 0x0027, VR::SQ, 1, 1> {};
+		struct SubjectRelativePositionInImage : TagTraits<0x0010, 0x0028, VR::US, 3, 3> {};
+		struct PatientBirthDate : TagTraits<0x0010, 0x0030, VR::DA, 1, 1> {};
+		struct PatientBirthTime : TagTraits<0x0010, 0x0032, VR::TM, 1, 1> {};
+		struct PatientBirthDateInAlternativeCalendar : TagTraits<0x0010, 0x0033, VR::LO, 1, 1> {};
+		struct PatientDeathDateInAlternativeCalendar : TagTraits<0x0010, 0x0034, VR::LO, 1, 1> {};
+		struct PatientAlternativeCalendar : TagTraits<0x0010, 0x0035, VR::CS, 1, 1> {};
+		struct PatientSex : TagTraits<0x0010, 0x0040, VR::CS, 1, 1> {};
+		struct PatientInsurancePlanCodeSequence : TagTraits<0x0010, 0x0050, VR::SQ, 1, 1> {};
+		struct PatientPrimaryLanguageCodeSequence : TagTraits<0x0010, 0x0101, VR::SQ, 1, 1> {};
+		struct PatientPrimaryLanguageModifierCodeSequence : TagTraits<0x0010, 0x0102, VR::SQ, 1, 1> {};
+		struct QualityControlSubject : TagTraits<0x0010, 0x0200, VR::CS, 1, 1> {};
+		struct QualityControlSubjectTypeCodeSequence : TagTraits<0x0010, 0x0201, VR::SQ, 1, 1> {};
+		struct StrainDescription : TagTraits<0x0010, 0x0212, VR::UC, 1, 1> {};
+		struct StrainNomenclature : TagTraits<0x0010, 0x0213, VR::LO, 1, 1> {};
+		struct StrainStockNumber : TagTraits<0x0010, 0x0214, VR::LO, 1, 1> {};
+		struct StrainSourceRegistryCodeSequence : TagTraits<0x0010, 0x0215, VR::SQ, 1, 1> {};
+		struct StrainStockSequence : TagTraits<0x0010, 0x0216, VR::SQ, 1, 1> {};
+		struct StrainSource : TagTraits<0x0010, 0x0217, VR::LO, 1, 1> {};
+		struct StrainAdditionalInformation : TagTraits<0x0010, 0x0218, VR::UT, 1, 1> {};
+		struct StrainCodeSequence : TagTraits<0x0010, 0x0219, VR::SQ, 1, 1> {};
+		struct GeneticModificationsSequence : TagTraits<0x0010, 0x0221, VR::SQ, 1, 1> {};
+		struct GeneticModificationsDescription : TagTraits<0x0010, 0x0222, VR::UC, 1, 1> {};
+		struct GeneticModificationsNomenclature : TagTraits<0x0010, 0x0223, VR::LO, 1, 1> {};
+		struct GeneticModificationsCodeSequence : TagTraits<0x0010, 0x0229, VR::SQ, 1, 1> {};
+		struct OtherPatientIDs : TagTraits<0x0010, 0x1000, VR::LO, 1, 0> {};
+		struct OtherPatientNames : TagTraits<0x0010, 0x1001, VR::PN, 1, 0> {};
+		struct OtherPatientIDsSequence : TagTraits<0x0010, 0x1002, VR::SQ, 1, 1> {};
+		struct PatientBirthName : TagTraits<0x0010, 0x1005, VR::PN, 1, 1> {};
+		struct PatientAge : TagTraits<0x0010, 0x1010, VR::AS, 1, 1> {};
+		struct PatientSize : TagTraits<0x0010, 0x1020, VR::DS, 1, 1> {};
+		struct PatientSizeCodeSequence : TagTraits<0x0010, 0x1021, VR::SQ, 1, 1> {};
+		struct PatientBodyMassIndex : TagTraits<0x0010, 0x1022, VR::DS, 1, 1> {};
+		struct MeasuredAPDimension : TagTraits<0x0010, 0x1023, VR::DS, 1, 1> {};
+		struct MeasuredLateralDimension : TagTraits<0x0010, 0x1024, VR::DS, 1, 1> {};
+		struct PatientWeight : TagTraits<0x0010, 0x1030, VR::DS, 1, 1> {};
+		struct PatientAddress : TagTraits<0x0010, 0x1040, VR::LO, 1, 1> {};
+		struct InsurancePlanIdentification : TagTraits<0x0010, 0x1050, VR::LO, 1, 0> {};
+		struct PatientMotherBirthName : TagTraits<0x0010, 0x1060, VR::PN, 1, 1> {};
+		struct MilitaryRank : TagTraits<0x0010, 0x1080, VR::LO, 1, 1> {};
+		struct BranchOfService : TagTraits<0x0010, 0x1081, VR::LO, 1, 1> {};
+		struct MedicalRecordLocator : TagTraits<0x0010, 0x1090, VR::LO, 1, 1> {};
+		struct ReferencedPatientPhotoSequence : TagTraits<0x0010, 0x1100, VR::SQ, 1, 1> {};
+		struct MedicalAlerts : TagTraits<0x0010, 0x2000, VR::LO, 1, 0> {};
+		struct Allergies : TagTraits<0x0010, 0x2110, VR::LO, 1, 0> {};
+		struct CountryOfResidence : TagTraits<0x0010, 0x2150, VR::LO, 1, 1> {};
+		struct RegionOfResidence : TagTraits<0x0010, 0x2152, VR::LO, 1, 1> {};
+		struct PatientTelephoneNumbers : TagTraits<0x0010, 0x2154, VR::SH, 1, 0> {};
+		struct PatientTelecomInformation : TagTraits<0x0010, 0x2155, VR::LT, 1, 1> {};
+		struct EthnicGroup : TagTraits<0x0010, 0x2160, VR::SH, 1, 1> {};
+		struct Occupation : TagTraits<0x0010, 0x2180, VR::SH, 1, 1> {};
+		struct SmokingStatus : TagTraits<0x0010, 0x21a0, VR::CS, 1, 1> {};
+		struct AdditionalPatientHistory : TagTraits<0x0010, 0x21b0, VR::LT, 1, 1> {};
+		struct PregnancyStatus : TagTraits<0x0010, 0x21c0, VR::US, 1, 1> {};
+		struct LastMenstrualDate : TagTraits<0x0010, 0x21d0, VR::DA, 1, 1> {};
+		struct PatientReligiousPreference : TagTraits<0x0010, 0x21f0, VR::LO, 1, 1> {};
+		struct PatientSpeciesDescription : TagTraits<0x0010, 0x2201, VR::LO, 1, 1> {};
+		struct PatientSpeciesCodeSequence : TagTraits<0x0010, 0x2202, VR::SQ, 1, 1> {};
+		struct PatientSexNeutered : TagTraits<0x0010, 0x2203, VR::CS, 1, 1> {};
+		struct AnatomicalOrientationType : TagTraits<0x0010, 0x2210, VR::CS, 1, 1> {};
+		struct PatientBreedDescription : TagTraits<0x0010, 0x2292, VR::LO, 1, 1> {};
+		struct PatientBreedCodeSequence : TagTraits<0x0010, 0x2293, VR::SQ, 1, 1> {};
+		struct BreedRegistrationSequence : TagTraits<0x0010, 0x2294, VR::SQ, 1, 1> {};
+		struct BreedRegistrationNumber : TagTraits<0x0010, 0x2295, VR::LO, 1, 1> {};
+		struct BreedRegistryCodeSequence : TagTraits<0x0010, 0x2296, VR::SQ, 1, 1> {};
+		struct ResponsiblePerson : TagTraits<0x0010, 0x2297, VR::PN, 1, 1> {};
+		struct ResponsiblePersonRole : TagTraits<0x0010, 0x2298, VR::CS, 1, 1> {};
+		struct ResponsibleOrganization : TagTraits<0x0010, 0x2299, VR::LO, 1, 1> {};
+		struct PatientComments : TagTraits<0x0010, 0x4000, VR::LT, 1, 1> {};
+		struct ExaminedBodyThickness : TagTraits<0x0010, 0x9431, VR::FL, 1, 1> {};
+		struct ClinicalTrialSponsorName : TagTraits<0x0012, 0x0010, VR::LO, 1, 1> {};
+		struct ClinicalTrialProtocolID : TagTraits<0x0012, 0x0020, VR::LO, 1, 1> {};
+		struct ClinicalTrialProtocolName : TagTraits<0x0012, 0x0021, VR::LO, 1, 1> {};
+		struct ClinicalTrialSiteID : TagTraits<0x0012, 0x0030, VR::LO, 1, 1> {};
+		struct ClinicalTrialSiteName : TagTraits<0x0012, 0x0031, VR::LO, 1, 1> {};
+		struct ClinicalTrialSubjectID : TagTraits<0x0012, 0x0040, VR::LO, 1, 1> {};
+		struct ClinicalTrialSubjectReadingID : TagTraits<0x0012, 0x0042, VR::LO, 1, 1> {};
+		struct ClinicalTrialTimePointID : TagTraits<0x0012, 0x0050, VR::LO, 1, 1> {};
+		struct ClinicalTrialTimePointDescription : TagTraits<0x0012, 0x0051, VR::ST, 1, 1> {};
+		struct ClinicalTrialCoordinatingCenterName : TagTraits<0x0012, 0x0060, VR::LO, 1, 1> {};
+		struct PatientIdentityRemoved : TagTraits<0x0012, 0x0062, VR::CS, 1, 1> {};
+		struct DeidentificationMethod : TagTraits<0x0012, 0x0063, VR::LO, 1, 0> {};
+		struct DeidentificationMethodCodeSequence : TagTraits<0x0012, 0x0064, VR::SQ, 1, 1> {};
+		struct ClinicalTrialSeriesID : TagTraits<0x0012, 0x0071, VR::LO, 1, 1> {};
+		struct ClinicalTrialSeriesDescription : TagTraits<0x0012, 0x0072, VR::LO, 1, 1> {};
+		struct ClinicalTrialProtocolEthicsCommitteeName : TagTraits<0x0012, 0x0081, VR::LO, 1, 1> {};
+		struct ClinicalTrialProtocolEthicsCommitteeApprovalNumber : TagTraits<0x0012, 0x0082, VR::LO, 1, 1> {};
+		struct ConsentForClinicalTrialUseSequence : TagTraits<0x0012, 0x0083, VR::SQ, 1, 1> {};
+		struct DistributionType : TagTraits<0x0012, 0x0084, VR::CS, 1, 1> {};
+		struct ConsentForDistributionFlag : TagTraits<0x0012, 0x0085, VR::CS, 1, 1> {};
+		struct EthicsCommitteeApprovalEffectivenessStartDate : TagTraits<0x0012, 0x0086, VR::DA, 1, 1> {};
+		struct EthicsCommitteeApprovalEffectivenessEndDate : TagTraits<0x0012, 0x0087, VR::DA, 1, 1> {};
+		struct CADFileFormat : TagTraits<0x0014, 0x0023, VR::ST, 1, 1> {};
+		struct ComponentReferenceSystem : TagTraits<0x0014, 0x0024, VR::ST, 1, 1> {};
+		struct ComponentManufacturingProcedure : TagTraits<0x0014, 0x0025, VR::ST, 1, 1> {};
+		struct ComponentManufacturer : TagTraits<0x0014, 0x0028, VR::ST, 1, 1> {};
+		struct MaterialThickness : TagTraits<0x0014, 0x0030, VR::DS, 1, 0> {};
+		struct MaterialPipeDiameter : TagTraits<0x0014, 0x0032, VR::DS, 1, 0> {};
+		struct MaterialIsolationDiameter : TagTraits<0x0014, 0x0034, VR::DS, 1, 0> {};
+		struct MaterialGrade : TagTraits<0x0014, 0x0042, VR::ST, 1, 1> {};
+		struct MaterialPropertiesDescription : TagTraits<0x0014, 0x0044, VR::ST, 1, 1> {};
+		struct MaterialPropertiesFileFormatRetired : TagTraits<0x0014, 0x0045, VR::ST, 1, 1> {};
+		struct MaterialNotes : TagTraits<0x0014, 0x0046, VR::LT, 1, 1> {};
+		struct ComponentShape : TagTraits<0x0014, 0x0050, VR::CS, 1, 1> {};
+		struct CurvatureType : TagTraits<0x0014, 0x0052, VR::CS, 1, 1> {};
+		struct OuterDiameter : TagTraits<0x0014, 0x0054, VR::DS, 1, 1> {};
+		struct InnerDiameter : TagTraits<0x0014, 0x0056, VR::DS, 1, 1> {};
+		struct ComponentWelderIDs : TagTraits<0x0014, 0x0100, VR::LO, 1, 0> {};
+		struct SecondaryApprovalStatus : TagTraits<0x0014, 0x0101, VR::CS, 1, 1> {};
+		struct SecondaryReviewDate : TagTraits<0x0014, 0x0102, VR::DA, 1, 1> {};
+		struct SecondaryReviewTime : TagTraits<0x0014, 0x0103, VR::TM, 1, 1> {};
+		struct SecondaryReviewerName : TagTraits<0x0014, 0x0104, VR::PN, 1, 1> {};
+		struct RepairID : TagTraits<0x0014, 0x0105, VR::ST, 1, 1> {};
+		struct MultipleComponentApprovalSequence : TagTraits<0x0014, 0x0106, VR::SQ, 1, 1> {};
+		struct OtherApprovalStatus : TagTraits<0x0014, 0x0107, VR::CS, 1, 0> {};
+		struct OtherSecondaryApprovalStatus : TagTraits<0x0014, 0x0108, VR::CS, 1, 0> {};
+		struct ActualEnvironmentalConditions : TagTraits<0x0014, 0x1010, VR::ST, 1, 1> {};
+		struct ExpiryDate : TagTraits<0x0014, 0x1020, VR::DA, 1, 1> {};
+		struct EnvironmentalConditions : TagTraits<0x0014, 0x1040, VR::ST, 1, 1> {};
+		struct EvaluatorSequence : TagTraits<0x0014, 0x2002, VR::SQ, 1, 1> {};
+		struct EvaluatorNumber : TagTraits<0x0014, 0x2004, VR::IS, 1, 1> {};
+		struct EvaluatorName : TagTraits<0x0014, 0x2006, VR::PN, 1, 1> {};
+		struct EvaluationAttempt : TagTraits<0x0014, 0x2008, VR::IS, 1, 1> {};
+		struct IndicationSequence : TagTraits<0x0014, 0x2012, VR::SQ, 1, 1> {};
+		struct IndicationNumber : TagTraits<0x0014, 0x2014, VR::IS, 1, 1> {};
+		struct IndicationLabel : TagTraits<0x0014, 0x2016, VR::SH, 1, 1> {};
+		struct IndicationDescription : TagTraits<0x0014, 0x2018, VR::ST, 1, 1> {};
+		struct IndicationType : TagTraits<0x0014, 0x201a, VR::CS, 1, 0> {};
+		struct IndicationDisposition : TagTraits<0x0014, 0x201c, VR::CS, 1, 1> {};
+		struct IndicationROISequence : TagTraits<0x0014, 0x201e, VR::SQ, 1, 1> {};
+		struct IndicationPhysicalPropertySequence : TagTraits<0x0014, 0x2030, VR::SQ, 1, 1> {};
+		struct PropertyLabel : TagTraits<0x0014, 0x2032, VR::SH, 1, 1> {};
+		struct CoordinateSystemNumberOfAxes : TagTraits<0x0014, 0x2202, VR::IS, 1, 1> {};
+		struct CoordinateSystemAxesSequence : TagTraits<0x0014, 0x2204, VR::SQ, 1, 1> {};
+		struct CoordinateSystemAxisDescription : TagTraits<0x0014, 0x2206, VR::ST, 1, 1> {};
+		struct CoordinateSystemDataSetMapping : TagTraits<0x0014, 0x2208, VR::CS, 1, 1> {};
+		struct CoordinateSystemAxisNumber : TagTraits<0x0014, 0x220a, VR::IS, 1, 1> {};
+		struct CoordinateSystemAxisType : TagTraits<0x0014, 0x220c, VR::CS, 1, 1> {};
+		struct CoordinateSystemAxisUnits : TagTraits<0x0014, 0x220e, VR::CS, 1, 1> {};
+		struct CoordinateSystemAxisValues : TagTraits<0x0014, 0x2210, VR::OB, 1, 1> {};
+		struct CoordinateSystemTransformSequence : TagTraits<0x0014, 0x2220, VR::SQ, 1, 1> {};
+		struct TransformDescription : TagTraits<0x0014, 0x2222, VR::ST, 1, 1> {};
+		struct TransformNumberOfAxes : TagTraits<0x0014, 0x2224, VR::IS, 1, 1> {};
+		struct TransformOrderOfAxes : TagTraits<0x0014, 0x2226, VR::IS, 1, 0> {};
+		struct TransformedAxisUnits : TagTraits<0x0014, 0x2228, VR::CS, 1, 1> {};
+		struct CoordinateSystemTransformRotationAndScaleMatrix : TagTraits<0x0014, 0x222a, VR::DS, 1, 0> {};
+		struct CoordinateSystemTransformTranslationMatrix : TagTraits<0x0014, 0x222c, VR::DS, 1, 0> {};
+		struct InternalDetectorFrameTime : TagTraits<0x0014, 0x3011, VR::DS, 1, 1> {};
+		struct NumberOfFramesIntegrated : TagTraits<0x0014, 0x3012, VR::DS, 1, 1> {};
+		struct DetectorTemperatureSequence : TagTraits<0x0014, 0x3020, VR::SQ, 1, 1> {};
+		struct SensorName : TagTraits<0x0014, 0x3022, VR::ST, 1, 1> {};
+		struct HorizontalOffsetOfSensor : TagTraits<0x0014, 0x3024, VR::DS, 1, 1> {};
+		struct VerticalOffsetOfSensor : TagTraits<0x0014, 0x3026, VR::DS, 1, 1> {};
+		struct SensorTemperature : TagTraits<0x0014, 0x3028, VR::DS, 1, 1> {};
+		struct DarkCurrentSequence : TagTraits<0x0014, 0x3040, VR::SQ, 1, 1> {};
+		struct GainCorrectionReferenceSequence : TagTraits<0x0014, 0x3060, VR::SQ, 1, 1> {};
+		struct KVUsedInGainCalibration : TagTraits<0x0014, 0x3071, VR::DS, 1, 1> {};
+		struct MAUsedInGainCalibration : TagTraits<0x0014, 0x3072, VR::DS, 1, 1> {};
+		struct NumberOfFramesUsedForIntegration : TagTraits<0x0014, 0x3073, VR::DS, 1, 1> {};
+		struct FilterMaterialUsedInGainCalibration : TagTraits<0x0014, 0x3074, VR::LO, 1, 1> {};
+		struct FilterThicknessUsedInGainCalibration : TagTraits<0x0014, 0x3075, VR::DS, 1, 1> {};
+		struct DateOfGainCalibration : TagTraits<0x0014, 0x3076, VR::DA, 1, 1> {};
+		struct TimeOfGainCalibration : TagTraits<0x0014, 0x3077, VR::TM, 1, 1> {};
+		struct BadPixelImage : TagTraits<0x0014, 0x3080, VR::OB, 1, 1> {};
+		struct CalibrationNotes : TagTraits<0x0014, 0x3099, VR::LT, 1, 1> {};
+		struct PulserEquipmentSequence : TagTraits<0x0014, 0x4002, VR::SQ, 1, 1> {};
+		struct PulserType : TagTraits<0x0014, 0x4004, VR::CS, 1, 1> {};
+		struct PulserNotes : TagTraits<0x0014, 0x4006, VR::LT, 1, 1> {};
+		struct ReceiverEquipmentSequence : TagTraits<0x0014, 0x4008, VR::SQ, 1, 1> {};
+		struct AmplifierType : TagTraits<0x0014, 0x400a, VR::CS, 1, 1> {};
+		struct ReceiverNotes : TagTraits<0x0014, 0x400c, VR::LT, 1, 1> {};
+		struct PreAmplifierEquipmentSequence : TagTraits<0x0014, 0x400e, VR::SQ, 1, 1> {};
+		struct PreAmplifierNotes : TagTraits<0x0014, 0x400f, VR::LT, 1, 1> {};
+		struct TransmitTransducerSequence : TagTraits<0x0014, 0x4010, VR::SQ, 1, 1> {};
+		struct ReceiveTransducerSequence : TagTraits<0x0014, 0x4011, VR::SQ, 1, 1> {};
+		struct NumberOfElements : TagTraits<0x0014, 0x4012, VR::US, 1, 1> {};
+		struct ElementShape : TagTraits<0x0014, 0x4013, VR::CS, 1, 1> {};
+		struct ElementDimensionA : TagTraits<0x0014, 0x4014, VR::DS, 1, 1> {};
+		struct ElementDimensionB : TagTraits<0x0014, 0x4015, VR::DS, 1, 1> {};
+		struct ElementPitchA : TagTraits<0x0014, 0x4016, VR::DS, 1, 1> {};
+		struct MeasuredBeamDimensionA : TagTraits<0x0014, 0x4017, VR::DS, 1, 1> {};
+		struct MeasuredBeamDimensionB : TagTraits<0x0014, 0x4018, VR::DS, 1, 1> {};
+		struct LocationOfMeasuredBeamDiameter : TagTraits<0x0014, 0x4019, VR::DS, 1, 1> {};
+		struct NominalFrequency : TagTraits<0x0014, 0x401a, VR::DS, 1, 1> {};
+		struct MeasuredCenterFrequency : TagTraits<0x0014, 0x401b, VR::DS, 1, 1> {};
+		struct MeasuredBandwidth : TagTraits<0x0014, 0x401c, VR::DS, 1, 1> {};
+		struct ElementPitchB : TagTraits<0x0014, 0x401d, VR::DS, 1, 1> {};
+		struct PulserSettingsSequence : TagTraits<0x0014, 0x4020, VR::SQ, 1, 1> {};
+		struct PulseWidth : TagTraits<0x0014, 0x4022, VR::DS, 1, 1> {};
+		struct ExcitationFrequency : TagTraits<0x0014, 0x4024, VR::DS, 1, 1> {};
+		struct ModulationType : TagTraits<0x0014, 0x4026, VR::CS, 1, 1> {};
+		struct Damping : TagTraits<0x0014, 0x4028, VR::DS, 1, 1> {};
+		struct ReceiverSettingsSequence : TagTraits<0x0014, 0x4030, VR::SQ, 1, 1> {};
+		struct AcquiredSoundpathLength : TagTraits<0x0014, 0x4031, VR::DS, 1, 1> {};
+		struct AcquisitionCompressionType : TagTraits<0x0014, 0x4032, VR::CS, 1, 1> {};
+		struct AcquisitionSampleSize : TagTraits<0x0014, 0x4033, VR::IS, 1, 1> {};
+		struct RectifierSmoothing : TagTraits<0x0014, 0x4034, VR::DS, 1, 1> {};
+		struct DACSequence : TagTraits<0x0014, 0x4035, VR::SQ, 1, 1> {};
+		struct DACType : TagTraits<0x0014, 0x4036, VR::CS, 1, 1> {};
+		struct DACGainPoints : TagTraits<0x0014, 0x4038, VR::DS, 1, 0> {};
+		struct DACTimePoints : TagTraits<0x0014, 0x403a, VR::DS, 1, 0> {};
+		struct DACAmplitude : TagTraits<0x0014, 0x403c, VR::DS, 1, 0> {};
+		struct PreAmplifierSettingsSequence : TagTraits<0x0014, 0x4040, VR::SQ, 1, 1> {};
+		struct TransmitTransducerSettingsSequence : TagTraits<0x0014, 0x4050, VR::SQ, 1, 1> {};
+		struct ReceiveTransducerSettingsSequence : TagTraits<0x0014, 0x4051, VR::SQ, 1, 1> {};
+		struct IncidentAngle : TagTraits<0x0014, 0x4052, VR::DS, 1, 1> {};
+		struct CouplingTechnique : TagTraits<0x0014, 0x4054, VR::ST, 1, 1> {};
+		struct CouplingMedium : TagTraits<0x0014, 0x4056, VR::ST, 1, 1> {};
+		struct CouplingVelocity : TagTraits<0x0014, 0x4057, VR::DS, 1, 1> {};
+		struct ProbeCenterLocationX : TagTraits<0x0014, 0x4058, VR::DS, 1, 1> {};
+		struct ProbeCenterLocationZ : TagTraits<0x0014, 0x4059, VR::DS, 1, 1> {};
+		struct SoundPathLength : TagTraits<0x0014, 0x405a, VR::DS, 1, 1> {};
+		struct DelayLawIdentifier : TagTraits<0x0014, 0x405c, VR::ST, 1, 1> {};
+		struct GateSettingsSequence : TagTraits<0x0014, 0x4060, VR::SQ, 1, 1> {};
+		struct GateThreshold : TagTraits<0x0014, 0x4062, VR::DS, 1, 1> {};
+		struct VelocityOfSound : TagTraits<0x0014, 0x4064, VR::DS, 1, 1> {};
+		struct CalibrationSettingsSequence : TagTraits<0x0014, 0x4070, VR::SQ, 1, 1> {};
+		struct CalibrationProcedure : TagTraits<0x0014, 0x4072, VR::ST, 1, 1> {};
+		struct ProcedureVersion : TagTraits<0x0014, 0x4074, VR::SH, 1, 1> {};
+		struct ProcedureCreationDate : TagTraits<0x0014, 0x4076, VR::DA, 1, 1> {};
+		struct ProcedureExpirationDate : TagTraits<0x0014, 0x4078, VR::DA, 1, 1> {};
+		struct ProcedureLastModifiedDate : TagTraits<0x0014, 0x407a, VR::DA, 1, 1> {};
+		struct CalibrationTime : TagTraits<0x0014, 0x407c, VR::TM, 1, 0> {};
+		struct CalibrationDate : TagTraits<0x0014, 0x407e, VR::DA, 1, 0> {};
+		struct ProbeDriveEquipmentSequence : TagTraits<0x0014, 0x4080, VR::SQ, 1, 1> {};
+		struct DriveType : TagTraits<0x0014, 0x4081, VR::CS, 1, 1> {};
+		struct ProbeDriveNotes : TagTraits<0x0014, 0x4082, VR::LT, 1, 1> {};
+		struct DriveProbeSequence : TagTraits<0x0014, 0x4083, VR::SQ, 1, 1> {};
+		struct ProbeInductance : TagTraits<0x0014, 0x4084, VR::DS, 1, 1> {};
+		struct ProbeResistance : TagTraits<0x0014, 0x4085, VR::DS, 1, 1> {};
+		struct ReceiveProbeSequence : TagTraits<0x0014, 0x4086, VR::SQ, 1, 1> {};
+		struct ProbeDriveSettingsSequence : TagTraits<0x0014, 0x4087, VR::SQ, 1, 1> {};
+		struct BridgeResistors : TagTraits<0x0014, 0x4088, VR::DS, 1, 1> {};
+		struct ProbeOrientationAngle : TagTraits<0x0014, 0x4089, VR::DS, 1, 1> {};
+		struct UserSelectedGainY : TagTraits<0x0014, 0x408b, VR::DS, 1, 1> {};
+		struct UserSelectedPhase : TagTraits<0x0014, 0x408c, VR::DS, 1, 1> {};
+		struct UserSelectedOffsetX : TagTraits<0x0014, 0x408d, VR::DS, 1, 1> {};
+		struct UserSelectedOffsetY : TagTraits<0x0014, 0x408e, VR::DS, 1, 1> {};
+		struct ChannelSettingsSequence : TagTraits<0x0014, 0x4091, VR::SQ, 1, 1> {};
+		struct ChannelThreshold : TagTraits<0x0014, 0x4092, VR::DS, 1, 1> {};
+		struct ScannerSettingsSequence : TagTraits<0x0014, 0x409a, VR::SQ, 1, 1> {};
+		struct ScanProcedure : TagTraits<0x0014, 0x409b, VR::ST, 1, 1> {};
+		struct TranslationRateX : TagTraits<0x0014, 0x409c, VR::DS, 1, 1> {};
+		struct TranslationRateY : TagTraits<0x0014, 0x409d, VR::DS, 1, 1> {};
+		struct ChannelOverlap : TagTraits<0x0014, 0x409f, VR::DS, 1, 1> {};
+		struct ImageQualityIndicatorType : TagTraits<0x0014, 0x40a0, VR::LO, 1, 1> {};
+		struct ImageQualityIndicatorMaterial : TagTraits<0x0014, 0x40a1, VR::LO, 1, 1> {};
+		struct ImageQualityIndicatorSize : TagTraits<0x0014, 0x40a2, VR::LO, 1, 1> {};
+		struct LINACEnergy : TagTraits<0x0014, 0x5002, VR::IS, 1, 1> {};
+		struct LINACOutput : TagTraits<0x0014, 0x5004, VR::IS, 1, 1> {};
+		struct ActiveAperture : TagTraits<0x0014, 0x5100, VR::US, 1, 1> {};
+		struct TotalAperture : TagTraits<0x0014, 0x5101, VR::DS, 1, 1> {};
+		struct ApertureElevation : TagTraits<0x0014, 0x5102, VR::DS, 1, 1> {};
+		struct MainLobeAngle : TagTraits<0x0014, 0x5103, VR::DS, 1, 1> {};
+		struct MainRoofAngle : TagTraits<0x0014, 0x5104, VR::DS, 1, 1> {};
+		struct ConnectorType : TagTraits<0x0014, 0x5105, VR::CS, 1, 1> {};
+		struct WedgeModelNumber : TagTraits<0x0014, 0x5106, VR::SH, 1, 1> {};
+		struct WedgeAngleFloat : TagTraits<0x0014, 0x5107, VR::DS, 1, 1> {};
+		struct WedgeRoofAngle : TagTraits<0x0014, 0x5108, VR::DS, 1, 1> {};
+		struct WedgeElement1Position : TagTraits<0x0014, 0x5109, VR::CS, 1, 1> {};
+		struct WedgeMaterialVelocity : TagTraits<0x0014, 0x510a, VR::DS, 1, 1> {};
+		struct WedgeMaterial : TagTraits<0x0014, 0x510b, VR::SH, 1, 1> {};
+		struct WedgeOffsetZ : TagTraits<0x0014, 0x510c, VR::DS, 1, 1> {};
+		struct WedgeOriginOffsetX : TagTraits<0x0014, 0x510d, VR::DS, 1, 1> {};
+		struct WedgeTimeDelay : TagTraits<0x0014, 0x510e, VR::DS, 1, 1> {};
+		struct WedgeName : TagTraits<0x0014, 0x510f, VR::SH, 1, 1> {};
+		struct WedgeManufacturerName : TagTraits<0x0014, 0x5110, VR::SH, 1, 1> {};
+		struct WedgeDescription : TagTraits<0x0014, 0x5111, VR::LO, 1, 1> {};
+		struct NominalBeamAngle : TagTraits<0x0014, 0x5112, VR::DS, 1, 1> {};
+		struct WedgeOffsetX : TagTraits<0x0014, 0x5113, VR::DS, 1, 1> {};
+		struct WedgeOffsetY : TagTraits<0x0014, 0x5114, VR::DS, 1, 1> {};
+		struct WedgeTotalLength : TagTraits<0x0014, 0x5115, VR::DS, 1, 1> {};
+		struct WedgeInContactLength : TagTraits<0x0014, 0x5116, VR::DS, 1, 1> {};
+		struct WedgeFrontGap : TagTraits<0x0014, 0x5117, VR::DS, 1, 1> {};
+		struct WedgeTotalHeight : TagTraits<0x0014, 0x5118, VR::DS, 1, 1> {};
+		struct WedgeFrontHeight : TagTraits<0x0014, 0x5119, VR::DS, 1, 1> {};
+		struct WedgeRearHeight : TagTraits<0x0014, 0x511a, VR::DS, 1, 1> {};
+		struct WedgeTotalWidth : TagTraits<0x0014, 0x511b, VR::DS, 1, 1> {};
+		struct WedgeInContactWidth : TagTraits<0x0014, 0x511c, VR::DS, 1, 1> {};
+		struct WedgeChamferHeight : TagTraits<0x0014, 0x511d, VR::DS, 1, 1> {};
+		struct WedgeCurve : TagTraits<0x0014, 0x511e, VR::CS, 1, 1> {};
+		struct RadiusAlongWedge : TagTraits<0x0014, 0x511f, VR::DS, 1, 1> {};
+		struct ContrastBolusAgent : TagTraits<0x0018, 0x0010, VR::LO, 1, 1> {};
+		struct ContrastBolusAgentSequence : TagTraits<0x0018, 0x0012, VR::SQ, 1, 1> {};
+		struct ContrastBolusT1Relaxivity : TagTraits<0x0018, 0x0013, VR::FL, 1, 1> {};
+		struct ContrastBolusAdministrationRouteSequence : TagTraits<0x0018, 0x0014, VR::SQ, 1, 1> {};
+		struct BodyPartExamined : TagTraits<0x0018, 0x0015, VR::CS, 1, 1> {};
+		struct ScanningSequence : TagTraits<0x0018, 0x0020, VR::CS, 1, 0> {};
+		struct SequenceVariant : TagTraits<0x0018, 0x0021, VR::CS, 1, 0> {};
+		struct ScanOptions : TagTraits<0x0018, 0x0022, VR::CS, 1, 0> {};
+		struct MRAcquisitionType : TagTraits<0x0018, 0x0023, VR::CS, 1, 1> {};
+		struct SequenceName : TagTraits<0x0018, 0x0024, VR::SH, 1, 1> {};
+		struct AngioFlag : TagTraits<0x0018, 0x0025, VR::CS, 1, 1> {};
+		struct InterventionDrugInformationSequence : TagTraits<0x0018, 0x0026, VR::SQ, 1, 1> {};
+		struct InterventionDrugStopTime : TagTraits<0x0018, 0x0027, VR::TM, 1, 1> {};
+		struct InterventionDrugDose : TagTraits<0x0018, 0x0028, VR::DS, 1, 1> {};
+		struct InterventionDrugCodeSequence : TagTraits<0x0018, 0x0029, VR::SQ, 1, 1> {};
+		struct AdditionalDrugSequence : TagTraits<0x0018, 0x002a, VR::SQ, 1, 1> {};
+		struct Radionuclide : TagTraits<0x0018, 0x0030, VR::LO, 1, 0> {};
+		struct Radiopharmaceutical : TagTraits<0x0018, 0x0031, VR::LO, 1, 1> {};
+		struct EnergyWindowCenterline : TagTraits<0x0018, 0x0032, VR::DS, 1, 1> {};
+		struct EnergyWindowTotalWidth : TagTraits<0x0018, 0x0033, VR::DS, 1, 0> {};
+		struct InterventionDrugName : TagTraits<0x0018, 0x0034, VR::LO, 1, 1> {};
+		struct InterventionDrugStartTime : TagTraits<0x0018, 0x0035, VR::TM, 1, 1> {};
+		struct InterventionSequence : TagTraits<0x0018, 0x0036, VR::SQ, 1, 1> {};
+		struct TherapyType : TagTraits<0x0018, 0x0037, VR::CS, 1, 1> {};
+		struct InterventionStatus : TagTraits<0x0018, 0x0038, VR::CS, 1, 1> {};
+		struct TherapyDescription : TagTraits<0x0018, 0x0039, VR::CS, 1, 1> {};
+		struct InterventionDescription : TagTraits<0x0018, 0x003a, VR::ST, 1, 1> {};
+		struct CineRate : TagTraits<0x0018, 0x0040, VR::IS, 1, 1> {};
+		struct InitialCineRunState : TagTraits<0x0018, 0x0042, VR::CS, 1, 1> {};
+		struct SliceThickness : TagTraits<0x0018, 0x0050, VR::DS, 1, 1> {};
+		struct KVP : TagTraits<0x0018, 0x0060, VR::DS, 1, 1> {};
+		struct CountsAccumulated : TagTraits<0x0018, 0x0070, VR::IS, 1, 1> {};
+		struct AcquisitionTerminationCondition : TagTraits<0x0018, 0x0071, VR::CS, 1, 1> {};
+		struct EffectiveDuration : TagTraits<0x0018, 0x0072, VR::DS, 1, 1> {};
+		struct AcquisitionStartCondition : TagTraits<0x0018, 0x0073, VR::CS, 1, 1> {};
+		struct AcquisitionStartConditionData : TagTraits<0x0018, 0x0074, VR::IS, 1, 1> {};
+		struct AcquisitionTerminationConditionData : TagTraits<0x0018, 0x0075, VR::IS, 1, 1> {};
+		struct RepetitionTime : TagTraits<0x0018, 0x0080, VR::DS, 1, 1> {};
+		struct EchoTime : TagTraits<0x0018, 0x0081, VR::DS, 1, 1> {};
+		struct InversionTime : TagTraits<0x0018, 0x0082, VR::DS, 1, 1> {};
+		struct NumberOfAverages : TagTraits<0x0018, 0x0083, VR::DS, 1, 1> {};
+		struct ImagingFrequency : TagTraits<0x0018, 0x0084, VR::DS, 1, 1> {};
+		struct ImagedNucleus : TagTraits<0x0018, 0x0085, VR::SH, 1, 1> {};
+		struct EchoNumbers : TagTraits<0x0018, 0x0086, VR::IS, 1, 0> {};
+		struct MagneticFieldStrength : TagTraits<0x0018, 0x0087, VR::DS, 1, 1> {};
+		struct SpacingBetweenSlices : TagTraits<0x0018, 0x0088, VR::DS, 1, 1> {};
+		struct NumberOfPhaseEncodingSteps : TagTraits<0x0018, 0x0089, VR::IS, 1, 1> {};
+		struct DataCollectionDiameter : TagTraits<0x0018, 0x0090, VR::DS, 1, 1> {};
+		struct EchoTrainLength : TagTraits<0x0018, 0x0091, VR::IS, 1, 1> {};
+		struct PercentSampling : TagTraits<0x0018, 0x0093, VR::DS, 1, 1> {};
+		struct PercentPhaseFieldOfView : TagTraits<0x0018, 0x0094, VR::DS, 1, 1> {};
+		struct PixelBandwidth : TagTraits<0x0018, 0x0095, VR::DS, 1, 1> {};
+		struct DeviceSerialNumber : TagTraits<0x0018, 0x1000, VR::LO, 1, 1> {};
+		struct DeviceUID : TagTraits<0x0018, 0x1002, VR::UI, 1, 1> {};
+		struct DeviceID : TagTraits<0x0018, 0x1003, VR::LO, 1, 1> {};
+		struct PlateID : TagTraits<0x0018, 0x1004, VR::LO, 1, 1> {};
+		struct GeneratorID : TagTraits<0x0018, 0x1005, VR::LO, 1, 1> {};
+		struct GridID : TagTraits<0x0018, 0x1006, VR::LO, 1, 1> {};
+		struct CassetteID : TagTraits<0x0018, 0x1007, VR::LO, 1, 1> {};
+		struct GantryID : TagTraits<0x0018, 0x1008, VR::LO, 1, 1> {};
+		struct UniqueDeviceIdentifier : TagTraits<0x0018, 0x1009, VR::UT, 1, 1> {};
+		struct UDISequence : TagTraits<0x0018, 0x100a, VR::SQ, 1, 1> {};
+		struct SecondaryCaptureDeviceID : TagTraits<0x0018, 0x1010, VR::LO, 1, 1> {};
+		struct HardcopyCreationDeviceID : TagTraits<0x0018, 0x1011, VR::LO, 1, 1> {};
+		struct DateOfSecondaryCapture : TagTraits<0x0018, 0x1012, VR::DA, 1, 1> {};
+		struct TimeOfSecondaryCapture : TagTraits<0x0018, 0x1014, VR::TM, 1, 1> {};
+		struct SecondaryCaptureDeviceManufacturer : TagTraits<0x0018, 0x1016, VR::LO, 1, 1> {};
+		struct HardcopyDeviceManufacturer : TagTraits<0x0018, 0x1017, VR::LO, 1, 1> {};
+		struct SecondaryCaptureDeviceManufacturerModelName : TagTraits<0x0018, 0x1018, VR::LO, 1, 1> {};
+		struct SecondaryCaptureDeviceSoftwareVersions : TagTraits<0x0018, 0x1019, VR::LO, 1, 0> {};
+		struct HardcopyDeviceSoftwareVersion : TagTraits<0x0018, 0x101a, VR::LO, 1, 0> {};
+		struct HardcopyDeviceManufacturerModelName : TagTraits<0x0018, 0x101b, VR::LO, 1, 1> {};
+		struct SoftwareVersions : TagTraits<0x0018, 0x1020, VR::LO, 1, 0> {};
+		struct VideoImageFormatAcquired : TagTraits<0x0018, 0x1022, VR::SH, 1, 1> {};
+		struct DigitalImageFormatAcquired : TagTraits<0x0018, 0x1023, VR::LO, 1, 1> {};
+		struct ProtocolName : TagTraits<0x0018, 0x1030, VR::LO, 1, 1> {};
+		struct ContrastBolusRoute : TagTraits<0x0018, 0x1040, VR::LO, 1, 1> {};
+		struct ContrastBolusVolume : TagTraits<0x0018, 0x1041, VR::DS, 1, 1> {};
+		struct ContrastBolusStartTime : TagTraits<0x0018, 0x1042, VR::TM, 1, 1> {};
+		struct ContrastBolusStopTime : TagTraits<0x0018, 0x1043, VR::TM, 1, 1> {};
+		struct ContrastBolusTotalDose : TagTraits<0x0018, 0x1044, VR::DS, 1, 1> {};
+		struct SyringeCounts : TagTraits<0x0018, 0x1045, VR::IS, 1, 1> {};
+		struct ContrastFlowRate : TagTraits<0x0018, 0x1046, VR::DS, 1, 0> {};
+		struct ContrastFlowDuration : TagTraits<0x0018, 0x1047, VR::DS, 1, 0> {};
+		struct ContrastBolusIngredient : TagTraits<0x0018, 0x1048, VR::CS, 1, 1> {};
+		struct ContrastBolusIngredientConcentration : TagTraits<0x0018, 0x1049, VR::DS, 1, 1> {};
+		struct SpatialResolution : TagTraits<0x0018, 0x1050, VR::DS, 1, 1> {};
+		struct TriggerTime : TagTraits<0x0018, 0x1060, VR::DS, 1, 1> {};
+		struct TriggerSourceOrType : TagTraits<0x0018, 0x1061, VR::LO, 1, 1> {};
+		struct NominalInterval : TagTraits<0x0018, 0x1062, VR::IS, 1, 1> {};
+		struct FrameTime : TagTraits<0x0018, 0x1063, VR::DS, 1, 1> {};
+		struct CardiacFramingType : TagTraits<0x0018, 0x1064, VR::LO, 1, 1> {};
+		struct FrameTimeVector : TagTraits<0x0018, 0x1065, VR::DS, 1, 0> {};
+		struct FrameDelay : TagTraits<0x0018, 0x1066, VR::DS, 1, 1> {};
+		struct ImageTriggerDelay : TagTraits<0x0018, 0x1067, VR::DS, 1, 1> {};
+		struct MultiplexGroupTimeOffset : TagTraits<0x0018, 0x1068, VR::DS, 1, 1> {};
+		struct TriggerTimeOffset : TagTraits<0x0018, 0x1069, VR::DS, 1, 1> {};
+		struct SynchronizationTrigger : TagTraits<0x0018, 0x106a, VR::CS, 1, 1> {};
+		struct SynchronizationChannel : TagTraits<0x0018, 0x106c, VR::US, 2, 2> {};
+		struct TriggerSamplePosition : TagTraits<0x0018, 0x106e, VR::UL, 1, 1> {};
+		struct RadiopharmaceuticalRoute : TagTraits<0x0018, 0x1070, VR::LO, 1, 1> {};
+		struct RadiopharmaceuticalVolume : TagTraits<0x0018, 0x1071, VR::DS, 1, 1> {};
+		struct RadiopharmaceuticalStartTime : TagTraits<0x0018, 0x1072, VR::TM, 1, 1> {};
+		struct RadiopharmaceuticalStopTime : TagTraits<0x0018, 0x1073, VR::TM, 1, 1> {};
+		struct RadionuclideTotalDose : TagTraits<0x0018, 0x1074, VR::DS, 1, 1> {};
+		struct RadionuclideHalfLife : TagTraits<0x0018, 0x1075, VR::DS, 1, 1> {};
+		struct RadionuclidePositronFraction : TagTraits<0x0018, 0x1076, VR::DS, 1, 1> {};
+		struct RadiopharmaceuticalSpecificActivity : TagTraits<0x0018, 0x1077, VR::DS, 1, 1> {};
+		struct RadiopharmaceuticalStartDateTime : TagTraits<0x0018, 0x1078, VR::DT, 1, 1> {};
+		struct RadiopharmaceuticalStopDateTime : TagTraits<0x0018, 0x1079, VR::DT, 1, 1> {};
+		struct BeatRejectionFlag : TagTraits<0x0018, 0x1080, VR::CS, 1, 1> {};
+		struct LowRRValue : TagTraits<0x0018, 0x1081, VR::IS, 1, 1> {};
+		struct HighRRValue : TagTraits<0x0018, 0x1082, VR::IS, 1, 1> {};
+		struct IntervalsAcquired : TagTraits<0x0018, 0x1083, VR::IS, 1, 1> {};
+		struct IntervalsRejected : TagTraits<0x0018, 0x1084, VR::IS, 1, 1> {};
+		struct PVCRejection : TagTraits<0x0018, 0x1085, VR::LO, 1, 1> {};
+		struct SkipBeats : TagTraits<0x0018, 0x1086, VR::IS, 1, 1> {};
+		struct HeartRate : TagTraits<0x0018, 0x1088, VR::IS, 1, 1> {};
+		struct CardiacNumberOfImages : TagTraits<0x0018, 0x1090, VR::IS, 1, 1> {};
+		struct TriggerWindow : TagTraits<0x0018, 0x1094, VR::IS, 1, 1> {};
+		struct ReconstructionDiameter : TagTraits<0x0018, 0x1100, VR::DS, 1, 1> {};
+		struct DistanceSourceToDetector : TagTraits<0x0018, 0x1110, VR::DS, 1, 1> {};
+		struct DistanceSourceToPatient : TagTraits<0x0018, 0x1111, VR::DS, 1, 1> {};
+		struct EstimatedRadiographicMagnificationFactor : TagTraits<0x0018, 0x1114, VR::DS, 1, 1> {};
+		struct GantryDetectorTilt : TagTraits<0x0018, 0x1120, VR::DS, 1, 1> {};
+		struct GantryDetectorSlew : TagTraits<0x0018, 0x1121, VR::DS, 1, 1> {};
+		struct TableHeight : TagTraits<0x0018, 0x1130, VR::DS, 1, 1> {};
+		struct TableTraverse : TagTraits<0x0018, 0x1131, VR::DS, 1, 1> {};
+		struct TableMotion : TagTraits<0x0018, 0x1134, VR::CS, 1, 1> {};
+		struct TableVerticalIncrement : TagTraits<0x0018, 0x1135, VR::DS, 1, 0> {};
+		struct TableLateralIncrement : TagTraits<0x0018, 0x1136, VR::DS, 1, 0> {};
+		struct TableLongitudinalIncrement : TagTraits<0x0018, 0x1137, VR::DS, 1, 0> {};
+		struct TableAngle : TagTraits<0x0018, 0x1138, VR::DS, 1, 1> {};
+		struct TableType : TagTraits<0x0018, 0x113a, VR::CS, 1, 1> {};
+		struct RotationDirection : TagTraits<0x0018, 0x1140, VR::CS, 1, 1> {};
+		struct AngularPosition : TagTraits<0x0018, 0x1141, VR::DS, 1, 1> {};
+		struct RadialPosition : TagTraits<0x0018, 0x1142, VR::DS, 1, 0> {};
+		struct ScanArc : TagTraits<0x0018, 0x1143, VR::DS, 1, 1> {};
+		struct AngularStep : TagTraits<0x0018, 0x1144, VR::DS, 1, 1> {};
+		struct CenterOfRotationOffset : TagTraits<0x0018, 0x1145, VR::DS, 1, 1> {};
+		struct RotationOffset : TagTraits<0x0018, 0x1146, VR::DS, 1, 0> {};
+		struct FieldOfViewShape : TagTraits<0x0018, 0x1147, VR::CS, 1, 1> {};
+		struct FieldOfViewDimensions : TagTraits<0x0018, 0x1149, VR::IS, 1, 2> {};
+		struct ExposureTime : TagTraits<0x0018, 0x1150, VR::IS, 1, 1> {};
+		struct XRayTubeCurrent : TagTraits<0x0018, 0x1151, VR::IS, 1, 1> {};
+		struct Exposure : TagTraits<0x0018, 0x1152, VR::IS, 1, 1> {};
+		struct ExposureInuAs : TagTraits<0x0018, 0x1153, VR::IS, 1, 1> {};
+		struct AveragePulseWidth : TagTraits<0x0018, 0x1154, VR::DS, 1, 1> {};
+		struct RadiationSetting : TagTraits<0x0018, 0x1155, VR::CS, 1, 1> {};
+		struct RectificationType : TagTraits<0x0018, 0x1156, VR::CS, 1, 1> {};
+		struct RadiationMode : TagTraits<0x0018, 0x115a, VR::CS, 1, 1> {};
+		struct ImageAndFluoroscopyAreaDoseProduct : TagTraits<0x0018, 0x115e, VR::DS, 1, 1> {};
+		struct FilterType : TagTraits<0x0018, 0x1160, VR::SH, 1, 1> {};
+		struct TypeOfFilters : TagTraits<0x0018, 0x1161, VR::LO, 1, 0> {};
+		struct IntensifierSize : TagTraits<0x0018, 0x1162, VR::DS, 1, 1> {};
+		struct ImagerPixelSpacing : TagTraits<0x0018, 0x1164, VR::DS, 2, 2> {};
+		struct Grid : TagTraits<0x0018, 0x1166, VR::CS, 1, 0> {};
+		struct GeneratorPower : TagTraits<0x0018, 0x1170, VR::IS, 1, 1> {};
+		struct CollimatorGridName : TagTraits<0x0018, 0x1180, VR::SH, 1, 1> {};
+		struct CollimatorType : TagTraits<0x0018, 0x1181, VR::CS, 1, 1> {};
+		struct FocalDistance : TagTraits<0x0018, 0x1182, VR::IS, 1, 2> {};
+		struct XFocusCenter : TagTraits<0x0018, 0x1183, VR::DS, 1, 2> {};
+		struct YFocusCenter : TagTraits<0x0018, 0x1184, VR::DS, 1, 2> {};
+		struct FocalSpots : TagTraits<0x0018, 0x1190, VR::DS, 1, 0> {};
+		struct AnodeTargetMaterial : TagTraits<0x0018, 0x1191, VR::CS, 1, 1> {};
+		struct BodyPartThickness : TagTraits<0x0018, 0x11a0, VR::DS, 1, 1> {};
+		struct CompressionForce : TagTraits<0x0018, 0x11a2, VR::DS, 1, 1> {};
+		struct PaddleDescription : TagTraits<0x0018, 0x11a4, VR::LO, 1, 1> {};
+		struct DateOfLastCalibration : TagTraits<0x0018, 0x1200, VR::DA, 1, 0> {};
+		struct TimeOfLastCalibration : TagTraits<0x0018, 0x1201, VR::TM, 1, 0> {};
+		struct DateTimeOfLastCalibration : TagTraits<0x0018, 0x1202, VR::DT, 1, 1> {};
+		struct ConvolutionKernel : TagTraits<0x0018, 0x1210, VR::SH, 1, 0> {};
+		struct UpperLowerPixelValues : TagTraits<0x0018, 0x1240, VR::IS, 1, 0> {};
+		struct ActualFrameDuration : TagTraits<0x0018, 0x1242, VR::IS, 1, 1> {};
+		struct CountRate : TagTraits<0x0018, 0x1243, VR::IS, 1, 1> {};
+		struct PreferredPlaybackSequencing : TagTraits<0x0018, 0x1244, VR::US, 1, 1> {};
+		struct ReceiveCoilName : TagTraits<0x0018, 0x1250, VR::SH, 1, 1> {};
+		struct TransmitCoilName : TagTraits<0x0018, 0x1251, VR::SH, 1, 1> {};
+		struct PlateType : TagTraits<0x0018, 0x1260, VR::SH, 1, 1> {};
+		struct PhosphorType : TagTraits<0x0018, 0x1261, VR::LO, 1, 1> {};
+		struct WaterEquivalentDiameter : TagTraits<0x0018, 0x1271, VR::FD, 1, 1> {};
+		struct WaterEquivalentDiameterCalculationMethodCodeSequence : TagTraits<0x0018, 0x1272, VR::SQ, 1, 1> {};
+		struct ScanVelocity : TagTraits<0x0018, 0x1300, VR::DS, 1, 1> {};
+		struct WholeBodyTechnique : TagTraits<0x0018, 0x1301, VR::CS, 1, 0> {};
+		struct ScanLength : TagTraits<0x0018, 0x1302, VR::IS, 1, 1> {};
+		struct AcquisitionMatrix : TagTraits<0x0018, 0x1310, VR::US, 4, 4> {};
+		struct InPlanePhaseEncodingDirection : TagTraits<0x0018, 0x1312, VR::CS, 1, 1> {};
+		struct FlipAngle : TagTraits<0x0018, 0x1314, VR::DS, 1, 1> {};
+		struct VariableFlipAngleFlag : TagTraits<0x0018, 0x1315, VR::CS, 1, 1> {};
+		struct SAR : TagTraits<0x0018, 0x1316, VR::DS, 1, 1> {};
+		struct dBdt : TagTraits<0x0018, 0x1318, VR::DS, 1, 1> {};
+		struct B1rms : TagTraits<0x0018, 0x1320, VR::FL, 1, 1> {};
+		struct AcquisitionDeviceProcessingDescription : TagTraits<0x0018, 0x1400, VR::LO, 1, 1> {};
+		struct AcquisitionDeviceProcessingCode : TagTraits<0x0018, 0x1401, VR::LO, 1, 1> {};
+		struct CassetteOrientation : TagTraits<0x0018, 0x1402, VR::CS, 1, 1> {};
+		struct CassetteSize : TagTraits<0x0018, 0x1403, VR::CS, 1, 1> {};
+		struct ExposuresOnPlate : TagTraits<0x0018, 0x1404, VR::US, 1, 1> {};
+		struct RelativeXRayExposure : TagTraits<0x0018, 0x1405, VR::IS, 1, 1> {};
+		struct ExposureIndex : TagTraits<0x0018, 0x1411, VR::DS, 1, 1> {};
+		struct TargetExposureIndex : TagTraits<0x0018, 0x1412, VR::DS, 1, 1> {};
+		struct DeviationIndex : TagTraits<0x0018, 0x1413, VR::DS, 1, 1> {};
+		struct ColumnAngulation : TagTraits<0x0018, 0x1450, VR::DS, 1, 1> {};
+		struct TomoLayerHeight : TagTraits<0x0018, 0x1460, VR::DS, 1, 1> {};
+		struct TomoAngle : TagTraits<0x0018, 0x1470, VR::DS, 1, 1> {};
+		struct TomoTime : TagTraits<0x0018, 0x1480, VR::DS, 1, 1> {};
+		struct TomoType : TagTraits<0x0018, 0x1490, VR::CS, 1, 1> {};
+		struct TomoClass : TagTraits<0x0018, 0x1491, VR::CS, 1, 1> {};
+		struct NumberOfTomosynthesisSourceImages : TagTraits<0x0018, 0x1495, VR::IS, 1, 1> {};
+		struct PositionerMotion : TagTraits<0x0018, 0x1500, VR::CS, 1, 1> {};
+		struct PositionerType : TagTraits<0x0018, 0x1508, VR::CS, 1, 1> {};
+		struct PositionerPrimaryAngle : TagTraits<0x0018, 0x1510, VR::DS, 1, 1> {};
+		struct PositionerSecondaryAngle : TagTraits<0x0018, 0x1511, VR::DS, 1, 1> {};
+		struct PositionerPrimaryAngleIncrement : TagTraits<0x0018, 0x1520, VR::DS, 1, 0> {};
+		struct PositionerSecondaryAngleIncrement : TagTraits<0x0018, 0x1521, VR::DS, 1, 0> {};
+		struct DetectorPrimaryAngle : TagTraits<0x0018, 0x1530, VR::DS, 1, 1> {};
+		struct DetectorSecondaryAngle : TagTraits<0x0018, 0x1531, VR::DS, 1, 1> {};
+		struct ShutterShape : TagTraits<0x0018, 0x1600, VR::CS, 1, 3> {};
+		struct ShutterLeftVerticalEdge : TagTraits<0x0018, 0x1602, VR::IS, 1, 1> {};
+		struct ShutterRightVerticalEdge : TagTraits<0x0018, 0x1604, VR::IS, 1, 1> {};
+		struct ShutterUpperHorizontalEdge : TagTraits<0x0018, 0x1606, VR::IS, 1, 1> {};
+		struct ShutterLowerHorizontalEdge : TagTraits<0x0018, 0x1608, VR::IS, 1, 1> {};
+		struct CenterOfCircularShutter : TagTraits<0x0018, 0x1610, VR::IS, 2, 2> {};
+		struct RadiusOfCircularShutter : TagTraits<0x0018, 0x1612, VR::IS, 1, 1> {};
+		struct VerticesOfThePolygonalShutter : TagTraits<0x0018, 0x1620, VR::IS, 2, 0> {};
+		struct ShutterPresentationValue : TagTraits<0x0018, 0x1622, VR::US, 1, 1> {};
+		struct ShutterOverlayGroup : TagTraits<0x0018, 0x1623, VR::US, 1, 1> {};
+		struct ShutterPresentationColorCIELabValue : TagTraits<0x0018, 0x1624, VR::US, 3, 3> {};
+		struct CollimatorShape : TagTraits<0x0018, 0x1700, VR::CS, 1, 3> {};
+		struct CollimatorLeftVerticalEdge : TagTraits<0x0018, 0x1702, VR::IS, 1, 1> {};
+		struct CollimatorRightVerticalEdge : TagTraits<0x0018, 0x1704, VR::IS, 1, 1> {};
+		struct CollimatorUpperHorizontalEdge : TagTraits<0x0018, 0x1706, VR::IS, 1, 1> {};
+		struct CollimatorLowerHorizontalEdge : TagTraits<0x0018, 0x1708, VR::IS, 1, 1> {};
+		struct CenterOfCircularCollimator : TagTraits<0x0018, 0x1710, VR::IS, 2, 2> {};
+		struct RadiusOfCircularCollimator : TagTraits<0x0018, 0x1712, VR::IS, 1, 1> {};
+		struct VerticesOfThePolygonalCollimator : TagTraits<0x0018, 0x1720, VR::IS, 2, 0> {};
+		struct AcquisitionTimeSynchronized : TagTraits<0x0018, 0x1800, VR::CS, 1, 1> {};
+		struct TimeSource : TagTraits<0x0018, 0x1801, VR::SH, 1, 1> {};
+		struct TimeDistributionProtocol : TagTraits<0x0018, 0x1802, VR::CS, 1, 1> {};
+		struct NTPSourceAddress : TagTraits<0x0018, 0x1803, VR::LO, 1, 1> {};
+		struct PageNumberVector : TagTraits<0x0018, 0x2001, VR::IS, 1, 0> {};
+		struct FrameLabelVector : TagTraits<0x0018, 0x2002, VR::SH, 1, 0> {};
+		struct FramePrimaryAngleVector : TagTraits<0x0018, 0x2003, VR::DS, 1, 0> {};
+		struct FrameSecondaryAngleVector : TagTraits<0x0018, 0x2004, VR::DS, 1, 0> {};
+		struct SliceLocationVector : TagTraits<0x0018, 0x2005, VR::DS, 1, 0> {};
+		struct DisplayWindowLabelVector : TagTraits<0x0018, 0x2006, VR::SH, 1, 0> {};
+		struct NominalScannedPixelSpacing : TagTraits<0x0018, 0x2010, VR::DS, 2, 2> {};
+		struct DigitizingDeviceTransportDirection : TagTraits<0x0018, 0x2020, VR::CS, 1, 1> {};
+		struct RotationOfScannedFilm : TagTraits<0x0018, 0x2030, VR::DS, 1, 1> {};
+		struct BiopsyTargetSequence : TagTraits<0x0018, 0x2041, VR::SQ, 1, 1> {};
+		struct TargetUID : TagTraits<0x0018, 0x2042, VR::UI, 1, 1> {};
+		struct LocalizingCursorPosition : TagTraits<0x0018, 0x2043, VR::FL, 2, 2> {};
+		struct CalculatedTargetPosition : TagTraits<0x0018, 0x2044, VR::FL, 3, 3> {};
+		struct TargetLabel : TagTraits<0x0018, 0x2045, VR::SH, 1, 1> {};
+		struct DisplayedZValue : TagTraits<0x0018, 0x2046, VR::FL, 1, 1> {};
+		struct IVUSAcquisition : TagTraits<0x0018, 0x3100, VR::CS, 1, 1> {};
+		struct IVUSPullbackRate : TagTraits<0x0018, 0x3101, VR::DS, 1, 1> {};
+		struct IVUSGatedRate : TagTraits<0x0018, 0x3102, VR::DS, 1, 1> {};
+		struct IVUSPullbackStartFrameNumber : TagTraits<0x0018, 0x3103, VR::IS, 1, 1> {};
+		struct IVUSPullbackStopFrameNumber : TagTraits<0x0018, 0x3104, VR::IS, 1, 1> {};
+		struct LesionNumber : TagTraits<0x0018, 0x3105, VR::IS, 1, 0> {};
+		struct AcquisitionComments : TagTraits<0x0018, 0x4000, VR::LT, 1, 1> {};
+		struct OutputPower : TagTraits<0x0018, 0x5000, VR::SH, 1, 0> {};
+		struct TransducerData : TagTraits<0x0018, 0x5010, VR::LO, 1, 0> {};
+		struct FocusDepth : TagTraits<0x0018, 0x5012, VR::DS, 1, 1> {};
+		struct ProcessingFunction : TagTraits<0x0018, 0x5020, VR::LO, 1, 1> {};
+		struct PostprocessingFunction : TagTraits<0x0018, 0x5021, VR::LO, 1, 1> {};
+		struct MechanicalIndex : TagTraits<0x0018, 0x5022, VR::DS, 1, 1> {};
+		struct BoneThermalIndex : TagTraits<0x0018, 0x5024, VR::DS, 1, 1> {};
+		struct CranialThermalIndex : TagTraits<0x0018, 0x5026, VR::DS, 1, 1> {};
+		struct SoftTissueThermalIndex : TagTraits<0x0018, 0x5027, VR::DS, 1, 1> {};
+		struct SoftTissueFocusThermalIndex : TagTraits<0x0018, 0x5028, VR::DS, 1, 1> {};
+		struct SoftTissueSurfaceThermalIndex : TagTraits<0x0018, 0x5029, VR::DS, 1, 1> {};
+		struct DynamicRange : TagTraits<0x0018, 0x5030, VR::DS, 1, 1> {};
+		struct TotalGain : TagTraits<0x0018, 0x5040, VR::DS, 1, 1> {};
+		struct DepthOfScanField : TagTraits<0x0018, 0x5050, VR::IS, 1, 1> {};
+		struct PatientPosition : TagTraits<0x0018, 0x5100, VR::CS, 1, 1> {};
+		struct ViewPosition : TagTraits<0x0018, 0x5101, VR::CS, 1, 1> {};
+		struct ProjectionEponymousNameCodeSequence : TagTraits<0x0018, 0x5104, VR::SQ, 1, 1> {};
+		struct ImageTransformationMatrix : TagTraits<0x0018, 0x5210, VR::DS, 6, 6> {};
+		struct ImageTranslationVector : TagTraits<0x0018, 0x5212, VR::DS, 3, 3> {};
+		struct Sensitivity : TagTraits<0x0018, 0x6000, VR::DS, 1, 1> {};
+		struct SequenceOfUltrasoundRegions : TagTraits<0x0018, 0x6011, VR::SQ, 1, 1> {};
+		struct RegionSpatialFormat : TagTraits<0x0018, 0x6012, VR::US, 1, 1> {};
+		struct RegionDataType : TagTraits<0x0018, 0x6014, VR::US, 1, 1> {};
+		struct RegionFlags : TagTraits<0x0018, 0x6016, VR::UL, 1, 1> {};
+		struct RegionLocationMinX0 : TagTraits<0x0018, 0x6018, VR::UL, 1, 1> {};
+		struct RegionLocationMinY0 : TagTraits<0x0018, 0x601a, VR::UL, 1, 1> {};
+		struct RegionLocationMaxX1 : TagTraits<0x0018, 0x601c, VR::UL, 1, 1> {};
+		struct RegionLocationMaxY1 : TagTraits<0x0018, 0x601e, VR::UL, 1, 1> {};
+		struct ReferencePixelX0 : TagTraits<0x0018, 0x6020, VR::SL, 1, 1> {};
+		struct ReferencePixelY0 : TagTraits<0x0018, 0x6022, VR::SL, 1, 1> {};
+		struct PhysicalUnitsXDirection : TagTraits<0x0018, 0x6024, VR::US, 1, 1> {};
+		struct PhysicalUnitsYDirection : TagTraits<0x0018, 0x6026, VR::US, 1, 1> {};
+		struct ReferencePixelPhysicalValueX : TagTraits<0x0018, 0x6028, VR::FD, 1, 1> {};
+		struct ReferencePixelPhysicalValueY : TagTraits<0x0018, 0x602a, VR::FD, 1, 1> {};
+		struct PhysicalDeltaX : TagTraits<0x0018, 0x602c, VR::FD, 1, 1> {};
+		struct PhysicalDeltaY : TagTraits<0x0018, 0x602e, VR::FD, 1, 1> {};
+		struct TransducerFrequency : TagTraits<0x0018, 0x6030, VR::UL, 1, 1> {};
+		struct TransducerType : TagTraits<0x0018, 0x6031, VR::CS, 1, 1> {};
+		struct PulseRepetitionFrequency : TagTraits<0x0018, 0x6032, VR::UL, 1, 1> {};
+		struct DopplerCorrectionAngle : TagTraits<0x0018, 0x6034, VR::FD, 1, 1> {};
+		struct SteeringAngle : TagTraits<0x0018, 0x6036, VR::FD, 1, 1> {};
+		struct DopplerSampleVolumeXPositionRetired : TagTraits<0x0018, 0x6038, VR::UL, 1, 1> {};
+		struct DopplerSampleVolumeXPosition : TagTraits<0x0018, 0x6039, VR::SL, 1, 1> {};
+		struct DopplerSampleVolumeYPositionRetired : TagTraits<0x0018, 0x603a, VR::UL, 1, 1> {};
+		struct DopplerSampleVolumeYPosition : TagTraits<0x0018, 0x603b, VR::SL, 1, 1> {};
+		struct TMLinePositionX0Retired : TagTraits<0x0018, 0x603c, VR::UL, 1, 1> {};
+		struct TMLinePositionX0 : TagTraits<0x0018, 0x603d, VR::SL, 1, 1> {};
+		struct TMLinePositionY0Retired : TagTraits<0x0018, 0x603e, VR::UL, 1, 1> {};
+		struct TMLinePositionY0 : TagTraits<0x0018, 0x603f, VR::SL, 1, 1> {};
+		struct TMLinePositionX1Retired : TagTraits<0x0018, 0x6040, VR::UL, 1, 1> {};
+		struct TMLinePositionX1 : TagTraits<0x0018, 0x6041, VR::SL, 1, 1> {};
+		struct TMLinePositionY1Retired : TagTraits<0x0018, 0x6042, VR::UL, 1, 1> {};
+		struct TMLinePositionY1 : TagTraits<0x0018, 0x6043, VR::SL, 1, 1> {};
+		struct PixelComponentOrganization : TagTraits<0x0018, 0x6044, VR::US, 1, 1> {};
+		struct PixelComponentMask : TagTraits<0x0018, 0x6046, VR::UL, 1, 1> {};
+		struct PixelComponentRangeStart : TagTraits<0x0018, 0x6048, VR::UL, 1, 1> {};
+		struct PixelComponentRangeStop : TagTraits<0x0018, 0x604a, VR::UL, 1, 1> {};
+		struct PixelComponentPhysicalUnits : TagTraits<0x0018, 0x604c, VR::US, 1, 1> {};
+		struct PixelComponentDataType : TagTraits<0x0018, 0x604e, VR::US, 1, 1> {};
+		struct NumberOfTableBreakPoints : TagTraits<0x0018, 0x6050, VR::UL, 1, 1> {};
+		struct TableOfXBreakPoints : TagTraits<0x0018, 0x6052, VR::UL, 1, 0> {};
+		struct TableOfYBreakPoints : TagTraits<0x0018, 0x6054, VR::FD, 1, 0> {};
+		struct NumberOfTableEntries : TagTraits<0x0018, 0x6056, VR::UL, 1, 1> {};
+		struct TableOfPixelValues : TagTraits<0x0018, 0x6058, VR::UL, 1, 0> {};
+		struct TableOfParameterValues : TagTraits<0x0018, 0x605a, VR::FL, 1, 0> {};
+		struct RWaveTimeVector : TagTraits<0x0018, 0x6060, VR::FL, 1, 0> {};
+		struct DetectorConditionsNominalFlag : TagTraits<0x0018, 0x7000, VR::CS, 1, 1> {};
+		struct DetectorTemperature : TagTraits<0x0018, 0x7001, VR::DS, 1, 1> {};
+		struct DetectorType : TagTraits<0x0018, 0x7004, VR::CS, 1, 1> {};
+		struct DetectorConfiguration : TagTraits<0x0018, 0x7005, VR::CS, 1, 1> {};
+		struct DetectorDescription : TagTraits<0x0018, 0x7006, VR::LT, 1, 1> {};
+		struct DetectorMode : TagTraits<0x0018, 0x7008, VR::LT, 1, 1> {};
+		struct DetectorID : TagTraits<0x0018, 0x700a, VR::SH, 1, 1> {};
+		struct DateOfLastDetectorCalibration : TagTraits<0x0018, 0x700c, VR::DA, 1, 1> {};
+		struct TimeOfLastDetectorCalibration : TagTraits<0x0018, 0x700e, VR::TM, 1, 1> {};
+		struct ExposuresOnDetectorSinceLastCalibration : TagTraits<0x0018, 0x7010, VR::IS, 1, 1> {};
+		struct ExposuresOnDetectorSinceManufactured : TagTraits<0x0018, 0x7011, VR::IS, 1, 1> {};
+		struct DetectorTimeSinceLastExposure : TagTraits<0x0018, 0x7012, VR::DS, 1, 1> {};
+		struct DetectorActiveTime : TagTraits<0x0018, 0x7014, VR::DS, 1, 1> {};
+		struct DetectorActivationOffsetFromExposure : TagTraits<0x0018, 0x7016, VR::DS, 1, 1> {};
+		struct DetectorBinning : TagTraits<0x0018, 0x701a, VR::DS, 2, 2> {};
+		struct DetectorElementPhysicalSize : TagTraits<0x0018, 0x7020, VR::DS, 2, 2> {};
+		struct DetectorElementSpacing : TagTraits<0x0018, 0x7022, VR::DS, 2, 2> {};
+		struct DetectorActiveShape : TagTraits<0x0018, 0x7024, VR::CS, 1, 1> {};
+		struct DetectorActiveDimensions : TagTraits<0x0018, 0x7026, VR::DS, 1, 2> {};
+		struct DetectorActiveOrigin : TagTraits<0x0018, 0x7028, VR::DS, 2, 2> {};
+		struct DetectorManufacturerName : TagTraits<0x0018, 0x702a, VR::LO, 1, 1> {};
+		struct DetectorManufacturerModelName : TagTraits<0x0018, 0x702b, VR::LO, 1, 1> {};
+		struct FieldOfViewOrigin : TagTraits<0x0018, 0x7030, VR::DS, 2, 2> {};
+		struct FieldOfViewRotation : TagTraits<0x0018, 0x7032, VR::DS, 1, 1> {};
+		struct FieldOfViewHorizontalFlip : TagTraits<0x0018, 0x7034, VR::CS, 1, 1> {};
+		struct PixelDataAreaOriginRelativeToFOV : TagTraits<0x0018, 0x7036, VR::FL, 2, 2> {};
+		struct PixelDataAreaRotationAngleRelativeToFOV : TagTraits<0x0018, 0x7038, VR::FL, 1, 1> {};
+		struct GridAbsorbingMaterial : TagTraits<0x0018, 0x7040, VR::LT, 1, 1> {};
+		struct GridSpacingMaterial : TagTraits<0x0018, 0x7041, VR::LT, 1, 1> {};
+		struct GridThickness : TagTraits<0x0018, 0x7042, VR::DS, 1, 1> {};
+		struct GridPitch : TagTraits<0x0018, 0x7044, VR::DS, 1, 1> {};
+		struct GridAspectRatio : TagTraits<0x0018, 0x7046, VR::IS, 2, 2> {};
+		struct GridPeriod : TagTraits<0x0018, 0x7048, VR::DS, 1, 1> {};
+		struct GridFocalDistance : TagTraits<0x0018, 0x704c, VR::DS, 1, 1> {};
+		struct FilterMaterial : TagTraits<0x0018, 0x7050, VR::CS, 1, 0> {};
+		struct FilterThicknessMinimum : TagTraits<0x0018, 0x7052, VR::DS, 1, 0> {};
+		struct FilterThicknessMaximum : TagTraits<0x0018, 0x7054, VR::DS, 1, 0> {};
+		struct FilterBeamPathLengthMinimum : TagTraits<0x0018, 0x7056, VR::FL, 1, 0> {};
+		struct FilterBeamPathLengthMaximum : TagTraits<0x0018, 0x7058, VR::FL, 1, 0> {};
+		struct ExposureControlMode : TagTraits<0x0018, 0x7060, VR::CS, 1, 1> {};
+		struct ExposureControlModeDescription : TagTraits<0x0018, 0x7062, VR::LT, 1, 1> {};
+		struct ExposureStatus : TagTraits<0x0018, 0x7064, VR::CS, 1, 1> {};
+		struct PhototimerSetting : TagTraits<0x0018, 0x7065, VR::DS, 1, 1> {};
+		struct ExposureTimeInuS : TagTraits<0x0018, 0x8150, VR::DS, 1, 1> {};
+		struct XRayTubeCurrentInuA : TagTraits<0x0018, 0x8151, VR::DS, 1, 1> {};
+		struct ContentQualification : TagTraits<0x0018, 0x9004, VR::CS, 1, 1> {};
+		struct PulseSequenceName : TagTraits<0x0018, 0x9005, VR::SH, 1, 1> {};
+		struct MRImagingModifierSequence : TagTraits<0x0018, 0x9006, VR::SQ, 1, 1> {};
+		struct EchoPulseSequence : TagTraits<0x0018, 0x9008, VR::CS, 1, 1> {};
+		struct InversionRecovery : TagTraits<0x0018, 0x9009, VR::CS, 1, 1> {};
+		struct FlowCompensation : TagTraits<0x0018, 0x9010, VR::CS, 1, 1> {};
+		struct MultipleSpinEcho : TagTraits<0x0018, 0x9011, VR::CS, 1, 1> {};
+		struct MultiPlanarExcitation : TagTraits<0x0018, 0x9012, VR::CS, 1, 1> {};
+		struct PhaseContrast : TagTraits<0x0018, 0x9014, VR::CS, 1, 1> {};
+		struct TimeOfFlightContrast : TagTraits<0x0018, 0x9015, VR::CS, 1, 1> {};
+		struct Spoiling : TagTraits<0x0018, 0x9016, VR::CS, 1, 1> {};
+		struct SteadyStatePulseSequence : TagTraits<0x0018, 0x9017, VR::CS, 1, 1> {};
+		struct EchoPlanarPulseSequence : TagTraits<0x0018, 0x9018, VR::CS, 1, 1> {};
+		struct TagAngleFirstAxis : TagTraits<0x0018, 0x9019, VR::FD, 1, 1> {};
+		struct MagnetizationTransfer : TagTraits<0x0018, 0x9020, VR::CS, 1, 1> {};
+		struct T2Preparation : TagTraits<0x0018, 0x9021, VR::CS, 1, 1> {};
+		struct BloodSignalNulling : TagTraits<0x0018, 0x9022, VR::CS, 1, 1> {};
+		struct SaturationRecovery : TagTraits<0x0018, 0x9024, VR::CS, 1, 1> {};
+		struct SpectrallySelectedSuppression : TagTraits<0x0018, 0x9025, VR::CS, 1, 1> {};
+		struct SpectrallySelectedExcitation : TagTraits<0x0018, 0x9026, VR::CS, 1, 1> {};
+		struct SpatialPresaturation : TagTraits<0x0018, 0x9027, VR::CS, 1, 1> {};
+		struct Tagging : TagTraits<0x0018, 0x9028, VR::CS, 1, 1> {};
+		struct OversamplingPhase : TagTraits<0x0018, 0x9029, VR::CS, 1, 1> {};
+		struct TagSpacingFirstDimension : TagTraits<0x0018, 0x9030, VR::FD, 1, 1> {};
+		struct GeometryOfKSpaceTraversal : TagTraits<0x0018, 0x9032, VR::CS, 1, 1> {};
+		struct SegmentedKSpaceTraversal : TagTraits<0x0018, 0x9033, VR::CS, 1, 1> {};
+		struct RectilinearPhaseEncodeReordering : TagTraits<0x0018, 0x9034, VR::CS, 1, 1> {};
+		struct TagThickness : TagTraits<0x0018, 0x9035, VR::FD, 1, 1> {};
+		struct PartialFourierDirection : TagTraits<0x0018, 0x9036, VR::CS, 1, 1> {};
+		struct CardiacSynchronizationTechnique : TagTraits<0x0018, 0x9037, VR::CS, 1, 1> {};
+		struct ReceiveCoilManufacturerName : TagTraits<0x0018, 0x9041, VR::LO, 1, 1> {};
+		struct MRReceiveCoilSequence : TagTraits<0x0018, 0x9042, VR::SQ, 1, 1> {};
+		struct ReceiveCoilType : TagTraits<0x0018, 0x9043, VR::CS, 1, 1> {};
+		struct QuadratureReceiveCoil : TagTraits<0x0018, 0x9044, VR::CS, 1, 1> {};
+		struct MultiCoilDefinitionSequence : TagTraits<0x0018, 0x9045, VR::SQ, 1, 1> {};
+		struct MultiCoilConfiguration : TagTraits<0x0018, 0x9046, VR::LO, 1, 1> {};
+		struct MultiCoilElementName : TagTraits<0x0018, 0x9047, VR::SH, 1, 1> {};
+		struct MultiCoilElementUsed : TagTraits<0x0018, 0x9048, VR::CS, 1, 1> {};
+		struct MRTransmitCoilSequence : TagTraits<0x0018, 0x9049, VR::SQ, 1, 1> {};
+		struct TransmitCoilManufacturerName : TagTraits<0x0018, 0x9050, VR::LO, 1, 1> {};
+		struct TransmitCoilType : TagTraits<0x0018, 0x9051, VR::CS, 1, 1> {};
+		struct SpectralWidth : TagTraits<0x0018, 0x9052, VR::FD, 1, 2> {};
+		struct ChemicalShiftReference : TagTraits<0x0018, 0x9053, VR::FD, 1, 2> {};
+		struct VolumeLocalizationTechnique : TagTraits<0x0018, 0x9054, VR::CS, 1, 1> {};
+		struct MRAcquisitionFrequencyEncodingSteps : TagTraits<0x0018, 0x9058, VR::US, 1, 1> {};
+		struct Decoupling : TagTraits<0x0018, 0x9059, VR::CS, 1, 1> {};
+		struct DecoupledNucleus : TagTraits<0x0018, 0x9060, VR::CS, 1, 2> {};
+		struct DecouplingFrequency : TagTraits<0x0018, 0x9061, VR::FD, 1, 2> {};
+		struct DecouplingMethod : TagTraits<0x0018, 0x9062, VR::CS, 1, 1> {};
+		struct DecouplingChemicalShiftReference : TagTraits<0x0018, 0x9063, VR::FD, 1, 2> {};
+		struct KSpaceFiltering : TagTraits<0x0018, 0x9064, VR::CS, 1, 1> {};
+		struct TimeDomainFiltering : TagTraits<0x0018, 0x9065, VR::CS, 1, 2> {};
+		struct NumberOfZeroFills : TagTraits<0x0018, 0x9066, VR::US, 1, 2> {};
+		struct BaselineCorrection : TagTraits<0x0018, 0x9067, VR::CS, 1, 1> {};
+		struct ParallelReductionFactorInPlane : TagTraits<0x0018, 0x9069, VR::FD, 1, 1> {};
+		struct CardiacRRIntervalSpecified : TagTraits<0x0018, 0x9070, VR::FD, 1, 1> {};
+		struct AcquisitionDuration : TagTraits<0x0018, 0x9073, VR::FD, 1, 1> {};
+		struct FrameAcquisitionDateTime : TagTraits<0x0018, 0x9074, VR::DT, 1, 1> {};
+		struct DiffusionDirectionality : TagTraits<0x0018, 0x9075, VR::CS, 1, 1> {};
+		struct DiffusionGradientDirectionSequence : TagTraits<0x0018, 0x9076, VR::SQ, 1, 1> {};
+		struct ParallelAcquisition : TagTraits<0x0018, 0x9077, VR::CS, 1, 1> {};
+		struct ParallelAcquisitionTechnique : TagTraits<0x0018, 0x9078, VR::CS, 1, 1> {};
+		struct InversionTimes : TagTraits<0x0018, 0x9079, VR::FD, 1, 0> {};
+		struct MetaboliteMapDescription : TagTraits<0x0018, 0x9080, VR::ST, 1, 1> {};
+		struct PartialFourier : TagTraits<0x0018, 0x9081, VR::CS, 1, 1> {};
+		struct EffectiveEchoTime : TagTraits<0x0018, 0x9082, VR::FD, 1, 1> {};
+		struct MetaboliteMapCodeSequence : TagTraits<0x0018, 0x9083, VR::SQ, 1, 1> {};
+		struct ChemicalShiftSequence : TagTraits<0x0018, 0x9084, VR::SQ, 1, 1> {};
+		struct CardiacSignalSource : TagTraits<0x0018, 0x9085, VR::CS, 1, 1> {};
+		struct DiffusionBValue : TagTraits<0x0018, 0x9087, VR::FD, 1, 1> {};
+		struct DiffusionGradientOrientation : TagTraits<0x0018, 0x9089, VR::FD, 3, 3> {};
+		struct VelocityEncodingDirection : TagTraits<0x0018, 0x9090, VR::FD, 3, 3> {};
+		struct VelocityEncodingMinimumValue : TagTraits<0x0018, 0x9091, VR::FD, 1, 1> {};
+		struct VelocityEncodingAcquisitionSequence : TagTraits<0x0018, 0x9092, VR::SQ, 1, 1> {};
+		struct NumberOfKSpaceTrajectories : TagTraits<0x0018, 0x9093, VR::US, 1, 1> {};
+		struct CoverageOfKSpace : TagTraits<0x0018, 0x9094, VR::CS, 1, 1> {};
+		struct SpectroscopyAcquisitionPhaseRows : TagTraits<0x0018, 0x9095, VR::UL, 1, 1> {};
+		struct ParallelReductionFactorInPlaneRetired : TagTraits<0x0018, 0x9096, VR::FD, 1, 1> {};
+		struct TransmitterFrequency : TagTraits<0x0018, 0x9098, VR::FD, 1, 2> {};
+		struct ResonantNucleus : TagTraits<0x0018, 0x9100, VR::CS, 1, 2> {};
+		struct FrequencyCorrection : TagTraits<0x0018, 0x9101, VR::CS, 1, 1> {};
+		struct MRSpectroscopyFOVGeometrySequence : TagTraits<0x0018, 0x9103, VR::SQ, 1, 1> {};
+		struct SlabThickness : TagTraits<0x0018, 0x9104, VR::FD, 1, 1> {};
+		struct SlabOrientation : TagTraits<0x0018, 0x9105, VR::FD, 3, 3> {};
+		struct MidSlabPosition : TagTraits<0x0018, 0x9106, VR::FD, 3, 3> {};
+		struct MRSpatialSaturationSequence : TagTraits<0x0018, 0x9107, VR::SQ, 1, 1> {};
+		struct MRTimingAndRelatedParametersSequence : TagTraits<0x0018, 0x9112, VR::SQ, 1, 1> {};
+		struct MREchoSequence : TagTraits<0x0018, 0x9114, VR::SQ, 1, 1> {};
+		struct MRModifierSequence : TagTraits<0x0018, 0x9115, VR::SQ, 1, 1> {};
+		struct MRDiffusionSequence : TagTraits<0x0018, 0x9117, VR::SQ, 1, 1> {};
+		struct CardiacSynchronizationSequence : TagTraits<0x0018, 0x9118, VR::SQ, 1, 1> {};
+		struct MRAveragesSequence : TagTraits<0x0018, 0x9119, VR::SQ, 1, 1> {};
+		struct MRFOVGeometrySequence : TagTraits<0x0018, 0x9125, VR::SQ, 1, 1> {};
+		struct VolumeLocalizationSequence : TagTraits<0x0018, 0x9126, VR::SQ, 1, 1> {};
+		struct SpectroscopyAcquisitionDataColumns : TagTraits<0x0018, 0x9127, VR::UL, 1, 1> {};
+		struct DiffusionAnisotropyType : TagTraits<0x0018, 0x9147, VR::CS, 1, 1> {};
+		struct FrameReferenceDateTime : TagTraits<0x0018, 0x9151, VR::DT, 1, 1> {};
+		struct MRMetaboliteMapSequence : TagTraits<0x0018, 0x9152, VR::SQ, 1, 1> {};
+		struct ParallelReductionFactorOutOfPlane : TagTraits<0x0018, 0x9155, VR::FD, 1, 1> {};
+		struct SpectroscopyAcquisitionOutOfPlanePhaseSteps : TagTraits<0x0018, 0x9159, VR::UL, 1, 1> {};
+		struct BulkMotionStatus : TagTraits<0x0018, 0x9166, VR::CS, 1, 1> {};
+		struct ParallelReductionFactorSecondInPlane : TagTraits<0x0018, 0x9168, VR::FD, 1, 1> {};
+		struct CardiacBeatRejectionTechnique : TagTraits<0x0018, 0x9169, VR::CS, 1, 1> {};
+		struct RespiratoryMotionCompensationTechnique : TagTraits<0x0018, 0x9170, VR::CS, 1, 1> {};
+		struct RespiratorySignalSource : TagTraits<0x0018, 0x9171, VR::CS, 1, 1> {};
+		struct BulkMotionCompensationTechnique : TagTraits<0x0018, 0x9172, VR::CS, 1, 1> {};
+		struct BulkMotionSignalSource : TagTraits<0x0018, 0x9173, VR::CS, 1, 1> {};
+		struct ApplicableSafetyStandardAgency : TagTraits<0x0018, 0x9174, VR::CS, 1, 1> {};
+		struct ApplicableSafetyStandardDescription : TagTraits<0x0018, 0x9175, VR::LO, 1, 1> {};
+		struct OperatingModeSequence : TagTraits<0x0018, 0x9176, VR::SQ, 1, 1> {};
+		struct OperatingModeType : TagTraits<0x0018, 0x9177, VR::CS, 1, 1> {};
+		struct OperatingMode : TagTraits<0x0018, 0x9178, VR::CS, 1, 1> {};
+		struct SpecificAbsorptionRateDefinition : TagTraits<0x0018, 0x9179, VR::CS, 1, 1> {};
+		struct GradientOutputType : TagTraits<0x0018, 0x9180, VR::CS, 1, 1> {};
+		struct SpecificAbsorptionRateValue : TagTraits<0x0018, 0x9181, VR::FD, 1, 1> {};
+		struct GradientOutput : TagTraits<0x0018, 0x9182, VR::FD, 1, 1> {};
+		struct FlowCompensationDirection : TagTraits<0x0018, 0x9183, VR::CS, 1, 1> {};
+		struct TaggingDelay : TagTraits<0x0018, 0x9184, VR::FD, 1, 1> {};
+		struct RespiratoryMotionCompensationTechniqueDescription : TagTraits<0x0018, 0x9185, VR::ST, 1, 1> {};
+		struct RespiratorySignalSourceID : TagTraits<0x0018, 0x9186, VR::SH, 1, 1> {};
+		struct ChemicalShiftMinimumIntegrationLimitInHz : TagTraits<0x0018, 0x9195, VR::FD, 1, 1> {};
+		struct ChemicalShiftMaximumIntegrationLimitInHz : TagTraits<0x0018, 0x9196, VR::FD, 1, 1> {};
+		struct MRVelocityEncodingSequence : TagTraits<0x0018, 0x9197, VR::SQ, 1, 1> {};
+		struct FirstOrderPhaseCorrection : TagTraits<0x0018, 0x9198, VR::CS, 1, 1> {};
+		struct WaterReferencedPhaseCorrection : TagTraits<0x0018, 0x9199, VR::CS, 1, 1> {};
+		struct MRSpectroscopyAcquisitionType : TagTraits<0x0018, 0x9200, VR::CS, 1, 1> {};
+		struct RespiratoryCyclePosition : TagTraits<0x0018, 0x9214, VR::CS, 1, 1> {};
+		struct VelocityEncodingMaximumValue : TagTraits<0x0018, 0x9217, VR::FD, 1, 1> {};
+		struct TagSpacingSecondDimension : TagTraits<0x0018, 0x9218, VR::FD, 1, 1> {};
+		struct TagAngleSecondAxis : TagTraits<0x0018, 0x9219, VR::SS, 1, 1> {};
+		struct FrameAcquisitionDuration : TagTraits<0x0018, 0x9220, VR::FD, 1, 1> {};
+		struct MRImageFrameTypeSequence : TagTraits<0x0018, 0x9226, VR::SQ, 1, 1> {};
+		struct MRSpectroscopyFrameTypeSequence : TagTraits<0x0018, 0x9227, VR::SQ, 1, 1> {};
+		struct MRAcquisitionPhaseEncodingStepsInPlane : TagTraits<0x0018, 0x9231, VR::US, 1, 1> {};
+		struct MRAcquisitionPhaseEncodingStepsOutOfPlane : TagTraits<0x0018, 0x9232, VR::US, 1, 1> {};
+		struct SpectroscopyAcquisitionPhaseColumns : TagTraits<0x0018, 0x9234, VR::UL, 1, 1> {};
+		struct CardiacCyclePosition : TagTraits<0x0018, 0x9236, VR::CS, 1, 1> {};
+		struct SpecificAbsorptionRateSequence : TagTraits<0x0018, 0x9239, VR::SQ, 1, 1> {};
+		struct RFEchoTrainLength : TagTraits<0x0018, 0x9240, VR::US, 1, 1> {};
+		struct GradientEchoTrainLength : TagTraits<0x0018, 0x9241, VR::US, 1, 1> {};
+		struct ArterialSpinLabelingContrast : TagTraits<0x0018, 0x9250, VR::CS, 1, 1> {};
+		struct MRArterialSpinLabelingSequence : TagTraits<0x0018, 0x9251, VR::SQ, 1, 1> {};
+		struct ASLTechniqueDescription : TagTraits<0x0018, 0x9252, VR::LO, 1, 1> {};
+		struct ASLSlabNumber : TagTraits<0x0018, 0x9253, VR::US, 1, 1> {};
+		struct ASLSlabThickness : TagTraits<0x0018, 0x9254, VR::FD, 1, 1> {};
+		struct ASLSlabOrientation : TagTraits<0x0018, 0x9255, VR::FD, 3, 3> {};
+		struct ASLMidSlabPosition : TagTraits<0x0018, 0x9256, VR::FD, 3, 3> {};
+		struct ASLContext : TagTraits<0x0018, 0x9257, VR::CS, 1, 1> {};
+		struct ASLPulseTrainDuration : TagTraits<0x0018, 0x9258, VR::UL, 1, 1> {};
+		struct ASLCrusherFlag : TagTraits<0x0018, 0x9259, VR::CS, 1, 1> {};
+		struct ASLCrusherFlowLimit : TagTraits<0x0018, 0x925a, VR::FD, 1, 1> {};
+		struct ASLCrusherDescription : TagTraits<0x0018, 0x925b, VR::LO, 1, 1> {};
+		struct ASLBolusCutoffFlag : TagTraits<0x0018, 0x925c, VR::CS, 1, 1> {};
+		struct ASLBolusCutoffTimingSequence : TagTraits<0x0018, 0x925d, VR::SQ, 1, 1> {};
+		struct ASLBolusCutoffTechnique : TagTraits<0x0018, 0x925e, VR::LO, 1, 1> {};
+		struct ASLBolusCutoffDelayTime : TagTraits<0x0018, 0x925f, VR::UL, 1, 1> {};
+		struct ASLSlabSequence : TagTraits<0x0018, 0x9260, VR::SQ, 1, 1> {};
+		struct ChemicalShiftMinimumIntegrationLimitInppm : TagTraits<0x0018, 0x9295, VR::FD, 1, 1> {};
+		struct ChemicalShiftMaximumIntegrationLimitInppm : TagTraits<0x0018, 0x9296, VR::FD, 1, 1> {};
+		struct WaterReferenceAcquisition : TagTraits<0x0018, 0x9297, VR::CS, 1, 1> {};
+		struct EchoPeakPosition : TagTraits<0x0018, 0x9298, VR::IS, 1, 1> {};
+		struct CTAcquisitionTypeSequence : TagTraits<0x0018, 0x9301, VR::SQ, 1, 1> {};
+		struct AcquisitionType : TagTraits<0x0018, 0x9302, VR::CS, 1, 1> {};
+		struct TubeAngle : TagTraits<0x0018, 0x9303, VR::FD, 1, 1> {};
+		struct CTAcquisitionDetailsSequence : TagTraits<0x0018, 0x9304, VR::SQ, 1, 1> {};
+		struct RevolutionTime : TagTraits<0x0018, 0x9305, VR::FD, 1, 1> {};
+		struct SingleCollimationWidth : TagTraits<0x0018, 0x9306, VR::FD, 1, 1> {};
+		struct TotalCollimationWidth : TagTraits<0x0018, 0x9307, VR::FD, 1, 1> {};
+		struct CTTableDynamicsSequence : TagTraits<0x0018, 0x9308, VR::SQ, 1, 1> {};
+		struct TableSpeed : TagTraits<0x0018, 0x9309, VR::FD, 1, 1> {};
+		struct TableFeedPerRotation : TagTraits<0x0018, 0x9310, VR::FD, 1, 1> {};
+		struct SpiralPitchFactor : TagTraits<0x0018, 0x9311, VR::FD, 1, 1> {};
+		struct CTGeometrySequence : TagTraits<0x0018, 0x9312, VR::SQ, 1, 1> {};
+		struct DataCollectionCenterPatient : TagTraits<0x0018, 0x9313, VR::FD, 3, 3> {};
+		struct CTReconstructionSequence : TagTraits<0x0018, 0x9314, VR::SQ, 1, 1> {};
+		struct ReconstructionAlgorithm : TagTraits<0x0018, 0x9315, VR::CS, 1, 1> {};
+		struct ConvolutionKernelGroup : TagTraits<0x0018, 0x9316, VR::CS, 1, 1> {};
+		struct ReconstructionFieldOfView : TagTraits<0x0018, 0x9317, VR::FD, 2, 2> {};
+		struct ReconstructionTargetCenterPatient : TagTraits<0x0018, 0x9318, VR::FD, 3, 3> {};
+		struct ReconstructionAngle : TagTraits<0x0018, 0x9319, VR::FD, 1, 1> {};
+		struct ImageFilter : TagTraits<0x0018, 0x9320, VR::SH, 1, 1> {};
+		struct CTExposureSequence : TagTraits<0x0018, 0x9321, VR::SQ, 1, 1> {};
+		struct ReconstructionPixelSpacing : TagTraits<0x0018, 0x9322, VR::FD, 2, 2> {};
+		struct ExposureModulationType : TagTraits<0x0018, 0x9323, VR::CS, 1, 0> {};
+		struct EstimatedDoseSaving : TagTraits<0x0018, 0x9324, VR::FD, 1, 1> {};
+		struct CTXRayDetailsSequence : TagTraits<0x0018, 0x9325, VR::SQ, 1, 1> {};
+		struct CTPositionSequence : TagTraits<0x0018, 0x9326, VR::SQ, 1, 1> {};
+		struct TablePosition : TagTraits<0x0018, 0x9327, VR::FD, 1, 1> {};
+		struct ExposureTimeInms : TagTraits<0x0018, 0x9328, VR::FD, 1, 1> {};
+		struct CTImageFrameTypeSequence : TagTraits<0x0018, 0x9329, VR::SQ, 1, 1> {};
+		struct XRayTubeCurrentInmA : TagTraits<0x0018, 0x9330, VR::FD, 1, 1> {};
+		struct ExposureInmAs : TagTraits<0x0018, 0x9332, VR::FD, 1, 1> {};
+		struct ConstantVolumeFlag : TagTraits<0x0018, 0x9333, VR::CS, 1, 1> {};
+		struct FluoroscopyFlag : TagTraits<0x0018, 0x9334, VR::CS, 1, 1> {};
+		struct DistanceSourceToDataCollectionCenter : TagTraits<0x0018, 0x9335, VR::FD, 1, 1> {};
+		struct ContrastBolusAgentNumber : TagTraits<0x0018, 0x9337, VR::US, 1, 1> {};
+		struct ContrastBolusIngredientCodeSequence : TagTraits<0x0018, 0x9338, VR::SQ, 1, 1> {};
+		struct ContrastAdministrationProfileSequence : TagTraits<0x0018, 0x9340, VR::SQ, 1, 1> {};
+		struct ContrastBolusUsageSequence : TagTraits<0x0018, 0x9341, VR::SQ, 1, 1> {};
+		struct ContrastBolusAgentAdministered : TagTraits<0x0018, 0x9342, VR::CS, 1, 1> {};
+		struct ContrastBolusAgentDetected : TagTraits<0x0018, 0x9343, VR::CS, 1, 1> {};
+		struct ContrastBolusAgentPhase : TagTraits<0x0018, 0x9344, VR::CS, 1, 1> {};
+		struct CTDIvol : TagTraits<0x0018, 0x9345, VR::FD, 1, 1> {};
+		struct CTDIPhantomTypeCodeSequence : TagTraits<0x0018, 0x9346, VR::SQ, 1, 1> {};
+		struct CalciumScoringMassFactorPatient : TagTraits<0x0018, 0x9351, VR::FL, 1, 1> {};
+		struct CalciumScoringMassFactorDevice : TagTraits<0x0018, 0x9352, VR::FL, 3, 3> {};
+		struct EnergyWeightingFactor : TagTraits<0x0018, 0x9353, VR::FL, 1, 1> {};
+		struct CTAdditionalXRaySourceSequence : TagTraits<0x0018, 0x9360, VR::SQ, 1, 1> {};
+		struct ProjectionPixelCalibrationSequence : TagTraits<0x0018, 0x9401, VR::SQ, 1, 1> {};
+		struct DistanceSourceToIsocenter : TagTraits<0x0018, 0x9402, VR::FL, 1, 1> {};
+		struct DistanceObjectToTableTop : TagTraits<0x0018, 0x9403, VR::FL, 1, 1> {};
+		struct ObjectPixelSpacingInCenterOfBeam : TagTraits<0x0018, 0x9404, VR::FL, 2, 2> {};
+		struct PositionerPositionSequence : TagTraits<0x0018, 0x9405, VR::SQ, 1, 1> {};
+		struct TablePositionSequence : TagTraits<0x0018, 0x9406, VR::SQ, 1, 1> {};
+		struct CollimatorShapeSequence : TagTraits<0x0018, 0x9407, VR::SQ, 1, 1> {};
+		struct PlanesInAcquisition : TagTraits<0x0018, 0x9410, VR::CS, 1, 1> {};
+		struct XAXRFFrameCharacteristicsSequence : TagTraits<0x0018, 0x9412, VR::SQ, 1, 1> {};
+		struct FrameAcquisitionSequence : TagTraits<0x0018, 0x9417, VR::SQ, 1, 1> {};
+		struct XRayReceptorType : TagTraits<0x0018, 0x9420, VR::CS, 1, 1> {};
+		struct AcquisitionProtocolName : TagTraits<0x0018, 0x9423, VR::LO, 1, 1> {};
+		struct AcquisitionProtocolDescription : TagTraits<0x0018, 0x9424, VR::LT, 1, 1> {};
+		struct ContrastBolusIngredientOpaque : TagTraits<0x0018, 0x9425, VR::CS, 1, 1> {};
+		struct DistanceReceptorPlaneToDetectorHousing : TagTraits<0x0018, 0x9426, VR::FL, 1, 1> {};
+		struct IntensifierActiveShape : TagTraits<0x0018, 0x9427, VR::CS, 1, 1> {};
+		struct IntensifierActiveDimensions : TagTraits<0x0018, 0x9428, VR::FL, 1, 2> {};
+		struct PhysicalDetectorSize : TagTraits<0x0018, 0x9429, VR::FL, 2, 2> {};
+		struct PositionOfIsocenterProjection : TagTraits<0x0018, 0x9430, VR::FL, 2, 2> {};
+		struct FieldOfViewSequence : TagTraits<0x0018, 0x9432, VR::SQ, 1, 1> {};
+		struct FieldOfViewDescription : TagTraits<0x0018, 0x9433, VR::LO, 1, 1> {};
+		struct ExposureControlSensingRegionsSequence : TagTraits<0x0018, 0x9434, VR::SQ, 1, 1> {};
+		struct ExposureControlSensingRegionShape : TagTraits<0x0018, 0x9435, VR::CS, 1, 1> {};
+		struct ExposureControlSensingRegionLeftVerticalEdge : TagTraits<0x0018, 0x9436, VR::SS, 1, 1> {};
+		struct ExposureControlSensingRegionRightVerticalEdge : TagTraits<0x0018, 0x9437, VR::SS, 1, 1> {};
+		struct ExposureControlSensingRegionUpperHorizontalEdge : TagTraits<0x0018, 0x9438, VR::SS, 1, 1> {};
+		struct ExposureControlSensingRegionLowerHorizontalEdge : TagTraits<0x0018, 0x9439, VR::SS, 1, 1> {};
+		struct CenterOfCircularExposureControlSensingRegion : TagTraits<0x0018, 0x9440, VR::SS, 2, 2> {};
+		struct RadiusOfCircularExposureControlSensingRegion : TagTraits<0x0018, 0x9441, VR::US, 1, 1> {};
+		struct VerticesOfThePolygonalExposureControlSensingRegion : TagTraits<0x0018, 0x9442, VR::SS, 2, 0> {};
+		struct ColumnAngulationPatient : TagTraits<0x0018, 0x9447, VR::FL, 1, 1> {};
+		struct BeamAngle : TagTraits<0x0018, 0x9449, VR::FL, 1, 1> {};
+		struct FrameDetectorParametersSequence : TagTraits<0x0018, 0x9451, VR::SQ, 1, 1> {};
+		struct CalculatedAnatomyThickness : TagTraits<0x0018, 0x9452, VR::FL, 1, 1> {};
+		struct CalibrationSequence : TagTraits<0x0018, 0x9455, VR::SQ, 1, 1> {};
+		struct ObjectThicknessSequence : TagTraits<0x0018, 0x9456, VR::SQ, 1, 1> {};
+		struct PlaneIdentification : TagTraits<0x0018, 0x9457, VR::CS, 1, 1> {};
+		struct FieldOfViewDimensionsInFloat : TagTraits<0x0018, 0x9461, VR::FL, 1, 2> {};
+		struct IsocenterReferenceSystemSequence : TagTraits<0x0018, 0x9462, VR::SQ, 1, 1> {};
+		struct PositionerIsocenterPrimaryAngle : TagTraits<0x0018, 0x9463, VR::FL, 1, 1> {};
+		struct PositionerIsocenterSecondaryAngle : TagTraits<0x0018, 0x9464, VR::FL, 1, 1> {};
+		struct PositionerIsocenterDetectorRotationAngle : TagTraits<0x0018, 0x9465, VR::FL, 1, 1> {};
+		struct TableXPositionToIsocenter : TagTraits<0x0018, 0x9466, VR::FL, 1, 1> {};
+		struct TableYPositionToIsocenter : TagTraits<0x0018, 0x9467, VR::FL, 1, 1> {};
+		struct TableZPositionToIsocenter : TagTraits<0x0018, 0x9468, VR::FL, 1, 1> {};
+		struct TableHorizontalRotationAngle : TagTraits<0x0018, 0x9469, VR::FL, 1, 1> {};
+		struct TableHeadTiltAngle : TagTraits<0x0018, 0x9470, VR::FL, 1, 1> {};
+		struct TableCradleTiltAngle : TagTraits<0x0018, 0x9471, VR::FL, 1, 1> {};
+		struct FrameDisplayShutterSequence : TagTraits<0x0018, 0x9472, VR::SQ, 1, 1> {};
+		struct AcquiredImageAreaDoseProduct : TagTraits<0x0018, 0x9473, VR::FL, 1, 1> {};
+		struct CArmPositionerTabletopRelationship : TagTraits<0x0018, 0x9474, VR::CS, 1, 1> {};
+		struct XRayGeometrySequence : TagTraits<0x0018, 0x9476, VR::SQ, 1, 1> {};
+		struct IrradiationEventIdentificationSequence : TagTraits<0x0018, 0x9477, VR::SQ, 1, 1> {};
+		struct XRay3DFrameTypeSequence : TagTraits<0x0018, 0x9504, VR::SQ, 1, 1> {};
+		struct ContributingSourcesSequence : TagTraits<0x0018, 0x9506, VR::SQ, 1, 1> {};
+		struct XRay3DAcquisitionSequence : TagTraits<0x0018, 0x9507, VR::SQ, 1, 1> {};
+		struct PrimaryPositionerScanArc : TagTraits<0x0018, 0x9508, VR::FL, 1, 1> {};
+		struct SecondaryPositionerScanArc : TagTraits<0x0018, 0x9509, VR::FL, 1, 1> {};
+		struct PrimaryPositionerScanStartAngle : TagTraits<0x0018, 0x9510, VR::FL, 1, 1> {};
+		struct SecondaryPositionerScanStartAngle : TagTraits<0x0018, 0x9511, VR::FL, 1, 1> {};
+		struct PrimaryPositionerIncrement : TagTraits<0x0018, 0x9514, VR::FL, 1, 1> {};
+		struct SecondaryPositionerIncrement : TagTraits<0x0018, 0x9515, VR::FL, 1, 1> {};
+		struct StartAcquisitionDateTime : TagTraits<0x0018, 0x9516, VR::DT, 1, 1> {};
+		struct EndAcquisitionDateTime : TagTraits<0x0018, 0x9517, VR::DT, 1, 1> {};
+		struct PrimaryPositionerIncrementSign : TagTraits<0x0018, 0x9518, VR::SS, 1, 1> {};
+		struct SecondaryPositionerIncrementSign : TagTraits<0x0018, 0x9519, VR::SS, 1, 1> {};
+		struct ApplicationName : TagTraits<0x0018, 0x9524, VR::LO, 1, 1> {};
+		struct ApplicationVersion : TagTraits<0x0018, 0x9525, VR::LO, 1, 1> {};
+		struct ApplicationManufacturer : TagTraits<0x0018, 0x9526, VR::LO, 1, 1> {};
+		struct AlgorithmType : TagTraits<0x0018, 0x9527, VR::CS, 1, 1> {};
+		struct AlgorithmDescription : TagTraits<0x0018, 0x9528, VR::LO, 1, 1> {};
+		struct XRay3DReconstructionSequence : TagTraits<0x0018, 0x9530, VR::SQ, 1, 1> {};
+		struct ReconstructionDescription : TagTraits<0x0018, 0x9531, VR::LO, 1, 1> {};
+		struct PerProjectionAcquisitionSequence : TagTraits<0x0018, 0x9538, VR::SQ, 1, 1> {};
+		struct DetectorPositionSequence : TagTraits<0x0018, 0x9541, VR::SQ, 1, 1> {};
+		struct XRayAcquisitionDoseSequence : TagTraits<0x0018, 0x9542, VR::SQ, 1, 1> {};
+		struct XRaySourceIsocenterPrimaryAngle : TagTraits<0x0018, 0x9543, VR::FD, 1, 1> {};
+		struct XRaySourceIsocenterSecondaryAngle : TagTraits<0x0018, 0x9544, VR::FD, 1, 1> {};
+		struct BreastSupportIsocenterPrimaryAngle : TagTraits<0x0018, 0x9545, VR::FD, 1, 1> {};
+		struct BreastSupportIsocenterSecondaryAngle : TagTraits<0x0018, 0x9546, VR::FD, 1, 1> {};
+		struct BreastSupportXPositionToIsocenter : TagTraits<0x0018, 0x9547, VR::FD, 1, 1> {};
+		struct BreastSupportYPositionToIsocenter : TagTraits<0x0018, 0x9548, VR::FD, 1, 1> {};
+		struct BreastSupportZPositionToIsocenter : TagTraits<0x0018, 0x9549, VR::FD, 1, 1> {};
+		struct DetectorIsocenterPrimaryAngle : TagTraits<0x0018, 0x9550, VR::FD, 1, 1> {};
+		struct DetectorIsocenterSecondaryAngle : TagTraits<0x0018, 0x9551, VR::FD, 1, 1> {};
+		struct DetectorXPositionToIsocenter : TagTraits<0x0018, 0x9552, VR::FD, 1, 1> {};
+		struct DetectorYPositionToIsocenter : TagTraits<0x0018, 0x9553, VR::FD, 1, 1> {};
+		struct DetectorZPositionToIsocenter : TagTraits<0x0018, 0x9554, VR::FD, 1, 1> {};
+		struct XRayGridSequence : TagTraits<0x0018, 0x9555, VR::SQ, 1, 1> {};
+		struct XRayFilterSequence : TagTraits<0x0018, 0x9556, VR::SQ, 1, 1> {};
+		struct DetectorActiveAreaTLHCPosition : TagTraits<0x0018, 0x9557, VR::FD, 3, 3> {};
+		struct DetectorActiveAreaOrientation : TagTraits<0x0018, 0x9558, VR::FD, 6, 6> {};
+		struct PositionerPrimaryAngleDirection : TagTraits<0x0018, 0x9559, VR::CS, 1, 1> {};
+		struct DiffusionBMatrixSequence : TagTraits<0x0018, 0x9601, VR::SQ, 1, 1> {};
+		struct DiffusionBValueXX : TagTraits<0x0018, 0x9602, VR::FD, 1, 1> {};
+		struct DiffusionBValueXY : TagTraits<0x0018, 0x9603, VR::FD, 1, 1> {};
+		struct DiffusionBValueXZ : TagTraits<0x0018, 0x9604, VR::FD, 1, 1> {};
+		struct DiffusionBValueYY : TagTraits<0x0018, 0x9605, VR::FD, 1, 1> {};
+		struct DiffusionBValueYZ : TagTraits<0x0018, 0x9606, VR::FD, 1, 1> {};
+		struct DiffusionBValueZZ : TagTraits<0x0018, 0x9607, VR::FD, 1, 1> {};
+		struct FunctionalMRSequence : TagTraits<0x0018, 0x9621, VR::SQ, 1, 1> {};
+		struct FunctionalSettlingPhaseFramesPresent : TagTraits<0x0018, 0x9622, VR::CS, 1, 1> {};
+		struct FunctionalSyncPulse : TagTraits<0x0018, 0x9623, VR::DT, 1, 1> {};
+		struct SettlingPhaseFrame : TagTraits<0x0018, 0x9624, VR::CS, 1, 1> {};
+		struct DecayCorrectionDateTime : TagTraits<0x0018, 0x9701, VR::DT, 1, 1> {};
+		struct StartDensityThreshold : TagTraits<0x0018, 0x9715, VR::FD, 1, 1> {};
+		struct StartRelativeDensityDifferenceThreshold : TagTraits<0x0018, 0x9716, VR::FD, 1, 1> {};
+		struct StartCardiacTriggerCountThreshold : TagTraits<0x0018, 0x9717, VR::FD, 1, 1> {};
+		struct StartRespiratoryTriggerCountThreshold : TagTraits<0x0018, 0x9718, VR::FD, 1, 1> {};
+		struct TerminationCountsThreshold : TagTraits<0x0018, 0x9719, VR::FD, 1, 1> {};
+		struct TerminationDensityThreshold : TagTraits<0x0018, 0x9720, VR::FD, 1, 1> {};
+		struct TerminationRelativeDensityThreshold : TagTraits<0x0018, 0x9721, VR::FD, 1, 1> {};
+		struct TerminationTimeThreshold : TagTraits<0x0018, 0x9722, VR::FD, 1, 1> {};
+		struct TerminationCardiacTriggerCountThreshold : TagTraits<0x0018, 0x9723, VR::FD, 1, 1> {};
+		struct TerminationRespiratoryTriggerCountThreshold : TagTraits<0x0018, 0x9724, VR::FD, 1, 1> {};
+		struct DetectorGeometry : TagTraits<0x0018, 0x9725, VR::CS, 1, 1> {};
+		struct TransverseDetectorSeparation : TagTraits<0x0018, 0x9726, VR::FD, 1, 1> {};
+		struct AxialDetectorDimension : TagTraits<0x0018, 0x9727, VR::FD, 1, 1> {};
+		struct RadiopharmaceuticalAgentNumber : TagTraits<0x0018, 0x9729, VR::US, 1, 1> {};
+		struct PETFrameAcquisitionSequence : TagTraits<0x0018, 0x9732, VR::SQ, 1, 1> {};
+		struct PETDetectorMotionDetailsSequence : TagTraits<0x0018, 0x9733, VR::SQ, 1, 1> {};
+		struct PETTableDynamicsSequence : TagTraits<0x0018, 0x9734, VR::SQ, 1, 1> {};
+		struct PETPositionSequence : TagTraits<0x0018, 0x9735, VR::SQ, 1, 1> {};
+		struct PETFrameCorrectionFactorsSequence : TagTraits<0x0018, 0x9736, VR::SQ, 1, 1> {};
+		struct RadiopharmaceuticalUsageSequence : TagTraits<0x0018, 0x9737, VR::SQ, 1, 1> {};
+		struct AttenuationCorrectionSource : TagTraits<0x0018, 0x9738, VR::CS, 1, 1> {};
+		struct NumberOfIterations : TagTraits<0x0018, 0x9739, VR::US, 1, 1> {};
+		struct NumberOfSubsets : TagTraits<0x0018, 0x9740, VR::US, 1, 1> {};
+		struct PETReconstructionSequence : TagTraits<0x0018, 0x9749, VR::SQ, 1, 1> {};
+		struct PETFrameTypeSequence : TagTraits<0x0018, 0x9751, VR::SQ, 1, 1> {};
+		struct TimeOfFlightInformationUsed : TagTraits<0x0018, 0x9755, VR::CS, 1, 1> {};
+		struct ReconstructionType : TagTraits<0x0018, 0x9756, VR::CS, 1, 1> {};
+		struct DecayCorrected : TagTraits<0x0018, 0x9758, VR::CS, 1, 1> {};
+		struct AttenuationCorrected : TagTraits<0x0018, 0x9759, VR::CS, 1, 1> {};
+		struct ScatterCorrected : TagTraits<0x0018, 0x9760, VR::CS, 1, 1> {};
+		struct DeadTimeCorrected : TagTraits<0x0018, 0x9761, VR::CS, 1, 1> {};
+		struct GantryMotionCorrected : TagTraits<0x0018, 0x9762, VR::CS, 1, 1> {};
+		struct PatientMotionCorrected : TagTraits<0x0018, 0x9763, VR::CS, 1, 1> {};
+		struct CountLossNormalizationCorrected : TagTraits<0x0018, 0x9764, VR::CS, 1, 1> {};
+		struct RandomsCorrected : TagTraits<0x0018, 0x9765, VR::CS, 1, 1> {};
+		struct NonUniformRadialSamplingCorrected : TagTraits<0x0018, 0x9766, VR::CS, 1, 1> {};
+		struct SensitivityCalibrated : TagTraits<0x0018, 0x9767, VR::CS, 1, 1> {};
+		struct DetectorNormalizationCorrection : TagTraits<0x0018, 0x9768, VR::CS, 1, 1> {};
+		struct IterativeReconstructionMethod : TagTraits<0x0018, 0x9769, VR::CS, 1, 1> {};
+		struct AttenuationCorrectionTemporalRelationship : TagTraits<0x0018, 0x9770, VR::CS, 1, 1> {};
+		struct PatientPhysiologicalStateSequence : TagTraits<0x0018, 0x9771, VR::SQ, 1, 1> {};
+		struct PatientPhysiologicalStateCodeSequence : TagTraits<0x0018, 0x9772, VR::SQ, 1, 1> {};
+		struct DepthsOfFocus : TagTraits<0x0018, 0x9801, VR::FD, 1, 0> {};
+		struct ExcludedIntervalsSequence : TagTraits<0x0018, 0x9803, VR::SQ, 1, 1> {};
+		struct ExclusionStartDateTime : TagTraits<0x0018, 0x9804, VR::DT, 1, 1> {};
+		struct ExclusionDuration : TagTraits<0x0018, 0x9805, VR::FD, 1, 1> {};
+		struct USImageDescriptionSequence : TagTraits<0x0018, 0x9806, VR::SQ, 1, 1> {};
+		struct ImageDataTypeSequence : TagTraits<0x0018, 0x9807, VR::SQ, 1, 1> {};
+		struct DataType : TagTraits<0x0018, 0x9808, VR::CS, 1, 1> {};
+		struct TransducerScanPatternCodeSequence : TagTraits<0x0018, 0x9809, VR::SQ, 1, 1> {};
+		struct AliasedDataType : TagTraits<0x0018, 0x980b, VR::CS, 1, 1> {};
+		struct PositionMeasuringDeviceUsed : TagTraits<0x0018, 0x980c, VR::CS, 1, 1> {};
+		struct TransducerGeometryCodeSequence : TagTraits<0x0018, 0x980d, VR::SQ, 1, 1> {};
+		struct TransducerBeamSteeringCodeSequence : TagTraits<0x0018, 0x980e, VR::SQ, 1, 1> {};
+		struct TransducerApplicationCodeSequence : TagTraits<0x0018, 0x980f, VR::SQ, 1, 1> {};
+		struct ReferenceLocationLabel : TagTraits<0x0018, 0x9900, VR::LO, 1, 1> {};
+		struct ReferenceLocationDescription : TagTraits<0x0018, 0x9901, VR::UT, 1, 1> {};
+		struct ReferenceBasisCodeSequence : TagTraits<0x0018, 0x9902, VR::SQ, 1, 1> {};
+		struct ReferenceGeometryCodeSequence : TagTraits<0x0018, 0x9903, VR::SQ, 1, 1> {};
+		struct OffsetDistance : TagTraits<0x0018, 0x9904, VR::DS, 1, 1> {};
+		struct OffsetDirection : TagTraits<0x0018, 0x9905, VR::CS, 1, 1> {};
+		struct PotentialScheduledProtocolCodeSequence : TagTraits<0x0018, 0x9906, VR::SQ, 1, 1> {};
+		struct PotentialRequestedProcedureCodeSequence : TagTraits<0x0018, 0x9907, VR::SQ, 1, 1> {};
+		struct PotentialReasonsForProcedure : TagTraits<0x0018, 0x9908, VR::UC, 1, 0> {};
+		struct PotentialReasonsForProcedureCodeSequence : TagTraits<0x0018, 0x9909, VR::SQ, 1, 1> {};
+		struct PotentialDiagnosticTasks : TagTraits<0x0018, 0x990a, VR::UC, 1, 0> {};
+		struct ContraindicationsCodeSequence : TagTraits<0x0018, 0x990b, VR::SQ, 1, 1> {};
+		struct ReferencedDefinedProtocolSequence : TagTraits<0x0018, 0x990c, VR::SQ, 1, 1> {};
+		struct ReferencedPerformedProtocolSequence : TagTraits<0x0018, 0x990d, VR::SQ, 1, 1> {};
+		struct PredecessorProtocolSequence : TagTraits<0x0018, 0x990e, VR::SQ, 1, 1> {};
+		struct ProtocolPlanningInformation : TagTraits<0x0018, 0x990f, VR::UT, 1, 1> {};
+		struct ProtocolDesignRationale : TagTraits<0x0018, 0x9910, VR::UT, 1, 1> {};
+		struct PatientSpecificationSequence : TagTraits<0x0018, 0x9911, VR::SQ, 1, 1> {};
+		struct ModelSpecificationSequence : TagTraits<0x0018, 0x9912, VR::SQ, 1, 1> {};
+		struct ParametersSpecificationSequence : TagTraits<0x0018, 0x9913, VR::SQ, 1, 1> {};
+		struct InstructionSequence : TagTraits<0x0018, 0x9914, VR::SQ, 1, 1> {};
+		struct InstructionIndex : TagTraits<0x0018, 0x9915, VR::US, 1, 1> {};
+		struct InstructionText : TagTraits<0x0018, 0x9916, VR::LO, 1, 1> {};
+		struct InstructionDescription : TagTraits<0x0018, 0x9917, VR::UT, 1, 1> {};
+		struct InstructionPerformedFlag : TagTraits<0x0018, 0x9918, VR::CS, 1, 1> {};
+		struct InstructionPerformedDateTime : TagTraits<0x0018, 0x9919, VR::DT, 1, 1> {};
+		struct InstructionPerformanceComment : TagTraits<0x0018, 0x991a, VR::UT, 1, 1> {};
+		struct PatientPositioningInstructionSequence : TagTraits<0x0018, 0x991b, VR::SQ, 1, 1> {};
+		struct PositioningMethodCodeSequence : TagTraits<0x0018, 0x991c, VR::SQ, 1, 1> {};
+		struct PositioningLandmarkSequence : TagTraits<0x0018, 0x991d, VR::SQ, 1, 1> {};
+		struct TargetFrameOfReferenceUID : TagTraits<0x0018, 0x991e, VR::UI, 1, 1> {};
+		struct AcquisitionProtocolElementSpecificationSequence : TagTraits<0x0018, 0x991f, VR::SQ, 1, 1> {};
+		struct AcquisitionProtocolElementSequence : TagTraits<0x0018, 0x9920, VR::SQ, 1, 1> {};
+		struct ProtocolElementNumber : TagTraits<0x0018, 0x9921, VR::US, 1, 1> {};
+		struct ProtocolElementName : TagTraits<0x0018, 0x9922, VR::LO, 1, 1> {};
+		struct ProtocolElementCharacteristicsSummary : TagTraits<0x0018, 0x9923, VR::UT, 1, 1> {};
+		struct ProtocolElementPurpose : TagTraits<0x0018, 0x9924, VR::UT, 1, 1> {};
+		struct AcquisitionMotion : TagTraits<0x0018, 0x9930, VR::CS, 1, 1> {};
+		struct AcquisitionStartLocationSequence : TagTraits<0x0018, 0x9931, VR::SQ, 1, 1> {};
+		struct AcquisitionEndLocationSequence : TagTraits<0x0018, 0x9932, VR::SQ, 1, 1> {};
+		struct ReconstructionProtocolElementSpecificationSequence : TagTraits<0x0018, 0x9933, VR::SQ, 1, 1> {};
+		struct ReconstructionProtocolElementSequence : TagTraits<0x0018, 0x9934, VR::SQ, 1, 1> {};
+		struct StorageProtocolElementSpecificationSequence : TagTraits<0x0018, 0x9935, VR::SQ, 1, 1> {};
+		struct StorageProtocolElementSequence : TagTraits<0x0018, 0x9936, VR::SQ, 1, 1> {};
+		struct RequestedSeriesDescription : TagTraits<0x0018, 0x9937, VR::LO, 1, 1> {};
+		struct SourceAcquisitionProtocolElementNumber : TagTraits<0x0018, 0x9938, VR::US, 1, 0> {};
+		struct SourceAcquisitionBeamNumber : TagTraits<0x0018, 0x9939, VR::US, 1, 0> {};
+		struct SourceReconstructionProtocolElementNumber : TagTraits<0x0018, 0x993a, VR::US, 1, 0> {};
+		struct ReconstructionStartLocationSequence : TagTraits<0x0018, 0x993b, VR::SQ, 1, 1> {};
+		struct ReconstructionEndLocationSequence : TagTraits<0x0018, 0x993c, VR::SQ, 1, 1> {};
+		struct ReconstructionAlgorithmSequence : TagTraits<0x0018, 0x993d, VR::SQ, 1, 1> {};
+		struct ReconstructionTargetCenterLocationSequence : TagTraits<0x0018, 0x993e, VR::SQ, 1, 1> {};
+		struct ImageFilterDescription : TagTraits<0x0018, 0x9941, VR::UT, 1, 1> {};
+		struct CTDIvolNotificationTrigger : TagTraits<0x0018, 0x9942, VR::FD, 1, 1> {};
+		struct DLPNotificationTrigger : TagTraits<0x0018, 0x9943, VR::FD, 1, 1> {};
+		struct AutoKVPSelectionType : TagTraits<0x0018, 0x9944, VR::CS, 1, 1> {};
+		struct AutoKVPUpperBound : TagTraits<0x0018, 0x9945, VR::FD, 1, 1> {};
+		struct AutoKVPLowerBound : TagTraits<0x0018, 0x9946, VR::FD, 1, 1> {};
+		struct ProtocolDefinedPatientPosition : TagTraits<0x0018, 0x9947, VR::CS, 1, 1> {};
+		struct ContributingEquipmentSequence : TagTraits<0x0018, 0xa001, VR::SQ, 1, 1> {};
+		struct ContributionDateTime : TagTraits<0x0018, 0xa002, VR::DT, 1, 1> {};
+		struct ContributionDescription : TagTraits<0x0018, 0xa003, VR::ST, 1, 1> {};
+		struct StudyInstanceUID : TagTraits<0x0020, 0x000d, VR::UI, 1, 1> {};
+		struct SeriesInstanceUID : TagTraits<0x0020, 0x000e, VR::UI, 1, 1> {};
+		struct StudyID : TagTraits<0x0020, 0x0010, VR::SH, 1, 1> {};
+		struct SeriesNumber : TagTraits<0x0020, 0x0011, VR::IS, 1, 1> {};
+		struct AcquisitionNumber : TagTraits<0x0020, 0x0012, VR::IS, 1, 1> {};
+		struct InstanceNumber : TagTraits<0x0020, 0x0013, VR::IS, 1, 1> {};
+		struct IsotopeNumber : TagTraits<0x0020, 0x0014, VR::IS, 1, 1> {};
+		struct PhaseNumber : TagTraits<0x0020, 0x0015, VR::IS, 1, 1> {};
+		struct IntervalNumber : TagTraits<0x0020, 0x0016, VR::IS, 1, 1> {};
+		struct TimeSlotNumber : TagTraits<0x0020, 0x0017, VR::IS, 1, 1> {};
+		struct AngleNumber : TagTraits<0x0020, 0x0018, VR::IS, 1, 1> {};
+		struct ItemNumber : TagTraits<0x0020, 0x0019, VR::IS, 1, 1> {};
+		struct PatientOrientation : TagTraits<0x0020, 0x0020, VR::CS, 2, 2> {};
+		struct OverlayNumber : TagTraits<0x0020, 0x0022, VR::IS, 1, 1> {};
+		struct CurveNumber : TagTraits<0x0020, 0x0024, VR::IS, 1, 1> {};
+		struct LUTNumber : TagTraits<0x0020, 0x0026, VR::IS, 1, 1> {};
+		struct ImagePosition : TagTraits<0x0020, 0x0030, VR::DS, 3, 3> {};
+		struct ImagePositionPatient : TagTraits<0x0020, 0x0032, VR::DS, 3, 3> {};
+		struct ImageOrientation : TagTraits<0x0020, 0x0035, VR::DS, 6, 6> {};
+		struct ImageOrientationPatient : TagTraits<0x0020, 0x0037, VR::DS, 6, 6> {};
+		struct Location : TagTraits<0x0020, 0x0050, VR::DS, 1, 1> {};
+		struct FrameOfReferenceUID : TagTraits<0x0020, 0x0052, VR::UI, 1, 1> {};
+		struct Laterality : TagTraits<0x0020, 0x0060, VR::CS, 1, 1> {};
+		struct ImageLaterality : TagTraits<0x0020, 0x0062, VR::CS, 1, 1> {};
+		struct ImageGeometryType : TagTraits<0x0020, 0x0070, VR::LO, 1, 1> {};
+		struct MaskingImage : TagTraits<0x0020, 0x0080, VR::CS, 1, 0> {};
+		struct ReportNumber : TagTraits<0x0020, 0x00aa, VR::IS, 1, 1> {};
+		struct TemporalPositionIdentifier : TagTraits<0x0020, 0x0100, VR::IS, 1, 1> {};
+		struct NumberOfTemporalPositions : TagTraits<0x0020, 0x0105, VR::IS, 1, 1> {};
+		struct TemporalResolution : TagTraits<0x0020, 0x0110, VR::DS, 1, 1> {};
+		struct SynchronizationFrameOfReferenceUID : TagTraits<0x0020, 0x0200, VR::UI, 1, 1> {};
+		struct SOPInstanceUIDOfConcatenationSource : TagTraits<0x0020, 0x0242, VR::UI, 1, 1> {};
+		struct SeriesInStudy : TagTraits<0x0020, 0x1000, VR::IS, 1, 1> {};
+		struct AcquisitionsInSeries : TagTraits<0x0020, 0x1001, VR::IS, 1, 1> {};
+		struct ImagesInAcquisition : TagTraits<0x0020, 0x1002, VR::IS, 1, 1> {};
+		struct ImagesInSeries : TagTraits<0x0020, 0x1003, VR::IS, 1, 1> {};
+		struct AcquisitionsInStudy : TagTraits<0x0020, 0x1004, VR::IS, 1, 1> {};
+		struct ImagesInStudy : TagTraits<0x0020, 0x1005, VR::IS, 1, 1> {};
+		struct Reference : TagTraits<0x0020, 0x1020, VR::LO, 1, 0> {};
+		struct TargetPositionReferenceIndicator : TagTraits<0x0020, 0x103f, VR::LO, 1, 1> {};
+		struct PositionReferenceIndicator : TagTraits<0x0020, 0x1040, VR::LO, 1, 1> {};
+		struct SliceLocation : TagTraits<0x0020, 0x1041, VR::DS, 1, 1> {};
+		struct OtherStudyNumbers : TagTraits<0x0020, 0x1070, VR::IS, 1, 0> {};
+		struct NumberOfPatientRelatedStudies : TagTraits<0x0020, 0x1200, VR::IS, 1, 1> {};
+		struct NumberOfPatientRelatedSeries : TagTraits<0x0020, 0x1202, VR::IS, 1, 1> {};
+		struct NumberOfPatientRelatedInstances : TagTraits<0x0020, 0x1204, VR::IS, 1, 1> {};
+		struct NumberOfStudyRelatedSeries : TagTraits<0x0020, 0x1206, VR::IS, 1, 1> {};
+		struct NumberOfStudyRelatedInstances : TagTraits<0x0020, 0x1208, VR::IS, 1, 1> {};
+		struct NumberOfSeriesRelatedInstances : TagTraits<0x0020, 0x1209, VR::IS, 1, 1> {};
+		struct ModifyingDeviceID : TagTraits<0x0020, 0x3401, VR::CS, 1, 1> {};
+		struct ModifiedImageID : TagTraits<0x0020, 0x3402, VR::CS, 1, 1> {};
+		struct ModifiedImageDate : TagTraits<0x0020, 0x3403, VR::DA, 1, 1> {};
+		struct ModifyingDeviceManufacturer : TagTraits<0x0020, 0x3404, VR::LO, 1, 1> {};
+		struct ModifiedImageTime : TagTraits<0x0020, 0x3405, VR::TM, 1, 1> {};
+		struct ModifiedImageDescription : TagTraits<0x0020, 0x3406, VR::LO, 1, 1> {};
+		struct ImageComments : TagTraits<0x0020, 0x4000, VR::LT, 1, 1> {};
+		struct OriginalImageIdentification : TagTraits<0x0020, 0x5000, VR::AT, 1, 0> {};
+		struct OriginalImageIdentificationNomenclature : TagTraits<0x0020, 0x5002, VR::LO, 1, 0> {};
+		struct StackID : TagTraits<0x0020, 0x9056, VR::SH, 1, 1> {};
+		struct InStackPositionNumber : TagTraits<0x0020, 0x9057, VR::UL, 1, 1> {};
+		struct FrameAnatomySequence : TagTraits<0x0020, 0x9071, VR::SQ, 1, 1> {};
+		struct FrameLaterality : TagTraits<0x0020, 0x9072, VR::CS, 1, 1> {};
+		struct FrameContentSequence : TagTraits<0x0020, 0x9111, VR::SQ, 1, 1> {};
+		struct PlanePositionSequence : TagTraits<0x0020, 0x9113, VR::SQ, 1, 1> {};
+		struct PlaneOrientationSequence : TagTraits<0x0020, 0x9116, VR::SQ, 1, 1> {};
+		struct TemporalPositionIndex : TagTraits<0x0020, 0x9128, VR::UL, 1, 1> {};
+		struct NominalCardiacTriggerDelayTime : TagTraits<0x0020, 0x9153, VR::FD, 1, 1> {};
+		struct NominalCardiacTriggerTimePriorToRPeak : TagTraits<0x0020, 0x9154, VR::FL, 1, 1> {};
+		struct ActualCardiacTriggerTimePriorToRPeak : TagTraits<0x0020, 0x9155, VR::FL, 1, 1> {};
+		struct FrameAcquisitionNumber : TagTraits<0x0020, 0x9156, VR::US, 1, 1> {};
+		struct DimensionIndexValues : TagTraits<0x0020, 0x9157, VR::UL, 1, 0> {};
+		struct FrameComments : TagTraits<0x0020, 0x9158, VR::LT, 1, 1> {};
+		struct ConcatenationUID : TagTraits<0x0020, 0x9161, VR::UI, 1, 1> {};
+		struct InConcatenationNumber : TagTraits<0x0020, 0x9162, VR::US, 1, 1> {};
+		struct InConcatenationTotalNumber : TagTraits<0x0020, 0x9163, VR::US, 1, 1> {};
+		struct DimensionOrganizationUID : TagTraits<0x0020, 0x9164, VR::UI, 1, 1> {};
+		struct DimensionIndexPointer : TagTraits<0x0020, 0x9165, VR::AT, 1, 1> {};
+		struct FunctionalGroupPointer : TagTraits<0x0020, 0x9167, VR::AT, 1, 1> {};
+		struct UnassignedSharedConvertedAttributesSequence : TagTraits<0x0020, 0x9170, VR::SQ, 1, 1> {};
+		struct UnassignedPerFrameConvertedAttributesSequence : TagTraits<0x0020, 0x9171, VR::SQ, 1, 1> {};
+		struct ConversionSourceAttributesSequence : TagTraits<0x0020, 0x9172, VR::SQ, 1, 1> {};
+		struct DimensionIndexPrivateCreator : TagTraits<0x0020, 0x9213, VR::LO, 1, 1> {};
+		struct DimensionOrganizationSequence : TagTraits<0x0020, 0x9221, VR::SQ, 1, 1> {};
+		struct DimensionIndexSequence : TagTraits<0x0020, 0x9222, VR::SQ, 1, 1> {};
+		struct ConcatenationFrameOffsetNumber : TagTraits<0x0020, 0x9228, VR::UL, 1, 1> {};
+		struct FunctionalGroupPrivateCreator : TagTraits<0x0020, 0x9238, VR::LO, 1, 1> {};
+		struct NominalPercentageOfCardiacPhase : TagTraits<0x0020, 0x9241, VR::FL, 1, 1> {};
+		struct NominalPercentageOfRespiratoryPhase : TagTraits<0x0020, 0x9245, VR::FL, 1, 1> {};
+		struct StartingRespiratoryAmplitude : TagTraits<0x0020, 0x9246, VR::FL, 1, 1> {};
+		struct StartingRespiratoryPhase : TagTraits<0x0020, 0x9247, VR::CS, 1, 1> {};
+		struct EndingRespiratoryAmplitude : TagTraits<0x0020, 0x9248, VR::FL, 1, 1> {};
+		struct EndingRespiratoryPhase : TagTraits<0x0020, 0x9249, VR::CS, 1, 1> {};
+		struct RespiratoryTriggerType : TagTraits<0x0020, 0x9250, VR::CS, 1, 1> {};
+		struct RRIntervalTimeNominal : TagTraits<0x0020, 0x9251, VR::FD, 1, 1> {};
+		struct ActualCardiacTriggerDelayTime : TagTraits<0x0020, 0x9252, VR::FD, 1, 1> {};
+		struct RespiratorySynchronizationSequence : TagTraits<0x0020, 0x9253, VR::SQ, 1, 1> {};
+		struct RespiratoryIntervalTime : TagTraits<0x0020, 0x9254, VR::FD, 1, 1> {};
+		struct NominalRespiratoryTriggerDelayTime : TagTraits<0x0020, 0x9255, VR::FD, 1, 1> {};
+		struct RespiratoryTriggerDelayThreshold : TagTraits<0x0020, 0x9256, VR::FD, 1, 1> {};
+		struct ActualRespiratoryTriggerDelayTime : TagTraits<0x0020, 0x9257, VR::FD, 1, 1> {};
+		struct ImagePositionVolume : TagTraits<0x0020, 0x9301, VR::FD, 3, 3> {};
+		struct ImageOrientationVolume : TagTraits<0x0020, 0x9302, VR::FD, 6, 6> {};
+		struct UltrasoundAcquisitionGeometry : TagTraits<0x0020, 0x9307, VR::CS, 1, 1> {};
+		struct ApexPosition : TagTraits<0x0020, 0x9308, VR::FD, 3, 3> {};
+		struct VolumeToTransducerMappingMatrix : TagTraits<0x0020, 0x9309, VR::FD, 16, 16> {};
+		struct VolumeToTableMappingMatrix : TagTraits<0x0020, 0x930a, VR::FD, 16, 16> {};
+		struct VolumeToTransducerRelationship : TagTraits<0x0020, 0x930b, VR::CS, 1, 1> {};
+		struct PatientFrameOfReferenceSource : TagTraits<0x0020, 0x930c, VR::CS, 1, 1> {};
+		struct TemporalPositionTimeOffset : TagTraits<0x0020, 0x930d, VR::FD, 1, 1> {};
+		struct PlanePositionVolumeSequence : TagTraits<0x0020, 0x930e, VR::SQ, 1, 1> {};
+		struct PlaneOrientationVolumeSequence : TagTraits<0x0020, 0x930f, VR::SQ, 1, 1> {};
+		struct TemporalPositionSequence : TagTraits<0x0020, 0x9310, VR::SQ, 1, 1> {};
+		struct DimensionOrganizationType : TagTraits<0x0020, 0x9311, VR::CS, 1, 1> {};
+		struct VolumeFrameOfReferenceUID : TagTraits<0x0020, 0x9312, VR::UI, 1, 1> {};
+		struct TableFrameOfReferenceUID : TagTraits<0x0020, 0x9313, VR::UI, 1, 1> {};
+		struct DimensionDescriptionLabel : TagTraits<0x0020, 0x9421, VR::LO, 1, 1> {};
+		struct PatientOrientationInFrameSequence : TagTraits<0x0020, 0x9450, VR::SQ, 1, 1> {};
+		struct FrameLabel : TagTraits<0x0020, 0x9453, VR::LO, 1, 1> {};
+		struct AcquisitionIndex : TagTraits<0x0020, 0x9518, VR::US, 1, 0> {};
+		struct ContributingSOPInstancesReferenceSequence : TagTraits<0x0020, 0x9529, VR::SQ, 1, 1> {};
+		struct ReconstructionIndex : TagTraits<0x0020, 0x9536, VR::US, 1, 1> {};
+		struct LightPathFilterPassThroughWavelength : TagTraits<0x0022, 0x0001, VR::US, 1, 1> {};
+		struct LightPathFilterPassBand : TagTraits<0x0022, 0x0002, VR::US, 2, 2> {};
+		struct ImagePathFilterPassThroughWavelength : TagTraits<0x0022, 0x0003, VR::US, 1, 1> {};
+		struct ImagePathFilterPassBand : TagTraits<0x0022, 0x0004, VR::US, 2, 2> {};
+		struct PatientEyeMovementCommanded : TagTraits<0x0022, 0x0005, VR::CS, 1, 1> {};
+		struct PatientEyeMovementCommandCodeSequence : TagTraits<0x0022, 0x0006, VR::SQ, 1, 1> {};
+		struct SphericalLensPower : TagTraits<0x0022, 0x0007, VR::FL, 1, 1> {};
+		struct CylinderLensPower : TagTraits<0x0022, 0x0008, VR::FL, 1, 1> {};
+		struct CylinderAxis : TagTraits<0x0022, 0x0009, VR::FL, 1, 1> {};
+		struct EmmetropicMagnification : TagTraits<0x0022, 0x000a, VR::FL, 1, 1> {};
+		struct IntraOcularPressure : TagTraits<0x0022, 0x000b, VR::FL, 1, 1> {};
+		struct HorizontalFieldOfView : TagTraits<0x0022, 0x000c, VR::FL, 1, 1> {};
+		struct PupilDilated : TagTraits<0x0022, 0x000d, VR::CS, 1, 1> {};
+		struct DegreeOfDilation : TagTraits<0x0022, 0x000e, VR::FL, 1, 1> {};
+		struct StereoBaselineAngle : TagTraits<0x0022, 0x0010, VR::FL, 1, 1> {};
+		struct StereoBaselineDisplacement : TagTraits<0x0022, 0x0011, VR::FL, 1, 1> {};
+		struct StereoHorizontalPixelOffset : TagTraits<0x0022, 0x0012, VR::FL, 1, 1> {};
+		struct StereoVerticalPixelOffset : TagTraits<0x0022, 0x0013, VR::FL, 1, 1> {};
+		struct StereoRotation : TagTraits<0x0022, 0x0014, VR::FL, 1, 1> {};
+		struct AcquisitionDeviceTypeCodeSequence : TagTraits<0x0022, 0x0015, VR::SQ, 1, 1> {};
+		struct IlluminationTypeCodeSequence : TagTraits<0x0022, 0x0016, VR::SQ, 1, 1> {};
+		struct LightPathFilterTypeStackCodeSequence : TagTraits<0x0022, 0x0017, VR::SQ, 1, 1> {};
+		struct ImagePathFilterTypeStackCodeSequence : TagTraits<0x0022, 0x0018, VR::SQ, 1, 1> {};
+		struct LensesCodeSequence : TagTraits<0x0022, 0x0019, VR::SQ, 1, 1> {};
+		struct ChannelDescriptionCodeSequence : TagTraits<0x0022, 0x001a, VR::SQ, 1, 1> {};
+		struct RefractiveStateSequence : TagTraits<0x0022, 0x001b, VR::SQ, 1, 1> {};
+		struct MydriaticAgentCodeSequence : TagTraits<0x0022, 0x001c, VR::SQ, 1, 1> {};
+		struct RelativeImagePositionCodeSequence : TagTraits<0x0022, 0x001d, VR::SQ, 1, 1> {};
+		struct CameraAngleOfView : TagTraits<0x0022, 0x001e, VR::FL, 1, 1> {};
+		struct StereoPairsSequence : TagTraits<0x0022, 0x0020, VR::SQ, 1, 1> {};
+		struct LeftImageSequence : TagTraits<0x0022, 0x0021, VR::SQ, 1, 1> {};
+		struct RightImageSequence : TagTraits<0x0022, 0x0022, VR::SQ, 1, 1> {};
+		struct StereoPairsPresent : TagTraits<0x0022, 0x0028, VR::CS, 1, 1> {};
+		struct AxialLengthOfTheEye : TagTraits<0x0022, 0x0030, VR::FL, 1, 1> {};
+		struct OphthalmicFrameLocationSequence : TagTraits<0x0022, 0x0031, VR::SQ, 1, 1> {};
+		struct ReferenceCoordinates : TagTraits<0x0022, 0x0032, VR::FL, 2, 0> {};
+		struct DepthSpatialResolution : TagTraits<0x0022, 0x0035, VR::FL, 1, 1> {};
+		struct MaximumDepthDistortion : TagTraits<0x0022, 0x0036, VR::FL, 1, 1> {};
+		struct AlongScanSpatialResolution : TagTraits<0x0022, 0x0037, VR::FL, 1, 1> {};
+		struct MaximumAlongScanDistortion : TagTraits<0x0022, 0x0038, VR::FL, 1, 1> {};
+		struct OphthalmicImageOrientation : TagTraits<0x0022, 0x0039, VR::CS, 1, 1> {};
+		struct DepthOfTransverseImage : TagTraits<0x0022, 0x0041, VR::FL, 1, 1> {};
+		struct MydriaticAgentConcentrationUnitsSequence : TagTraits<0x0022, 0x0042, VR::SQ, 1, 1> {};
+		struct AcrossScanSpatialResolution : TagTraits<0x0022, 0x0048, VR::FL, 1, 1> {};
+		struct MaximumAcrossScanDistortion : TagTraits<0x0022, 0x0049, VR::FL, 1, 1> {};
+		struct MydriaticAgentConcentration : TagTraits<0x0022, 0x004e, VR::DS, 1, 1> {};
+		struct IlluminationWaveLength : TagTraits<0x0022, 0x0055, VR::FL, 1, 1> {};
+		struct IlluminationPower : TagTraits<0x0022, 0x0056, VR::FL, 1, 1> {};
+		struct IlluminationBandwidth : TagTraits<0x0022, 0x0057, VR::FL, 1, 1> {};
+		struct MydriaticAgentSequence : TagTraits<0x0022, 0x0058, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialMeasurementsRightEyeSequence : TagTraits<0x0022, 0x1007, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialMeasurementsLeftEyeSequence : TagTraits<0x0022, 0x1008, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialMeasurementsDeviceType : TagTraits<0x0022, 0x1009, VR::CS, 1, 1> {};
+		struct OphthalmicAxialLengthMeasurementsType : TagTraits<0x0022, 0x1010, VR::CS, 1, 1> {};
+		struct OphthalmicAxialLengthSequence : TagTraits<0x0022, 0x1012, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLength : TagTraits<0x0022, 0x1019, VR::FL, 1, 1> {};
+		struct LensStatusCodeSequence : TagTraits<0x0022, 0x1024, VR::SQ, 1, 1> {};
+		struct VitreousStatusCodeSequence : TagTraits<0x0022, 0x1025, VR::SQ, 1, 1> {};
+		struct IOLFormulaCodeSequence : TagTraits<0x0022, 0x1028, VR::SQ, 1, 1> {};
+		struct IOLFormulaDetail : TagTraits<0x0022, 0x1029, VR::LO, 1, 1> {};
+		struct KeratometerIndex : TagTraits<0x0022, 0x1033, VR::FL, 1, 1> {};
+		struct SourceOfOphthalmicAxialLengthCodeSequence : TagTraits<0x0022, 0x1035, VR::SQ, 1, 1> {};
+		struct TargetRefraction : TagTraits<0x0022, 0x1037, VR::FL, 1, 1> {};
+		struct RefractiveProcedureOccurred : TagTraits<0x0022, 0x1039, VR::CS, 1, 1> {};
+		struct RefractiveSurgeryTypeCodeSequence : TagTraits<0x0022, 0x1040, VR::SQ, 1, 1> {};
+		struct OphthalmicUltrasoundMethodCodeSequence : TagTraits<0x0022, 0x1044, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLengthMeasurementsSequence : TagTraits<0x0022, 0x1050, VR::SQ, 1, 1> {};
+		struct IOLPower : TagTraits<0x0022, 0x1053, VR::FL, 1, 1> {};
+		struct PredictedRefractiveError : TagTraits<0x0022, 0x1054, VR::FL, 1, 1> {};
+		struct OphthalmicAxialLengthVelocity : TagTraits<0x0022, 0x1059, VR::FL, 1, 1> {};
+		struct LensStatusDescription : TagTraits<0x0022, 0x1065, VR::LO, 1, 1> {};
+		struct VitreousStatusDescription : TagTraits<0x0022, 0x1066, VR::LO, 1, 1> {};
+		struct IOLPowerSequence : TagTraits<0x0022, 0x1090, VR::SQ, 1, 1> {};
+		struct LensConstantSequence : TagTraits<0x0022, 0x1092, VR::SQ, 1, 1> {};
+		struct IOLManufacturer : TagTraits<0x0022, 0x1093, VR::LO, 1, 1> {};
+		struct LensConstantDescription : TagTraits<0x0022, 0x1094, VR::LO, 1, 1> {};
+		struct ImplantName : TagTraits<0x0022, 0x1095, VR::LO, 1, 1> {};
+		struct KeratometryMeasurementTypeCodeSequence : TagTraits<0x0022, 0x1096, VR::SQ, 1, 1> {};
+		struct ImplantPartNumber : TagTraits<0x0022, 0x1097, VR::LO, 1, 1> {};
+		struct ReferencedOphthalmicAxialMeasurementsSequence : TagTraits<0x0022, 0x1100, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLengthMeasurementsSegmentNameCodeSequence : TagTraits<0x0022, 0x1101, VR::SQ, 1, 1> {};
+		struct RefractiveErrorBeforeRefractiveSurgeryCodeSequence : TagTraits<0x0022, 0x1103, VR::SQ, 1, 1> {};
+		struct IOLPowerForExactEmmetropia : TagTraits<0x0022, 0x1121, VR::FL, 1, 1> {};
+		struct IOLPowerForExactTargetRefraction : TagTraits<0x0022, 0x1122, VR::FL, 1, 1> {};
+		struct AnteriorChamberDepthDefinitionCodeSequence : TagTraits<0x0022, 0x1125, VR::SQ, 1, 1> {};
+		struct LensThicknessSequence : TagTraits<0x0022, 0x1127, VR::SQ, 1, 1> {};
+		struct AnteriorChamberDepthSequence : TagTraits<0x0022, 0x1128, VR::SQ, 1, 1> {};
+		struct LensThickness : TagTraits<0x0022, 0x1130, VR::FL, 1, 1> {};
+		struct AnteriorChamberDepth : TagTraits<0x0022, 0x1131, VR::FL, 1, 1> {};
+		struct SourceOfLensThicknessDataCodeSequence : TagTraits<0x0022, 0x1132, VR::SQ, 1, 1> {};
+		struct SourceOfAnteriorChamberDepthDataCodeSequence : TagTraits<0x0022, 0x1133, VR::SQ, 1, 1> {};
+		struct SourceOfRefractiveMeasurementsSequence : TagTraits<0x0022, 0x1134, VR::SQ, 1, 1> {};
+		struct SourceOfRefractiveMeasurementsCodeSequence : TagTraits<0x0022, 0x1135, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLengthMeasurementModified : TagTraits<0x0022, 0x1140, VR::CS, 1, 1> {};
+		struct OphthalmicAxialLengthDataSourceCodeSequence : TagTraits<0x0022, 0x1150, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLengthAcquisitionMethodCodeSequence : TagTraits<0x0022, 0x1153, VR::SQ, 1, 1> {};
+		struct SignalToNoiseRatio : TagTraits<0x0022, 0x1155, VR::FL, 1, 1> {};
+		struct OphthalmicAxialLengthDataSourceDescription : TagTraits<0x0022, 0x1159, VR::LO, 1, 1> {};
+		struct OphthalmicAxialLengthMeasurementsTotalLengthSequence : TagTraits<0x0022, 0x1210, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLengthMeasurementsSegmentalLengthSequence : TagTraits<0x0022, 0x1211, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLengthMeasurementsLengthSummationSequence : TagTraits<0x0022, 0x1212, VR::SQ, 1, 1> {};
+		struct UltrasoundOphthalmicAxialLengthMeasurementsSequence : TagTraits<0x0022, 0x1220, VR::SQ, 1, 1> {};
+		struct OpticalOphthalmicAxialLengthMeasurementsSequence : TagTraits<0x0022, 0x1225, VR::SQ, 1, 1> {};
+		struct UltrasoundSelectedOphthalmicAxialLengthSequence : TagTraits<0x0022, 0x1230, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLengthSelectionMethodCodeSequence : TagTraits<0x0022, 0x1250, VR::SQ, 1, 1> {};
+		struct OpticalSelectedOphthalmicAxialLengthSequence : TagTraits<0x0022, 0x1255, VR::SQ, 1, 1> {};
+		struct SelectedSegmentalOphthalmicAxialLengthSequence : TagTraits<0x0022, 0x1257, VR::SQ, 1, 1> {};
+		struct SelectedTotalOphthalmicAxialLengthSequence : TagTraits<0x0022, 0x1260, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLengthQualityMetricSequence : TagTraits<0x0022, 0x1262, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLengthQualityMetricTypeCodeSequence : TagTraits<0x0022, 0x1265, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLengthQualityMetricTypeDescription : TagTraits<0x0022, 0x1273, VR::LO, 1, 1> {};
+		struct IntraocularLensCalculationsRightEyeSequence : TagTraits<0x0022, 0x1300, VR::SQ, 1, 1> {};
+		struct IntraocularLensCalculationsLeftEyeSequence : TagTraits<0x0022, 0x1310, VR::SQ, 1, 1> {};
+		struct ReferencedOphthalmicAxialLengthMeasurementQCImageSequence : TagTraits<0x0022, 0x1330, VR::SQ, 1, 1> {};
+		struct OphthalmicMappingDeviceType : TagTraits<0x0022, 0x1415, VR::CS, 1, 1> {};
+		struct AcquisitionMethodCodeSequence : TagTraits<0x0022, 0x1420, VR::SQ, 1, 1> {};
+		struct AcquisitionMethodAlgorithmSequence : TagTraits<0x0022, 0x1423, VR::SQ, 1, 1> {};
+		struct OphthalmicThicknessMapTypeCodeSequence : TagTraits<0x0022, 0x1436, VR::SQ, 1, 1> {};
+		struct OphthalmicThicknessMappingNormalsSequence : TagTraits<0x0022, 0x1443, VR::SQ, 1, 1> {};
+		struct RetinalThicknessDefinitionCodeSequence : TagTraits<0x0022, 0x1445, VR::SQ, 1, 1> {};
+		struct PixelValueMappingToCodedConceptSequence : TagTraits<0x0022, 0x1450, VR::SQ, 1, 1> {};
+		struct PixelValueMappingExplanation : TagTraits<0x0022, 0x1454, VR::LO, 1, 1> {};
+		struct OphthalmicThicknessMapQualityThresholdSequence : TagTraits<0x0022, 0x1458, VR::SQ, 1, 1> {};
+		struct OphthalmicThicknessMapThresholdQualityRating : TagTraits<0x0022, 0x1460, VR::FL, 1, 1> {};
+		struct AnatomicStructureReferencePoint : TagTraits<0x0022, 0x1463, VR::FL, 2, 2> {};
+		struct RegistrationToLocalizerSequence : TagTraits<0x0022, 0x1465, VR::SQ, 1, 1> {};
+		struct RegisteredLocalizerUnits : TagTraits<0x0022, 0x1466, VR::CS, 1, 1> {};
+		struct RegisteredLocalizerTopLeftHandCorner : TagTraits<0x0022, 0x1467, VR::FL, 2, 2> {};
+		struct RegisteredLocalizerBottomRightHandCorner : TagTraits<0x0022, 0x1468, VR::FL, 2, 2> {};
+		struct OphthalmicThicknessMapQualityRatingSequence : TagTraits<0x0022, 0x1470, VR::SQ, 1, 1> {};
+		struct RelevantOPTAttributesSequence : TagTraits<0x0022, 0x1472, VR::SQ, 1, 1> {};
+		struct TransformationMethodCodeSequence : TagTraits<0x0022, 0x1512, VR::SQ, 1, 1> {};
+		struct TransformationAlgorithmSequence : TagTraits<0x0022, 0x1513, VR::SQ, 1, 1> {};
+		struct OphthalmicAxialLengthMethod : TagTraits<0x0022, 0x1515, VR::CS, 1, 1> {};
+		struct OphthalmicFOV : TagTraits<0x0022, 0x1517, VR::FL, 1, 1> {};
+		struct TwoDimensionalToThreeDimensionalMapSequence : TagTraits<0x0022, 0x1518, VR::SQ, 1, 1> {};
+		struct WideFieldOphthalmicPhotographyQualityRatingSequence : TagTraits<0x0022, 0x1525, VR::SQ, 1, 1> {};
+		struct WideFieldOphthalmicPhotographyQualityThresholdSequence : TagTraits<0x0022, 0x1526, VR::SQ, 1, 1> {};
+		struct WideFieldOphthalmicPhotographyThresholdQualityRating : TagTraits<0x0022, 0x1527, VR::FL, 1, 1> {};
+		struct XCoordinatesCenterPixelViewAngle : TagTraits<0x0022, 0x1528, VR::FL, 1, 1> {};
+		struct YCoordinatesCenterPixelViewAngle : TagTraits<0x0022, 0x1529, VR::FL, 1, 1> {};
+		struct NumberOfMapPoints : TagTraits<0x0022, 0x1530, VR::UL, 1, 1> {};
+		struct TwoDimensionalToThreeDimensionalMapData : TagTraits<0x0022, 0x1531, VR::OF, 1, 1> {};
+		struct DerivationAlgorithmSequence : TagTraits<0x0022, 0x1612, VR::SQ, 1, 1> {};
+		struct OphthalmicImageTypeCodeSequence : TagTraits<0x0022, 0x1615, VR::SQ, 1, 1> {};
+		struct OphthalmicImageTypeDescription : TagTraits<0x0022, 0x1616, VR::LO, 1, 1> {};
+		struct ScanPatternTypeCodeSequence : TagTraits<0x0022, 0x1618, VR::SQ, 1, 1> {};
+		struct ReferencedSurfaceMeshIdentificationSequence : TagTraits<0x0022, 0x1620, VR::SQ, 1, 1> {};
+		struct OphthalmicVolumetricPropertiesFlag : TagTraits<0x0022, 0x1622, VR::CS, 1, 1> {};
+		struct OphthalmicAnatomicReferencePointXCoordinate : TagTraits<0x0022, 0x1624, VR::FL, 1, 1> {};
+		struct OphthalmicAnatomicReferencePointYCoordinate : TagTraits<0x0022, 0x1626, VR::FL, 1, 1> {};
+		struct OphthalmicEnFaceImageQualityRatingSequence : TagTraits<0x0022, 0x1628, VR::SQ, 1, 1> {};
+		struct QualityThreshold : TagTraits<0x0022, 0x1630, VR::DS, 1, 1> {};
+		struct OCTBscanAnalysisAcquisitionParametersSequence : TagTraits<0x0022, 0x1640, VR::SQ, 1, 1> {};
+		struct NumberofBscansPerFrame : TagTraits<0x0022, 0x1642, VR::UL, 1, 1> {};
+		struct BscanSlabThickness : TagTraits<0x0022, 0x1643, VR::FL, 1, 1> {};
+		struct DistanceBetweenBscanSlabs : TagTraits<0x0022, 0x1644, VR::FL, 1, 1> {};
+		struct BscanCycleTime : TagTraits<0x0022, 0x1645, VR::FL, 1, 1> {};
+		struct BscanCycleTimeVector : TagTraits<0x0022, 0x1646, VR::FL, 1, 0> {};
+		struct AscanRate : TagTraits<0x0022, 0x1649, VR::FL, 1, 1> {};
+		struct BscanRate : TagTraits<0x0022, 0x1650, VR::FL, 1, 1> {};
+		struct SurfaceMeshZPixelOffset : TagTraits<0x0022, 0x1658, VR::UL, 1, 1> {};
+		struct VisualFieldHorizontalExtent : TagTraits<0x0024, 0x0010, VR::FL, 1, 1> {};
+		struct VisualFieldVerticalExtent : TagTraits<0x0024, 0x0011, VR::FL, 1, 1> {};
+		struct VisualFieldShape : TagTraits<0x0024, 0x0012, VR::CS, 1, 1> {};
+		struct ScreeningTestModeCodeSequence : TagTraits<0x0024, 0x0016, VR::SQ, 1, 1> {};
+		struct MaximumStimulusLuminance : TagTraits<0x0024, 0x0018, VR::FL, 1, 1> {};
+		struct BackgroundLuminance : TagTraits<0x0024, 0x0020, VR::FL, 1, 1> {};
+		struct StimulusColorCodeSequence : TagTraits<0x0024, 0x0021, VR::SQ, 1, 1> {};
+		struct BackgroundIlluminationColorCodeSequence : TagTraits<0x0024, 0x0024, VR::SQ, 1, 1> {};
+		struct StimulusArea : TagTraits<0x0024, 0x0025, VR::FL, 1, 1> {};
+		struct StimulusPresentationTime : TagTraits<0x0024, 0x0028, VR::FL, 1, 1> {};
+		struct FixationSequence : TagTraits<0x0024, 0x0032, VR::SQ, 1, 1> {};
+		struct FixationMonitoringCodeSequence : TagTraits<0x0024, 0x0033, VR::SQ, 1, 1> {};
+		struct VisualFieldCatchTrialSequence : TagTraits<0x0024, 0x0034, VR::SQ, 1, 1> {};
+		struct FixationCheckedQuantity : TagTraits<0x0024, 0x0035, VR::US, 1, 1> {};
+		struct PatientNotProperlyFixatedQuantity : TagTraits<0x0024, 0x0036, VR::US, 1, 1> {};
+		struct PresentedVisualStimuliDataFlag : TagTraits<0x0024, 0x0037, VR::CS, 1, 1> {};
+		struct NumberOfVisualStimuli : TagTraits<0x0024, 0x0038, VR::US, 1, 1> {};
+		struct ExcessiveFixationLossesDataFlag : TagTraits<0x0024, 0x0039, VR::CS, 1, 1> {};
+		struct ExcessiveFixationLosses : TagTraits<0x0024, 0x0040, VR::CS, 1, 1> {};
+		struct StimuliRetestingQuantity : TagTraits<0x0024, 0x0042, VR::US, 1, 1> {};
+		struct CommentsOnPatientPerformanceOfVisualField : TagTraits<0x0024, 0x0044, VR::LT, 1, 1> {};
+		struct FalseNegativesEstimateFlag : TagTraits<0x0024, 0x0045, VR::CS, 1, 1> {};
+		struct FalseNegativesEstimate : TagTraits<0x0024, 0x0046, VR::FL, 1, 1> {};
+		struct NegativeCatchTrialsQuantity : TagTraits<0x0024, 0x0048, VR::US, 1, 1> {};
+		struct FalseNegativesQuantity : TagTraits<0x0024, 0x0050, VR::US, 1, 1> {};
+		struct ExcessiveFalseNegativesDataFlag : TagTraits<0x0024, 0x0051, VR::CS, 1, 1> {};
+		struct ExcessiveFalseNegatives : TagTraits<0x0024, 0x0052, VR::CS, 1, 1> {};
+		struct FalsePositivesEstimateFlag : TagTraits<0x0024, 0x0053, VR::CS, 1, 1> {};
+		struct FalsePositivesEstimate : TagTraits<0x0024, 0x0054, VR::FL, 1, 1> {};
+		struct CatchTrialsDataFlag : TagTraits<0x0024, 0x0055, VR::CS, 1, 1> {};
+		struct PositiveCatchTrialsQuantity : TagTraits<0x0024, 0x0056, VR::US, 1, 1> {};
+		struct TestPointNormalsDataFlag : TagTraits<0x0024, 0x0057, VR::CS, 1, 1> {};
+		struct TestPointNormalsSequence : TagTraits<0x0024, 0x0058, VR::SQ, 1, 1> {};
+		struct GlobalDeviationProbabilityNormalsFlag : TagTraits<0x0024, 0x0059, VR::CS, 1, 1> {};
+		struct FalsePositivesQuantity : TagTraits<0x0024, 0x0060, VR::US, 1, 1> {};
+		struct ExcessiveFalsePositivesDataFlag : TagTraits<0x0024, 0x0061, VR::CS, 1, 1> {};
+		struct ExcessiveFalsePositives : TagTraits<0x0024, 0x0062, VR::CS, 1, 1> {};
+		struct VisualFieldTestNormalsFlag : TagTraits<0x0024, 0x0063, VR::CS, 1, 1> {};
+		struct ResultsNormalsSequence : TagTraits<0x0024, 0x0064, VR::SQ, 1, 1> {};
+		struct AgeCorrectedSensitivityDeviationAlgorithmSequence : TagTraits<0x0024, 0x0065, VR::SQ, 1, 1> {};
+		struct GlobalDeviationFromNormal : TagTraits<0x0024, 0x0066, VR::FL, 1, 1> {};
+		struct GeneralizedDefectSensitivityDeviationAlgorithmSequence : TagTraits<0x0024, 0x0067, VR::SQ, 1, 1> {};
+		struct LocalizedDeviationFromNormal : TagTraits<0x0024, 0x0068, VR::FL, 1, 1> {};
+		struct PatientReliabilityIndicator : TagTraits<0x0024, 0x0069, VR::LO, 1, 1> {};
+		struct VisualFieldMeanSensitivity : TagTraits<0x0024, 0x0070, VR::FL, 1, 1> {};
+		struct GlobalDeviationProbability : TagTraits<0x0024, 0x0071, VR::FL, 1, 1> {};
+		struct LocalDeviationProbabilityNormalsFlag : TagTraits<0x0024, 0x0072, VR::CS, 1, 1> {};
+		struct LocalizedDeviationProbability : TagTraits<0x0024, 0x0073, VR::FL, 1, 1> {};
+		struct ShortTermFluctuationCalculated : TagTraits<0x0024, 0x0074, VR::CS, 1, 1> {};
+		struct ShortTermFluctuation : TagTraits<0x0024, 0x0075, VR::FL, 1, 1> {};
+		struct ShortTermFluctuationProbabilityCalculated : TagTraits<0x0024, 0x0076, VR::CS, 1, 1> {};
+		struct ShortTermFluctuationProbability : TagTraits<0x0024, 0x0077, VR::FL, 1, 1> {};
+		struct CorrectedLocalizedDeviationFromNormalCalculated : TagTraits<0x0024, 0x0078, VR::CS, 1, 1> {};
+		struct CorrectedLocalizedDeviationFromNormal : TagTraits<0x0024, 0x0079, VR::FL, 1, 1> {};
+		struct CorrectedLocalizedDeviationFromNormalProbabilityCalculated : TagTraits<0x0024, 0x0080, VR::CS, 1, 1> {};
+		struct CorrectedLocalizedDeviationFromNormalProbability : TagTraits<0x0024, 0x0081, VR::FL, 1, 1> {};
+		struct GlobalDeviationProbabilitySequence : TagTraits<0x0024, 0x0083, VR::SQ, 1, 1> {};
+		struct LocalizedDeviationProbabilitySequence : TagTraits<0x0024, 0x0085, VR::SQ, 1, 1> {};
+		struct FovealSensitivityMeasured : TagTraits<0x0024, 0x0086, VR::CS, 1, 1> {};
+		struct FovealSensitivity : TagTraits<0x0024, 0x0087, VR::FL, 1, 1> {};
+		struct VisualFieldTestDuration : TagTraits<0x0024, 0x0088, VR::FL, 1, 1> {};
+		struct VisualFieldTestPointSequence : TagTraits<0x0024, 0x0089, VR::SQ, 1, 1> {};
+		struct VisualFieldTestPointXCoordinate : TagTraits<0x0024, 0x0090, VR::FL, 1, 1> {};
+		struct VisualFieldTestPointYCoordinate : TagTraits<0x0024, 0x0091, VR::FL, 1, 1> {};
+		struct AgeCorrectedSensitivityDeviationValue : TagTraits<0x0024, 0x0092, VR::FL, 1, 1> {};
+		struct StimulusResults : TagTraits<0x0024, 0x0093, VR::CS, 1, 1> {};
+		struct SensitivityValue : TagTraits<0x0024, 0x0094, VR::FL, 1, 1> {};
+		struct RetestStimulusSeen : TagTraits<0x0024, 0x0095, VR::CS, 1, 1> {};
+		struct RetestSensitivityValue : TagTraits<0x0024, 0x0096, VR::FL, 1, 1> {};
+		struct VisualFieldTestPointNormalsSequence : TagTraits<0x0024, 0x0097, VR::SQ, 1, 1> {};
+		struct QuantifiedDefect : TagTraits<0x0024, 0x0098, VR::FL, 1, 1> {};
+		struct AgeCorrectedSensitivityDeviationProbabilityValue : TagTraits<0x0024, 0x0100, VR::FL, 1, 1> {};
+		struct GeneralizedDefectCorrectedSensitivityDeviationFlag : TagTraits<0x0024, 0x0102, VR::CS, 1, 1> {};
+		struct GeneralizedDefectCorrectedSensitivityDeviationValue : TagTraits<0x0024, 0x0103, VR::FL, 1, 1> {};
+		struct GeneralizedDefectCorrectedSensitivityDeviationProbabilityValue : TagTraits<0x0024, 0x0104, VR::FL, 1, 1> {};
+		struct MinimumSensitivityValue : TagTraits<0x0024, 0x0105, VR::FL, 1, 1> {};
+		struct BlindSpotLocalized : TagTraits<0x0024, 0x0106, VR::CS, 1, 1> {};
+		struct BlindSpotXCoordinate : TagTraits<0x0024, 0x0107, VR::FL, 1, 1> {};
+		struct BlindSpotYCoordinate : TagTraits<0x0024, 0x0108, VR::FL, 1, 1> {};
+		struct VisualAcuityMeasurementSequence : TagTraits<0x0024, 0x0110, VR::SQ, 1, 1> {};
+		struct RefractiveParametersUsedOnPatientSequence : TagTraits<0x0024, 0x0112, VR::SQ, 1, 1> {};
+		struct MeasurementLaterality : TagTraits<0x0024, 0x0113, VR::CS, 1, 1> {};
+		struct OphthalmicPatientClinicalInformationLeftEyeSequence : TagTraits<0x0024, 0x0114, VR::SQ, 1, 1> {};
+		struct OphthalmicPatientClinicalInformationRightEyeSequence : TagTraits<0x0024, 0x0115, VR::SQ, 1, 1> {};
+		struct FovealPointNormativeDataFlag : TagTraits<0x0024, 0x0117, VR::CS, 1, 1> {};
+		struct FovealPointProbabilityValue : TagTraits<0x0024, 0x0118, VR::FL, 1, 1> {};
+		struct ScreeningBaselineMeasured : TagTraits<0x0024, 0x0120, VR::CS, 1, 1> {};
+		struct ScreeningBaselineMeasuredSequence : TagTraits<0x0024, 0x0122, VR::SQ, 1, 1> {};
+		struct ScreeningBaselineType : TagTraits<0x0024, 0x0124, VR::CS, 1, 1> {};
+		struct ScreeningBaselineValue : TagTraits<0x0024, 0x0126, VR::FL, 1, 1> {};
+		struct AlgorithmSource : TagTraits<0x0024, 0x0202, VR::LO, 1, 1> {};
+		struct DataSetName : TagTraits<0x0024, 0x0306, VR::LO, 1, 1> {};
+		struct DataSetVersion : TagTraits<0x0024, 0x0307, VR::LO, 1, 1> {};
+		struct DataSetSource : TagTraits<0x0024, 0x0308, VR::LO, 1, 1> {};
+		struct DataSetDescription : TagTraits<0x0024, 0x0309, VR::LO, 1, 1> {};
+		struct VisualFieldTestReliabilityGlobalIndexSequence : TagTraits<0x0024, 0x0317, VR::SQ, 1, 1> {};
+		struct VisualFieldGlobalResultsIndexSequence : TagTraits<0x0024, 0x0320, VR::SQ, 1, 1> {};
+		struct DataObservationSequence : TagTraits<0x0024, 0x0325, VR::SQ, 1, 1> {};
+		struct IndexNormalsFlag : TagTraits<0x0024, 0x0338, VR::CS, 1, 1> {};
+		struct IndexProbability : TagTraits<0x0024, 0x0341, VR::FL, 1, 1> {};
+		struct IndexProbabilitySequence : TagTraits<0x0024, 0x0344, VR::SQ, 1, 1> {};
+		struct SamplesPerPixel : TagTraits<0x0028, 0x0002, VR::US, 1, 1> {};
+		struct SamplesPerPixelUsed : TagTraits<0x0028, 0x0003, VR::US, 1, 1> {};
+		struct PhotometricInterpretation : TagTraits<0x0028, 0x0004, VR::CS, 1, 1> {};
+		struct ImageDimensions : TagTraits<0x0028, 0x0005, VR::US, 1, 1> {};
+		struct PlanarConfiguration : TagTraits<0x0028, 0x0006, VR::US, 1, 1> {};
+		struct NumberOfFrames : TagTraits<0x0028, 0x0008, VR::IS, 1, 1> {};
+		struct FrameIncrementPointer : TagTraits<0x0028, 0x0009, VR::AT, 1, 0> {};
+		struct FrameDimensionPointer : TagTraits<0x0028, 0x000a, VR::AT, 1, 0> {};
+		struct Rows : TagTraits<0x0028, 0x0010, VR::US, 1, 1> {};
+		struct Columns : TagTraits<0x0028, 0x0011, VR::US, 1, 1> {};
+		struct Planes : TagTraits<0x0028, 0x0012, VR::US, 1, 1> {};
+		struct UltrasoundColorDataPresent : TagTraits<0x0028, 0x0014, VR::US, 1, 1> {};
+		struct PixelSpacing : TagTraits<0x0028, 0x0030, VR::DS, 2, 2> {};
+		struct ZoomFactor : TagTraits<0x0028, 0x0031, VR::DS, 2, 2> {};
+		struct ZoomCenter : TagTraits<0x0028, 0x0032, VR::DS, 2, 2> {};
+		struct PixelAspectRatio : TagTraits<0x0028, 0x0034, VR::IS, 2, 2> {};
+		struct ImageFormat : TagTraits<0x0028, 0x0040, VR::CS, 1, 1> {};
+		struct ManipulatedImage : TagTraits<0x0028, 0x0050, VR::LO, 1, 0> {};
+		struct CorrectedImage : TagTraits<0x0028, 0x0051, VR::CS, 1, 0> {};
+		struct CompressionRecognitionCode : TagTraits<0x0028, 0x005f, VR::LO, 1, 1> {};
+		struct CompressionCode : TagTraits<0x0028, 0x0060, VR::CS, 1, 1> {};
+		struct CompressionOriginator : TagTraits<0x0028, 0x0061, VR::SH, 1, 1> {};
+		struct CompressionLabel : TagTraits<0x0028, 0x0062, VR::LO, 1, 1> {};
+		struct CompressionDescription : TagTraits<0x0028, 0x0063, VR::SH, 1, 1> {};
+		struct CompressionSequence : TagTraits<0x0028, 0x0065, VR::CS, 1, 0> {};
+		struct CompressionStepPointers : TagTraits<0x0028, 0x0066, VR::AT, 1, 0> {};
+		struct RepeatInterval : TagTraits<0x0028, 0x0068, VR::US, 1, 1> {};
+		struct BitsGrouped : TagTraits<0x0028, 0x0069, VR::US, 1, 1> {};
+		struct PerimeterTable : TagTraits<0x0028, 0x0070, VR::US, 1, 0> {};
+		struct PredictorRows : TagTraits<0x0028, 0x0080, VR::US, 1, 1> {};
+		struct PredictorColumns : TagTraits<0x0028, 0x0081, VR::US, 1, 1> {};
+		struct PredictorConstants : TagTraits<0x0028, 0x0082, VR::US, 1, 0> {};
+		struct BlockedPixels : TagTraits<0x0028, 0x0090, VR::CS, 1, 1> {};
+		struct BlockRows : TagTraits<0x0028, 0x0091, VR::US, 1, 1> {};
+		struct BlockColumns : TagTraits<0x0028, 0x0092, VR::US, 1, 1> {};
+		struct RowOverlap : TagTraits<0x0028, 0x0093, VR::US, 1, 1> {};
+		struct ColumnOverlap : TagTraits<0x0028, 0x0094, VR::US, 1, 1> {};
+		struct BitsAllocated : TagTraits<0x0028, 0x0100, VR::US, 1, 1> {};
+		struct BitsStored : TagTraits<0x0028, 0x0101, VR::US, 1, 1> {};
+		struct HighBit : TagTraits<0x0028, 0x0102, VR::US, 1, 1> {};
+		struct PixelRepresentation : TagTraits<0x0028, 0x0103, VR::US, 1, 1> {};
+		struct FloatPixelPaddingValue : TagTraits<0x0028, 0x0122, VR::FL, 1, 1> {};
+		struct DoubleFloatPixelPaddingValue : TagTraits<0x0028, 0x0123, VR::FD, 1, 1> {};
+		struct FloatPixelPaddingRangeLimit : TagTraits<0x0028, 0x0124, VR::FL, 1, 1> {};
+		struct DoubleFloatPixelPaddingRangeLimit : TagTraits<0x0028, 0x0125, VR::FD, 1, 1> {};
+		struct ImageLocation : TagTraits<0x0028, 0x0200, VR::US, 1, 1> {};
+		struct QualityControlImage : TagTraits<0x0028, 0x0300, VR::CS, 1, 1> {};
+		struct BurnedInAnnotation : TagTraits<0x0028, 0x0301, VR::CS, 1, 1> {};
+		struct RecognizableVisualFeatures : TagTraits<0x0028, 0x0302, VR::CS, 1, 1> {};
+		struct LongitudinalTemporalInformationModified : TagTraits<0x0028, 0x0303, VR::CS, 1, 1> {};
+		struct ReferencedColorPaletteInstanceUID : TagTraits<0x0028, 0x0304, VR::UI, 1, 1> {};
+		struct TransformLabel : TagTraits<0x0028, 0x0400, VR::LO, 1, 1> {};
+		struct TransformVersionNumber : TagTraits<0x0028, 0x0401, VR::LO, 1, 1> {};
+		struct NumberOfTransformSteps : TagTraits<0x0028, 0x0402, VR::US, 1, 1> {};
+		struct SequenceOfCompressedData : TagTraits<0x0028, 0x0403, VR::LO, 1, 0> {};
+		struct DetailsOfCoefficients : TagTraits<0x0028, 0x0404, VR::AT, 1, 0> {};
+		struct DCTLabel : TagTraits<0x0028, 0x0700, VR::LO, 1, 1> {};
+		struct DataBlockDescription : TagTraits<0x0028, 0x0701, VR::CS, 1, 0> {};
+		struct DataBlock : TagTraits<0x0028, 0x0702, VR::AT, 1, 0> {};
+		struct NormalizationFactorFormat : TagTraits<0x0028, 0x0710, VR::US, 1, 1> {};
+		struct ZonalMapNumberFormat : TagTraits<0x0028, 0x0720, VR::US, 1, 1> {};
+		struct ZonalMapLocation : TagTraits<0x0028, 0x0721, VR::AT, 1, 0> {};
+		struct ZonalMapFormat : TagTraits<0x0028, 0x0722, VR::US, 1, 1> {};
+		struct AdaptiveMapFormat : TagTraits<0x0028, 0x0730, VR::US, 1, 1> {};
+		struct CodeNumberFormat : TagTraits<0x0028, 0x0740, VR::US, 1, 1> {};
+		struct PixelSpacingCalibrationType : TagTraits<0x0028, 0x0a02, VR::CS, 1, 1> {};
+		struct PixelSpacingCalibrationDescription : TagTraits<0x0028, 0x0a04, VR::LO, 1, 1> {};
+		struct PixelIntensityRelationship : TagTraits<0x0028, 0x1040, VR::CS, 1, 1> {};
+		struct PixelIntensityRelationshipSign : TagTraits<0x0028, 0x1041, VR::SS, 1, 1> {};
+		struct WindowCenter : TagTraits<0x0028, 0x1050, VR::DS, 1, 0> {};
+		struct WindowWidth : TagTraits<0x0028, 0x1051, VR::DS, 1, 0> {};
+		struct RescaleIntercept : TagTraits<0x0028, 0x1052, VR::DS, 1, 1> {};
+		struct RescaleSlope : TagTraits<0x0028, 0x1053, VR::DS, 1, 1> {};
+		struct RescaleType : TagTraits<0x0028, 0x1054, VR::LO, 1, 1> {};
+		struct WindowCenterWidthExplanation : TagTraits<0x0028, 0x1055, VR::LO, 1, 0> {};
+		struct VOILUTFunction : TagTraits<0x0028, 0x1056, VR::CS, 1, 1> {};
+		struct GrayScale : TagTraits<0x0028, 0x1080, VR::CS, 1, 1> {};
+		struct RecommendedViewingMode : TagTraits<0x0028, 0x1090, VR::CS, 1, 1> {};
+		struct AlphaPaletteColorLookupTableDescriptor : TagTraits<0x0028, 0x1104, VR::US, 3, 3> {};
+		struct PaletteColorLookupTableUID : TagTraits<0x0028, 0x1199, VR::UI, 1, 1> {};
+		struct RedPaletteColorLookupTableData : TagTraits<0x0028, 0x1201, VR::OW, 1, 1> {};
+		struct GreenPaletteColorLookupTableData : TagTraits<0x0028, 0x1202, VR::OW, 1, 1> {};
+		struct BluePaletteColorLookupTableData : TagTraits<0x0028, 0x1203, VR::OW, 1, 1> {};
+		struct AlphaPaletteColorLookupTableData : TagTraits<0x0028, 0x1204, VR::OW, 1, 1> {};
+		struct LargeRedPaletteColorLookupTableData : TagTraits<0x0028, 0x1211, VR::OW, 1, 1> {};
+		struct LargeGreenPaletteColorLookupTableData : TagTraits<0x0028, 0x1212, VR::OW, 1, 1> {};
+		struct LargeBluePaletteColorLookupTableData : TagTraits<0x0028, 0x1213, VR::OW, 1, 1> {};
+		struct LargePaletteColorLookupTableUID : TagTraits<0x0028, 0x1214, VR::UI, 1, 1> {};
+		struct SegmentedRedPaletteColorLookupTableData : TagTraits<0x0028, 0x1221, VR::OW, 1, 1> {};
+		struct SegmentedGreenPaletteColorLookupTableData : TagTraits<0x0028, 0x1222, VR::OW, 1, 1> {};
+		struct SegmentedBluePaletteColorLookupTableData : TagTraits<0x0028, 0x1223, VR::OW, 1, 1> {};
+		struct SegmentedAlphaPaletteColorLookupTableData : TagTraits<0x0028, 0x1224, VR::OW, 1, 1> {};
+		struct StoredValueColorRangeSequence : TagTraits<0x0028, 0x1230, VR::SQ, 1, 1> {};
+		struct MinimumStoredValueMapped : TagTraits<0x0028, 0x1231, VR::FD, 1, 1> {};
+		struct MaximumStoredValueMapped : TagTraits<0x0028, 0x1232, VR::FD, 1, 1> {};
+		struct BreastImplantPresent : TagTraits<0x0028, 0x1300, VR::CS, 1, 1> {};
+		struct PartialView : TagTraits<0x0028, 0x1350, VR::CS, 1, 1> {};
+		struct PartialViewDescription : TagTraits<0x0028, 0x1351, VR::ST, 1, 1> {};
+		struct PartialViewCodeSequence : TagTraits<0x0028, 0x1352, VR::SQ, 1, 1> {};
+		struct SpatialLocationsPreserved : TagTraits<0x0028, 0x135a, VR::CS, 1, 1> {};
+		struct DataFrameAssignmentSequence : TagTraits<0x0028, 0x1401, VR::SQ, 1, 1> {};
+		struct DataPathAssignment : TagTraits<0x0028, 0x1402, VR::CS, 1, 1> {};
+		struct BitsMappedToColorLookupTable : TagTraits<0x0028, 0x1403, VR::US, 1, 1> {};
+		struct BlendingLUT1Sequence : TagTraits<0x0028, 0x1404, VR::SQ, 1, 1> {};
+		struct BlendingLUT1TransferFunction : TagTraits<0x0028, 0x1405, VR::CS, 1, 1> {};
+		struct BlendingWeightConstant : TagTraits<0x0028, 0x1406, VR::FD, 1, 1> {};
+		struct BlendingLookupTableDescriptor : TagTraits<0x0028, 0x1407, VR::US, 3, 3> {};
+		struct BlendingLookupTableData : TagTraits<0x0028, 0x1408, VR::OW, 1, 1> {};
+		struct EnhancedPaletteColorLookupTableSequence : TagTraits<0x0028, 0x140b, VR::SQ, 1, 1> {};
+		struct BlendingLUT2Sequence : TagTraits<0x0028, 0x140c, VR::SQ, 1, 1> {};
+		struct BlendingLUT2TransferFunction : TagTraits<0x0028, 0x140d, VR::CS, 1, 1> {};
+		struct DataPathID : TagTraits<0x0028, 0x140e, VR::CS, 1, 1> {};
+		struct RGBLUTTransferFunction : TagTraits<0x0028, 0x140f, VR::CS, 1, 1> {};
+		struct AlphaLUTTransferFunction : TagTraits<0x0028, 0x1410, VR::CS, 1, 1> {};
+		struct ICCProfile : TagTraits<0x0028, 0x2000, VR::OB, 1, 1> {};
+		struct ColorSpace : TagTraits<0x0028, 0x2002, VR::CS, 1, 1> {};
+		struct LossyImageCompression : TagTraits<0x0028, 0x2110, VR::CS, 1, 1> {};
+		struct LossyImageCompressionRatio : TagTraits<0x0028, 0x2112, VR::DS, 1, 0> {};
+		struct LossyImageCompressionMethod : TagTraits<0x0028, 0x2114, VR::CS, 1, 0> {};
+		struct ModalityLUTSequence : TagTraits<0x0028, 0x3000, VR::SQ, 1, 1> {};
+		struct LUTExplanation : TagTraits<0x0028, 0x3003, VR::LO, 1, 1> {};
+		struct ModalityLUTType : TagTraits<0x0028, 0x3004, VR::LO, 1, 1> {};
+		struct VOILUTSequence : TagTraits<0x0028, 0x3010, VR::SQ, 1, 1> {};
+		struct SoftcopyVOILUTSequence : TagTraits<0x0028, 0x3110, VR::SQ, 1, 1> {};
+		struct ImagePresentationComments : TagTraits<0x0028, 0x4000, VR::LT, 1, 1> {};
+		struct BiPlaneAcquisitionSequence : TagTraits<0x0028, 0x5000, VR::SQ, 1, 1> {};
+		struct RepresentativeFrameNumber : TagTraits<0x0028, 0x6010, VR::US, 1, 1> {};
+		struct FrameNumbersOfInterest : TagTraits<0x0028, 0x6020, VR::US, 1, 0> {};
+		struct FrameOfInterestDescription : TagTraits<0x0028, 0x6022, VR::LO, 1, 0> {};
+		struct FrameOfInterestType : TagTraits<0x0028, 0x6023, VR::CS, 1, 0> {};
+		struct MaskPointers : TagTraits<0x0028, 0x6030, VR::US, 1, 0> {};
+		struct RWavePointer : TagTraits<0x0028, 0x6040, VR::US, 1, 0> {};
+		struct MaskSubtractionSequence : TagTraits<0x0028, 0x6100, VR::SQ, 1, 1> {};
+		struct MaskOperation : TagTraits<0x0028, 0x6101, VR::CS, 1, 1> {};
+		struct ApplicableFrameRange : TagTraits<0x0028, 0x6102, VR::US, 2, 0> {};
+		struct MaskFrameNumbers : TagTraits<0x0028, 0x6110, VR::US, 1, 0> {};
+		struct ContrastFrameAveraging : TagTraits<0x0028, 0x6112, VR::US, 1, 1> {};
+		struct MaskSubPixelShift : TagTraits<0x0028, 0x6114, VR::FL, 2, 2> {};
+		struct TIDOffset : TagTraits<0x0028, 0x6120, VR::SS, 1, 1> {};
+		struct MaskOperationExplanation : TagTraits<0x0028, 0x6190, VR::ST, 1, 1> {};
+		struct EquipmentAdministratorSequence : TagTraits<0x0028, 0x7000, VR::SQ, 1, 1> {};
+		struct NumberOfDisplaySubsystems : TagTraits<0x0028, 0x7001, VR::US, 1, 1> {};
+		struct CurrentConfigurationID : TagTraits<0x0028, 0x7002, VR::US, 1, 1> {};
+		struct DisplaySubsystemID : TagTraits<0x0028, 0x7003, VR::US, 1, 1> {};
+		struct DisplaySubsystemName : TagTraits<0x0028, 0x7004, VR::SH, 1, 1> {};
+		struct DisplaySubsystemDescription : TagTraits<0x0028, 0x7005, VR::LO, 1, 1> {};
+		struct SystemStatus : TagTraits<0x0028, 0x7006, VR::CS, 1, 1> {};
+		struct SystemStatusComment : TagTraits<0x0028, 0x7007, VR::LO, 1, 1> {};
+		struct TargetLuminanceCharacteristicsSequence : TagTraits<0x0028, 0x7008, VR::SQ, 1, 1> {};
+		struct LuminanceCharacteristicsID : TagTraits<0x0028, 0x7009, VR::US, 1, 1> {};
+		struct DisplaySubsystemConfigurationSequence : TagTraits<0x0028, 0x700a, VR::SQ, 1, 1> {};
+		struct ConfigurationID : TagTraits<0x0028, 0x700b, VR::US, 1, 1> {};
+		struct ConfigurationName : TagTraits<0x0028, 0x700c, VR::SH, 1, 1> {};
+		struct ConfigurationDescription : TagTraits<0x0028, 0x700d, VR::LO, 1, 1> {};
+		struct ReferencedTargetLuminanceCharacteristicsID : TagTraits<0x0028, 0x700e, VR::US, 1, 1> {};
+		struct QAResultsSequence : TagTraits<0x0028, 0x700f, VR::SQ, 1, 1> {};
+		struct DisplaySubsystemQAResultsSequence : TagTraits<0x0028, 0x7010, VR::SQ, 1, 1> {};
+		struct ConfigurationQAResultsSequence : TagTraits<0x0028, 0x7011, VR::SQ, 1, 1> {};
+		struct MeasurementEquipmentSequence : TagTraits<0x0028, 0x7012, VR::SQ, 1, 1> {};
+		struct MeasurementFunctions : TagTraits<0x0028, 0x7013, VR::CS, 1, 0> {};
+		struct MeasurementEquipmentType : TagTraits<0x0028, 0x7014, VR::CS, 1, 1> {};
+		struct VisualEvaluationResultSequence : TagTraits<0x0028, 0x7015, VR::SQ, 1, 1> {};
+		struct DisplayCalibrationResultSequence : TagTraits<0x0028, 0x7016, VR::SQ, 1, 1> {};
+		struct DDLValue : TagTraits<0x0028, 0x7017, VR::US, 1, 1> {};
+		struct CIExyWhitePoint : TagTraits<0x0028, 0x7018, VR::FL, 2, 2> {};
+		struct DisplayFunctionType : TagTraits<0x0028, 0x7019, VR::CS, 1, 1> {};
+		struct GammaValue : TagTraits<0x0028, 0x701a, VR::FL, 1, 1> {};
+		struct NumberOfLuminancePoints : TagTraits<0x0028, 0x701b, VR::US, 1, 1> {};
+		struct LuminanceResponseSequence : TagTraits<0x0028, 0x701c, VR::SQ, 1, 1> {};
+		struct TargetMinimumLuminance : TagTraits<0x0028, 0x701d, VR::FL, 1, 1> {};
+		struct TargetMaximumLuminance : TagTraits<0x0028, 0x701e, VR::FL, 1, 1> {};
+		struct LuminanceValue : TagTraits<0x0028, 0x701f, VR::FL, 1, 1> {};
+		struct LuminanceResponseDescription : TagTraits<0x0028, 0x7020, VR::LO, 1, 1> {};
+		struct WhitePointFlag : TagTraits<0x0028, 0x7021, VR::CS, 1, 1> {};
+		struct DisplayDeviceTypeCodeSequence : TagTraits<0x0028, 0x7022, VR::SQ, 1, 1> {};
+		struct DisplaySubsystemSequence : TagTraits<0x0028, 0x7023, VR::SQ, 1, 1> {};
+		struct LuminanceResultSequence : TagTraits<0x0028, 0x7024, VR::SQ, 1, 1> {};
+		struct AmbientLightValueSource : TagTraits<0x0028, 0x7025, VR::CS, 1, 1> {};
+		struct MeasuredCharacteristics : TagTraits<0x0028, 0x7026, VR::CS, 1, 0> {};
+		struct LuminanceUniformityResultSequence : TagTraits<0x0028, 0x7027, VR::SQ, 1, 1> {};
+		struct VisualEvaluationTestSequence : TagTraits<0x0028, 0x7028, VR::SQ, 1, 1> {};
+		struct TestResult : TagTraits<0x0028, 0x7029, VR::CS, 1, 1> {};
+		struct TestResultComment : TagTraits<0x0028, 0x702a, VR::LO, 1, 1> {};
+		struct TestImageValidation : TagTraits<0x0028, 0x702b, VR::CS, 1, 1> {};
+		struct TestPatternCodeSequence : TagTraits<0x0028, 0x702c, VR::SQ, 1, 1> {};
+		struct MeasurementPatternCodeSequence : TagTraits<0x0028, 0x702d, VR::SQ, 1, 1> {};
+		struct VisualEvaluationMethodCodeSequence : TagTraits<0x0028, 0x702e, VR::SQ, 1, 1> {};
+		struct PixelDataProviderURL : TagTraits<0x0028, 0x7fe0, VR::UR, 1, 1> {};
+		struct DataPointRows : TagTraits<0x0028, 0x9001, VR::UL, 1, 1> {};
+		struct DataPointColumns : TagTraits<0x0028, 0x9002, VR::UL, 1, 1> {};
+		struct SignalDomainColumns : TagTraits<0x0028, 0x9003, VR::CS, 1, 1> {};
+		struct LargestMonochromePixelValue : TagTraits<0x0028, 0x9099, VR::US, 1, 1> {};
+		struct DataRepresentation : TagTraits<0x0028, 0x9108, VR::CS, 1, 1> {};
+		struct PixelMeasuresSequence : TagTraits<0x0028, 0x9110, VR::SQ, 1, 1> {};
+		struct FrameVOILUTSequence : TagTraits<0x0028, 0x9132, VR::SQ, 1, 1> {};
+		struct PixelValueTransformationSequence : TagTraits<0x0028, 0x9145, VR::SQ, 1, 1> {};
+		struct SignalDomainRows : TagTraits<0x0028, 0x9235, VR::CS, 1, 1> {};
+		struct DisplayFilterPercentage : TagTraits<0x0028, 0x9411, VR::FL, 1, 1> {};
+		struct FramePixelShiftSequence : TagTraits<0x0028, 0x9415, VR::SQ, 1, 1> {};
+		struct SubtractionItemID : TagTraits<0x0028, 0x9416, VR::US, 1, 1> {};
+		struct PixelIntensityRelationshipLUTSequence : TagTraits<0x0028, 0x9422, VR::SQ, 1, 1> {};
+		struct FramePixelDataPropertiesSequence : TagTraits<0x0028, 0x9443, VR::SQ, 1, 1> {};
+		struct GeometricalProperties : TagTraits<0x0028, 0x9444, VR::CS, 1, 1> {};
+		struct GeometricMaximumDistortion : TagTraits<0x0028, 0x9445, VR::FL, 1, 1> {};
+		struct ImageProcessingApplied : TagTraits<0x0028, 0x9446, VR::CS, 1, 0> {};
+		struct MaskSelectionMode : TagTraits<0x0028, 0x9454, VR::CS, 1, 1> {};
+		struct LUTFunction : TagTraits<0x0028, 0x9474, VR::CS, 1, 1> {};
+		struct MaskVisibilityPercentage : TagTraits<0x0028, 0x9478, VR::FL, 1, 1> {};
+		struct PixelShiftSequence : TagTraits<0x0028, 0x9501, VR::SQ, 1, 1> {};
+		struct RegionPixelShiftSequence : TagTraits<0x0028, 0x9502, VR::SQ, 1, 1> {};
+		struct VerticesOfTheRegion : TagTraits<0x0028, 0x9503, VR::SS, 2, 0> {};
+		struct MultiFramePresentationSequence : TagTraits<0x0028, 0x9505, VR::SQ, 1, 1> {};
+		struct PixelShiftFrameRange : TagTraits<0x0028, 0x9506, VR::US, 2, 0> {};
+		struct LUTFrameRange : TagTraits<0x0028, 0x9507, VR::US, 2, 0> {};
+		struct ImageToEquipmentMappingMatrix : TagTraits<0x0028, 0x9520, VR::DS, 16, 16> {};
+		struct EquipmentCoordinateSystemIdentification : TagTraits<0x0028, 0x9537, VR::CS, 1, 1> {};
+		struct StudyStatusID : TagTraits<0x0032, 0x000a, VR::CS, 1, 1> {};
+		struct StudyPriorityID : TagTraits<0x0032, 0x000c, VR::CS, 1, 1> {};
+		struct StudyIDIssuer : TagTraits<0x0032, 0x0012, VR::LO, 1, 1> {};
+		struct StudyVerifiedDate : TagTraits<0x0032, 0x0032, VR::DA, 1, 1> {};
+		struct StudyVerifiedTime : TagTraits<0x0032, 0x0033, VR::TM, 1, 1> {};
+		struct StudyReadDate : TagTraits<0x0032, 0x0034, VR::DA, 1, 1> {};
+		struct StudyReadTime : TagTraits<0x0032, 0x0035, VR::TM, 1, 1> {};
+		struct ScheduledStudyStartDate : TagTraits<0x0032, 0x1000, VR::DA, 1, 1> {};
+		struct ScheduledStudyStartTime : TagTraits<0x0032, 0x1001, VR::TM, 1, 1> {};
+		struct ScheduledStudyStopDate : TagTraits<0x0032, 0x1010, VR::DA, 1, 1> {};
+		struct ScheduledStudyStopTime : TagTraits<0x0032, 0x1011, VR::TM, 1, 1> {};
+		struct ScheduledStudyLocation : TagTraits<0x0032, 0x1020, VR::LO, 1, 1> {};
+		struct ScheduledStudyLocationAETitle : TagTraits<0x0032, 0x1021, VR::AE, 1, 0> {};
+		struct ReasonForStudy : TagTraits<0x0032, 0x1030, VR::LO, 1, 1> {};
+		struct RequestingPhysicianIdentificationSequence : TagTraits<0x0032, 0x1031, VR::SQ, 1, 1> {};
+		struct RequestingPhysician : TagTraits<0x0032, 0x1032, VR::PN, 1, 1> {};
+		struct RequestingService : TagTraits<0x0032, 0x1033, VR::LO, 1, 1> {};
+		struct RequestingServiceCodeSequence : TagTraits<0x0032, 0x1034, VR::SQ, 1, 1> {};
+		struct StudyArrivalDate : TagTraits<0x0032, 0x1040, VR::DA, 1, 1> {};
+		struct StudyArrivalTime : TagTraits<0x0032, 0x1041, VR::TM, 1, 1> {};
+		struct StudyCompletionDate : TagTraits<0x0032, 0x1050, VR::DA, 1, 1> {};
+		struct StudyCompletionTime : TagTraits<0x0032, 0x1051, VR::TM, 1, 1> {};
+		struct StudyComponentStatusID : TagTraits<0x0032, 0x1055, VR::CS, 1, 1> {};
+		struct RequestedProcedureDescription : TagTraits<0x0032, 0x1060, VR::LO, 1, 1> {};
+		struct RequestedProcedureCodeSequence : TagTraits<0x0032, 0x1064, VR::SQ, 1, 1> {};
+		struct RequestedContrastAgent : TagTraits<0x0032, 0x1070, VR::LO, 1, 1> {};
+		struct StudyComments : TagTraits<0x0032, 0x4000, VR::LT, 1, 1> {};
+		struct ReferencedPatientAliasSequence : TagTraits<0x0038, 0x0004, VR::SQ, 1, 1> {};
+		struct VisitStatusID : TagTraits<0x0038, 0x0008, VR::CS, 1, 1> {};
+		struct AdmissionID : TagTraits<0x0038, 0x0010, VR::LO, 1, 1> {};
+		struct IssuerOfAdmissionID : TagTraits<0x0038, 0x0011, VR::LO, 1, 1> {};
+		struct IssuerOfAdmissionIDSequence : TagTraits<0x0038, 0x0014, VR::SQ, 1, 1> {};
+		struct RouteOfAdmissions : TagTraits<0x0038, 0x0016, VR::LO, 1, 1> {};
+		struct ScheduledAdmissionDate : TagTraits<0x0038, 0x001a, VR::DA, 1, 1> {};
+		struct ScheduledAdmissionTime : TagTraits<0x0038, 0x001b, VR::TM, 1, 1> {};
+		struct ScheduledDischargeDate : TagTraits<0x0038, 0x001c, VR::DA, 1, 1> {};
+		struct ScheduledDischargeTime : TagTraits<0x0038, 0x001d, VR::TM, 1, 1> {};
+		struct ScheduledPatientInstitutionResidence : TagTraits<0x0038, 0x001e, VR::LO, 1, 1> {};
+		struct AdmittingDate : TagTraits<0x0038, 0x0020, VR::DA, 1, 1> {};
+		struct AdmittingTime : TagTraits<0x0038, 0x0021, VR::TM, 1, 1> {};
+		struct DischargeDate : TagTraits<0x0038, 0x0030, VR::DA, 1, 1> {};
+		struct DischargeTime : TagTraits<0x0038, 0x0032, VR::TM, 1, 1> {};
+		struct DischargeDiagnosisDescription : TagTraits<0x0038, 0x0040, VR::LO, 1, 1> {};
+		struct DischargeDiagnosisCodeSequence : TagTraits<0x0038, 0x0044, VR::SQ, 1, 1> {};
+		struct SpecialNeeds : TagTraits<0x0038, 0x0050, VR::LO, 1, 1> {};
+		struct ServiceEpisodeID : TagTraits<0x0038, 0x0060, VR::LO, 1, 1> {};
+		struct IssuerOfServiceEpisodeID : TagTraits<0x0038, 0x0061, VR::LO, 1, 1> {};
+		struct ServiceEpisodeDescription : TagTraits<0x0038, 0x0062, VR::LO, 1, 1> {};
+		struct IssuerOfServiceEpisodeIDSequence : TagTraits<0x0038, 0x0064, VR::SQ, 1, 1> {};
+		struct PertinentDocumentsSequence : TagTraits<0x0038, 0x0100, VR::SQ, 1, 1> {};
+		struct PertinentResourcesSequence : TagTraits<0x0038, 0x0101, VR::SQ, 1, 1> {};
+		struct ResourceDescription : TagTraits<0x0038, 0x0102, VR::LO, 1, 1> {};
+		struct CurrentPatientLocation : TagTraits<0x0038, 0x0300, VR::LO, 1, 1> {};
+		struct PatientInstitutionResidence : TagTraits<0x0038, 0x0400, VR::LO, 1, 1> {};
+		struct PatientState : TagTraits<0x0038, 0x0500, VR::LO, 1, 1> {};
+		struct PatientClinicalTrialParticipationSequence : TagTraits<0x0038, 0x0502, VR::SQ, 1, 1> {};
+		struct VisitComments : TagTraits<0x0038, 0x4000, VR::LT, 1, 1> {};
+		struct WaveformOriginality : TagTraits<0x003a, 0x0004, VR::CS, 1, 1> {};
+		struct NumberOfWaveformChannels : TagTraits<0x003a, 0x0005, VR::US, 1, 1> {};
+		struct NumberOfWaveformSamples : TagTraits<0x003a, 0x0010, VR::UL, 1, 1> {};
+		struct SamplingFrequency : TagTraits<0x003a, 0x001a, VR::DS, 1, 1> {};
+		struct MultiplexGroupLabel : TagTraits<0x003a, 0x0020, VR::SH, 1, 1> {};
+		struct ChannelDefinitionSequence : TagTraits<0x003a, 0x0200, VR::SQ, 1, 1> {};
+		struct WaveformChannelNumber : TagTraits<0x003a, 0x0202, VR::IS, 1, 1> {};
+		struct ChannelLabel : TagTraits<0x003a, 0x0203, VR::SH, 1, 1> {};
+		struct ChannelStatus : TagTraits<0x003a, 0x0205, VR::CS, 1, 0> {};
+		struct ChannelSourceSequence : TagTraits<0x003a, 0x0208, VR::SQ, 1, 1> {};
+		struct ChannelSourceModifiersSequence : TagTraits<0x003a, 0x0209, VR::SQ, 1, 1> {};
+		struct SourceWaveformSequence : TagTraits<0x003a, 0x020a, VR::SQ, 1, 1> {};
+		struct ChannelDerivationDescription : TagTraits<0x003a, 0x020c, VR::LO, 1, 1> {};
+		struct ChannelSensitivity : TagTraits<0x003a, 0x0210, VR::DS, 1, 1> {};
+		struct ChannelSensitivityUnitsSequence : TagTraits<0x003a, 0x0211, VR::SQ, 1, 1> {};
+		struct ChannelSensitivityCorrectionFactor : TagTraits<0x003a, 0x0212, VR::DS, 1, 1> {};
+		struct ChannelBaseline : TagTraits<0x003a, 0x0213, VR::DS, 1, 1> {};
+		struct ChannelTimeSkew : TagTraits<0x003a, 0x0214, VR::DS, 1, 1> {};
+		struct ChannelSampleSkew : TagTraits<0x003a, 0x0215, VR::DS, 1, 1> {};
+		struct ChannelOffset : TagTraits<0x003a, 0x0218, VR::DS, 1, 1> {};
+		struct WaveformBitsStored : TagTraits<0x003a, 0x021a, VR::US, 1, 1> {};
+		struct FilterLowFrequency : TagTraits<0x003a, 0x0220, VR::DS, 1, 1> {};
+		struct FilterHighFrequency : TagTraits<0x003a, 0x0221, VR::DS, 1, 1> {};
+		struct NotchFilterFrequency : TagTraits<0x003a, 0x0222, VR::DS, 1, 1> {};
+		struct NotchFilterBandwidth : TagTraits<0x003a, 0x0223, VR::DS, 1, 1> {};
+		struct WaveformDataDisplayScale : TagTraits<0x003a, 0x0230, VR::FL, 1, 1> {};
+		struct WaveformDisplayBackgroundCIELabValue : TagTraits<0x003a, 0x0231, VR::US, 3, 3> {};
+		struct WaveformPresentationGroupSequence : TagTraits<0x003a, 0x0240, VR::SQ, 1, 1> {};
+		struct PresentationGroupNumber : TagTraits<0x003a, 0x0241, VR::US, 1, 1> {};
+		struct ChannelDisplaySequence : TagTraits<0x003a, 0x0242, VR::SQ, 1, 1> {};
+		struct ChannelRecommendedDisplayCIELabValue : TagTraits<0x003a, 0x0244, VR::US, 3, 3> {};
+		struct ChannelPosition : TagTraits<0x003a, 0x0245, VR::FL, 1, 1> {};
+		struct DisplayShadingFlag : TagTraits<0x003a, 0x0246, VR::CS, 1, 1> {};
+		struct FractionalChannelDisplayScale : TagTraits<0x003a, 0x0247, VR::FL, 1, 1> {};
+		struct AbsoluteChannelDisplayScale : TagTraits<0x003a, 0x0248, VR::FL, 1, 1> {};
+		struct MultiplexedAudioChannelsDescriptionCodeSequence : TagTraits<0x003a, 0x0300, VR::SQ, 1, 1> {};
+		struct ChannelIdentificationCode : TagTraits<0x003a, 0x0301, VR::IS, 1, 1> {};
+		struct ChannelMode : TagTraits<0x003a, 0x0302, VR::CS, 1, 1> {};
+		struct ScheduledStationAETitle : TagTraits<0x0040, 0x0001, VR::AE, 1, 0> {};
+		struct ScheduledProcedureStepStartDate : TagTraits<0x0040, 0x0002, VR::DA, 1, 1> {};
+		struct ScheduledProcedureStepStartTime : TagTraits<0x0040, 0x0003, VR::TM, 1, 1> {};
+		struct ScheduledProcedureStepEndDate : TagTraits<0x0040, 0x0004, VR::DA, 1, 1> {};
+		struct ScheduledProcedureStepEndTime : TagTraits<0x0040, 0x0005, VR::TM, 1, 1> {};
+		struct ScheduledPerformingPhysicianName : TagTraits<0x0040, 0x0006, VR::PN, 1, 1> {};
+		struct ScheduledProcedureStepDescription : TagTraits<0x0040, 0x0007, VR::LO, 1, 1> {};
+		struct ScheduledProtocolCodeSequence : TagTraits<0x0040, 0x0008, VR::SQ, 1, 1> {};
+		struct ScheduledProcedureStepID : TagTraits<0x0040, 0x0009, VR::SH, 1, 1> {};
+		struct StageCodeSequence : TagTraits<0x0040, 0x000a, VR::SQ, 1, 1> {};
+		struct ScheduledPerformingPhysicianIdentificationSequence : TagTraits<0x0040, 0x000b, VR::SQ, 1, 1> {};
+		struct ScheduledStationName : TagTraits<0x0040, 0x0010, VR::SH, 1, 0> {};
+		struct ScheduledProcedureStepLocation : TagTraits<0x0040, 0x0011, VR::SH, 1, 1> {};
+		struct PreMedication : TagTraits<0x0040, 0x0012, VR::LO, 1, 1> {};
+		struct ScheduledProcedureStepStatus : TagTraits<0x0040, 0x0020, VR::CS, 1, 1> {};
+		struct OrderPlacerIdentifierSequence : TagTraits<0x0040, 0x0026, VR::SQ, 1, 1> {};
+		struct OrderFillerIdentifierSequence : TagTraits<0x0040, 0x0027, VR::SQ, 1, 1> {};
+		struct LocalNamespaceEntityID : TagTraits<0x0040, 0x0031, VR::UT, 1, 1> {};
+		struct UniversalEntityID : TagTraits<0x0040, 0x0032, VR::UT, 1, 1> {};
+		struct UniversalEntityIDType : TagTraits<0x0040, 0x0033, VR::CS, 1, 1> {};
+		struct IdentifierTypeCode : TagTraits<0x0040, 0x0035, VR::CS, 1, 1> {};
+		struct AssigningFacilitySequence : TagTraits<0x0040, 0x0036, VR::SQ, 1, 1> {};
+		struct AssigningJurisdictionCodeSequence : TagTraits<0x0040, 0x0039, VR::SQ, 1, 1> {};
+		struct AssigningAgencyOrDepartmentCodeSequence : TagTraits<0x0040, 0x003a, VR::SQ, 1, 1> {};
+		struct ScheduledProcedureStepSequence : TagTraits<0x0040, 0x0100, VR::SQ, 1, 1> {};
+		struct ReferencedNonImageCompositeSOPInstanceSequence : TagTraits<0x0040, 0x0220, VR::SQ, 1, 1> {};
+		struct PerformedStationAETitle : TagTraits<0x0040, 0x0241, VR::AE, 1, 1> {};
+		struct PerformedStationName : TagTraits<0x0040, 0x0242, VR::SH, 1, 1> {};
+		struct PerformedLocation : TagTraits<0x0040, 0x0243, VR::SH, 1, 1> {};
+		struct PerformedProcedureStepStartDate : TagTraits<0x0040, 0x0244, VR::DA, 1, 1> {};
+		struct PerformedProcedureStepStartTime : TagTraits<0x0040, 0x0245, VR::TM, 1, 1> {};
+		struct PerformedProcedureStepEndDate : TagTraits<0x0040, 0x0250, VR::DA, 1, 1> {};
+		struct PerformedProcedureStepEndTime : TagTraits<0x0040, 0x0251, VR::TM, 1, 1> {};
+		struct PerformedProcedureStepStatus : TagTraits<0x0040, 0x0252, VR::CS, 1, 1> {};
+		struct PerformedProcedureStepID : TagTraits<0x0040, 0x0253, VR::SH, 1, 1> {};
+		struct PerformedProcedureStepDescription : TagTraits<0x0040, 0x0254, VR::LO, 1, 1> {};
+		struct PerformedProcedureTypeDescription : TagTraits<0x0040, 0x0255, VR::LO, 1, 1> {};
+		struct PerformedProtocolCodeSequence : TagTraits<0x0040, 0x0260, VR::SQ, 1, 1> {};
+		struct PerformedProtocolType : TagTraits<0x0040, 0x0261, VR::CS, 1, 1> {};
+		struct ScheduledStepAttributesSequence : TagTraits<0x0040, 0x0270, VR::SQ, 1, 1> {};
+		struct RequestAttributesSequence : TagTraits<0x0040, 0x0275, VR::SQ, 1, 1> {};
+		struct CommentsOnThePerformedProcedureStep : TagTraits<0x0040, 0x0280, VR::ST, 1, 1> {};
+		struct PerformedProcedureStepDiscontinuationReasonCodeSequence : TagTraits<0x0040, 0x0281, VR::SQ, 1, 1> {};
+		struct QuantitySequence : TagTraits<0x0040, 0x0293, VR::SQ, 1, 1> {};
+		struct Quantity : TagTraits<0x0040, 0x0294, VR::DS, 1, 1> {};
+		struct MeasuringUnitsSequence : TagTraits<0x0040, 0x0295, VR::SQ, 1, 1> {};
+		struct BillingItemSequence : TagTraits<0x0040, 0x0296, VR::SQ, 1, 1> {};
+		struct TotalTimeOfFluoroscopy : TagTraits<0x0040, 0x0300, VR::US, 1, 1> {};
+		struct TotalNumberOfExposures : TagTraits<0x0040, 0x0301, VR::US, 1, 1> {};
+		struct EntranceDose : TagTraits<0x0040, 0x0302, VR::US, 1, 1> {};
+		struct ExposedArea : TagTraits<0x0040, 0x0303, VR::US, 1, 2> {};
+		struct DistanceSourceToEntrance : TagTraits<0x0040, 0x0306, VR::DS, 1, 1> {};
+		struct DistanceSourceToSupport : TagTraits<0x0040, 0x0307, VR::DS, 1, 1> {};
+		struct ExposureDoseSequence : TagTraits<0x0040, 0x030e, VR::SQ, 1, 1> {};
+		struct CommentsOnRadiationDose : TagTraits<0x0040, 0x0310, VR::ST, 1, 1> {};
+		struct XRayOutput : TagTraits<0x0040, 0x0312, VR::DS, 1, 1> {};
+		struct HalfValueLayer : TagTraits<0x0040, 0x0314, VR::DS, 1, 1> {};
+		struct OrganDose : TagTraits<0x0040, 0x0316, VR::DS, 1, 1> {};
+		struct OrganExposed : TagTraits<0x0040, 0x0318, VR::CS, 1, 1> {};
+		struct BillingProcedureStepSequence : TagTraits<0x0040, 0x0320, VR::SQ, 1, 1> {};
+		struct FilmConsumptionSequence : TagTraits<0x0040, 0x0321, VR::SQ, 1, 1> {};
+		struct BillingSuppliesAndDevicesSequence : TagTraits<0x0040, 0x0324, VR::SQ, 1, 1> {};
+		struct ReferencedProcedureStepSequence : TagTraits<0x0040, 0x0330, VR::SQ, 1, 1> {};
+		struct PerformedSeriesSequence : TagTraits<0x0040, 0x0340, VR::SQ, 1, 1> {};
+		struct CommentsOnTheScheduledProcedureStep : TagTraits<0x0040, 0x0400, VR::LT, 1, 1> {};
+		struct ProtocolContextSequence : TagTraits<0x0040, 0x0440, VR::SQ, 1, 1> {};
+		struct ContentItemModifierSequence : TagTraits<0x0040, 0x0441, VR::SQ, 1, 1> {};
+		struct ScheduledSpecimenSequence : TagTraits<0x0040, 0x0500, VR::SQ, 1, 1> {};
+		struct SpecimenAccessionNumber : TagTraits<0x0040, 0x050a, VR::LO, 1, 1> {};
+		struct ContainerIdentifier : TagTraits<0x0040, 0x0512, VR::LO, 1, 1> {};
+		struct IssuerOfTheContainerIdentifierSequence : TagTraits<0x0040, 0x0513, VR::SQ, 1, 1> {};
+		struct AlternateContainerIdentifierSequence : TagTraits<0x0040, 0x0515, VR::SQ, 1, 1> {};
+		struct ContainerTypeCodeSequence : TagTraits<0x0040, 0x0518, VR::SQ, 1, 1> {};
+		struct ContainerDescription : TagTraits<0x0040, 0x051a, VR::LO, 1, 1> {};
+		struct ContainerComponentSequence : TagTraits<0x0040, 0x0520, VR::SQ, 1, 1> {};
+		struct SpecimenSequence : TagTraits<0x0040, 0x0550, VR::SQ, 1, 1> {};
+		struct SpecimenIdentifier : TagTraits<0x0040, 0x0551, VR::LO, 1, 1> {};
+		struct SpecimenDescriptionSequenceTrial : TagTraits<0x0040, 0x0552, VR::SQ, 1, 1> {};
+		struct SpecimenDescriptionTrial : TagTraits<0x0040, 0x0553, VR::ST, 1, 1> {};
+		struct SpecimenUID : TagTraits<0x0040, 0x0554, VR::UI, 1, 1> {};
+		struct AcquisitionContextSequence : TagTraits<0x0040, 0x0555, VR::SQ, 1, 1> {};
+		struct AcquisitionContextDescription : TagTraits<0x0040, 0x0556, VR::ST, 1, 1> {};
+		struct SpecimenTypeCodeSequence : TagTraits<0x0040, 0x059a, VR::SQ, 1, 1> {};
+		struct SpecimenDescriptionSequence : TagTraits<0x0040, 0x0560, VR::SQ, 1, 1> {};
+		struct IssuerOfTheSpecimenIdentifierSequence : TagTraits<0x0040, 0x0562, VR::SQ, 1, 1> {};
+		struct SpecimenShortDescription : TagTraits<0x0040, 0x0600, VR::LO, 1, 1> {};
+		struct SpecimenDetailedDescription : TagTraits<0x0040, 0x0602, VR::UT, 1, 1> {};
+		struct SpecimenPreparationSequence : TagTraits<0x0040, 0x0610, VR::SQ, 1, 1> {};
+		struct SpecimenPreparationStepContentItemSequence : TagTraits<0x0040, 0x0612, VR::SQ, 1, 1> {};
+		struct SpecimenLocalizationContentItemSequence : TagTraits<0x0040, 0x0620, VR::SQ, 1, 1> {};
+		struct SlideIdentifier : TagTraits<0x0040, 0x06fa, VR::LO, 1, 1> {};
+		struct ImageCenterPointCoordinatesSequence : TagTraits<0x0040, 0x071a, VR::SQ, 1, 1> {};
+		struct XOffsetInSlideCoordinateSystem : TagTraits<0x0040, 0x072a, VR::DS, 1, 1> {};
+		struct YOffsetInSlideCoordinateSystem : TagTraits<0x0040, 0x073a, VR::DS, 1, 1> {};
+		struct ZOffsetInSlideCoordinateSystem : TagTraits<0x0040, 0x074a, VR::DS, 1, 1> {};
+		struct PixelSpacingSequence : TagTraits<0x0040, 0x08d8, VR::SQ, 1, 1> {};
+		struct CoordinateSystemAxisCodeSequence : TagTraits<0x0040, 0x08da, VR::SQ, 1, 1> {};
+		struct MeasurementUnitsCodeSequence : TagTraits<0x0040, 0x08ea, VR::SQ, 1, 1> {};
+		struct VitalStainCodeSequenceTrial : TagTraits<0x0040, 0x09f8, VR::SQ, 1, 1> {};
+		struct RequestedProcedureID : TagTraits<0x0040, 0x1001, VR::SH, 1, 1> {};
+		struct ReasonForTheRequestedProcedure : TagTraits<0x0040, 0x1002, VR::LO, 1, 1> {};
+		struct RequestedProcedurePriority : TagTraits<0x0040, 0x1003, VR::SH, 1, 1> {};
+		struct PatientTransportArrangements : TagTraits<0x0040, 0x1004, VR::LO, 1, 1> {};
+		struct RequestedProcedureLocation : TagTraits<0x0040, 0x1005, VR::LO, 1, 1> {};
+		struct PlacerOrderNumberProcedure : TagTraits<0x0040, 0x1006, VR::SH, 1, 1> {};
+		struct FillerOrderNumberProcedure : TagTraits<0x0040, 0x1007, VR::SH, 1, 1> {};
+		struct ConfidentialityCode : TagTraits<0x0040, 0x1008, VR::LO, 1, 1> {};
+		struct ReportingPriority : TagTraits<0x0040, 0x1009, VR::SH, 1, 1> {};
+		struct ReasonForRequestedProcedureCodeSequence : TagTraits<0x0040, 0x100a, VR::SQ, 1, 1> {};
+		struct NamesOfIntendedRecipientsOfResults : TagTraits<0x0040, 0x1010, VR::PN, 1, 0> {};
+		struct IntendedRecipientsOfResultsIdentificationSequence : TagTraits<0x0040, 0x1011, VR::SQ, 1, 1> {};
+		struct ReasonForPerformedProcedureCodeSequence : TagTraits<0x0040, 0x1012, VR::SQ, 1, 1> {};
+		struct RequestedProcedureDescriptionTrial : TagTraits<0x0040, 0x1060, VR::LO, 1, 1> {};
+		struct PersonIdentificationCodeSequence : TagTraits<0x0040, 0x1101, VR::SQ, 1, 1> {};
+		struct PersonAddress : TagTraits<0x0040, 0x1102, VR::ST, 1, 1> {};
+		struct PersonTelephoneNumbers : TagTraits<0x0040, 0x1103, VR::LO, 1, 0> {};
+		struct PersonTelecomInformation : TagTraits<0x0040, 0x1104, VR::LT, 1, 1> {};
+		struct RequestedProcedureComments : TagTraits<0x0040, 0x1400, VR::LT, 1, 1> {};
+		struct ReasonForTheImagingServiceRequest : TagTraits<0x0040, 0x2001, VR::LO, 1, 1> {};
+		struct IssueDateOfImagingServiceRequest : TagTraits<0x0040, 0x2004, VR::DA, 1, 1> {};
+		struct IssueTimeOfImagingServiceRequest : TagTraits<0x0040, 0x2005, VR::TM, 1, 1> {};
+		struct PlacerOrderNumberImagingServiceRequestRetired : TagTraits<0x0040, 0x2006, VR::SH, 1, 1> {};
+		struct FillerOrderNumberImagingServiceRequestRetired : TagTraits<0x0040, 0x2007, VR::SH, 1, 1> {};
+		struct OrderEnteredBy : TagTraits<0x0040, 0x2008, VR::PN, 1, 1> {};
+		struct OrderEntererLocation : TagTraits<0x0040, 0x2009, VR::SH, 1, 1> {};
+		struct OrderCallbackPhoneNumber : TagTraits<0x0040, 0x2010, VR::SH, 1, 1> {};
+		struct OrderCallbackTelecomInformation : TagTraits<0x0040, 0x2011, VR::LT, 1, 1> {};
+		struct PlacerOrderNumberImagingServiceRequest : TagTraits<0x0040, 0x2016, VR::LO, 1, 1> {};
+		struct FillerOrderNumberImagingServiceRequest : TagTraits<0x0040, 0x2017, VR::LO, 1, 1> {};
+		struct ImagingServiceRequestComments : TagTraits<0x0040, 0x2400, VR::LT, 1, 1> {};
+		struct ConfidentialityConstraintOnPatientDataDescription : TagTraits<0x0040, 0x3001, VR::LO, 1, 1> {};
+		struct GeneralPurposeScheduledProcedureStepStatus : TagTraits<0x0040, 0x4001, VR::CS, 1, 1> {};
+		struct GeneralPurposePerformedProcedureStepStatus : TagTraits<0x0040, 0x4002, VR::CS, 1, 1> {};
+		struct GeneralPurposeScheduledProcedureStepPriority : TagTraits<0x0040, 0x4003, VR::CS, 1, 1> {};
+		struct ScheduledProcessingApplicationsCodeSequence : TagTraits<0x0040, 0x4004, VR::SQ, 1, 1> {};
+		struct ScheduledProcedureStepStartDateTime : TagTraits<0x0040, 0x4005, VR::DT, 1, 1> {};
+		struct MultipleCopiesFlag : TagTraits<0x0040, 0x4006, VR::CS, 1, 1> {};
+		struct PerformedProcessingApplicationsCodeSequence : TagTraits<0x0040, 0x4007, VR::SQ, 1, 1> {};
+		struct HumanPerformerCodeSequence : TagTraits<0x0040, 0x4009, VR::SQ, 1, 1> {};
+		struct ScheduledProcedureStepModificationDateTime : TagTraits<0x0040, 0x4010, VR::DT, 1, 1> {};
+		struct ExpectedCompletionDateTime : TagTraits<0x0040, 0x4011, VR::DT, 1, 1> {};
+		struct ResultingGeneralPurposePerformedProcedureStepsSequence : TagTraits<0x0040, 0x4015, VR::SQ, 1, 1> {};
+		struct ReferencedGeneralPurposeScheduledProcedureStepSequence : TagTraits<0x0040, 0x4016, VR::SQ, 1, 1> {};
+		struct ScheduledWorkitemCodeSequence : TagTraits<0x0040, 0x4018, VR::SQ, 1, 1> {};
+		struct PerformedWorkitemCodeSequence : TagTraits<0x0040, 0x4019, VR::SQ, 1, 1> {};
+		struct InputAvailabilityFlag : TagTraits<0x0040, 0x4020, VR::CS, 1, 1> {};
+		struct InputInformationSequence : TagTraits<0x0040, 0x4021, VR::SQ, 1, 1> {};
+		struct RelevantInformationSequence : TagTraits<0x0040, 0x4022, VR::SQ, 1, 1> {};
+		struct ReferencedGeneralPurposeScheduledProcedureStepTransactionUID : TagTraits<0x0040, 0x4023, VR::UI, 1, 1> {};
+		struct ScheduledStationNameCodeSequence : TagTraits<0x0040, 0x4025, VR::SQ, 1, 1> {};
+		struct ScheduledStationClassCodeSequence : TagTraits<0x0040, 0x4026, VR::SQ, 1, 1> {};
+		struct ScheduledStationGeographicLocationCodeSequence : TagTraits<0x0040, 0x4027, VR::SQ, 1, 1> {};
+		struct PerformedStationNameCodeSequence : TagTraits<0x0040, 0x4028, VR::SQ, 1, 1> {};
+		struct PerformedStationClassCodeSequence : TagTraits<0x0040, 0x4029, VR::SQ, 1, 1> {};
+		struct PerformedStationGeographicLocationCodeSequence : TagTraits<0x0040, 0x4030, VR::SQ, 1, 1> {};
+		struct RequestedSubsequentWorkitemCodeSequence : TagTraits<0x0040, 0x4031, VR::SQ, 1, 1> {};
+		struct NonDICOMOutputCodeSequence : TagTraits<0x0040, 0x4032, VR::SQ, 1, 1> {};
+		struct OutputInformationSequence : TagTraits<0x0040, 0x4033, VR::SQ, 1, 1> {};
+		struct ScheduledHumanPerformersSequence : TagTraits<0x0040, 0x4034, VR::SQ, 1, 1> {};
+		struct ActualHumanPerformersSequence : TagTraits<0x0040, 0x4035, VR::SQ, 1, 1> {};
+		struct HumanPerformerOrganization : TagTraits<0x0040, 0x4036, VR::LO, 1, 1> {};
+		struct HumanPerformerName : TagTraits<0x0040, 0x4037, VR::PN, 1, 1> {};
+		struct RawDataHandling : TagTraits<0x0040, 0x4040, VR::CS, 1, 1> {};
+		struct InputReadinessState : TagTraits<0x0040, 0x4041, VR::CS, 1, 1> {};
+		struct PerformedProcedureStepStartDateTime : TagTraits<0x0040, 0x4050, VR::DT, 1, 1> {};
+		struct PerformedProcedureStepEndDateTime : TagTraits<0x0040, 0x4051, VR::DT, 1, 1> {};
+		struct ProcedureStepCancellationDateTime : TagTraits<0x0040, 0x4052, VR::DT, 1, 1> {};
+		struct OutputDestinationSequence : TagTraits<0x0040, 0x4070, VR::SQ, 1, 1> {};
+		struct DICOMStorageSequence : TagTraits<0x0040, 0x4071, VR::SQ, 1, 1> {};
+		struct STOWRSStorageSequence : TagTraits<0x0040, 0x4072, VR::SQ, 1, 1> {};
+		struct StorageURL : TagTraits<0x0040, 0x4073, VR::UR, 1, 1> {};
+		struct XDSStorageSequence : TagTraits<0x0040, 0x4074, VR::SQ, 1, 1> {};
+		struct EntranceDoseInmGy : TagTraits<0x0040, 0x8302, VR::DS, 1, 1> {};
+		struct EntranceDoseDerivation : TagTraits<0x0040, 0x8303, VR::CS, 1, 1> {};
+		struct ParametricMapFrameTypeSequence : TagTraits<0x0040, 0x9092, VR::SQ, 1, 1> {};
+		struct ReferencedImageRealWorldValueMappingSequence : TagTraits<0x0040, 0x9094, VR::SQ, 1, 1> {};
+		struct RealWorldValueMappingSequence : TagTraits<0x0040, 0x9096, VR::SQ, 1, 1> {};
+		struct PixelValueMappingCodeSequence : TagTraits<0x0040, 0x9098, VR::SQ, 1, 1> {};
+		struct LUTLabel : TagTraits<0x0040, 0x9210, VR::SH, 1, 1> {};
+		struct RealWorldValueLUTData : TagTraits<0x0040, 0x9212, VR::FD, 1, 0> {};
+		struct DoubleFloatRealWorldValueLastValueMapped : TagTraits<0x0040, 0x9213, VR::FD, 1, 1> {};
+		struct DoubleFloatRealWorldValueFirstValueMapped : TagTraits<0x0040, 0x9214, VR::FD, 1, 1> {};
+		struct QuantityDefinitionSequence : TagTraits<0x0040, 0x9220, VR::SQ, 1, 1> {};
+		struct RealWorldValueIntercept : TagTraits<0x0040, 0x9224, VR::FD, 1, 1> {};
+		struct RealWorldValueSlope : TagTraits<0x0040, 0x9225, VR::FD, 1, 1> {};
+		struct FindingsFlagTrial : TagTraits<0x0040, 0xa007, VR::CS, 1, 1> {};
+		struct RelationshipType : TagTraits<0x0040, 0xa010, VR::CS, 1, 1> {};
+		struct FindingsSequenceTrial : TagTraits<0x0040, 0xa020, VR::SQ, 1, 1> {};
+		struct FindingsGroupUIDTrial : TagTraits<0x0040, 0xa021, VR::UI, 1, 1> {};
+		struct ReferencedFindingsGroupUIDTrial : TagTraits<0x0040, 0xa022, VR::UI, 1, 1> {};
+		struct FindingsGroupRecordingDateTrial : TagTraits<0x0040, 0xa023, VR::DA, 1, 1> {};
+		struct FindingsGroupRecordingTimeTrial : TagTraits<0x0040, 0xa024, VR::TM, 1, 1> {};
+		struct FindingsSourceCategoryCodeSequenceTrial : TagTraits<0x0040, 0xa026, VR::SQ, 1, 1> {};
+		struct VerifyingOrganization : TagTraits<0x0040, 0xa027, VR::LO, 1, 1> {};
+		struct DocumentingOrganizationIdentifierCodeSequenceTrial : TagTraits<0x0040, 0xa028, VR::SQ, 1, 1> {};
+		struct VerificationDateTime : TagTraits<0x0040, 0xa030, VR::DT, 1, 1> {};
+		struct ObservationDateTime : TagTraits<0x0040, 0xa032, VR::DT, 1, 1> {};
+		struct ValueType : TagTraits<0x0040, 0xa040, VR::CS, 1, 1> {};
+		struct ConceptNameCodeSequence : TagTraits<0x0040, 0xa043, VR::SQ, 1, 1> {};
+		struct MeasurementPrecisionDescriptionTrial : TagTraits<0x0040, 0xa047, VR::LO, 1, 1> {};
+		struct ContinuityOfContent : TagTraits<0x0040, 0xa050, VR::CS, 1, 1> {};
+		struct UrgencyOrPriorityAlertsTrial : TagTraits<0x0040, 0xa057, VR::CS, 1, 0> {};
+		struct SequencingIndicatorTrial : TagTraits<0x0040, 0xa060, VR::LO, 1, 1> {};
+		struct DocumentIdentifierCodeSequenceTrial : TagTraits<0x0040, 0xa066, VR::SQ, 1, 1> {};
+		struct DocumentAuthorTrial : TagTraits<0x0040, 0xa067, VR::PN, 1, 1> {};
+		struct DocumentAuthorIdentifierCodeSequenceTrial : TagTraits<0x0040, 0xa068, VR::SQ, 1, 1> {};
+		struct IdentifierCodeSequenceTrial : TagTraits<0x0040, 0xa070, VR::SQ, 1, 1> {};
+		struct VerifyingObserverSequence : TagTraits<0x0040, 0xa073, VR::SQ, 1, 1> {};
+		struct ObjectBinaryIdentifierTrial : TagTraits<0x0040, 0xa074, VR::OB, 1, 1> {};
+		struct VerifyingObserverName : TagTraits<0x0040, 0xa075, VR::PN, 1, 1> {};
+		struct DocumentingObserverIdentifierCodeSequenceTrial : TagTraits<0x0040, 0xa076, VR::SQ, 1, 1> {};
+		struct AuthorObserverSequence : TagTraits<0x0040, 0xa078, VR::SQ, 1, 1> {};
+		struct ParticipantSequence : TagTraits<0x0040, 0xa07a, VR::SQ, 1, 1> {};
+		struct CustodialOrganizationSequence : TagTraits<0x0040, 0xa07c, VR::SQ, 1, 1> {};
+		struct ParticipationType : TagTraits<0x0040, 0xa080, VR::CS, 1, 1> {};
+		struct ParticipationDateTime : TagTraits<0x0040, 0xa082, VR::DT, 1, 1> {};
+		struct ObserverType : TagTraits<0x0040, 0xa084, VR::CS, 1, 1> {};
+		struct ProcedureIdentifierCodeSequenceTrial : TagTraits<0x0040, 0xa085, VR::SQ, 1, 1> {};
+		struct VerifyingObserverIdentificationCodeSequence : TagTraits<0x0040, 0xa088, VR::SQ, 1, 1> {};
+		struct ObjectDirectoryBinaryIdentifierTrial : TagTraits<0x0040, 0xa089, VR::OB, 1, 1> {};
+		struct EquivalentCDADocumentSequence : TagTraits<0x0040, 0xa090, VR::SQ, 1, 1> {};
+		struct ReferencedWaveformChannels : TagTraits<0x0040, 0xa0b0, VR::US, 2, 0> {};
+		struct DateOfDocumentOrVerbalTransactionTrial : TagTraits<0x0040, 0xa110, VR::DA, 1, 1> {};
+		struct TimeOfDocumentCreationOrVerbalTransactionTrial : TagTraits<0x0040, 0xa112, VR::TM, 1, 1> {};
+		struct DateTime : TagTraits<0x0040, 0xa120, VR::DT, 1, 1> {};
+		struct Date : TagTraits<0x0040, 0xa121, VR::DA, 1, 1> {};
+		struct Time : TagTraits<0x0040, 0xa122, VR::TM, 1, 1> {};
+		struct PersonName : TagTraits<0x0040, 0xa123, VR::PN, 1, 1> {};
+		struct UID : TagTraits<0x0040, 0xa124, VR::UI, 1, 1> {};
+		struct ReportStatusIDTrial : TagTraits<0x0040, 0xa125, VR::CS, 2, 2> {};
+		struct TemporalRangeType : TagTraits<0x0040, 0xa130, VR::CS, 1, 1> {};
+		struct ReferencedSamplePositions : TagTraits<0x0040, 0xa132, VR::UL, 1, 0> {};
+		struct ReferencedFrameNumbers : TagTraits<0x0040, 0xa136, VR::US, 1, 0> {};
+		struct ReferencedTimeOffsets : TagTraits<0x0040, 0xa138, VR::DS, 1, 0> {};
+		struct ReferencedDateTime : TagTraits<0x0040, 0xa13a, VR::DT, 1, 0> {};
+		struct TextValue : TagTraits<0x0040, 0xa160, VR::UT, 1, 1> {};
+		struct FloatingPointValue : TagTraits<0x0040, 0xa161, VR::FD, 1, 0> {};
+		struct RationalNumeratorValue : TagTraits<0x0040, 0xa162, VR::SL, 1, 0> {};
+		struct RationalDenominatorValue : TagTraits<0x0040, 0xa163, VR::UL, 1, 0> {};
+		struct ObservationCategoryCodeSequenceTrial : TagTraits<0x0040, 0xa167, VR::SQ, 1, 1> {};
+		struct ConceptCodeSequence : TagTraits<0x0040, 0xa168, VR::SQ, 1, 1> {};
+		struct BibliographicCitationTrial : TagTraits<0x0040, 0xa16a, VR::ST, 1, 1> {};
+		struct PurposeOfReferenceCodeSequence : TagTraits<0x0040, 0xa170, VR::SQ, 1, 1> {};
+		struct ObservationUID : TagTraits<0x0040, 0xa171, VR::UI, 1, 1> {};
+		struct ReferencedObservationUIDTrial : TagTraits<0x0040, 0xa172, VR::UI, 1, 1> {};
+		struct ReferencedObservationClassTrial : TagTraits<0x0040, 0xa173, VR::CS, 1, 1> {};
+		struct ReferencedObjectObservationClassTrial : TagTraits<0x0040, 0xa174, VR::CS, 1, 1> {};
+		struct AnnotationGroupNumber : TagTraits<0x0040, 0xa180, VR::US, 1, 1> {};
+		struct ObservationDateTrial : TagTraits<0x0040, 0xa192, VR::DA, 1, 1> {};
+		struct ObservationTimeTrial : TagTraits<0x0040, 0xa193, VR::TM, 1, 1> {};
+		struct MeasurementAutomationTrial : TagTraits<0x0040, 0xa194, VR::CS, 1, 1> {};
+		struct ModifierCodeSequence : TagTraits<0x0040, 0xa195, VR::SQ, 1, 1> {};
+		struct IdentificationDescriptionTrial : TagTraits<0x0040, 0xa224, VR::ST, 1, 1> {};
+		struct CoordinatesSetGeometricTypeTrial : TagTraits<0x0040, 0xa290, VR::CS, 1, 1> {};
+		struct AlgorithmCodeSequenceTrial : TagTraits<0x0040, 0xa296, VR::SQ, 1, 1> {};
+		struct AlgorithmDescriptionTrial : TagTraits<0x0040, 0xa297, VR::ST, 1, 1> {};
+		struct PixelCoordinatesSetTrial : TagTraits<0x0040, 0xa29a, VR::SL, 2, 0> {};
+		struct MeasuredValueSequence : TagTraits<0x0040, 0xa300, VR::SQ, 1, 1> {};
+		struct NumericValueQualifierCodeSequence : TagTraits<0x0040, 0xa301, VR::SQ, 1, 1> {};
+		struct CurrentObserverTrial : TagTraits<0x0040, 0xa307, VR::PN, 1, 1> {};
+		struct NumericValue : TagTraits<0x0040, 0xa30a, VR::DS, 1, 0> {};
+		struct ReferencedAccessionSequenceTrial : TagTraits<0x0040, 0xa313, VR::SQ, 1, 1> {};
+		struct ReportStatusCommentTrial : TagTraits<0x0040, 0xa33a, VR::ST, 1, 1> {};
+		struct ProcedureContextSequenceTrial : TagTraits<0x0040, 0xa340, VR::SQ, 1, 1> {};
+		struct VerbalSourceTrial : TagTraits<0x0040, 0xa352, VR::PN, 1, 1> {};
+		struct AddressTrial : TagTraits<0x0040, 0xa353, VR::ST, 1, 1> {};
+		struct TelephoneNumberTrial : TagTraits<0x0040, 0xa354, VR::LO, 1, 1> {};
+		struct VerbalSourceIdentifierCodeSequenceTrial : TagTraits<0x0040, 0xa358, VR::SQ, 1, 1> {};
+		struct PredecessorDocumentsSequence : TagTraits<0x0040, 0xa360, VR::SQ, 1, 1> {};
+		struct ReferencedRequestSequence : TagTraits<0x0040, 0xa370, VR::SQ, 1, 1> {};
+		struct PerformedProcedureCodeSequence : TagTraits<0x0040, 0xa372, VR::SQ, 1, 1> {};
+		struct CurrentRequestedProcedureEvidenceSequence : TagTraits<0x0040, 0xa375, VR::SQ, 1, 1> {};
+		struct ReportDetailSequenceTrial : TagTraits<0x0040, 0xa380, VR::SQ, 1, 1> {};
+		struct PertinentOtherEvidenceSequence : TagTraits<0x0040, 0xa385, VR::SQ, 1, 1> {};
+		struct HL7StructuredDocumentReferenceSequence : TagTraits<0x0040, 0xa390, VR::SQ, 1, 1> {};
+		struct ObservationSubjectUIDTrial : TagTraits<0x0040, 0xa402, VR::UI, 1, 1> {};
+		struct ObservationSubjectClassTrial : TagTraits<0x0040, 0xa403, VR::CS, 1, 1> {};
+		struct ObservationSubjectTypeCodeSequenceTrial : TagTraits<0x0040, 0xa404, VR::SQ, 1, 1> {};
+		struct CompletionFlag : TagTraits<0x0040, 0xa491, VR::CS, 1, 1> {};
+		struct CompletionFlagDescription : TagTraits<0x0040, 0xa492, VR::LO, 1, 1> {};
+		struct VerificationFlag : TagTraits<0x0040, 0xa493, VR::CS, 1, 1> {};
+		struct ArchiveRequested : TagTraits<0x0040, 0xa494, VR::CS, 1, 1> {};
+		struct PreliminaryFlag : TagTraits<0x0040, 0xa496, VR::CS, 1, 1> {};
+		struct ContentTemplateSequence : TagTraits<0x0040, 0xa504, VR::SQ, 1, 1> {};
+		struct IdenticalDocumentsSequence : TagTraits<0x0040, 0xa525, VR::SQ, 1, 1> {};
+		struct ObservationSubjectContextFlagTrial : TagTraits<0x0040, 0xa600, VR::CS, 1, 1> {};
+		struct ObserverContextFlagTrial : TagTraits<0x0040, 0xa601, VR::CS, 1, 1> {};
+		struct ProcedureContextFlagTrial : TagTraits<0x0040, 0xa603, VR::CS, 1, 1> {};
+		struct ContentSequence : TagTraits<0x0040, 0xa730, VR::SQ, 1, 1> {};
+		struct RelationshipSequenceTrial : TagTraits<0x0040, 0xa731, VR::SQ, 1, 1> {};
+		struct RelationshipTypeCodeSequenceTrial : TagTraits<0x0040, 0xa732, VR::SQ, 1, 1> {};
+		struct LanguageCodeSequenceTrial : TagTraits<0x0040, 0xa744, VR::SQ, 1, 1> {};
+		struct UniformResourceLocatorTrial : TagTraits<0x0040, 0xa992, VR::ST, 1, 1> {};
+		struct WaveformAnnotationSequence : TagTraits<0x0040, 0xb020, VR::SQ, 1, 1> {};
+		struct TemplateIdentifier : TagTraits<0x0040, 0xdb00, VR::CS, 1, 1> {};
+		struct TemplateVersion : TagTraits<0x0040, 0xdb06, VR::DT, 1, 1> {};
+		struct TemplateLocalVersion : TagTraits<0x0040, 0xdb07, VR::DT, 1, 1> {};
+		struct TemplateExtensionFlag : TagTraits<0x0040, 0xdb0b, VR::CS, 1, 1> {};
+		struct TemplateExtensionOrganizationUID : TagTraits<0x0040, 0xdb0c, VR::UI, 1, 1> {};
+		struct TemplateExtensionCreatorUID : TagTraits<0x0040, 0xdb0d, VR::UI, 1, 1> {};
+		struct ReferencedContentItemIdentifier : TagTraits<0x0040, 0xdb73, VR::UL, 1, 0> {};
+		struct HL7InstanceIdentifier : TagTraits<0x0040, 0xe001, VR::ST, 1, 1> {};
+		struct HL7DocumentEffectiveTime : TagTraits<0x0040, 0xe004, VR::DT, 1, 1> {};
+		struct HL7DocumentTypeCodeSequence : TagTraits<0x0040, 0xe006, VR::SQ, 1, 1> {};
+		struct DocumentClassCodeSequence : TagTraits<0x0040, 0xe008, VR::SQ, 1, 1> {};
+		struct RetrieveURI : TagTraits<0x0040, 0xe010, VR::UR, 1, 1> {};
+		struct RetrieveLocationUID : TagTraits<0x0040, 0xe011, VR::UI, 1, 1> {};
+		struct TypeOfInstances : TagTraits<0x0040, 0xe020, VR::CS, 1, 1> {};
+		struct DICOMRetrievalSequence : TagTraits<0x0040, 0xe021, VR::SQ, 1, 1> {};
+		struct DICOMMediaRetrievalSequence : TagTraits<0x0040, 0xe022, VR::SQ, 1, 1> {};
+		struct WADORetrievalSequence : TagTraits<0x0040, 0xe023, VR::SQ, 1, 1> {};
+		struct XDSRetrievalSequence : TagTraits<0x0040, 0xe024, VR::SQ, 1, 1> {};
+		struct WADORSRetrievalSequence : TagTraits<0x0040, 0xe025, VR::SQ, 1, 1> {};
+		struct RepositoryUniqueID : TagTraits<0x0040, 0xe030, VR::UI, 1, 1> {};
+		struct HomeCommunityID : TagTraits<0x0040, 0xe031, VR::UI, 1, 1> {};
+		struct DocumentTitle : TagTraits<0x0042, 0x0010, VR::ST, 1, 1> {};
+		struct EncapsulatedDocument : TagTraits<0x0042, 0x0011, VR::OB, 1, 1> {};
+		struct MIMETypeOfEncapsulatedDocument : TagTraits<0x0042, 0x0012, VR::LO, 1, 1> {};
+		struct SourceInstanceSequence : TagTraits<0x0042, 0x0013, VR::SQ, 1, 1> {};
+		struct ListOfMIMETypes : TagTraits<0x0042, 0x0014, VR::LO, 1, 0> {};
+		struct ProductPackageIdentifier : TagTraits<0x0044, 0x0001, VR::ST, 1, 1> {};
+		struct SubstanceAdministrationApproval : TagTraits<0x0044, 0x0002, VR::CS, 1, 1> {};
+		struct ApprovalStatusFurtherDescription : TagTraits<0x0044, 0x0003, VR::LT, 1, 1> {};
+		struct ApprovalStatusDateTime : TagTraits<0x0044, 0x0004, VR::DT, 1, 1> {};
+		struct ProductTypeCodeSequence : TagTraits<0x0044, 0x0007, VR::SQ, 1, 1> {};
+		struct ProductName : TagTraits<0x0044, 0x0008, VR::LO, 1, 0> {};
+		struct ProductDescription : TagTraits<0x0044, 0x0009, VR::LT, 1, 1> {};
+		struct ProductLotIdentifier : TagTraits<0x0044, 0x000a, VR::LO, 1, 1> {};
+		struct ProductExpirationDateTime : TagTraits<0x0044, 0x000b, VR::DT, 1, 1> {};
+		struct SubstanceAdministrationDateTime : TagTraits<0x0044, 0x0010, VR::DT, 1, 1> {};
+		struct SubstanceAdministrationNotes : TagTraits<0x0044, 0x0011, VR::LO, 1, 1> {};
+		struct SubstanceAdministrationDeviceID : TagTraits<0x0044, 0x0012, VR::LO, 1, 1> {};
+		struct ProductParameterSequence : TagTraits<0x0044, 0x0013, VR::SQ, 1, 1> {};
+		struct SubstanceAdministrationParameterSequence : TagTraits<0x0044, 0x0019, VR::SQ, 1, 1> {};
+		struct ApprovalSequence : TagTraits<0x0044, 0x0100, VR::SQ, 1, 1> {};
+		struct AssertionCodeSequence : TagTraits<0x0044, 0x0101, VR::SQ, 1, 1> {};
+		struct AssertionUID : TagTraits<0x0044, 0x0102, VR::UI, 1, 1> {};
+		struct AsserterIdentificationSequence : TagTraits<0x0044, 0x0103, VR::SQ, 1, 1> {};
+		struct AssertionDateTime : TagTraits<0x0044, 0x0104, VR::DT, 1, 1> {};
+		struct AssertionExpirationDateTime : TagTraits<0x0044, 0x0105, VR::DT, 1, 1> {};
+		struct AssertionComments : TagTraits<0x0044, 0x0106, VR::UT, 1, 1> {};
+		struct RelatedAssertionSequence : TagTraits<0x0044, 0x0107, VR::SQ, 1, 1> {};
+		struct ReferencedAssertionUID : TagTraits<0x0044, 0x0108, VR::UI, 1, 1> {};
+		struct ApprovalSubjectSequence : TagTraits<0x0044, 0x0109, VR::SQ, 1, 1> {};
+		struct OrganizationalRoleCodeSequence : TagTraits<0x0044, 0x010a, VR::SQ, 1, 1> {};
+		struct LensDescription : TagTraits<0x0046, 0x0012, VR::LO, 1, 1> {};
+		struct RightLensSequence : TagTraits<0x0046, 0x0014, VR::SQ, 1, 1> {};
+		struct LeftLensSequence : TagTraits<0x0046, 0x0015, VR::SQ, 1, 1> {};
+		struct UnspecifiedLateralityLensSequence : TagTraits<0x0046, 0x0016, VR::SQ, 1, 1> {};
+		struct CylinderSequence : TagTraits<0x0046, 0x0018, VR::SQ, 1, 1> {};
+		struct PrismSequence : TagTraits<0x0046, 0x0028, VR::SQ, 1, 1> {};
+		struct HorizontalPrismPower : TagTraits<0x0046, 0x0030, VR::FD, 1, 1> {};
+		struct HorizontalPrismBase : TagTraits<0x0046, 0x0032, VR::CS, 1, 1> {};
+		struct VerticalPrismPower : TagTraits<0x0046, 0x0034, VR::FD, 1, 1> {};
+		struct VerticalPrismBase : TagTraits<0x0046, 0x0036, VR::CS, 1, 1> {};
+		struct LensSegmentType : TagTraits<0x0046, 0x0038, VR::CS, 1, 1> {};
+		struct OpticalTransmittance : TagTraits<0x0046, 0x0040, VR::FD, 1, 1> {};
+		struct ChannelWidth : TagTraits<0x0046, 0x0042, VR::FD, 1, 1> {};
+		struct PupilSize : TagTraits<0x0046, 0x0044, VR::FD, 1, 1> {};
+		struct CornealSize : TagTraits<0x0046, 0x0046, VR::FD, 1, 1> {};
+		struct AutorefractionRightEyeSequence : TagTraits<0x0046, 0x0050, VR::SQ, 1, 1> {};
+		struct AutorefractionLeftEyeSequence : TagTraits<0x0046, 0x0052, VR::SQ, 1, 1> {};
+		struct DistancePupillaryDistance : TagTraits<0x0046, 0x0060, VR::FD, 1, 1> {};
+		struct NearPupillaryDistance : TagTraits<0x0046, 0x0062, VR::FD, 1, 1> {};
+		struct IntermediatePupillaryDistance : TagTraits<0x0046, 0x0063, VR::FD, 1, 1> {};
+		struct OtherPupillaryDistance : TagTraits<0x0046, 0x0064, VR::FD, 1, 1> {};
+		struct KeratometryRightEyeSequence : TagTraits<0x0046, 0x0070, VR::SQ, 1, 1> {};
+		struct KeratometryLeftEyeSequence : TagTraits<0x0046, 0x0071, VR::SQ, 1, 1> {};
+		struct SteepKeratometricAxisSequence : TagTraits<0x0046, 0x0074, VR::SQ, 1, 1> {};
+		struct RadiusOfCurvature : TagTraits<0x0046, 0x0075, VR::FD, 1, 1> {};
+		struct KeratometricPower : TagTraits<0x0046, 0x0076, VR::FD, 1, 1> {};
+		struct KeratometricAxis : TagTraits<0x0046, 0x0077, VR::FD, 1, 1> {};
+		struct FlatKeratometricAxisSequence : TagTraits<0x0046, 0x0080, VR::SQ, 1, 1> {};
+		struct BackgroundColor : TagTraits<0x0046, 0x0092, VR::CS, 1, 1> {};
+		struct Optotype : TagTraits<0x0046, 0x0094, VR::CS, 1, 1> {};
+		struct OptotypePresentation : TagTraits<0x0046, 0x0095, VR::CS, 1, 1> {};
+		struct SubjectiveRefractionRightEyeSequence : TagTraits<0x0046, 0x0097, VR::SQ, 1, 1> {};
+		struct SubjectiveRefractionLeftEyeSequence : TagTraits<0x0046, 0x0098, VR::SQ, 1, 1> {};
+		struct AddNearSequence : TagTraits<0x0046, 0x0100, VR::SQ, 1, 1> {};
+		struct AddIntermediateSequence : TagTraits<0x0046, 0x0101, VR::SQ, 1, 1> {};
+		struct AddOtherSequence : TagTraits<0x0046, 0x0102, VR::SQ, 1, 1> {};
+		struct AddPower : TagTraits<0x0046, 0x0104, VR::FD, 1, 1> {};
+		struct ViewingDistance : TagTraits<0x0046, 0x0106, VR::FD, 1, 1> {};
+		struct VisualAcuityTypeCodeSequence : TagTraits<0x0046, 0x0121, VR::SQ, 1, 1> {};
+		struct VisualAcuityRightEyeSequence : TagTraits<0x0046, 0x0122, VR::SQ, 1, 1> {};
+		struct VisualAcuityLeftEyeSequence : TagTraits<0x0046, 0x0123, VR::SQ, 1, 1> {};
+		struct VisualAcuityBothEyesOpenSequence : TagTraits<0x0046, 0x0124, VR::SQ, 1, 1> {};
+		struct ViewingDistanceType : TagTraits<0x0046, 0x0125, VR::CS, 1, 1> {};
+		struct VisualAcuityModifiers : TagTraits<0x0046, 0x0135, VR::SS, 2, 2> {};
+		struct DecimalVisualAcuity : TagTraits<0x0046, 0x0137, VR::FD, 1, 1> {};
+		struct OptotypeDetailedDefinition : TagTraits<0x0046, 0x0139, VR::LO, 1, 1> {};
+		struct ReferencedRefractiveMeasurementsSequence : TagTraits<0x0046, 0x0145, VR::SQ, 1, 1> {};
+		struct SpherePower : TagTraits<0x0046, 0x0146, VR::FD, 1, 1> {};
+		struct CylinderPower : TagTraits<0x0046, 0x0147, VR::FD, 1, 1> {};
+		struct CornealTopographySurface : TagTraits<0x0046, 0x0201, VR::CS, 1, 1> {};
+		struct CornealVertexLocation : TagTraits<0x0046, 0x0202, VR::FL, 2, 2> {};
+		struct PupilCentroidXCoordinate : TagTraits<0x0046, 0x0203, VR::FL, 1, 1> {};
+		struct PupilCentroidYCoordinate : TagTraits<0x0046, 0x0204, VR::FL, 1, 1> {};
+		struct EquivalentPupilRadius : TagTraits<0x0046, 0x0205, VR::FL, 1, 1> {};
+		struct CornealTopographyMapTypeCodeSequence : TagTraits<0x0046, 0x0207, VR::SQ, 1, 1> {};
+		struct VerticesOfTheOutlineOfPupil : TagTraits<0x0046, 0x0208, VR::IS, 2, 0> {};
+		struct CornealTopographyMappingNormalsSequence : TagTraits<0x0046, 0x0210, VR::SQ, 1, 1> {};
+		struct MaximumCornealCurvatureSequence : TagTraits<0x0046, 0x0211, VR::SQ, 1, 1> {};
+		struct MaximumCornealCurvature : TagTraits<0x0046, 0x0212, VR::FL, 1, 1> {};
+		struct MaximumCornealCurvatureLocation : TagTraits<0x0046, 0x0213, VR::FL, 2, 2> {};
+		struct MinimumKeratometricSequence : TagTraits<0x0046, 0x0215, VR::SQ, 1, 1> {};
+		struct SimulatedKeratometricCylinderSequence : TagTraits<0x0046, 0x0218, VR::SQ, 1, 1> {};
+		struct AverageCornealPower : TagTraits<0x0046, 0x0220, VR::FL, 1, 1> {};
+		struct CornealISValue : TagTraits<0x0046, 0x0224, VR::FL, 1, 1> {};
+		struct AnalyzedArea : TagTraits<0x0046, 0x0227, VR::FL, 1, 1> {};
+		struct SurfaceRegularityIndex : TagTraits<0x0046, 0x0230, VR::FL, 1, 1> {};
+		struct SurfaceAsymmetryIndex : TagTraits<0x0046, 0x0232, VR::FL, 1, 1> {};
+		struct CornealEccentricityIndex : TagTraits<0x0046, 0x0234, VR::FL, 1, 1> {};
+		struct KeratoconusPredictionIndex : TagTraits<0x0046, 0x0236, VR::FL, 1, 1> {};
+		struct DecimalPotentialVisualAcuity : TagTraits<0x0046, 0x0238, VR::FL, 1, 1> {};
+		struct CornealTopographyMapQualityEvaluation : TagTraits<0x0046, 0x0242, VR::CS, 1, 1> {};
+		struct SourceImageCornealProcessedDataSequence : TagTraits<0x0046, 0x0244, VR::SQ, 1, 1> {};
+		struct CornealPointLocation : TagTraits<0x0046, 0x0247, VR::FL, 3, 3> {};
+		struct CornealPointEstimated : TagTraits<0x0046, 0x0248, VR::CS, 1, 1> {};
+		struct AxialPower : TagTraits<0x0046, 0x0249, VR::FL, 1, 1> {};
+		struct TangentialPower : TagTraits<0x0046, 0x0250, VR::FL, 1, 1> {};
+		struct RefractivePower : TagTraits<0x0046, 0x0251, VR::FL, 1, 1> {};
+		struct RelativeElevation : TagTraits<0x0046, 0x0252, VR::FL, 1, 1> {};
+		struct CornealWavefront : TagTraits<0x0046, 0x0253, VR::FL, 1, 1> {};
+		struct ImagedVolumeWidth : TagTraits<0x0048, 0x0001, VR::FL, 1, 1> {};
+		struct ImagedVolumeHeight : TagTraits<0x0048, 0x0002, VR::FL, 1, 1> {};
+		struct ImagedVolumeDepth : TagTraits<0x0048, 0x0003, VR::FL, 1, 1> {};
+		struct TotalPixelMatrixColumns : TagTraits<0x0048, 0x0006, VR::UL, 1, 1> {};
+		struct TotalPixelMatrixRows : TagTraits<0x0048, 0x0007, VR::UL, 1, 1> {};
+		struct TotalPixelMatrixOriginSequence : TagTraits<0x0048, 0x0008, VR::SQ, 1, 1> {};
+		struct SpecimenLabelInImage : TagTraits<0x0048, 0x0010, VR::CS, 1, 1> {};
+		struct FocusMethod : TagTraits<0x0048, 0x0011, VR::CS, 1, 1> {};
+		struct ExtendedDepthOfField : TagTraits<0x0048, 0x0012, VR::CS, 1, 1> {};
+		struct NumberOfFocalPlanes : TagTraits<0x0048, 0x0013, VR::US, 1, 1> {};
+		struct DistanceBetweenFocalPlanes : TagTraits<0x0048, 0x0014, VR::FL, 1, 1> {};
+		struct RecommendedAbsentPixelCIELabValue : TagTraits<0x0048, 0x0015, VR::US, 3, 3> {};
+		struct IlluminatorTypeCodeSequence : TagTraits<0x0048, 0x0100, VR::SQ, 1, 1> {};
+		struct ImageOrientationSlide : TagTraits<0x0048, 0x0102, VR::DS, 6, 6> {};
+		struct OpticalPathSequence : TagTraits<0x0048, 0x0105, VR::SQ, 1, 1> {};
+		struct OpticalPathIdentifier : TagTraits<0x0048, 0x0106, VR::SH, 1, 1> {};
+		struct OpticalPathDescription : TagTraits<0x0048, 0x0107, VR::ST, 1, 1> {};
+		struct IlluminationColorCodeSequence : TagTraits<0x0048, 0x0108, VR::SQ, 1, 1> {};
+		struct SpecimenReferenceSequence : TagTraits<0x0048, 0x0110, VR::SQ, 1, 1> {};
+		struct CondenserLensPower : TagTraits<0x0048, 0x0111, VR::DS, 1, 1> {};
+		struct ObjectiveLensPower : TagTraits<0x0048, 0x0112, VR::DS, 1, 1> {};
+		struct ObjectiveLensNumericalAperture : TagTraits<0x0048, 0x0113, VR::DS, 1, 1> {};
+		struct PaletteColorLookupTableSequence : TagTraits<0x0048, 0x0120, VR::SQ, 1, 1> {};
+		struct ReferencedImageNavigationSequence : TagTraits<0x0048, 0x0200, VR::SQ, 1, 1> {};
+		struct TopLeftHandCornerOfLocalizerArea : TagTraits<0x0048, 0x0201, VR::US, 2, 2> {};
+		struct BottomRightHandCornerOfLocalizerArea : TagTraits<0x0048, 0x0202, VR::US, 2, 2> {};
+		struct OpticalPathIdentificationSequence : TagTraits<0x0048, 0x0207, VR::SQ, 1, 1> {};
+		struct PlanePositionSlideSequence : TagTraits<0x0048, 0x021a, VR::SQ, 1, 1> {};
+		struct ColumnPositionInTotalImagePixelMatrix : TagTraits<0x0048, 0x021e, VR::SL, 1, 1> {};
+		struct RowPositionInTotalImagePixelMatrix : TagTraits<0x0048, 0x021f, VR::SL, 1, 1> {};
+		struct PixelOriginInterpretation : TagTraits<0x0048, 0x0301, VR::CS, 1, 1> {};
+		struct CalibrationImage : TagTraits<0x0050, 0x0004, VR::CS, 1, 1> {};
+		struct DeviceSequence : TagTraits<0x0050, 0x0010, VR::SQ, 1, 1> {};
+		struct ContainerComponentTypeCodeSequence : TagTraits<0x0050, 0x0012, VR::SQ, 1, 1> {};
+		struct ContainerComponentThickness : TagTraits<0x0050, 0x0013, VR::FD, 1, 1> {};
+		struct DeviceLength : TagTraits<0x0050, 0x0014, VR::DS, 1, 1> {};
+		struct ContainerComponentWidth : TagTraits<0x0050, 0x0015, VR::FD, 1, 1> {};
+		struct DeviceDiameter : TagTraits<0x0050, 0x0016, VR::DS, 1, 1> {};
+		struct DeviceDiameterUnits : TagTraits<0x0050, 0x0017, VR::CS, 1, 1> {};
+		struct DeviceVolume : TagTraits<0x0050, 0x0018, VR::DS, 1, 1> {};
+		struct InterMarkerDistance : TagTraits<0x0050, 0x0019, VR::DS, 1, 1> {};
+		struct ContainerComponentMaterial : TagTraits<0x0050, 0x001a, VR::CS, 1, 1> {};
+		struct ContainerComponentID : TagTraits<0x0050, 0x001b, VR::LO, 1, 1> {};
+		struct ContainerComponentLength : TagTraits<0x0050, 0x001c, VR::FD, 1, 1> {};
+		struct ContainerComponentDiameter : TagTraits<0x0050, 0x001d, VR::FD, 1, 1> {};
+		struct ContainerComponentDescription : TagTraits<0x0050, 0x001e, VR::LO, 1, 1> {};
+		struct DeviceDescription : TagTraits<0x0050, 0x0020, VR::LO, 1, 1> {};
+		struct ContrastBolusIngredientPercentByVolume : TagTraits<0x0052, 0x0001, VR::FL, 1, 1> {};
+		struct OCTFocalDistance : TagTraits<0x0052, 0x0002, VR::FD, 1, 1> {};
+		struct BeamSpotSize : TagTraits<0x0052, 0x0003, VR::FD, 1, 1> {};
+		struct EffectiveRefractiveIndex : TagTraits<0x0052, 0x0004, VR::FD, 1, 1> {};
+		struct OCTAcquisitionDomain : TagTraits<0x0052, 0x0006, VR::CS, 1, 1> {};
+		struct OCTOpticalCenterWavelength : TagTraits<0x0052, 0x0007, VR::FD, 1, 1> {};
+		struct AxialResolution : TagTraits<0x0052, 0x0008, VR::FD, 1, 1> {};
+		struct RangingDepth : TagTraits<0x0052, 0x0009, VR::FD, 1, 1> {};
+		struct ALineRate : TagTraits<0x0052, 0x0011, VR::FD, 1, 1> {};
+		struct ALinesPerFrame : TagTraits<0x0052, 0x0012, VR::US, 1, 1> {};
+		struct CatheterRotationalRate : TagTraits<0x0052, 0x0013, VR::FD, 1, 1> {};
+		struct ALinePixelSpacing : TagTraits<0x0052, 0x0014, VR::FD, 1, 1> {};
+		struct ModeOfPercutaneousAccessSequence : TagTraits<0x0052, 0x0016, VR::SQ, 1, 1> {};
+		struct IntravascularOCTFrameTypeSequence : TagTraits<0x0052, 0x0025, VR::SQ, 1, 1> {};
+		struct OCTZOffsetApplied : TagTraits<0x0052, 0x0026, VR::CS, 1, 1> {};
+		struct IntravascularFrameContentSequence : TagTraits<0x0052, 0x0027, VR::SQ, 1, 1> {};
+		struct IntravascularLongitudinalDistance : TagTraits<0x0052, 0x0028, VR::FD, 1, 1> {};
+		struct IntravascularOCTFrameContentSequence : TagTraits<0x0052, 0x0029, VR::SQ, 1, 1> {};
+		struct OCTZOffsetCorrection : TagTraits<0x0052, 0x0030, VR::SS, 1, 1> {};
+		struct CatheterDirectionOfRotation : TagTraits<0x0052, 0x0031, VR::CS, 1, 1> {};
+		struct SeamLineLocation : TagTraits<0x0052, 0x0033, VR::FD, 1, 1> {};
+		struct FirstALineLocation : TagTraits<0x0052, 0x0034, VR::FD, 1, 1> {};
+		struct SeamLineIndex : TagTraits<0x0052, 0x0036, VR::US, 1, 1> {};
+		struct NumberOfPaddedALines : TagTraits<0x0052, 0x0038, VR::US, 1, 1> {};
+		struct InterpolationType : TagTraits<0x0052, 0x0039, VR::CS, 1, 1> {};
+		struct RefractiveIndexApplied : TagTraits<0x0052, 0x003a, VR::CS, 1, 1> {};
+		struct EnergyWindowVector : TagTraits<0x0054, 0x0010, VR::US, 1, 0> {};
+		struct NumberOfEnergyWindows : TagTraits<0x0054, 0x0011, VR::US, 1, 1> {};
+		struct EnergyWindowInformationSequence : TagTraits<0x0054, 0x0012, VR::SQ, 1, 1> {};
+		struct EnergyWindowRangeSequence : TagTraits<0x0054, 0x0013, VR::SQ, 1, 1> {};
+		struct EnergyWindowLowerLimit : TagTraits<0x0054, 0x0014, VR::DS, 1, 1> {};
+		struct EnergyWindowUpperLimit : TagTraits<0x0054, 0x0015, VR::DS, 1, 1> {};
+		struct RadiopharmaceuticalInformationSequence : TagTraits<0x0054, 0x0016, VR::SQ, 1, 1> {};
+		struct ResidualSyringeCounts : TagTraits<0x0054, 0x0017, VR::IS, 1, 1> {};
+		struct EnergyWindowName : TagTraits<0x0054, 0x0018, VR::SH, 1, 1> {};
+		struct DetectorVector : TagTraits<0x0054, 0x0020, VR::US, 1, 0> {};
+		struct NumberOfDetectors : TagTraits<0x0054, 0x0021, VR::US, 1, 1> {};
+		struct DetectorInformationSequence : TagTraits<0x0054, 0x0022, VR::SQ, 1, 1> {};
+		struct PhaseVector : TagTraits<0x0054, 0x0030, VR::US, 1, 0> {};
+		struct NumberOfPhases : TagTraits<0x0054, 0x0031, VR::US, 1, 1> {};
+		struct PhaseInformationSequence : TagTraits<0x0054, 0x0032, VR::SQ, 1, 1> {};
+		struct NumberOfFramesInPhase : TagTraits<0x0054, 0x0033, VR::US, 1, 1> {};
+		struct PhaseDelay : TagTraits<0x0054, 0x0036, VR::IS, 1, 1> {};
+		struct PauseBetweenFrames : TagTraits<0x0054, 0x0038, VR::IS, 1, 1> {};
+		struct PhaseDescription : TagTraits<0x0054, 0x0039, VR::CS, 1, 1> {};
+		struct RotationVector : TagTraits<0x0054, 0x0050, VR::US, 1, 0> {};
+		struct NumberOfRotations : TagTraits<0x0054, 0x0051, VR::US, 1, 1> {};
+		struct RotationInformationSequence : TagTraits<0x0054, 0x0052, VR::SQ, 1, 1> {};
+		struct NumberOfFramesInRotation : TagTraits<0x0054, 0x0053, VR::US, 1, 1> {};
+		struct RRIntervalVector : TagTraits<0x0054, 0x0060, VR::US, 1, 0> {};
+		struct NumberOfRRIntervals : TagTraits<0x0054, 0x0061, VR::US, 1, 1> {};
+		struct GatedInformationSequence : TagTraits<0x0054, 0x0062, VR::SQ, 1, 1> {};
+		struct DataInformationSequence : TagTraits<0x0054, 0x0063, VR::SQ, 1, 1> {};
+		struct TimeSlotVector : TagTraits<0x0054, 0x0070, VR::US, 1, 0> {};
+		struct NumberOfTimeSlots : TagTraits<0x0054, 0x0071, VR::US, 1, 1> {};
+		struct TimeSlotInformationSequence : TagTraits<0x0054, 0x0072, VR::SQ, 1, 1> {};
+		struct TimeSlotTime : TagTraits<0x0054, 0x0073, VR::DS, 1, 1> {};
+		struct SliceVector : TagTraits<0x0054, 0x0080, VR::US, 1, 0> {};
+		struct NumberOfSlices : TagTraits<0x0054, 0x0081, VR::US, 1, 1> {};
+		struct AngularViewVector : TagTraits<0x0054, 0x0090, VR::US, 1, 0> {};
+		struct TimeSliceVector : TagTraits<0x0054, 0x0100, VR::US, 1, 0> {};
+		struct NumberOfTimeSlices : TagTraits<0x0054, 0x0101, VR::US, 1, 1> {};
+		struct StartAngle : TagTraits<0x0054, 0x0200, VR::DS, 1, 1> {};
+		struct TypeOfDetectorMotion : TagTraits<0x0054, 0x0202, VR::CS, 1, 1> {};
+		struct TriggerVector : TagTraits<0x0054, 0x0210, VR::IS, 1, 0> {};
+		struct NumberOfTriggersInPhase : TagTraits<0x0054, 0x0211, VR::US, 1, 1> {};
+		struct ViewCodeSequence : TagTraits<0x0054, 0x0220, VR::SQ, 1, 1> {};
+		struct ViewModifierCodeSequence : TagTraits<0x0054, 0x0222, VR::SQ, 1, 1> {};
+		struct RadionuclideCodeSequence : TagTraits<0x0054, 0x0300, VR::SQ, 1, 1> {};
+		struct AdministrationRouteCodeSequence : TagTraits<0x0054, 0x0302, VR::SQ, 1, 1> {};
+		struct RadiopharmaceuticalCodeSequence : TagTraits<0x0054, 0x0304, VR::SQ, 1, 1> {};
+		struct CalibrationDataSequence : TagTraits<0x0054, 0x0306, VR::SQ, 1, 1> {};
+		struct EnergyWindowNumber : TagTraits<0x0054, 0x0308, VR::US, 1, 1> {};
+		struct ImageID : TagTraits<0x0054, 0x0400, VR::SH, 1, 1> {};
+		struct PatientOrientationCodeSequence : TagTraits<0x0054, 0x0410, VR::SQ, 1, 1> {};
+		struct PatientOrientationModifierCodeSequence : TagTraits<0x0054, 0x0412, VR::SQ, 1, 1> {};
+		struct PatientGantryRelationshipCodeSequence : TagTraits<0x0054, 0x0414, VR::SQ, 1, 1> {};
+		struct SliceProgressionDirection : TagTraits<0x0054, 0x0500, VR::CS, 1, 1> {};
+		struct ScanProgressionDirection : TagTraits<0x0054, 0x0501, VR::CS, 1, 1> {};
+		struct SeriesType : TagTraits<0x0054, 0x1000, VR::CS, 2, 2> {};
+		struct Units : TagTraits<0x0054, 0x1001, VR::CS, 1, 1> {};
+		struct CountsSource : TagTraits<0x0054, 0x1002, VR::CS, 1, 1> {};
+		struct ReprojectionMethod : TagTraits<0x0054, 0x1004, VR::CS, 1, 1> {};
+		struct SUVType : TagTraits<0x0054, 0x1006, VR::CS, 1, 1> {};
+		struct RandomsCorrectionMethod : TagTraits<0x0054, 0x1100, VR::CS, 1, 1> {};
+		struct AttenuationCorrectionMethod : TagTraits<0x0054, 0x1101, VR::LO, 1, 1> {};
+		struct DecayCorrection : TagTraits<0x0054, 0x1102, VR::CS, 1, 1> {};
+		struct ReconstructionMethod : TagTraits<0x0054, 0x1103, VR::LO, 1, 1> {};
+		struct DetectorLinesOfResponseUsed : TagTraits<0x0054, 0x1104, VR::LO, 1, 1> {};
+		struct ScatterCorrectionMethod : TagTraits<0x0054, 0x1105, VR::LO, 1, 1> {};
+		struct AxialAcceptance : TagTraits<0x0054, 0x1200, VR::DS, 1, 1> {};
+		struct AxialMash : TagTraits<0x0054, 0x1201, VR::IS, 2, 2> {};
+		struct TransverseMash : TagTraits<0x0054, 0x1202, VR::IS, 1, 1> {};
+		struct DetectorElementSize : TagTraits<0x0054, 0x1203, VR::DS, 2, 2> {};
+		struct CoincidenceWindowWidth : TagTraits<0x0054, 0x1210, VR::DS, 1, 1> {};
+		struct SecondaryCountsType : TagTraits<0x0054, 0x1220, VR::CS, 1, 0> {};
+		struct FrameReferenceTime : TagTraits<0x0054, 0x1300, VR::DS, 1, 1> {};
+		struct PrimaryPromptsCountsAccumulated : TagTraits<0x0054, 0x1310, VR::IS, 1, 1> {};
+		struct SecondaryCountsAccumulated : TagTraits<0x0054, 0x1311, VR::IS, 1, 0> {};
+		struct SliceSensitivityFactor : TagTraits<0x0054, 0x1320, VR::DS, 1, 1> {};
+		struct DecayFactor : TagTraits<0x0054, 0x1321, VR::DS, 1, 1> {};
+		struct DoseCalibrationFactor : TagTraits<0x0054, 0x1322, VR::DS, 1, 1> {};
+		struct ScatterFractionFactor : TagTraits<0x0054, 0x1323, VR::DS, 1, 1> {};
+		struct DeadTimeFactor : TagTraits<0x0054, 0x1324, VR::DS, 1, 1> {};
+		struct ImageIndex : TagTraits<0x0054, 0x1330, VR::US, 1, 1> {};
+		struct CountsIncluded : TagTraits<0x0054, 0x1400, VR::CS, 1, 0> {};
+		struct DeadTimeCorrectionFlag : TagTraits<0x0054, 0x1401, VR::CS, 1, 1> {};
+		struct HistogramSequence : TagTraits<0x0060, 0x3000, VR::SQ, 1, 1> {};
+		struct HistogramNumberOfBins : TagTraits<0x0060, 0x3002, VR::US, 1, 1> {};
+		struct HistogramBinWidth : TagTraits<0x0060, 0x3008, VR::US, 1, 1> {};
+		struct HistogramExplanation : TagTraits<0x0060, 0x3010, VR::LO, 1, 1> {};
+		struct HistogramData : TagTraits<0x0060, 0x3020, VR::UL, 1, 0> {};
+		struct SegmentationType : TagTraits<0x0062, 0x0001, VR::CS, 1, 1> {};
+		struct SegmentSequence : TagTraits<0x0062, 0x0002, VR::SQ, 1, 1> {};
+		struct SegmentedPropertyCategoryCodeSequence : TagTraits<0x0062, 0x0003, VR::SQ, 1, 1> {};
+		struct SegmentNumber : TagTraits<0x0062, 0x0004, VR::US, 1, 1> {};
+		struct SegmentLabel : TagTraits<0x0062, 0x0005, VR::LO, 1, 1> {};
+		struct SegmentDescription : TagTraits<0x0062, 0x0006, VR::ST, 1, 1> {};
+		struct SegmentationAlgorithmIdentificationSequence : TagTraits<0x0062, 0x0007, VR::SQ, 1, 1> {};
+		struct SegmentAlgorithmType : TagTraits<0x0062, 0x0008, VR::CS, 1, 1> {};
+		struct SegmentAlgorithmName : TagTraits<0x0062, 0x0009, VR::LO, 1, 1> {};
+		struct SegmentIdentificationSequence : TagTraits<0x0062, 0x000a, VR::SQ, 1, 1> {};
+		struct ReferencedSegmentNumber : TagTraits<0x0062, 0x000b, VR::US, 1, 0> {};
+		struct RecommendedDisplayGrayscaleValue : TagTraits<0x0062, 0x000c, VR::US, 1, 1> {};
+		struct RecommendedDisplayCIELabValue : TagTraits<0x0062, 0x000d, VR::US, 3, 3> {};
+		struct MaximumFractionalValue : TagTraits<0x0062, 0x000e, VR::US, 1, 1> {};
+		struct SegmentedPropertyTypeCodeSequence : TagTraits<0x0062, 0x000f, VR::SQ, 1, 1> {};
+		struct SegmentationFractionalType : TagTraits<0x0062, 0x0010, VR::CS, 1, 1> {};
+		struct SegmentedPropertyTypeModifierCodeSequence : TagTraits<0x0062, 0x0011, VR::SQ, 1, 1> {};
+		struct UsedSegmentsSequence : TagTraits<0x0062, 0x0012, VR::SQ, 1, 1> {};
+		struct TrackingID : TagTraits<0x0062, 0x0020, VR::UT, 1, 1> {};
+		struct TrackingUID : TagTraits<0x0062, 0x0021, VR::UI, 1, 1> {};
+		struct DeformableRegistrationSequence : TagTraits<0x0064, 0x0002, VR::SQ, 1, 1> {};
+		struct SourceFrameOfReferenceUID : TagTraits<0x0064, 0x0003, VR::UI, 1, 1> {};
+		struct DeformableRegistrationGridSequence : TagTraits<0x0064, 0x0005, VR::SQ, 1, 1> {};
+		struct GridDimensions : TagTraits<0x0064, 0x0007, VR::UL, 3, 3> {};
+		struct GridResolution : TagTraits<0x0064, 0x0008, VR::FD, 3, 3> {};
+		struct VectorGridData : TagTraits<0x0064, 0x0009, VR::OF, 1, 1> {};
+		struct PreDeformationMatrixRegistrationSequence : TagTraits<0x0064, 0x000f, VR::SQ, 1, 1> {};
+		struct PostDeformationMatrixRegistrationSequence : TagTraits<0x0064, 0x0010, VR::SQ, 1, 1> {};
+		struct NumberOfSurfaces : TagTraits<0x0066, 0x0001, VR::UL, 1, 1> {};
+		struct SurfaceSequence : TagTraits<0x0066, 0x0002, VR::SQ, 1, 1> {};
+		struct SurfaceNumber : TagTraits<0x0066, 0x0003, VR::UL, 1, 1> {};
+		struct SurfaceComments : TagTraits<0x0066, 0x0004, VR::LT, 1, 1> {};
+		struct SurfaceProcessing : TagTraits<0x0066, 0x0009, VR::CS, 1, 1> {};
+		struct SurfaceProcessingRatio : TagTraits<0x0066, 0x000a, VR::FL, 1, 1> {};
+		struct SurfaceProcessingDescription : TagTraits<0x0066, 0x000b, VR::LO, 1, 1> {};
+		struct RecommendedPresentationOpacity : TagTraits<0x0066, 0x000c, VR::FL, 1, 1> {};
+		struct RecommendedPresentationType : TagTraits<0x0066, 0x000d, VR::CS, 1, 1> {};
+		struct FiniteVolume : TagTraits<0x0066, 0x000e, VR::CS, 1, 1> {};
+		struct Manifold : TagTraits<0x0066, 0x0010, VR::CS, 1, 1> {};
+		struct SurfacePointsSequence : TagTraits<0x0066, 0x0011, VR::SQ, 1, 1> {};
+		struct SurfacePointsNormalsSequence : TagTraits<0x0066, 0x0012, VR::SQ, 1, 1> {};
+		struct SurfaceMeshPrimitivesSequence : TagTraits<0x0066, 0x0013, VR::SQ, 1, 1> {};
+		struct NumberOfSurfacePoints : TagTraits<0x0066, 0x0015, VR::UL, 1, 1> {};
+		struct PointCoordinatesData : TagTraits<0x0066, 0x0016, VR::OF, 1, 1> {};
+		struct PointPositionAccuracy : TagTraits<0x0066, 0x0017, VR::FL, 3, 3> {};
+		struct MeanPointDistance : TagTraits<0x0066, 0x0018, VR::FL, 1, 1> {};
+		struct MaximumPointDistance : TagTraits<0x0066, 0x0019, VR::FL, 1, 1> {};
+		struct PointsBoundingBoxCoordinates : TagTraits<0x0066, 0x001a, VR::FL, 6, 6> {};
+		struct AxisOfRotation : TagTraits<0x0066, 0x001b, VR::FL, 3, 3> {};
+		struct CenterOfRotation : TagTraits<0x0066, 0x001c, VR::FL, 3, 3> {};
+		struct NumberOfVectors : TagTraits<0x0066, 0x001e, VR::UL, 1, 1> {};
+		struct VectorDimensionality : TagTraits<0x0066, 0x001f, VR::US, 1, 1> {};
+		struct VectorAccuracy : TagTraits<0x0066, 0x0020, VR::FL, 1, 0> {};
+		struct VectorCoordinateData : TagTraits<0x0066, 0x0021, VR::OF, 1, 1> {};
+		struct TrianglePointIndexList : TagTraits<0x0066, 0x0023, VR::OW, 1, 1> {};
+		struct EdgePointIndexList : TagTraits<0x0066, 0x0024, VR::OW, 1, 1> {};
+		struct VertexPointIndexList : TagTraits<0x0066, 0x0025, VR::OW, 1, 1> {};
+		struct TriangleStripSequence : TagTraits<0x0066, 0x0026, VR::SQ, 1, 1> {};
+		struct TriangleFanSequence : TagTraits<0x0066, 0x0027, VR::SQ, 1, 1> {};
+		struct LineSequence : TagTraits<0x0066, 0x0028, VR::SQ, 1, 1> {};
+		struct PrimitivePointIndexList : TagTraits<0x0066, 0x0029, VR::OW, 1, 1> {};
+		struct SurfaceCount : TagTraits<0x0066, 0x002a, VR::UL, 1, 1> {};
+		struct ReferencedSurfaceSequence : TagTraits<0x0066, 0x002b, VR::SQ, 1, 1> {};
+		struct ReferencedSurfaceNumber : TagTraits<0x0066, 0x002c, VR::UL, 1, 1> {};
+		struct SegmentSurfaceGenerationAlgorithmIdentificationSequence : TagTraits<0x0066, 0x002d, VR::SQ, 1, 1> {};
+		struct SegmentSurfaceSourceInstanceSequence : TagTraits<0x0066, 0x002e, VR::SQ, 1, 1> {};
+		struct AlgorithmFamilyCodeSequence : TagTraits<0x0066, 0x002f, VR::SQ, 1, 1> {};
+		struct AlgorithmNameCodeSequence : TagTraits<0x0066, 0x0030, VR::SQ, 1, 1> {};
+		struct AlgorithmVersion : TagTraits<0x0066, 0x0031, VR::LO, 1, 1> {};
+		struct AlgorithmParameters : TagTraits<0x0066, 0x0032, VR::LT, 1, 1> {};
+		struct FacetSequence : TagTraits<0x0066, 0x0034, VR::SQ, 1, 1> {};
+		struct SurfaceProcessingAlgorithmIdentificationSequence : TagTraits<0x0066, 0x0035, VR::SQ, 1, 1> {};
+		struct AlgorithmName : TagTraits<0x0066, 0x0036, VR::LO, 1, 1> {};
+		struct RecommendedPointRadius : TagTraits<0x0066, 0x0037, VR::FL, 1, 1> {};
+		struct RecommendedLineThickness : TagTraits<0x0066, 0x0038, VR::FL, 1, 1> {};
+		struct LongPrimitivePointIndexList : TagTraits<0x0066, 0x0040, VR::OL, 1, 1> {};
+		struct LongTrianglePointIndexList : TagTraits<0x0066, 0x0041, VR::OL, 1, 1> {};
+		struct LongEdgePointIndexList : TagTraits<0x0066, 0x0042, VR::OL, 1, 1> {};
+		struct LongVertexPointIndexList : TagTraits<0x0066, 0x0043, VR::OL, 1, 1> {};
+		struct TrackSetSequence : TagTraits<0x0066, 0x0101, VR::SQ, 1, 1> {};
+		struct TrackSequence : TagTraits<0x0066, 0x0102, VR::SQ, 1, 1> {};
+		struct RecommendedDisplayCIELabValueList : TagTraits<0x0066, 0x0103, VR::OW, 1, 1> {};
+		struct TrackingAlgorithmIdentificationSequence : TagTraits<0x0066, 0x0104, VR::SQ, 1, 1> {};
+		struct TrackSetNumber : TagTraits<0x0066, 0x0105, VR::UL, 1, 1> {};
+		struct TrackSetLabel : TagTraits<0x0066, 0x0106, VR::LO, 1, 1> {};
+		struct TrackSetDescription : TagTraits<0x0066, 0x0107, VR::UT, 1, 1> {};
+		struct TrackSetAnatomicalTypeCodeSequence : TagTraits<0x0066, 0x0108, VR::SQ, 1, 1> {};
+		struct MeasurementsSequence : TagTraits<0x0066, 0x0121, VR::SQ, 1, 1> {};
+		struct TrackSetStatisticsSequence : TagTraits<0x0066, 0x0124, VR::SQ, 1, 1> {};
+		struct FloatingPointValues : TagTraits<0x0066, 0x0125, VR::OF, 1, 1> {};
+		struct TrackPointIndexList : TagTraits<0x0066, 0x0129, VR::OL, 1, 1> {};
+		struct TrackStatisticsSequence : TagTraits<0x0066, 0x0130, VR::SQ, 1, 1> {};
+		struct MeasurementValuesSequence : TagTraits<0x0066, 0x0132, VR::SQ, 1, 1> {};
+		struct DiffusionAcquisitionCodeSequence : TagTraits<0x0066, 0x0133, VR::SQ, 1, 1> {};
+		struct DiffusionModelCodeSequence : TagTraits<0x0066, 0x0134, VR::SQ, 1, 1> {};
+		struct ImplantSize : TagTraits<0x0068, 0x6210, VR::LO, 1, 1> {};
+		struct ImplantTemplateVersion : TagTraits<0x0068, 0x6221, VR::LO, 1, 1> {};
+		struct ReplacedImplantTemplateSequence : TagTraits<0x0068, 0x6222, VR::SQ, 1, 1> {};
+		struct ImplantType : TagTraits<0x0068, 0x6223, VR::CS, 1, 1> {};
+		struct DerivationImplantTemplateSequence : TagTraits<0x0068, 0x6224, VR::SQ, 1, 1> {};
+		struct OriginalImplantTemplateSequence : TagTraits<0x0068, 0x6225, VR::SQ, 1, 1> {};
+		struct EffectiveDateTime : TagTraits<0x0068, 0x6226, VR::DT, 1, 1> {};
+		struct ImplantTargetAnatomySequence : TagTraits<0x0068, 0x6230, VR::SQ, 1, 1> {};
+		struct InformationFromManufacturerSequence : TagTraits<0x0068, 0x6260, VR::SQ, 1, 1> {};
+		struct NotificationFromManufacturerSequence : TagTraits<0x0068, 0x6265, VR::SQ, 1, 1> {};
+		struct InformationIssueDateTime : TagTraits<0x0068, 0x6270, VR::DT, 1, 1> {};
+		struct InformationSummary : TagTraits<0x0068, 0x6280, VR::ST, 1, 1> {};
+		struct ImplantRegulatoryDisapprovalCodeSequence : TagTraits<0x0068, 0x62a0, VR::SQ, 1, 1> {};
+		struct OverallTemplateSpatialTolerance : TagTraits<0x0068, 0x62a5, VR::FD, 1, 1> {};
+		struct HPGLDocumentSequence : TagTraits<0x0068, 0x62c0, VR::SQ, 1, 1> {};
+		struct HPGLDocumentID : TagTraits<0x0068, 0x62d0, VR::US, 1, 1> {};
+		struct HPGLDocumentLabel : TagTraits<0x0068, 0x62d5, VR::LO, 1, 1> {};
+		struct ViewOrientationCodeSequence : TagTraits<0x0068, 0x62e0, VR::SQ, 1, 1> {};
+		struct ViewOrientationModifierCodeSequence : TagTraits<0x0068, 0x62f0, VR::SQ, 1, 1> {};
+		struct HPGLDocumentScaling : TagTraits<0x0068, 0x62f2, VR::FD, 1, 1> {};
+		struct HPGLDocument : TagTraits<0x0068, 0x6300, VR::OB, 1, 1> {};
+		struct HPGLContourPenNumber : TagTraits<0x0068, 0x6310, VR::US, 1, 1> {};
+		struct HPGLPenSequence : TagTraits<0x0068, 0x6320, VR::SQ, 1, 1> {};
+		struct HPGLPenNumber : TagTraits<0x0068, 0x6330, VR::US, 1, 1> {};
+		struct HPGLPenLabel : TagTraits<0x0068, 0x6340, VR::LO, 1, 1> {};
+		struct HPGLPenDescription : TagTraits<0x0068, 0x6345, VR::ST, 1, 1> {};
+		struct RecommendedRotationPoint : TagTraits<0x0068, 0x6346, VR::FD, 2, 2> {};
+		struct BoundingRectangle : TagTraits<0x0068, 0x6347, VR::FD, 4, 4> {};
+		struct ImplantTemplate3DModelSurfaceNumber : TagTraits<0x0068, 0x6350, VR::US, 1, 0> {};
+		struct SurfaceModelDescriptionSequence : TagTraits<0x0068, 0x6360, VR::SQ, 1, 1> {};
+		struct SurfaceModelLabel : TagTraits<0x0068, 0x6380, VR::LO, 1, 1> {};
+		struct SurfaceModelScalingFactor : TagTraits<0x0068, 0x6390, VR::FD, 1, 1> {};
+		struct MaterialsCodeSequence : TagTraits<0x0068, 0x63a0, VR::SQ, 1, 1> {};
+		struct CoatingMaterialsCodeSequence : TagTraits<0x0068, 0x63a4, VR::SQ, 1, 1> {};
+		struct ImplantTypeCodeSequence : TagTraits<0x0068, 0x63a8, VR::SQ, 1, 1> {};
+		struct FixationMethodCodeSequence : TagTraits<0x0068, 0x63ac, VR::SQ, 1, 1> {};
+		struct MatingFeatureSetsSequence : TagTraits<0x0068, 0x63b0, VR::SQ, 1, 1> {};
+		struct MatingFeatureSetID : TagTraits<0x0068, 0x63c0, VR::US, 1, 1> {};
+		struct MatingFeatureSetLabel : TagTraits<0x0068, 0x63d0, VR::LO, 1, 1> {};
+		struct MatingFeatureSequence : TagTraits<0x0068, 0x63e0, VR::SQ, 1, 1> {};
+		struct MatingFeatureID : TagTraits<0x0068, 0x63f0, VR::US, 1, 1> {};
+		struct MatingFeatureDegreeOfFreedomSequence : TagTraits<0x0068, 0x6400, VR::SQ, 1, 1> {};
+		struct DegreeOfFreedomID : TagTraits<0x0068, 0x6410, VR::US, 1, 1> {};
+		struct DegreeOfFreedomType : TagTraits<0x0068, 0x6420, VR::CS, 1, 1> {};
+		struct TwoDMatingFeatureCoordinatesSequence : TagTraits<0x0068, 0x6430, VR::SQ, 1, 1> {};
+		struct ReferencedHPGLDocumentID : TagTraits<0x0068, 0x6440, VR::US, 1, 1> {};
+		struct TwoDMatingPoint : TagTraits<0x0068, 0x6450, VR::FD, 2, 2> {};
+		struct TwoDMatingAxes : TagTraits<0x0068, 0x6460, VR::FD, 4, 4> {};
+		struct TwoDDegreeOfFreedomSequence : TagTraits<0x0068, 0x6470, VR::SQ, 1, 1> {};
+		struct ThreeDDegreeOfFreedomAxis : TagTraits<0x0068, 0x6490, VR::FD, 3, 3> {};
+		struct RangeOfFreedom : TagTraits<0x0068, 0x64a0, VR::FD, 2, 2> {};
+		struct ThreeDMatingPoint : TagTraits<0x0068, 0x64c0, VR::FD, 3, 3> {};
+		struct ThreeDMatingAxes : TagTraits<0x0068, 0x64d0, VR::FD, 9, 9> {};
+		struct TwoDDegreeOfFreedomAxis : TagTraits<0x0068, 0x64f0, VR::FD, 3, 3> {};
+		struct PlanningLandmarkPointSequence : TagTraits<0x0068, 0x6500, VR::SQ, 1, 1> {};
+		struct PlanningLandmarkLineSequence : TagTraits<0x0068, 0x6510, VR::SQ, 1, 1> {};
+		struct PlanningLandmarkPlaneSequence : TagTraits<0x0068, 0x6520, VR::SQ, 1, 1> {};
+		struct PlanningLandmarkID : TagTraits<0x0068, 0x6530, VR::US, 1, 1> {};
+		struct PlanningLandmarkDescription : TagTraits<0x0068, 0x6540, VR::LO, 1, 1> {};
+		struct PlanningLandmarkIdentificationCodeSequence : TagTraits<0x0068, 0x6545, VR::SQ, 1, 1> {};
+		struct TwoDPointCoordinatesSequence : TagTraits<0x0068, 0x6550, VR::SQ, 1, 1> {};
+		struct TwoDPointCoordinates : TagTraits<0x0068, 0x6560, VR::FD, 2, 2> {};
+		struct ThreeDPointCoordinates : TagTraits<0x0068, 0x6590, VR::FD, 3, 3> {};
+		struct TwoDLineCoordinatesSequence : TagTraits<0x0068, 0x65a0, VR::SQ, 1, 1> {};
+		struct TwoDLineCoordinates : TagTraits<0x0068, 0x65b0, VR::FD, 4, 4> {};
+		struct ThreeDLineCoordinates : TagTraits<0x0068, 0x65d0, VR::FD, 6, 6> {};
+		struct TwoDPlaneCoordinatesSequence : TagTraits<0x0068, 0x65e0, VR::SQ, 1, 1> {};
+		struct TwoDPlaneIntersection : TagTraits<0x0068, 0x65f0, VR::FD, 4, 4> {};
+		struct ThreeDPlaneOrigin : TagTraits<0x0068, 0x6610, VR::FD, 3, 3> {};
+		struct ThreeDPlaneNormal : TagTraits<0x0068, 0x6620, VR::FD, 3, 3> {};
+		struct GraphicAnnotationSequence : TagTraits<0x0070, 0x0001, VR::SQ, 1, 1> {};
+		struct GraphicLayer : TagTraits<0x0070, 0x0002, VR::CS, 1, 1> {};
+		struct BoundingBoxAnnotationUnits : TagTraits<0x0070, 0x0003, VR::CS, 1, 1> {};
+		struct AnchorPointAnnotationUnits : TagTraits<0x0070, 0x0004, VR::CS, 1, 1> {};
+		struct GraphicAnnotationUnits : TagTraits<0x0070, 0x0005, VR::CS, 1, 1> {};
+		struct UnformattedTextValue : TagTraits<0x0070, 0x0006, VR::ST, 1, 1> {};
+		struct TextObjectSequence : TagTraits<0x0070, 0x0008, VR::SQ, 1, 1> {};
+		struct GraphicObjectSequence : TagTraits<0x0070, 0x0009, VR::SQ, 1, 1> {};
+		struct BoundingBoxTopLeftHandCorner : TagTraits<0x0070, 0x0010, VR::FL, 2, 2> {};
+		struct BoundingBoxBottomRightHandCorner : TagTraits<0x0070, 0x0011, VR::FL, 2, 2> {};
+		struct BoundingBoxTextHorizontalJustification : TagTraits<0x0070, 0x0012, VR::CS, 1, 1> {};
+		struct AnchorPoint : TagTraits<0x0070, 0x0014, VR::FL, 2, 2> {};
+		struct AnchorPointVisibility : TagTraits<0x0070, 0x0015, VR::CS, 1, 1> {};
+		struct GraphicDimensions : TagTraits<0x0070, 0x0020, VR::US, 1, 1> {};
+		struct NumberOfGraphicPoints : TagTraits<0x0070, 0x0021, VR::US, 1, 1> {};
+		struct GraphicData : TagTraits<0x0070, 0x0022, VR::FL, 2, 0> {};
+		struct GraphicType : TagTraits<0x0070, 0x0023, VR::CS, 1, 1> {};
+		struct GraphicFilled : TagTraits<0x0070, 0x0024, VR::CS, 1, 1> {};
+		struct ImageRotationRetired : TagTraits<0x0070, 0x0040, VR::IS, 1, 1> {};
+		struct ImageHorizontalFlip : TagTraits<0x0070, 0x0041, VR::CS, 1, 1> {};
+		struct ImageRotation : TagTraits<0x0070, 0x0042, VR::US, 1, 1> {};
+		struct DisplayedAreaTopLeftHandCornerTrial : TagTraits<0x0070, 0x0050, VR::US, 2, 2> {};
+		struct DisplayedAreaBottomRightHandCornerTrial : TagTraits<0x0070, 0x0051, VR::US, 2, 2> {};
+		struct DisplayedAreaTopLeftHandCorner : TagTraits<0x0070, 0x0052, VR::SL, 2, 2> {};
+		struct DisplayedAreaBottomRightHandCorner : TagTraits<0x0070, 0x0053, VR::SL, 2, 2> {};
+		struct DisplayedAreaSelectionSequence : TagTraits<0x0070, 0x005a, VR::SQ, 1, 1> {};
+		struct GraphicLayerSequence : TagTraits<0x0070, 0x0060, VR::SQ, 1, 1> {};
+		struct GraphicLayerOrder : TagTraits<0x0070, 0x0062, VR::IS, 1, 1> {};
+		struct GraphicLayerRecommendedDisplayGrayscaleValue : TagTraits<0x0070, 0x0066, VR::US, 1, 1> {};
+		struct GraphicLayerRecommendedDisplayRGBValue : TagTraits<0x0070, 0x0067, VR::US, 3, 3> {};
+		struct GraphicLayerDescription : TagTraits<0x0070, 0x0068, VR::LO, 1, 1> {};
+		struct ContentLabel : TagTraits<0x0070, 0x0080, VR::CS, 1, 1> {};
+		struct ContentDescription : TagTraits<0x0070, 0x0081, VR::LO, 1, 1> {};
+		struct PresentationCreationDate : TagTraits<0x0070, 0x0082, VR::DA, 1, 1> {};
+		struct PresentationCreationTime : TagTraits<0x0070, 0x0083, VR::TM, 1, 1> {};
+		struct ContentCreatorName : TagTraits<0x0070, 0x0084, VR::PN, 1, 1> {};
+		struct ContentCreatorIdentificationCodeSequence : TagTraits<0x0070, 0x0086, VR::SQ, 1, 1> {};
+		struct AlternateContentDescriptionSequence : TagTraits<0x0070, 0x0087, VR::SQ, 1, 1> {};
+		struct PresentationSizeMode : TagTraits<0x0070, 0x0100, VR::CS, 1, 1> {};
+		struct PresentationPixelSpacing : TagTraits<0x0070, 0x0101, VR::DS, 2, 2> {};
+		struct PresentationPixelAspectRatio : TagTraits<0x0070, 0x0102, VR::IS, 2, 2> {};
+		struct PresentationPixelMagnificationRatio : TagTraits<0x0070, 0x0103, VR::FL, 1, 1> {};
+		struct GraphicGroupLabel : TagTraits<0x0070, 0x0207, VR::LO, 1, 1> {};
+		struct GraphicGroupDescription : TagTraits<0x0070, 0x0208, VR::ST, 1, 1> {};
+		struct CompoundGraphicSequence : TagTraits<0x0070, 0x0209, VR::SQ, 1, 1> {};
+		struct CompoundGraphicInstanceID : TagTraits<0x0070, 0x0226, VR::UL, 1, 1> {};
+		struct FontName : TagTraits<0x0070, 0x0227, VR::LO, 1, 1> {};
+		struct FontNameType : TagTraits<0x0070, 0x0228, VR::CS, 1, 1> {};
+		struct CSSFontName : TagTraits<0x0070, 0x0229, VR::LO, 1, 1> {};
+		struct RotationAngle : TagTraits<0x0070, 0x0230, VR::FD, 1, 1> {};
+		struct TextStyleSequence : TagTraits<0x0070, 0x0231, VR::SQ, 1, 1> {};
+		struct LineStyleSequence : TagTraits<0x0070, 0x0232, VR::SQ, 1, 1> {};
+		struct FillStyleSequence : TagTraits<0x0070, 0x0233, VR::SQ, 1, 1> {};
+		struct GraphicGroupSequence : TagTraits<0x0070, 0x0234, VR::SQ, 1, 1> {};
+		struct TextColorCIELabValue : TagTraits<0x0070, 0x0241, VR::US, 3, 3> {};
+		struct HorizontalAlignment : TagTraits<0x0070, 0x0242, VR::CS, 1, 1> {};
+		struct VerticalAlignment : TagTraits<0x0070, 0x0243, VR::CS, 1, 1> {};
+		struct ShadowStyle : TagTraits<0x0070, 0x0244, VR::CS, 1, 1> {};
+		struct ShadowOffsetX : TagTraits<0x0070, 0x0245, VR::FL, 1, 1> {};
+		struct ShadowOffsetY : TagTraits<0x0070, 0x0246, VR::FL, 1, 1> {};
+		struct ShadowColorCIELabValue : TagTraits<0x0070, 0x0247, VR::US, 3, 3> {};
+		struct Underlined : TagTraits<0x0070, 0x0248, VR::CS, 1, 1> {};
+		struct Bold : TagTraits<0x0070, 0x0249, VR::CS, 1, 1> {};
+		struct Italic : TagTraits<0x0070, 0x0250, VR::CS, 1, 1> {};
+		struct PatternOnColorCIELabValue : TagTraits<0x0070, 0x0251, VR::US, 3, 3> {};
+		struct PatternOffColorCIELabValue : TagTraits<0x0070, 0x0252, VR::US, 3, 3> {};
+		struct LineThickness : TagTraits<0x0070, 0x0253, VR::FL, 1, 1> {};
+		struct LineDashingStyle : TagTraits<0x0070, 0x0254, VR::CS, 1, 1> {};
+		struct LinePattern : TagTraits<0x0070, 0x0255, VR::UL, 1, 1> {};
+		struct FillPattern : TagTraits<0x0070, 0x0256, VR::OB, 1, 1> {};
+		struct FillMode : TagTraits<0x0070, 0x0257, VR::CS, 1, 1> {};
+		struct ShadowOpacity : TagTraits<0x0070, 0x0258, VR::FL, 1, 1> {};
+		struct GapLength : TagTraits<0x0070, 0x0261, VR::FL, 1, 1> {};
+		struct DiameterOfVisibility : TagTraits<0x0070, 0x0262, VR::FL, 1, 1> {};
+		struct RotationPoint : TagTraits<0x0070, 0x0273, VR::FL, 2, 2> {};
+		struct TickAlignment : TagTraits<0x0070, 0x0274, VR::CS, 1, 1> {};
+		struct ShowTickLabel : TagTraits<0x0070, 0x0278, VR::CS, 1, 1> {};
+		struct TickLabelAlignment : TagTraits<0x0070, 0x0279, VR::CS, 1, 1> {};
+		struct CompoundGraphicUnits : TagTraits<0x0070, 0x0282, VR::CS, 1, 1> {};
+		struct PatternOnOpacity : TagTraits<0x0070, 0x0284, VR::FL, 1, 1> {};
+		struct PatternOffOpacity : TagTraits<0x0070, 0x0285, VR::FL, 1, 1> {};
+		struct MajorTicksSequence : TagTraits<0x0070, 0x0287, VR::SQ, 1, 1> {};
+		struct TickPosition : TagTraits<0x0070, 0x0288, VR::FL, 1, 1> {};
+		struct TickLabel : TagTraits<0x0070, 0x0289, VR::SH, 1, 1> {};
+		struct CompoundGraphicType : TagTraits<0x0070, 0x0294, VR::CS, 1, 1> {};
+		struct GraphicGroupID : TagTraits<0x0070, 0x0295, VR::UL, 1, 1> {};
+		struct ShapeType : TagTraits<0x0070, 0x0306, VR::CS, 1, 1> {};
+		struct RegistrationSequence : TagTraits<0x0070, 0x0308, VR::SQ, 1, 1> {};
+		struct MatrixRegistrationSequence : TagTraits<0x0070, 0x0309, VR::SQ, 1, 1> {};
+		struct MatrixSequence : TagTraits<0x0070, 0x030a, VR::SQ, 1, 1> {};
+		struct FrameOfReferenceToDisplayedCoordinateSystemTransformationMatrix : TagTraits<0x0070, 0x030b, VR::FD, 16, 16> {};
+		struct FrameOfReferenceTransformationMatrixType : TagTraits<0x0070, 0x030c, VR::CS, 1, 1> {};
+		struct RegistrationTypeCodeSequence : TagTraits<0x0070, 0x030d, VR::SQ, 1, 1> {};
+		struct FiducialDescription : TagTraits<0x0070, 0x030f, VR::ST, 1, 1> {};
+		struct FiducialIdentifier : TagTraits<0x0070, 0x0310, VR::SH, 1, 1> {};
+		struct FiducialIdentifierCodeSequence : TagTraits<0x0070, 0x0311, VR::SQ, 1, 1> {};
+		struct ContourUncertaintyRadius : TagTraits<0x0070, 0x0312, VR::FD, 1, 1> {};
+		struct UsedFiducialsSequence : TagTraits<0x0070, 0x0314, VR::SQ, 1, 1> {};
+		struct GraphicCoordinatesDataSequence : TagTraits<0x0070, 0x0318, VR::SQ, 1, 1> {};
+		struct FiducialUID : TagTraits<0x0070, 0x031a, VR::UI, 1, 1> {};
+		struct FiducialSetSequence : TagTraits<0x0070, 0x031c, VR::SQ, 1, 1> {};
+		struct FiducialSequence : TagTraits<0x0070, 0x031e, VR::SQ, 1, 1> {};
+		struct FiducialsPropertyCategoryCodeSequence : TagTraits<0x0070, 0x031f, VR::SQ, 1, 1> {};
+		struct GraphicLayerRecommendedDisplayCIELabValue : TagTraits<0x0070, 0x0401, VR::US, 3, 3> {};
+		struct BlendingSequence : TagTraits<0x0070, 0x0402, VR::SQ, 1, 1> {};
+		struct RelativeOpacity : TagTraits<0x0070, 0x0403, VR::FL, 1, 1> {};
+		struct ReferencedSpatialRegistrationSequence : TagTraits<0x0070, 0x0404, VR::SQ, 1, 1> {};
+		struct BlendingPosition : TagTraits<0x0070, 0x0405, VR::CS, 1, 1> {};
+		struct PresentationDisplayCollectionUID : TagTraits<0x0070, 0x1101, VR::UI, 1, 1> {};
+		struct PresentationSequenceCollectionUID : TagTraits<0x0070, 0x1102, VR::UI, 1, 1> {};
+		struct PresentationSequencePositionIndex : TagTraits<0x0070, 0x1103, VR::US, 1, 1> {};
+		struct RenderedImageReferenceSequence : TagTraits<0x0070, 0x1104, VR::SQ, 1, 1> {};
+		struct VolumetricPresentationStateInputSequence : TagTraits<0x0070, 0x1201, VR::SQ, 1, 1> {};
+		struct PresentationInputType : TagTraits<0x0070, 0x1202, VR::CS, 1, 1> {};
+		struct InputSequencePositionIndex : TagTraits<0x0070, 0x1203, VR::US, 1, 1> {};
+		struct Crop : TagTraits<0x0070, 0x1204, VR::CS, 1, 1> {};
+		struct CroppingSpecificationIndex : TagTraits<0x0070, 0x1205, VR::US, 1, 0> {};
+		struct CompositingMethod : TagTraits<0x0070, 0x1206, VR::CS, 1, 1> {};
+		struct VolumetricPresentationInputNumber : TagTraits<0x0070, 0x1207, VR::US, 1, 1> {};
+		struct ImageVolumeGeometry : TagTraits<0x0070, 0x1208, VR::CS, 1, 1> {};
+		struct VolumetricPresentationInputSetUID : TagTraits<0x0070, 0x1209, VR::UI, 1, 1> {};
+		struct VolumetricPresentationInputSetSequence : TagTraits<0x0070, 0x120a, VR::SQ, 1, 1> {};
+		struct GlobalCrop : TagTraits<0x0070, 0x120b, VR::CS, 1, 1> {};
+		struct GlobalCroppingSpecificationIndex : TagTraits<0x0070, 0x120c, VR::US, 1, 0> {};
+		struct RenderingMethod : TagTraits<0x0070, 0x120d, VR::CS, 1, 1> {};
+		struct VolumeCroppingSequence : TagTraits<0x0070, 0x1301, VR::SQ, 1, 1> {};
+		struct VolumeCroppingMethod : TagTraits<0x0070, 0x1302, VR::CS, 1, 1> {};
+		struct BoundingBoxCrop : TagTraits<0x0070, 0x1303, VR::FD, 6, 6> {};
+		struct ObliqueCroppingPlaneSequence : TagTraits<0x0070, 0x1304, VR::SQ, 1, 1> {};
+		struct Plane : TagTraits<0x0070, 0x1305, VR::FD, 4, 4> {};
+		struct PlaneNormal : TagTraits<0x0070, 0x1306, VR::FD, 3, 3> {};
+		struct CroppingSpecificationNumber : TagTraits<0x0070, 0x1309, VR::US, 1, 1> {};
+		struct MultiPlanarReconstructionStyle : TagTraits<0x0070, 0x1501, VR::CS, 1, 1> {};
+		struct MPRThicknessType : TagTraits<0x0070, 0x1502, VR::CS, 1, 1> {};
+		struct MPRSlabThickness : TagTraits<0x0070, 0x1503, VR::FD, 1, 1> {};
+		struct MPRTopLeftHandCorner : TagTraits<0x0070, 0x1505, VR::FD, 3, 3> {};
+		struct MPRViewWidthDirection : TagTraits<0x0070, 0x1507, VR::FD, 3, 3> {};
+		struct MPRViewWidth : TagTraits<0x0070, 0x1508, VR::FD, 1, 1> {};
+		struct NumberOfVolumetricCurvePoints : TagTraits<0x0070, 0x150c, VR::UL, 1, 1> {};
+		struct VolumetricCurvePoints : TagTraits<0x0070, 0x150d, VR::OD, 1, 1> {};
+		struct MPRViewHeightDirection : TagTraits<0x0070, 0x1511, VR::FD, 3, 3> {};
+		struct MPRViewHeight : TagTraits<0x0070, 0x1512, VR::FD, 1, 1> {};
+		struct RenderProjection : TagTraits<0x0070, 0x1602, VR::CS, 1, 1> {};
+		struct ViewpointPosition : TagTraits<0x0070, 0x1603, VR::FD, 3, 3> {};
+		struct ViewpointLookAtPoint : TagTraits<0x0070, 0x1604, VR::FD, 3, 3> {};
+		struct ViewpointUpDirection : TagTraits<0x0070, 0x1605, VR::FD, 3, 3> {};
+		struct RenderFieldOfView : TagTraits<0x0070, 0x1606, VR::FD, 6, 6> {};
+		struct SamplingStepSize : TagTraits<0x0070, 0x1607, VR::FD, 1, 1> {};
+		struct ShadingStyle : TagTraits<0x0070, 0x1701, VR::CS, 1, 1> {};
+		struct AmbientReflectionIntensity : TagTraits<0x0070, 0x1702, VR::FD, 1, 1> {};
+		struct LightDirection : TagTraits<0x0070, 0x1703, VR::FD, 3, 3> {};
+		struct DiffuseReflectionIntensity : TagTraits<0x0070, 0x1704, VR::FD, 1, 1> {};
+		struct SpecularReflectionIntensity : TagTraits<0x0070, 0x1705, VR::FD, 1, 1> {};
+		struct Shininess : TagTraits<0x0070, 0x1706, VR::FD, 1, 1> {};
+		struct PresentationStateClassificationComponentSequence : TagTraits<0x0070, 0x1801, VR::SQ, 1, 1> {};
+		struct ComponentType : TagTraits<0x0070, 0x1802, VR::CS, 1, 1> {};
+		struct ComponentInputSequence : TagTraits<0x0070, 0x1803, VR::SQ, 1, 1> {};
+		struct VolumetricPresentationInputIndex : TagTraits<0x0070, 0x1804, VR::US, 1, 1> {};
+		struct PresentationStateCompositorComponentSequence : TagTraits<0x0070, 0x1805, VR::SQ, 1, 1> {};
+		struct WeightingTransferFunctionSequence : TagTraits<0x0070, 0x1806, VR::SQ, 1, 1> {};
+		struct WeightingLookupTableDescriptor : TagTraits<0x0070, 0x1807, VR::US, 3, 3> {};
+		struct WeightingLookupTableData : TagTraits<0x0070, 0x1808, VR::OB, 1, 1> {};
+		struct VolumetricAnnotationSequence : TagTraits<0x0070, 0x1901, VR::SQ, 1, 1> {};
+		struct ReferencedStructuredContextSequence : TagTraits<0x0070, 0x1903, VR::SQ, 1, 1> {};
+		struct ReferencedContentItem : TagTraits<0x0070, 0x1904, VR::UI, 1, 1> {};
+		struct VolumetricPresentationInputAnnotationSequence : TagTraits<0x0070, 0x1905, VR::SQ, 1, 1> {};
+		struct AnnotationClipping : TagTraits<0x0070, 0x1907, VR::CS, 1, 1> {};
+		struct PresentationAnimationStyle : TagTraits<0x0070, 0x1a01, VR::CS, 1, 1> {};
+		struct RecommendedAnimationRate : TagTraits<0x0070, 0x1a03, VR::FD, 1, 1> {};
+		struct AnimationCurveSequence : TagTraits<0x0070, 0x1a04, VR::SQ, 1, 1> {};
+		struct AnimationStepSize : TagTraits<0x0070, 0x1a05, VR::FD, 1, 1> {};
+		struct SwivelRange : TagTraits<0x0070, 0x1a06, VR::FD, 1, 1> {};
+		struct VolumetricCurveUpDirections : TagTraits<0x0070, 0x1a07, VR::OD, 1, 1> {};
+		struct VolumeStreamSequence : TagTraits<0x0070, 0x1a08, VR::SQ, 1, 1> {};
+		struct RGBATransferFunctionDescription : TagTraits<0x0070, 0x1a09, VR::LO, 1, 1> {};
+		struct AdvancedBlendingSequence : TagTraits<0x0070, 0x1b01, VR::SQ, 1, 1> {};
+		struct BlendingInputNumber : TagTraits<0x0070, 0x1b02, VR::US, 1, 1> {};
+		struct BlendingDisplayInputSequence : TagTraits<0x0070, 0x1b03, VR::SQ, 1, 1> {};
+		struct BlendingDisplaySequence : TagTraits<0x0070, 0x1b04, VR::SQ, 1, 1> {};
+		struct BlendingMode : TagTraits<0x0070, 0x1b06, VR::CS, 1, 1> {};
+		struct TimeSeriesBlending : TagTraits<0x0070, 0x1b07, VR::CS, 1, 1> {};
+		struct GeometryForDisplay : TagTraits<0x0070, 0x1b08, VR::CS, 1, 1> {};
+		struct ThresholdSequence : TagTraits<0x0070, 0x1b11, VR::SQ, 1, 1> {};
+		struct ThresholdValueSequence : TagTraits<0x0070, 0x1b12, VR::SQ, 1, 1> {};
+		struct ThresholdType : TagTraits<0x0070, 0x1b13, VR::CS, 1, 1> {};
+		struct ThresholdValue : TagTraits<0x0070, 0x1b14, VR::FD, 1, 1> {};
+		struct HangingProtocolName : TagTraits<0x0072, 0x0002, VR::SH, 1, 1> {};
+		struct HangingProtocolDescription : TagTraits<0x0072, 0x0004, VR::LO, 1, 1> {};
+		struct HangingProtocolLevel : TagTraits<0x0072, 0x0006, VR::CS, 1, 1> {};
+		struct HangingProtocolCreator : TagTraits<0x0072, 0x0008, VR::LO, 1, 1> {};
+		struct HangingProtocolCreationDateTime : TagTraits<0x0072, 0x000a, VR::DT, 1, 1> {};
+		struct HangingProtocolDefinitionSequence : TagTraits<0x0072, 0x000c, VR::SQ, 1, 1> {};
+		struct HangingProtocolUserIdentificationCodeSequence : TagTraits<0x0072, 0x000e, VR::SQ, 1, 1> {};
+		struct HangingProtocolUserGroupName : TagTraits<0x0072, 0x0010, VR::LO, 1, 1> {};
+		struct SourceHangingProtocolSequence : TagTraits<0x0072, 0x0012, VR::SQ, 1, 1> {};
+		struct NumberOfPriorsReferenced : TagTraits<0x0072, 0x0014, VR::US, 1, 1> {};
+		struct ImageSetsSequence : TagTraits<0x0072, 0x0020, VR::SQ, 1, 1> {};
+		struct ImageSetSelectorSequence : TagTraits<0x0072, 0x0022, VR::SQ, 1, 1> {};
+		struct ImageSetSelectorUsageFlag : TagTraits<0x0072, 0x0024, VR::CS, 1, 1> {};
+		struct SelectorAttribute : TagTraits<0x0072, 0x0026, VR::AT, 1, 1> {};
+		struct SelectorValueNumber : TagTraits<0x0072, 0x0028, VR::US, 1, 1> {};
+		struct TimeBasedImageSetsSequence : TagTraits<0x0072, 0x0030, VR::SQ, 1, 1> {};
+		struct ImageSetNumber : TagTraits<0x0072, 0x0032, VR::US, 1, 1> {};
+		struct ImageSetSelectorCategory : TagTraits<0x0072, 0x0034, VR::CS, 1, 1> {};
+		struct RelativeTime : TagTraits<0x0072, 0x0038, VR::US, 2, 2> {};
+		struct RelativeTimeUnits : TagTraits<0x0072, 0x003a, VR::CS, 1, 1> {};
+		struct AbstractPriorValue : TagTraits<0x0072, 0x003c, VR::SS, 2, 2> {};
+		struct AbstractPriorCodeSequence : TagTraits<0x0072, 0x003e, VR::SQ, 1, 1> {};
+		struct ImageSetLabel : TagTraits<0x0072, 0x0040, VR::LO, 1, 1> {};
+		struct SelectorAttributeVR : TagTraits<0x0072, 0x0050, VR::CS, 1, 1> {};
+		struct SelectorSequencePointer : TagTraits<0x0072, 0x0052, VR::AT, 1, 0> {};
+		struct SelectorSequencePointerPrivateCreator : TagTraits<0x0072, 0x0054, VR::LO, 1, 0> {};
+		struct SelectorAttributePrivateCreator : TagTraits<0x0072, 0x0056, VR::LO, 1, 1> {};
+		struct SelectorAEValue : TagTraits<0x0072, 0x005e, VR::AE, 1, 0> {};
+		struct SelectorASValue : TagTraits<0x0072, 0x005f, VR::AS, 1, 0> {};
+		struct SelectorATValue : TagTraits<0x0072, 0x0060, VR::AT, 1, 0> {};
+		struct SelectorDAValue : TagTraits<0x0072, 0x0061, VR::DA, 1, 0> {};
+		struct SelectorCSValue : TagTraits<0x0072, 0x0062, VR::CS, 1, 0> {};
+		struct SelectorDTValue : TagTraits<0x0072, 0x0063, VR::DT, 1, 0> {};
+		struct SelectorISValue : TagTraits<0x0072, 0x0064, VR::IS, 1, 0> {};
+		struct SelectorOBValue : TagTraits<0x0072, 0x0065, VR::OB, 1, 1> {};
+		struct SelectorLOValue : TagTraits<0x0072, 0x0066, VR::LO, 1, 0> {};
+		struct SelectorOFValue : TagTraits<0x0072, 0x0067, VR::OF, 1, 1> {};
+		struct SelectorLTValue : TagTraits<0x0072, 0x0068, VR::LT, 1, 1> {};
+		struct SelectorOWValue : TagTraits<0x0072, 0x0069, VR::OW, 1, 1> {};
+		struct SelectorPNValue : TagTraits<0x0072, 0x006a, VR::PN, 1, 0> {};
+		struct SelectorTMValue : TagTraits<0x0072, 0x006b, VR::TM, 1, 0> {};
+		struct SelectorSHValue : TagTraits<0x0072, 0x006c, VR::SH, 1, 0> {};
+		struct SelectorUNValue : TagTraits<0x0072, 0x006d, VR::UN, 1, 1> {};
+		struct SelectorSTValue : TagTraits<0x0072, 0x006e, VR::ST, 1, 1> {};
+		struct SelectorUCValue : TagTraits<0x0072, 0x006f, VR::UC, 1, 0> {};
+		struct SelectorUTValue : TagTraits<0x0072, 0x0070, VR::UT, 1, 1> {};
+		struct SelectorURValue : TagTraits<0x0072, 0x0071, VR::UR, 1, 1> {};
+		struct SelectorDSValue : TagTraits<0x0072, 0x0072, VR::DS, 1, 0> {};
+		struct SelectorODValue : TagTraits<0x0072, 0x0073, VR::OD, 1, 1> {};
+		struct SelectorFDValue : TagTraits<0x0072, 0x0074, VR::FD, 1, 0> {};
+		struct SelectorOLValue : TagTraits<0x0072, 0x0075, VR::OL, 1, 1> {};
+		struct SelectorFLValue : TagTraits<0x0072, 0x0076, VR::FL, 1, 0> {};
+		struct SelectorULValue : TagTraits<0x0072, 0x0078, VR::UL, 1, 0> {};
+		struct SelectorUSValue : TagTraits<0x0072, 0x007a, VR::US, 1, 0> {};
+		struct SelectorSLValue : TagTraits<0x0072, 0x007c, VR::SL, 1, 0> {};
+		struct SelectorSSValue : TagTraits<0x0072, 0x007e, VR::SS, 1, 0> {};
+		struct SelectorUIValue : TagTraits<0x0072, 0x007f, VR::UI, 1, 0> {};
+		struct SelectorCodeSequenceValue : TagTraits<0x0072, 0x0080, VR::SQ, 1, 1> {};
+		struct NumberOfScreens : TagTraits<0x0072, 0x0100, VR::US, 1, 1> {};
+		struct NominalScreenDefinitionSequence : TagTraits<0x0072, 0x0102, VR::SQ, 1, 1> {};
+		struct NumberOfVerticalPixels : TagTraits<0x0072, 0x0104, VR::US, 1, 1> {};
+		struct NumberOfHorizontalPixels : TagTraits<0x0072, 0x0106, VR::US, 1, 1> {};
+		struct DisplayEnvironmentSpatialPosition : TagTraits<0x0072, 0x0108, VR::FD, 4, 4> {};
+		struct ScreenMinimumGrayscaleBitDepth : TagTraits<0x0072, 0x010a, VR::US, 1, 1> {};
+		struct ScreenMinimumColorBitDepth : TagTraits<0x0072, 0x010c, VR::US, 1, 1> {};
+		struct ApplicationMaximumRepaintTime : TagTraits<0x0072, 0x010e, VR::US, 1, 1> {};
+		struct DisplaySetsSequence : TagTraits<0x0072, 0x0200, VR::SQ, 1, 1> {};
+		struct DisplaySetNumber : TagTraits<0x0072, 0x0202, VR::US, 1, 1> {};
+		struct DisplaySetLabel : TagTraits<0x0072, 0x0203, VR::LO, 1, 1> {};
+		struct DisplaySetPresentationGroup : TagTraits<0x0072, 0x0204, VR::US, 1, 1> {};
+		struct DisplaySetPresentationGroupDescription : TagTraits<0x0072, 0x0206, VR::LO, 1, 1> {};
+		struct PartialDataDisplayHandling : TagTraits<0x0072, 0x0208, VR::CS, 1, 1> {};
+		struct SynchronizedScrollingSequence : TagTraits<0x0072, 0x0210, VR::SQ, 1, 1> {};
+		struct DisplaySetScrollingGroup : TagTraits<0x0072, 0x0212, VR::US, 2, 0> {};
+		struct NavigationIndicatorSequence : TagTraits<0x0072, 0x0214, VR::SQ, 1, 1> {};
+		struct NavigationDisplaySet : TagTraits<0x0072, 0x0216, VR::US, 1, 1> {};
+		struct ReferenceDisplaySets : TagTraits<0x0072, 0x0218, VR::US, 1, 0> {};
+		struct ImageBoxesSequence : TagTraits<0x0072, 0x0300, VR::SQ, 1, 1> {};
+		struct ImageBoxNumber : TagTraits<0x0072, 0x0302, VR::US, 1, 1> {};
+		struct ImageBoxLayoutType : TagTraits<0x0072, 0x0304, VR::CS, 1, 1> {};
+		struct ImageBoxTileHorizontalDimension : TagTraits<0x0072, 0x0306, VR::US, 1, 1> {};
+		struct ImageBoxTileVerticalDimension : TagTraits<0x0072, 0x0308, VR::US, 1, 1> {};
+		struct ImageBoxScrollDirection : TagTraits<0x0072, 0x0310, VR::CS, 1, 1> {};
+		struct ImageBoxSmallScrollType : TagTraits<0x0072, 0x0312, VR::CS, 1, 1> {};
+		struct ImageBoxSmallScrollAmount : TagTraits<0x0072, 0x0314, VR::US, 1, 1> {};
+		struct ImageBoxLargeScrollType : TagTraits<0x0072, 0x0316, VR::CS, 1, 1> {};
+		struct ImageBoxLargeScrollAmount : TagTraits<0x0072, 0x0318, VR::US, 1, 1> {};
+		struct ImageBoxOverlapPriority : TagTraits<0x0072, 0x0320, VR::US, 1, 1> {};
+		struct CineRelativeToRealTime : TagTraits<0x0072, 0x0330, VR::FD, 1, 1> {};
+		struct FilterOperationsSequence : TagTraits<0x0072, 0x0400, VR::SQ, 1, 1> {};
+		struct FilterByCategory : TagTraits<0x0072, 0x0402, VR::CS, 1, 1> {};
+		struct FilterByAttributePresence : TagTraits<0x0072, 0x0404, VR::CS, 1, 1> {};
+		struct FilterByOperator : TagTraits<0x0072, 0x0406, VR::CS, 1, 1> {};
+		struct StructuredDisplayBackgroundCIELabValue : TagTraits<0x0072, 0x0420, VR::US, 3, 3> {};
+		struct EmptyImageBoxCIELabValue : TagTraits<0x0072, 0x0421, VR::US, 3, 3> {};
+		struct StructuredDisplayImageBoxSequence : TagTraits<0x0072, 0x0422, VR::SQ, 1, 1> {};
+		struct StructuredDisplayTextBoxSequence : TagTraits<0x0072, 0x0424, VR::SQ, 1, 1> {};
+		struct ReferencedFirstFrameSequence : TagTraits<0x0072, 0x0427, VR::SQ, 1, 1> {};
+		struct ImageBoxSynchronizationSequence : TagTraits<0x0072, 0x0430, VR::SQ, 1, 1> {};
+		struct SynchronizedImageBoxList : TagTraits<0x0072, 0x0432, VR::US, 2, 0> {};
+		struct TypeOfSynchronization : TagTraits<0x0072, 0x0434, VR::CS, 1, 1> {};
+		struct BlendingOperationType : TagTraits<0x0072, 0x0500, VR::CS, 1, 1> {};
+		struct ReformattingOperationType : TagTraits<0x0072, 0x0510, VR::CS, 1, 1> {};
+		struct ReformattingThickness : TagTraits<0x0072, 0x0512, VR::FD, 1, 1> {};
+		struct ReformattingInterval : TagTraits<0x0072, 0x0514, VR::FD, 1, 1> {};
+		struct ReformattingOperationInitialViewDirection : TagTraits<0x0072, 0x0516, VR::CS, 1, 1> {};
+		struct ThreeDRenderingType : TagTraits<0x0072, 0x0520, VR::CS, 1, 0> {};
+		struct SortingOperationsSequence : TagTraits<0x0072, 0x0600, VR::SQ, 1, 1> {};
+		struct SortByCategory : TagTraits<0x0072, 0x0602, VR::CS, 1, 1> {};
+		struct SortingDirection : TagTraits<0x0072, 0x0604, VR::CS, 1, 1> {};
+		struct DisplaySetPatientOrientation : TagTraits<0x0072, 0x0700, VR::CS, 2, 2> {};
+		struct VOIType : TagTraits<0x0072, 0x0702, VR::CS, 1, 1> {};
+		struct PseudoColorType : TagTraits<0x0072, 0x0704, VR::CS, 1, 1> {};
+		struct PseudoColorPaletteInstanceReferenceSequence : TagTraits<0x0072, 0x0705, VR::SQ, 1, 1> {};
+		struct ShowGrayscaleInverted : TagTraits<0x0072, 0x0706, VR::CS, 1, 1> {};
+		struct ShowImageTrueSizeFlag : TagTraits<0x0072, 0x0710, VR::CS, 1, 1> {};
+		struct ShowGraphicAnnotationFlag : TagTraits<0x0072, 0x0712, VR::CS, 1, 1> {};
+		struct ShowPatientDemographicsFlag : TagTraits<0x0072, 0x0714, VR::CS, 1, 1> {};
+		struct ShowAcquisitionTechniquesFlag : TagTraits<0x0072, 0x0716, VR::CS, 1, 1> {};
+		struct DisplaySetHorizontalJustification : TagTraits<0x0072, 0x0717, VR::CS, 1, 1> {};
+		struct DisplaySetVerticalJustification : TagTraits<0x0072, 0x0718, VR::CS, 1, 1> {};
+		struct ContinuationStartMeterset : TagTraits<0x0074, 0x0120, VR::FD, 1, 1> {};
+		struct ContinuationEndMeterset : TagTraits<0x0074, 0x0121, VR::FD, 1, 1> {};
+		struct ProcedureStepState : TagTraits<0x0074, 0x1000, VR::CS, 1, 1> {};
+		struct ProcedureStepProgressInformationSequence : TagTraits<0x0074, 0x1002, VR::SQ, 1, 1> {};
+		struct ProcedureStepProgress : TagTraits<0x0074, 0x1004, VR::DS, 1, 1> {};
+		struct ProcedureStepProgressDescription : TagTraits<0x0074, 0x1006, VR::ST, 1, 1> {};
+		struct ProcedureStepCommunicationsURISequence : TagTraits<0x0074, 0x1008, VR::SQ, 1, 1> {};
+		struct ContactURI : TagTraits<0x0074, 0x100a, VR::UR, 1, 1> {};
+		struct ContactDisplayName : TagTraits<0x0074, 0x100c, VR::LO, 1, 1> {};
+		struct ProcedureStepDiscontinuationReasonCodeSequence : TagTraits<0x0074, 0x100e, VR::SQ, 1, 1> {};
+		struct BeamTaskSequence : TagTraits<0x0074, 0x1020, VR::SQ, 1, 1> {};
+		struct BeamTaskType : TagTraits<0x0074, 0x1022, VR::CS, 1, 1> {};
+		struct BeamOrderIndexTrial : TagTraits<0x0074, 0x1024, VR::IS, 1, 1> {};
+		struct AutosequenceFlag : TagTraits<0x0074, 0x1025, VR::CS, 1, 1> {};
+		struct TableTopVerticalAdjustedPosition : TagTraits<0x0074, 0x1026, VR::FD, 1, 1> {};
+		struct TableTopLongitudinalAdjustedPosition : TagTraits<0x0074, 0x1027, VR::FD, 1, 1> {};
+		struct TableTopLateralAdjustedPosition : TagTraits<0x0074, 0x1028, VR::FD, 1, 1> {};
+		struct PatientSupportAdjustedAngle : TagTraits<0x0074, 0x102a, VR::FD, 1, 1> {};
+		struct TableTopEccentricAdjustedAngle : TagTraits<0x0074, 0x102b, VR::FD, 1, 1> {};
+		struct TableTopPitchAdjustedAngle : TagTraits<0x0074, 0x102c, VR::FD, 1, 1> {};
+		struct TableTopRollAdjustedAngle : TagTraits<0x0074, 0x102d, VR::FD, 1, 1> {};
+		struct DeliveryVerificationImageSequence : TagTraits<0x0074, 0x1030, VR::SQ, 1, 1> {};
+		struct VerificationImageTiming : TagTraits<0x0074, 0x1032, VR::CS, 1, 1> {};
+		struct DoubleExposureFlag : TagTraits<0x0074, 0x1034, VR::CS, 1, 1> {};
+		struct DoubleExposureOrdering : TagTraits<0x0074, 0x1036, VR::CS, 1, 1> {};
+		struct DoubleExposureMetersetTrial : TagTraits<0x0074, 0x1038, VR::DS, 1, 1> {};
+		struct DoubleExposureFieldDeltaTrial : TagTraits<0x0074, 0x103a, VR::DS, 4, 4> {};
+		struct RelatedReferenceRTImageSequence : TagTraits<0x0074, 0x1040, VR::SQ, 1, 1> {};
+		struct GeneralMachineVerificationSequence : TagTraits<0x0074, 0x1042, VR::SQ, 1, 1> {};
+		struct ConventionalMachineVerificationSequence : TagTraits<0x0074, 0x1044, VR::SQ, 1, 1> {};
+		struct IonMachineVerificationSequence : TagTraits<0x0074, 0x1046, VR::SQ, 1, 1> {};
+		struct FailedAttributesSequence : TagTraits<0x0074, 0x1048, VR::SQ, 1, 1> {};
+		struct OverriddenAttributesSequence : TagTraits<0x0074, 0x104a, VR::SQ, 1, 1> {};
+		struct ConventionalControlPointVerificationSequence : TagTraits<0x0074, 0x104c, VR::SQ, 1, 1> {};
+		struct IonControlPointVerificationSequence : TagTraits<0x0074, 0x104e, VR::SQ, 1, 1> {};
+		struct AttributeOccurrenceSequence : TagTraits<0x0074, 0x1050, VR::SQ, 1, 1> {};
+		struct AttributeOccurrencePointer : TagTraits<0x0074, 0x1052, VR::AT, 1, 1> {};
+		struct AttributeItemSelector : TagTraits<0x0074, 0x1054, VR::UL, 1, 1> {};
+		struct AttributeOccurrencePrivateCreator : TagTraits<0x0074, 0x1056, VR::LO, 1, 1> {};
+		struct SelectorSequencePointerItems : TagTraits<0x0074, 0x1057, VR::IS, 1, 0> {};
+		struct ScheduledProcedureStepPriority : TagTraits<0x0074, 0x1200, VR::CS, 1, 1> {};
+		struct WorklistLabel : TagTraits<0x0074, 0x1202, VR::LO, 1, 1> {};
+		struct ProcedureStepLabel : TagTraits<0x0074, 0x1204, VR::LO, 1, 1> {};
+		struct ScheduledProcessingParametersSequence : TagTraits<0x0074, 0x1210, VR::SQ, 1, 1> {};
+		struct PerformedProcessingParametersSequence : TagTraits<0x0074, 0x1212, VR::SQ, 1, 1> {};
+		struct UnifiedProcedureStepPerformedProcedureSequence : TagTraits<0x0074, 0x1216, VR::SQ, 1, 1> {};
+		struct RelatedProcedureStepSequence : TagTraits<0x0074, 0x1220, VR::SQ, 1, 1> {};
+		struct ProcedureStepRelationshipType : TagTraits<0x0074, 0x1222, VR::LO, 1, 1> {};
+		struct ReplacedProcedureStepSequence : TagTraits<0x0074, 0x1224, VR::SQ, 1, 1> {};
+		struct DeletionLock : TagTraits<0x0074, 0x1230, VR::LO, 1, 1> {};
+		struct ReceivingAE : TagTraits<0x0074, 0x1234, VR::AE, 1, 1> {};
+		struct RequestingAE : TagTraits<0x0074, 0x1236, VR::AE, 1, 1> {};
+		struct ReasonForCancellation : TagTraits<0x0074, 0x1238, VR::LT, 1, 1> {};
+		struct SCPStatus : TagTraits<0x0074, 0x1242, VR::CS, 1, 1> {};
+		struct SubscriptionListStatus : TagTraits<0x0074, 0x1244, VR::CS, 1, 1> {};
+		struct UnifiedProcedureStepListStatus : TagTraits<0x0074, 0x1246, VR::CS, 1, 1> {};
+		struct BeamOrderIndex : TagTraits<0x0074, 0x1324, VR::UL, 1, 1> {};
+		struct DoubleExposureMeterset : TagTraits<0x0074, 0x1338, VR::FD, 1, 1> {};
+		struct DoubleExposureFieldDelta : TagTraits<0x0074, 0x133a, VR::FD, 4, 4> {};
+		struct BrachyTaskSequence : TagTraits<0x0074, 0x1401, VR::SQ, 1, 1> {};
+		struct ContinuationStartTotalReferenceAirKerma : TagTraits<0x0074, 0x1402, VR::DS, 1, 1> {};
+		struct ContinuationEndTotalReferenceAirKerma : TagTraits<0x0074, 0x1403, VR::DS, 1, 1> {};
+		struct ContinuationPulseNumber : TagTraits<0x0074, 0x1404, VR::IS, 1, 1> {};
+		struct ChannelDeliveryOrderSequence : TagTraits<0x0074, 0x1405, VR::SQ, 1, 1> {};
+		struct ReferencedChannelNumber : TagTraits<0x0074, 0x1406, VR::IS, 1, 1> {};
+		struct StartCumulativeTimeWeight : TagTraits<0x0074, 0x1407, VR::DS, 1, 1> {};
+		struct EndCumulativeTimeWeight : TagTraits<0x0074, 0x1408, VR::DS, 1, 1> {};
+		struct OmittedChannelSequence : TagTraits<0x0074, 0x1409, VR::SQ, 1, 1> {};
+		struct ReasonForChannelOmission : TagTraits<0x0074, 0x140a, VR::CS, 1, 1> {};
+		struct ReasonForChannelOmissionDescription : TagTraits<0x0074, 0x140b, VR::LO, 1, 1> {};
+		struct ChannelDeliveryOrderIndex : TagTraits<0x0074, 0x140c, VR::IS, 1, 1> {};
+		struct ChannelDeliveryContinuationSequence : TagTraits<0x0074, 0x140d, VR::SQ, 1, 1> {};
+		struct OmittedApplicationSetupSequence : TagTraits<0x0074, 0x140e, VR::SQ, 1, 1> {};
+		struct ImplantAssemblyTemplateName : TagTraits<0x0076, 0x0001, VR::LO, 1, 1> {};
+		struct ImplantAssemblyTemplateIssuer : TagTraits<0x0076, 0x0003, VR::LO, 1, 1> {};
+		struct ImplantAssemblyTemplateVersion : TagTraits<0x0076, 0x0006, VR::LO, 1, 1> {};
+		struct ReplacedImplantAssemblyTemplateSequence : TagTraits<0x0076, 0x0008, VR::SQ, 1, 1> {};
+		struct ImplantAssemblyTemplateType : TagTraits<0x0076, 0x000a, VR::CS, 1, 1> {};
+		struct OriginalImplantAssemblyTemplateSequence : TagTraits<0x0076, 0x000c, VR::SQ, 1, 1> {};
+		struct DerivationImplantAssemblyTemplateSequence : TagTraits<0x0076, 0x000e, VR::SQ, 1, 1> {};
+		struct ImplantAssemblyTemplateTargetAnatomySequence : TagTraits<0x0076, 0x0010, VR::SQ, 1, 1> {};
+		struct ProcedureTypeCodeSequence : TagTraits<0x0076, 0x0020, VR::SQ, 1, 1> {};
+		struct SurgicalTechnique : TagTraits<0x0076, 0x0030, VR::LO, 1, 1> {};
+		struct ComponentTypesSequence : TagTraits<0x0076, 0x0032, VR::SQ, 1, 1> {};
+		struct ComponentTypeCodeSequence : TagTraits<0x0076, 0x0034, VR::SQ, 1, 1> {};
+		struct ExclusiveComponentType : TagTraits<0x0076, 0x0036, VR::CS, 1, 1> {};
+		struct MandatoryComponentType : TagTraits<0x0076, 0x0038, VR::CS, 1, 1> {};
+		struct ComponentSequence : TagTraits<0x0076, 0x0040, VR::SQ, 1, 1> {};
+		struct ComponentID : TagTraits<0x0076, 0x0055, VR::US, 1, 1> {};
+		struct ComponentAssemblySequence : TagTraits<0x0076, 0x0060, VR::SQ, 1, 1> {};
+		struct Component1ReferencedID : TagTraits<0x0076, 0x0070, VR::US, 1, 1> {};
+		struct Component1ReferencedMatingFeatureSetID : TagTraits<0x0076, 0x0080, VR::US, 1, 1> {};
+		struct Component1ReferencedMatingFeatureID : TagTraits<0x0076, 0x0090, VR::US, 1, 1> {};
+		struct Component2ReferencedID : TagTraits<0x0076, 0x00a0, VR::US, 1, 1> {};
+		struct Component2ReferencedMatingFeatureSetID : TagTraits<0x0076, 0x00b0, VR::US, 1, 1> {};
+		struct Component2ReferencedMatingFeatureID : TagTraits<0x0076, 0x00c0, VR::US, 1, 1> {};
+		struct ImplantTemplateGroupName : TagTraits<0x0078, 0x0001, VR::LO, 1, 1> {};
+		struct ImplantTemplateGroupDescription : TagTraits<0x0078, 0x0010, VR::ST, 1, 1> {};
+		struct ImplantTemplateGroupIssuer : TagTraits<0x0078, 0x0020, VR::LO, 1, 1> {};
+		struct ImplantTemplateGroupVersion : TagTraits<0x0078, 0x0024, VR::LO, 1, 1> {};
+		struct ReplacedImplantTemplateGroupSequence : TagTraits<0x0078, 0x0026, VR::SQ, 1, 1> {};
+		struct ImplantTemplateGroupTargetAnatomySequence : TagTraits<0x0078, 0x0028, VR::SQ, 1, 1> {};
+		struct ImplantTemplateGroupMembersSequence : TagTraits<0x0078, 0x002a, VR::SQ, 1, 1> {};
+		struct ImplantTemplateGroupMemberID : TagTraits<0x0078, 0x002e, VR::US, 1, 1> {};
+		struct ThreeDImplantTemplateGroupMemberMatchingPoint : TagTraits<0x0078, 0x0050, VR::FD, 3, 3> {};
+		struct ThreeDImplantTemplateGroupMemberMatchingAxes : TagTraits<0x0078, 0x0060, VR::FD, 9, 9> {};
+		struct ImplantTemplateGroupMemberMatching2DCoordinatesSequence : TagTraits<0x0078, 0x0070, VR::SQ, 1, 1> {};
+		struct TwoDImplantTemplateGroupMemberMatchingPoint : TagTraits<0x0078, 0x0090, VR::FD, 2, 2> {};
+		struct TwoDImplantTemplateGroupMemberMatchingAxes : TagTraits<0x0078, 0x00a0, VR::FD, 4, 4> {};
+		struct ImplantTemplateGroupVariationDimensionSequence : TagTraits<0x0078, 0x00b0, VR::SQ, 1, 1> {};
+		struct ImplantTemplateGroupVariationDimensionName : TagTraits<0x0078, 0x00b2, VR::LO, 1, 1> {};
+		struct ImplantTemplateGroupVariationDimensionRankSequence : TagTraits<0x0078, 0x00b4, VR::SQ, 1, 1> {};
+		struct ReferencedImplantTemplateGroupMemberID : TagTraits<0x0078, 0x00b6, VR::US, 1, 1> {};
+		struct ImplantTemplateGroupVariationDimensionRank : TagTraits<0x0078, 0x00b8, VR::US, 1, 1> {};
+		struct SurfaceScanAcquisitionTypeCodeSequence : TagTraits<0x0080, 0x0001, VR::SQ, 1, 1> {};
+		struct SurfaceScanModeCodeSequence : TagTraits<0x0080, 0x0002, VR::SQ, 1, 1> {};
+		struct RegistrationMethodCodeSequence : TagTraits<0x0080, 0x0003, VR::SQ, 1, 1> {};
+		struct ShotDurationTime : TagTraits<0x0080, 0x0004, VR::FD, 1, 1> {};
+		struct ShotOffsetTime : TagTraits<0x0080, 0x0005, VR::FD, 1, 1> {};
+		struct SurfacePointPresentationValueData : TagTraits<0x0080, 0x0006, VR::US, 1, 0> {};
+		struct SurfacePointColorCIELabValueData : TagTraits<0x0080, 0x0007, VR::US, 3, 0> {};
+		struct UVMappingSequence : TagTraits<0x0080, 0x0008, VR::SQ, 1, 1> {};
+		struct TextureLabel : TagTraits<0x0080, 0x0009, VR::SH, 1, 1> {};
+		struct UValueData : TagTraits<0x0080, 0x0010, VR::OF, 1, 0> {};
+		struct VValueData : TagTraits<0x0080, 0x0011, VR::OF, 1, 0> {};
+		struct ReferencedTextureSequence : TagTraits<0x0080, 0x0012, VR::SQ, 1, 1> {};
+		struct ReferencedSurfaceDataSequence : TagTraits<0x0080, 0x0013, VR::SQ, 1, 1> {};
+		struct AssessmentSummary : TagTraits<0x0082, 0x0001, VR::CS, 1, 1> {};
+		struct AssessmentSummaryDescription : TagTraits<0x0082, 0x0003, VR::UT, 1, 1> {};
+		struct AssessedSOPInstanceSequence : TagTraits<0x0082, 0x0004, VR::SQ, 1, 1> {};
+		struct ReferencedComparisonSOPInstanceSequence : TagTraits<0x0082, 0x0005, VR::SQ, 1, 1> {};
+		struct NumberOfAssessmentObservations : TagTraits<0x0082, 0x0006, VR::UL, 1, 1> {};
+		struct AssessmentObservationsSequence : TagTraits<0x0082, 0x0007, VR::SQ, 1, 1> {};
+		struct ObservationSignificance : TagTraits<0x0082, 0x0008, VR::CS, 1, 1> {};
+		struct ObservationDescription : TagTraits<0x0082, 0x000a, VR::UT, 1, 1> {};
+		struct StructuredConstraintObservationSequence : TagTraits<0x0082, 0x000c, VR::SQ, 1, 1> {};
+		struct AssessedAttributeValueSequence : TagTraits<0x0082, 0x0010, VR::SQ, 1, 1> {};
+		struct AssessmentSetID : TagTraits<0x0082, 0x0016, VR::LO, 1, 1> {};
+		struct AssessmentRequesterSequence : TagTraits<0x0082, 0x0017, VR::SQ, 1, 1> {};
+		struct SelectorAttributeName : TagTraits<0x0082, 0x0018, VR::LO, 1, 1> {};
+		struct SelectorAttributeKeyword : TagTraits<0x0082, 0x0019, VR::LO, 1, 1> {};
+		struct AssessmentTypeCodeSequence : TagTraits<0x0082, 0x0021, VR::SQ, 1, 1> {};
+		struct ObservationBasisCodeSequence : TagTraits<0x0082, 0x0022, VR::SQ, 1, 1> {};
+		struct AssessmentLabel : TagTraits<0x0082, 0x0023, VR::LO, 1, 1> {};
+		struct ConstraintType : TagTraits<0x0082, 0x0032, VR::CS, 1, 1> {};
+		struct SpecificationSelectionGuidance : TagTraits<0x0082, 0x0033, VR::UT, 1, 1> {};
+		struct ConstraintValueSequence : TagTraits<0x0082, 0x0034, VR::SQ, 1, 1> {};
+		struct RecommendedDefaultValueSequence : TagTraits<0x0082, 0x0035, VR::SQ, 1, 1> {};
+		struct ConstraintViolationSignificance : TagTraits<0x0082, 0x0036, VR::CS, 1, 1> {};
+		struct ConstraintViolationCondition : TagTraits<0x0082, 0x0037, VR::UT, 1, 1> {};
+		struct ModifiableConstraintFlag : TagTraits<0x0082, 0x0038, VR::CS, 1, 1> {};
+		struct StorageMediaFileSetID : TagTraits<0x0088, 0x0130, VR::SH, 1, 1> {};
+		struct StorageMediaFileSetUID : TagTraits<0x0088, 0x0140, VR::UI, 1, 1> {};
+		struct IconImageSequence : TagTraits<0x0088, 0x0200, VR::SQ, 1, 1> {};
+		struct TopicTitle : TagTraits<0x0088, 0x0904, VR::LO, 1, 1> {};
+		struct TopicSubject : TagTraits<0x0088, 0x0906, VR::ST, 1, 1> {};
+		struct TopicAuthor : TagTraits<0x0088, 0x0910, VR::LO, 1, 1> {};
+		struct TopicKeywords : TagTraits<0x0088, 0x0912, VR::LO, 1, 32> {};
+		struct SOPInstanceStatus : TagTraits<0x0100, 0x0410, VR::CS, 1, 1> {};
+		struct SOPAuthorizationDateTime : TagTraits<0x0100, 0x0420, VR::DT, 1, 1> {};
+		struct SOPAuthorizationComment : TagTraits<0x0100, 0x0424, VR::LT, 1, 1> {};
+		struct AuthorizationEquipmentCertificationNumber : TagTraits<0x0100, 0x0426, VR::LO, 1, 1> {};
+		struct MACIDNumber : TagTraits<0x0400, 0x0005, VR::US, 1, 1> {};
+		struct MACCalculationTransferSyntaxUID : TagTraits<0x0400, 0x0010, VR::UI, 1, 1> {};
+		struct MACAlgorithm : TagTraits<0x0400, 0x0015, VR::CS, 1, 1> {};
+		struct DataElementsSigned : TagTraits<0x0400, 0x0020, VR::AT, 1, 0> {};
+		struct DigitalSignatureUID : TagTraits<0x0400, 0x0100, VR::UI, 1, 1> {};
+		struct DigitalSignatureDateTime : TagTraits<0x0400, 0x0105, VR::DT, 1, 1> {};
+		struct CertificateType : TagTraits<0x0400, 0x0110, VR::CS, 1, 1> {};
+		struct CertificateOfSigner : TagTraits<0x0400, 0x0115, VR::OB, 1, 1> {};
+		struct Signature : TagTraits<0x0400, 0x0120, VR::OB, 1, 1> {};
+		struct CertifiedTimestampType : TagTraits<0x0400, 0x0305, VR::CS, 1, 1> {};
+		struct CertifiedTimestamp : TagTraits<0x0400, 0x0310, VR::OB, 1, 1> {};
+		struct DigitalSignaturePurposeCodeSequence : TagTraits<0x0400, 0x0401, VR::SQ, 1, 1> {};
+		struct ReferencedDigitalSignatureSequence : TagTraits<0x0400, 0x0402, VR::SQ, 1, 1> {};
+		struct ReferencedSOPInstanceMACSequence : TagTraits<0x0400, 0x0403, VR::SQ, 1, 1> {};
+		struct MAC : TagTraits<0x0400, 0x0404, VR::OB, 1, 1> {};
+		struct EncryptedAttributesSequence : TagTraits<0x0400, 0x0500, VR::SQ, 1, 1> {};
+		struct EncryptedContentTransferSyntaxUID : TagTraits<0x0400, 0x0510, VR::UI, 1, 1> {};
+		struct EncryptedContent : TagTraits<0x0400, 0x0520, VR::OB, 1, 1> {};
+		struct ModifiedAttributesSequence : TagTraits<0x0400, 0x0550, VR::SQ, 1, 1> {};
+		struct OriginalAttributesSequence : TagTraits<0x0400, 0x0561, VR::SQ, 1, 1> {};
+		struct AttributeModificationDateTime : TagTraits<0x0400, 0x0562, VR::DT, 1, 1> {};
+		struct ModifyingSystem : TagTraits<0x0400, 0x0563, VR::LO, 1, 1> {};
+		struct SourceOfPreviousValues : TagTraits<0x0400, 0x0564, VR::LO, 1, 1> {};
+		struct ReasonForTheAttributeModification : TagTraits<0x0400, 0x0565, VR::CS, 1, 1> {};
+		struct NumberOfCopies : TagTraits<0x2000, 0x0010, VR::IS, 1, 1> {};
+		struct PrinterConfigurationSequence : TagTraits<0x2000, 0x001e, VR::SQ, 1, 1> {};
+		struct PrintPriority : TagTraits<0x2000, 0x0020, VR::CS, 1, 1> {};
+		struct MediumType : TagTraits<0x2000, 0x0030, VR::CS, 1, 1> {};
+		struct FilmDestination : TagTraits<0x2000, 0x0040, VR::CS, 1, 1> {};
+		struct FilmSessionLabel : TagTraits<0x2000, 0x0050, VR::LO, 1, 1> {};
+		struct MemoryAllocation : TagTraits<0x2000, 0x0060, VR::IS, 1, 1> {};
+		struct MaximumMemoryAllocation : TagTraits<0x2000, 0x0061, VR::IS, 1, 1> {};
+		struct ColorImagePrintingFlag : TagTraits<0x2000, 0x0062, VR::CS, 1, 1> {};
+		struct CollationFlag : TagTraits<0x2000, 0x0063, VR::CS, 1, 1> {};
+		struct AnnotationFlag : TagTraits<0x2000, 0x0065, VR::CS, 1, 1> {};
+		struct ImageOverlayFlag : TagTraits<0x2000, 0x0067, VR::CS, 1, 1> {};
+		struct PresentationLUTFlag : TagTraits<0x2000, 0x0069, VR::CS, 1, 1> {};
+		struct ImageBoxPresentationLUTFlag : TagTraits<0x2000, 0x006a, VR::CS, 1, 1> {};
+		struct MemoryBitDepth : TagTraits<0x2000, 0x00a0, VR::US, 1, 1> {};
+		struct PrintingBitDepth : TagTraits<0x2000, 0x00a1, VR::US, 1, 1> {};
+		struct MediaInstalledSequence : TagTraits<0x2000, 0x00a2, VR::SQ, 1, 1> {};
+		struct OtherMediaAvailableSequence : TagTraits<0x2000, 0x00a4, VR::SQ, 1, 1> {};
+		struct SupportedImageDisplayFormatsSequence : TagTraits<0x2000, 0x00a8, VR::SQ, 1, 1> {};
+		struct ReferencedFilmBoxSequence : TagTraits<0x2000, 0x0500, VR::SQ, 1, 1> {};
+		struct ReferencedStoredPrintSequence : TagTraits<0x2000, 0x0510, VR::SQ, 1, 1> {};
+		struct ImageDisplayFormat : TagTraits<0x2010, 0x0010, VR::ST, 1, 1> {};
+		struct AnnotationDisplayFormatID : TagTraits<0x2010, 0x0030, VR::CS, 1, 1> {};
+		struct FilmOrientation : TagTraits<0x2010, 0x0040, VR::CS, 1, 1> {};
+		struct FilmSizeID : TagTraits<0x2010, 0x0050, VR::CS, 1, 1> {};
+		struct PrinterResolutionID : TagTraits<0x2010, 0x0052, VR::CS, 1, 1> {};
+		struct DefaultPrinterResolutionID : TagTraits<0x2010, 0x0054, VR::CS, 1, 1> {};
+		struct MagnificationType : TagTraits<0x2010, 0x0060, VR::CS, 1, 1> {};
+		struct SmoothingType : TagTraits<0x2010, 0x0080, VR::CS, 1, 1> {};
+		struct DefaultMagnificationType : TagTraits<0x2010, 0x00a6, VR::CS, 1, 1> {};
+		struct OtherMagnificationTypesAvailable : TagTraits<0x2010, 0x00a7, VR::CS, 1, 0> {};
+		struct DefaultSmoothingType : TagTraits<0x2010, 0x00a8, VR::CS, 1, 1> {};
+		struct OtherSmoothingTypesAvailable : TagTraits<0x2010, 0x00a9, VR::CS, 1, 0> {};
+		struct BorderDensity : TagTraits<0x2010, 0x0100, VR::CS, 1, 1> {};
+		struct EmptyImageDensity : TagTraits<0x2010, 0x0110, VR::CS, 1, 1> {};
+		struct MinDensity : TagTraits<0x2010, 0x0120, VR::US, 1, 1> {};
+		struct MaxDensity : TagTraits<0x2010, 0x0130, VR::US, 1, 1> {};
+		struct Trim : TagTraits<0x2010, 0x0140, VR::CS, 1, 1> {};
+		struct ConfigurationInformation : TagTraits<0x2010, 0x0150, VR::ST, 1, 1> {};
+		struct ConfigurationInformationDescription : TagTraits<0x2010, 0x0152, VR::LT, 1, 1> {};
+		struct MaximumCollatedFilms : TagTraits<0x2010, 0x0154, VR::IS, 1, 1> {};
+		struct Illumination : TagTraits<0x2010, 0x015e, VR::US, 1, 1> {};
+		struct ReflectedAmbientLight : TagTraits<0x2010, 0x0160, VR::US, 1, 1> {};
+		struct PrinterPixelSpacing : TagTraits<0x2010, 0x0376, VR::DS, 2, 2> {};
+		struct ReferencedFilmSessionSequence : TagTraits<0x2010, 0x0500, VR::SQ, 1, 1> {};
+		struct ReferencedImageBoxSequence : TagTraits<0x2010, 0x0510, VR::SQ, 1, 1> {};
+		struct ReferencedBasicAnnotationBoxSequence : TagTraits<0x2010, 0x0520, VR::SQ, 1, 1> {};
+		struct ImageBoxPosition : TagTraits<0x2020, 0x0010, VR::US, 1, 1> {};
+		struct Polarity : TagTraits<0x2020, 0x0020, VR::CS, 1, 1> {};
+		struct RequestedImageSize : TagTraits<0x2020, 0x0030, VR::DS, 1, 1> {};
+		struct RequestedDecimateCropBehavior : TagTraits<0x2020, 0x0040, VR::CS, 1, 1> {};
+		struct RequestedResolutionID : TagTraits<0x2020, 0x0050, VR::CS, 1, 1> {};
+		struct RequestedImageSizeFlag : TagTraits<0x2020, 0x00a0, VR::CS, 1, 1> {};
+		struct DecimateCropResult : TagTraits<0x2020, 0x00a2, VR::CS, 1, 1> {};
+		struct BasicGrayscaleImageSequence : TagTraits<0x2020, 0x0110, VR::SQ, 1, 1> {};
+		struct BasicColorImageSequence : TagTraits<0x2020, 0x0111, VR::SQ, 1, 1> {};
+		struct ReferencedImageOverlayBoxSequence : TagTraits<0x2020, 0x0130, VR::SQ, 1, 1> {};
+		struct ReferencedVOILUTBoxSequence : TagTraits<0x2020, 0x0140, VR::SQ, 1, 1> {};
+		struct AnnotationPosition : TagTraits<0x2030, 0x0010, VR::US, 1, 1> {};
+		struct TextString : TagTraits<0x2030, 0x0020, VR::LO, 1, 1> {};
+		struct ReferencedOverlayPlaneSequence : TagTraits<0x2040, 0x0010, VR::SQ, 1, 1> {};
+		struct ReferencedOverlayPlaneGroups : TagTraits<0x2040, 0x0011, VR::US, 1, 99> {};
+		struct OverlayPixelDataSequence : TagTraits<0x2040, 0x0020, VR::SQ, 1, 1> {};
+		struct OverlayMagnificationType : TagTraits<0x2040, 0x0060, VR::CS, 1, 1> {};
+		struct OverlaySmoothingType : TagTraits<0x2040, 0x0070, VR::CS, 1, 1> {};
+		struct OverlayOrImageMagnification : TagTraits<0x2040, 0x0072, VR::CS, 1, 1> {};
+		struct MagnifyToNumberOfColumns : TagTraits<0x2040, 0x0074, VR::US, 1, 1> {};
+		struct OverlayForegroundDensity : TagTraits<0x2040, 0x0080, VR::CS, 1, 1> {};
+		struct OverlayBackgroundDensity : TagTraits<0x2040, 0x0082, VR::CS, 1, 1> {};
+		struct OverlayMode : TagTraits<0x2040, 0x0090, VR::CS, 1, 1> {};
+		struct ThresholdDensity : TagTraits<0x2040, 0x0100, VR::CS, 1, 1> {};
+		struct ReferencedImageBoxSequenceRetired : TagTraits<0x2040, 0x0500, VR::SQ, 1, 1> {};
+		struct PresentationLUTSequence : TagTraits<0x2050, 0x0010, VR::SQ, 1, 1> {};
+		struct PresentationLUTShape : TagTraits<0x2050, 0x0020, VR::CS, 1, 1> {};
+		struct ReferencedPresentationLUTSequence : TagTraits<0x2050, 0x0500, VR::SQ, 1, 1> {};
+		struct PrintJobID : TagTraits<0x2100, 0x0010, VR::SH, 1, 1> {};
+		struct ExecutionStatus : TagTraits<0x2100, 0x0020, VR::CS, 1, 1> {};
+		struct ExecutionStatusInfo : TagTraits<0x2100, 0x0030, VR::CS, 1, 1> {};
+		struct CreationDate : TagTraits<0x2100, 0x0040, VR::DA, 1, 1> {};
+		struct CreationTime : TagTraits<0x2100, 0x0050, VR::TM, 1, 1> {};
+		struct Originator : TagTraits<0x2100, 0x0070, VR::AE, 1, 1> {};
+		struct DestinationAE : TagTraits<0x2100, 0x0140, VR::AE, 1, 1> {};
+		struct OwnerID : TagTraits<0x2100, 0x0160, VR::SH, 1, 1> {};
+		struct NumberOfFilms : TagTraits<0x2100, 0x0170, VR::IS, 1, 1> {};
+		struct ReferencedPrintJobSequencePullStoredPrint : TagTraits<0x2100, 0x0500, VR::SQ, 1, 1> {};
+		struct PrinterStatus : TagTraits<0x2110, 0x0010, VR::CS, 1, 1> {};
+		struct PrinterStatusInfo : TagTraits<0x2110, 0x0020, VR::CS, 1, 1> {};
+		struct PrinterName : TagTraits<0x2110, 0x0030, VR::LO, 1, 1> {};
+		struct PrintQueueID : TagTraits<0x2110, 0x0099, VR::SH, 1, 1> {};
+		struct QueueStatus : TagTraits<0x2120, 0x0010, VR::CS, 1, 1> {};
+		struct PrintJobDescriptionSequence : TagTraits<0x2120, 0x0050, VR::SQ, 1, 1> {};
+		struct ReferencedPrintJobSequence : TagTraits<0x2120, 0x0070, VR::SQ, 1, 1> {};
+		struct PrintManagementCapabilitiesSequence : TagTraits<0x2130, 0x0010, VR::SQ, 1, 1> {};
+		struct PrinterCharacteristicsSequence : TagTraits<0x2130, 0x0015, VR::SQ, 1, 1> {};
+		struct FilmBoxContentSequence : TagTraits<0x2130, 0x0030, VR::SQ, 1, 1> {};
+		struct ImageBoxContentSequence : TagTraits<0x2130, 0x0040, VR::SQ, 1, 1> {};
+		struct AnnotationContentSequence : TagTraits<0x2130, 0x0050, VR::SQ, 1, 1> {};
+		struct ImageOverlayBoxContentSequence : TagTraits<0x2130, 0x0060, VR::SQ, 1, 1> {};
+		struct PresentationLUTContentSequence : TagTraits<0x2130, 0x0080, VR::SQ, 1, 1> {};
+		struct ProposedStudySequence : TagTraits<0x2130, 0x00a0, VR::SQ, 1, 1> {};
+		struct OriginalImageSequence : TagTraits<0x2130, 0x00c0, VR::SQ, 1, 1> {};
+		struct LabelUsingInformationExtractedFromInstances : TagTraits<0x2200, 0x0001, VR::CS, 1, 1> {};
+		struct LabelText : TagTraits<0x2200, 0x0002, VR::UT, 1, 1> {};
+		struct LabelStyleSelection : TagTraits<0x2200, 0x0003, VR::CS, 1, 1> {};
+		struct MediaDisposition : TagTraits<0x2200, 0x0004, VR::LT, 1, 1> {};
+		struct BarcodeValue : TagTraits<0x2200, 0x0005, VR::LT, 1, 1> {};
+		struct BarcodeSymbology : TagTraits<0x2200, 0x0006, VR::CS, 1, 1> {};
+		struct AllowMediaSplitting : TagTraits<0x2200, 0x0007, VR::CS, 1, 1> {};
+		struct IncludeNonDICOMObjects : TagTraits<0x2200, 0x0008, VR::CS, 1, 1> {};
+		struct IncludeDisplayApplication : TagTraits<0x2200, 0x0009, VR::CS, 1, 1> {};
+		struct PreserveCompositeInstancesAfterMediaCreation : TagTraits<0x2200, 0x000a, VR::CS, 1, 1> {};
+		struct TotalNumberOfPiecesOfMediaCreated : TagTraits<0x2200, 0x000b, VR::US, 1, 1> {};
+		struct RequestedMediaApplicationProfile : TagTraits<0x2200, 0x000c, VR::LO, 1, 1> {};
+		struct ReferencedStorageMediaSequence : TagTraits<0x2200, 0x000d, VR::SQ, 1, 1> {};
+		struct FailureAttributes : TagTraits<0x2200, 0x000e, VR::AT, 1, 0> {};
+		struct AllowLossyCompression : TagTraits<0x2200, 0x000f, VR::CS, 1, 1> {};
+		struct RequestPriority : TagTraits<0x2200, 0x0020, VR::CS, 1, 1> {};
+		struct RTImageLabel : TagTraits<0x3002, 0x0002, VR::SH, 1, 1> {};
+		struct RTImageName : TagTraits<0x3002, 0x0003, VR::LO, 1, 1> {};
+		struct RTImageDescription : TagTraits<0x3002, 0x0004, VR::ST, 1, 1> {};
+		struct ReportedValuesOrigin : TagTraits<0x3002, 0x000a, VR::CS, 1, 1> {};
+		struct RTImagePlane : TagTraits<0x3002, 0x000c, VR::CS, 1, 1> {};
+		struct XRayImageReceptorTranslation : TagTraits<0x3002, 0x000d, VR::DS, 3, 3> {};
+		struct XRayImageReceptorAngle : TagTraits<0x3002, 0x000e, VR::DS, 1, 1> {};
+		struct RTImageOrientation : TagTraits<0x3002, 0x0010, VR::DS, 6, 6> {};
+		struct ImagePlanePixelSpacing : TagTraits<0x3002, 0x0011, VR::DS, 2, 2> {};
+		struct RTImagePosition : TagTraits<0x3002, 0x0012, VR::DS, 2, 2> {};
+		struct RadiationMachineName : TagTraits<0x3002, 0x0020, VR::SH, 1, 1> {};
+		struct RadiationMachineSAD : TagTraits<0x3002, 0x0022, VR::DS, 1, 1> {};
+		struct RadiationMachineSSD : TagTraits<0x3002, 0x0024, VR::DS, 1, 1> {};
+		struct RTImageSID : TagTraits<0x3002, 0x0026, VR::DS, 1, 1> {};
+		struct SourceToReferenceObjectDistance : TagTraits<0x3002, 0x0028, VR::DS, 1, 1> {};
+		struct FractionNumber : TagTraits<0x3002, 0x0029, VR::IS, 1, 1> {};
+		struct ExposureSequence : TagTraits<0x3002, 0x0030, VR::SQ, 1, 1> {};
+		struct MetersetExposure : TagTraits<0x3002, 0x0032, VR::DS, 1, 1> {};
+		struct DiaphragmPosition : TagTraits<0x3002, 0x0034, VR::DS, 4, 4> {};
+		struct FluenceMapSequence : TagTraits<0x3002, 0x0040, VR::SQ, 1, 1> {};
+		struct FluenceDataSource : TagTraits<0x3002, 0x0041, VR::CS, 1, 1> {};
+		struct FluenceDataScale : TagTraits<0x3002, 0x0042, VR::DS, 1, 1> {};
+		struct PrimaryFluenceModeSequence : TagTraits<0x3002, 0x0050, VR::SQ, 1, 1> {};
+		struct FluenceMode : TagTraits<0x3002, 0x0051, VR::CS, 1, 1> {};
+		struct FluenceModeID : TagTraits<0x3002, 0x0052, VR::SH, 1, 1> {};
+		struct DVHType : TagTraits<0x3004, 0x0001, VR::CS, 1, 1> {};
+		struct DoseUnits : TagTraits<0x3004, 0x0002, VR::CS, 1, 1> {};
+		struct DoseType : TagTraits<0x3004, 0x0004, VR::CS, 1, 1> {};
+		struct SpatialTransformOfDose : TagTraits<0x3004, 0x0005, VR::CS, 1, 1> {};
+		struct DoseComment : TagTraits<0x3004, 0x0006, VR::LO, 1, 1> {};
+		struct NormalizationPoint : TagTraits<0x3004, 0x0008, VR::DS, 3, 3> {};
+		struct DoseSummationType : TagTraits<0x3004, 0x000a, VR::CS, 1, 1> {};
+		struct GridFrameOffsetVector : TagTraits<0x3004, 0x000c, VR::DS, 2, 0> {};
+		struct DoseGridScaling : TagTraits<0x3004, 0x000e, VR::DS, 1, 1> {};
+		struct RTDoseROISequence : TagTraits<0x3004, 0x0010, VR::SQ, 1, 1> {};
+		struct DoseValue : TagTraits<0x3004, 0x0012, VR::DS, 1, 1> {};
+		struct TissueHeterogeneityCorrection : TagTraits<0x3004, 0x0014, VR::CS, 1, 3> {};
+		struct DVHNormalizationPoint : TagTraits<0x3004, 0x0040, VR::DS, 3, 3> {};
+		struct DVHNormalizationDoseValue : TagTraits<0x3004, 0x0042, VR::DS, 1, 1> {};
+		struct DVHSequence : TagTraits<0x3004, 0x0050, VR::SQ, 1, 1> {};
+		struct DVHDoseScaling : TagTraits<0x3004, 0x0052, VR::DS, 1, 1> {};
+		struct DVHVolumeUnits : TagTraits<0x3004, 0x0054, VR::CS, 1, 1> {};
+		struct DVHNumberOfBins : TagTraits<0x3004, 0x0056, VR::IS, 1, 1> {};
+		struct DVHData : TagTraits<0x3004, 0x0058, VR::DS, 2, 0> {};
+		struct DVHReferencedROISequence : TagTraits<0x3004, 0x0060, VR::SQ, 1, 1> {};
+		struct DVHROIContributionType : TagTraits<0x3004, 0x0062, VR::CS, 1, 1> {};
+		struct DVHMinimumDose : TagTraits<0x3004, 0x0070, VR::DS, 1, 1> {};
+		struct DVHMaximumDose : TagTraits<0x3004, 0x0072, VR::DS, 1, 1> {};
+		struct DVHMeanDose : TagTraits<0x3004, 0x0074, VR::DS, 1, 1> {};
+		struct StructureSetLabel : TagTraits<0x3006, 0x0002, VR::SH, 1, 1> {};
+		struct StructureSetName : TagTraits<0x3006, 0x0004, VR::LO, 1, 1> {};
+		struct StructureSetDescription : TagTraits<0x3006, 0x0006, VR::ST, 1, 1> {};
+		struct StructureSetDate : TagTraits<0x3006, 0x0008, VR::DA, 1, 1> {};
+		struct StructureSetTime : TagTraits<0x3006, 0x0009, VR::TM, 1, 1> {};
+		struct ReferencedFrameOfReferenceSequence : TagTraits<0x3006, 0x0010, VR::SQ, 1, 1> {};
+		struct RTReferencedStudySequence : TagTraits<0x3006, 0x0012, VR::SQ, 1, 1> {};
+		struct RTReferencedSeriesSequence : TagTraits<0x3006, 0x0014, VR::SQ, 1, 1> {};
+		struct ContourImageSequence : TagTraits<0x3006, 0x0016, VR::SQ, 1, 1> {};
+		struct PredecessorStructureSetSequence : TagTraits<0x3006, 0x0018, VR::SQ, 1, 1> {};
+		struct StructureSetROISequence : TagTraits<0x3006, 0x0020, VR::SQ, 1, 1> {};
+		struct ROINumber : TagTraits<0x3006, 0x0022, VR::IS, 1, 1> {};
+		struct ReferencedFrameOfReferenceUID : TagTraits<0x3006, 0x0024, VR::UI, 1, 1> {};
+		struct ROIName : TagTraits<0x3006, 0x0026, VR::LO, 1, 1> {};
+		struct ROIDescription : TagTraits<0x3006, 0x0028, VR::ST, 1, 1> {};
+		struct ROIDisplayColor : TagTraits<0x3006, 0x002a, VR::IS, 3, 3> {};
+		struct ROIVolume : TagTraits<0x3006, 0x002c, VR::DS, 1, 1> {};
+		struct RTRelatedROISequence : TagTraits<0x3006, 0x0030, VR::SQ, 1, 1> {};
+		struct RTROIRelationship : TagTraits<0x3006, 0x0033, VR::CS, 1, 1> {};
+		struct ROIGenerationAlgorithm : TagTraits<0x3006, 0x0036, VR::CS, 1, 1> {};
+		struct ROIGenerationDescription : TagTraits<0x3006, 0x0038, VR::LO, 1, 1> {};
+		struct ROIContourSequence : TagTraits<0x3006, 0x0039, VR::SQ, 1, 1> {};
+		struct ContourSequence : TagTraits<0x3006, 0x0040, VR::SQ, 1, 1> {};
+		struct ContourGeometricType : TagTraits<0x3006, 0x0042, VR::CS, 1, 1> {};
+		struct ContourSlabThickness : TagTraits<0x3006, 0x0044, VR::DS, 1, 1> {};
+		struct ContourOffsetVector : TagTraits<0x3006, 0x0045, VR::DS, 3, 3> {};
+		struct NumberOfContourPoints : TagTraits<0x3006, 0x0046, VR::IS, 1, 1> {};
+		struct ContourNumber : TagTraits<0x3006, 0x0048, VR::IS, 1, 1> {};
+		struct AttachedContours : TagTraits<0x3006, 0x0049, VR::IS, 1, 0> {};
+		struct ContourData : TagTraits<0x3006, 0x0050, VR::DS, 3, 0> {};
+		struct RTROIObservationsSequence : TagTraits<0x3006, 0x0080, VR::SQ, 1, 1> {};
+		struct ObservationNumber : TagTraits<0x3006, 0x0082, VR::IS, 1, 1> {};
+		struct ReferencedROINumber : TagTraits<0x3006, 0x0084, VR::IS, 1, 1> {};
+		struct ROIObservationLabel : TagTraits<0x3006, 0x0085, VR::SH, 1, 1> {};
+		struct RTROIIdentificationCodeSequence : TagTraits<0x3006, 0x0086, VR::SQ, 1, 1> {};
+		struct ROIObservationDescription : TagTraits<0x3006, 0x0088, VR::ST, 1, 1> {};
+		struct RelatedRTROIObservationsSequence : TagTraits<0x3006, 0x00a0, VR::SQ, 1, 1> {};
+		struct RTROIInterpretedType : TagTraits<0x3006, 0x00a4, VR::CS, 1, 1> {};
+		struct ROIInterpreter : TagTraits<0x3006, 0x00a6, VR::PN, 1, 1> {};
+		struct ROIPhysicalPropertiesSequence : TagTraits<0x3006, 0x00b0, VR::SQ, 1, 1> {};
+		struct ROIPhysicalProperty : TagTraits<0x3006, 0x00b2, VR::CS, 1, 1> {};
+		struct ROIPhysicalPropertyValue : TagTraits<0x3006, 0x00b4, VR::DS, 1, 1> {};
+		struct ROIElementalCompositionSequence : TagTraits<0x3006, 0x00b6, VR::SQ, 1, 1> {};
+		struct ROIElementalCompositionAtomicNumber : TagTraits<0x3006, 0x00b7, VR::US, 1, 1> {};
+		struct ROIElementalCompositionAtomicMassFraction : TagTraits<0x3006, 0x00b8, VR::FL, 1, 1> {};
+		struct AdditionalRTROIIdentificationCodeSequence : TagTraits<0x3006, 0x00b9, VR::SQ, 1, 1> {};
+		struct FrameOfReferenceRelationshipSequence : TagTraits<0x3006, 0x00c0, VR::SQ, 1, 1> {};
+		struct RelatedFrameOfReferenceUID : TagTraits<0x3006, 0x00c2, VR::UI, 1, 1> {};
+		struct FrameOfReferenceTransformationType : TagTraits<0x3006, 0x00c4, VR::CS, 1, 1> {};
+		struct FrameOfReferenceTransformationMatrix : TagTraits<0x3006, 0x00c6, VR::DS, 16, 16> {};
+		struct FrameOfReferenceTransformationComment : TagTraits<0x3006, 0x00c8, VR::LO, 1, 1> {};
+		struct MeasuredDoseReferenceSequence : TagTraits<0x3008, 0x0010, VR::SQ, 1, 1> {};
+		struct MeasuredDoseDescription : TagTraits<0x3008, 0x0012, VR::ST, 1, 1> {};
+		struct MeasuredDoseType : TagTraits<0x3008, 0x0014, VR::CS, 1, 1> {};
+		struct MeasuredDoseValue : TagTraits<0x3008, 0x0016, VR::DS, 1, 1> {};
+		struct TreatmentSessionBeamSequence : TagTraits<0x3008, 0x0020, VR::SQ, 1, 1> {};
+		struct TreatmentSessionIonBeamSequence : TagTraits<0x3008, 0x0021, VR::SQ, 1, 1> {};
+		struct CurrentFractionNumber : TagTraits<0x3008, 0x0022, VR::IS, 1, 1> {};
+		struct TreatmentControlPointDate : TagTraits<0x3008, 0x0024, VR::DA, 1, 1> {};
+		struct TreatmentControlPointTime : TagTraits<0x3008, 0x0025, VR::TM, 1, 1> {};
+		struct TreatmentTerminationStatus : TagTraits<0x3008, 0x002a, VR::CS, 1, 1> {};
+		struct TreatmentTerminationCode : TagTraits<0x3008, 0x002b, VR::SH, 1, 1> {};
+		struct TreatmentVerificationStatus : TagTraits<0x3008, 0x002c, VR::CS, 1, 1> {};
+		struct ReferencedTreatmentRecordSequence : TagTraits<0x3008, 0x0030, VR::SQ, 1, 1> {};
+		struct SpecifiedPrimaryMeterset : TagTraits<0x3008, 0x0032, VR::DS, 1, 1> {};
+		struct SpecifiedSecondaryMeterset : TagTraits<0x3008, 0x0033, VR::DS, 1, 1> {};
+		struct DeliveredPrimaryMeterset : TagTraits<0x3008, 0x0036, VR::DS, 1, 1> {};
+		struct DeliveredSecondaryMeterset : TagTraits<0x3008, 0x0037, VR::DS, 1, 1> {};
+		struct SpecifiedTreatmentTime : TagTraits<0x3008, 0x003a, VR::DS, 1, 1> {};
+		struct DeliveredTreatmentTime : TagTraits<0x3008, 0x003b, VR::DS, 1, 1> {};
+		struct ControlPointDeliverySequence : TagTraits<0x3008, 0x0040, VR::SQ, 1, 1> {};
+		struct IonControlPointDeliverySequence : TagTraits<0x3008, 0x0041, VR::SQ, 1, 1> {};
+		struct SpecifiedMeterset : TagTraits<0x3008, 0x0042, VR::DS, 1, 1> {};
+		struct DeliveredMeterset : TagTraits<0x3008, 0x0044, VR::DS, 1, 1> {};
+		struct MetersetRateSet : TagTraits<0x3008, 0x0045, VR::FL, 1, 1> {};
+		struct MetersetRateDelivered : TagTraits<0x3008, 0x0046, VR::FL, 1, 1> {};
+		struct ScanSpotMetersetsDelivered : TagTraits<0x3008, 0x0047, VR::FL, 1, 0> {};
+		struct DoseRateDelivered : TagTraits<0x3008, 0x0048, VR::DS, 1, 1> {};
+		struct TreatmentSummaryCalculatedDoseReferenceSequence : TagTraits<0x3008, 0x0050, VR::SQ, 1, 1> {};
+		struct CumulativeDoseToDoseReference : TagTraits<0x3008, 0x0052, VR::DS, 1, 1> {};
+		struct FirstTreatmentDate : TagTraits<0x3008, 0x0054, VR::DA, 1, 1> {};
+		struct MostRecentTreatmentDate : TagTraits<0x3008, 0x0056, VR::DA, 1, 1> {};
+		struct NumberOfFractionsDelivered : TagTraits<0x3008, 0x005a, VR::IS, 1, 1> {};
+		struct OverrideSequence : TagTraits<0x3008, 0x0060, VR::SQ, 1, 1> {};
+		struct ParameterSequencePointer : TagTraits<0x3008, 0x0061, VR::AT, 1, 1> {};
+		struct OverrideParameterPointer : TagTraits<0x3008, 0x0062, VR::AT, 1, 1> {};
+		struct ParameterItemIndex : TagTraits<0x3008, 0x0063, VR::IS, 1, 1> {};
+		struct MeasuredDoseReferenceNumber : TagTraits<0x3008, 0x0064, VR::IS, 1, 1> {};
+		struct ParameterPointer : TagTraits<0x3008, 0x0065, VR::AT, 1, 1> {};
+		struct OverrideReason : TagTraits<0x3008, 0x0066, VR::ST, 1, 1> {};
+		struct ParameterValueNumber : TagTraits<0x3008, 0x0067, VR::US, 1, 1> {};
+		struct CorrectedParameterSequence : TagTraits<0x3008, 0x0068, VR::SQ, 1, 1> {};
+		struct CorrectionValue : TagTraits<0x3008, 0x006a, VR::FL, 1, 1> {};
+		struct CalculatedDoseReferenceSequence : TagTraits<0x3008, 0x0070, VR::SQ, 1, 1> {};
+		struct CalculatedDoseReferenceNumber : TagTraits<0x3008, 0x0072, VR::IS, 1, 1> {};
+		struct CalculatedDoseReferenceDescription : TagTraits<0x3008, 0x0074, VR::ST, 1, 1> {};
+		struct CalculatedDoseReferenceDoseValue : TagTraits<0x3008, 0x0076, VR::DS, 1, 1> {};
+		struct StartMeterset : TagTraits<0x3008, 0x0078, VR::DS, 1, 1> {};
+		struct EndMeterset : TagTraits<0x3008, 0x007a, VR::DS, 1, 1> {};
+		struct ReferencedMeasuredDoseReferenceSequence : TagTraits<0x3008, 0x0080, VR::SQ, 1, 1> {};
+		struct ReferencedMeasuredDoseReferenceNumber : TagTraits<0x3008, 0x0082, VR::IS, 1, 1> {};
+		struct ReferencedCalculatedDoseReferenceSequence : TagTraits<0x3008, 0x0090, VR::SQ, 1, 1> {};
+		struct ReferencedCalculatedDoseReferenceNumber : TagTraits<0x3008, 0x0092, VR::IS, 1, 1> {};
+		struct BeamLimitingDeviceLeafPairsSequence : TagTraits<0x3008, 0x00a0, VR::SQ, 1, 1> {};
+		struct RecordedWedgeSequence : TagTraits<0x3008, 0x00b0, VR::SQ, 1, 1> {};
+		struct RecordedCompensatorSequence : TagTraits<0x3008, 0x00c0, VR::SQ, 1, 1> {};
+		struct RecordedBlockSequence : TagTraits<0x3008, 0x00d0, VR::SQ, 1, 1> {};
+		struct TreatmentSummaryMeasuredDoseReferenceSequence : TagTraits<0x3008, 0x00e0, VR::SQ, 1, 1> {};
+		struct RecordedSnoutSequence : TagTraits<0x3008, 0x00f0, VR::SQ, 1, 1> {};
+		struct RecordedRangeShifterSequence : TagTraits<0x3008, 0x00f2, VR::SQ, 1, 1> {};
+		struct RecordedLateralSpreadingDeviceSequence : TagTraits<0x3008, 0x00f4, VR::SQ, 1, 1> {};
+		struct RecordedRangeModulatorSequence : TagTraits<0x3008, 0x00f6, VR::SQ, 1, 1> {};
+		struct RecordedSourceSequence : TagTraits<0x3008, 0x0100, VR::SQ, 1, 1> {};
+		struct SourceSerialNumber : TagTraits<0x3008, 0x0105, VR::LO, 1, 1> {};
+		struct TreatmentSessionApplicationSetupSequence : TagTraits<0x3008, 0x0110, VR::SQ, 1, 1> {};
+		struct ApplicationSetupCheck : TagTraits<0x3008, 0x0116, VR::CS, 1, 1> {};
+		struct RecordedBrachyAccessoryDeviceSequence : TagTraits<0x3008, 0x0120, VR::SQ, 1, 1> {};
+		struct ReferencedBrachyAccessoryDeviceNumber : TagTraits<0x3008, 0x0122, VR::IS, 1, 1> {};
+		struct RecordedChannelSequence : TagTraits<0x3008, 0x0130, VR::SQ, 1, 1> {};
+		struct SpecifiedChannelTotalTime : TagTraits<0x3008, 0x0132, VR::DS, 1, 1> {};
+		struct DeliveredChannelTotalTime : TagTraits<0x3008, 0x0134, VR::DS, 1, 1> {};
+		struct SpecifiedNumberOfPulses : TagTraits<0x3008, 0x0136, VR::IS, 1, 1> {};
+		struct DeliveredNumberOfPulses : TagTraits<0x3008, 0x0138, VR::IS, 1, 1> {};
+		struct SpecifiedPulseRepetitionInterval : TagTraits<0x3008, 0x013a, VR::DS, 1, 1> {};
+		struct DeliveredPulseRepetitionInterval : TagTraits<0x3008, 0x013c, VR::DS, 1, 1> {};
+		struct RecordedSourceApplicatorSequence : TagTraits<0x3008, 0x0140, VR::SQ, 1, 1> {};
+		struct ReferencedSourceApplicatorNumber : TagTraits<0x3008, 0x0142, VR::IS, 1, 1> {};
+		struct RecordedChannelShieldSequence : TagTraits<0x3008, 0x0150, VR::SQ, 1, 1> {};
+		struct ReferencedChannelShieldNumber : TagTraits<0x3008, 0x0152, VR::IS, 1, 1> {};
+		struct BrachyControlPointDeliveredSequence : TagTraits<0x3008, 0x0160, VR::SQ, 1, 1> {};
+		struct SafePositionExitDate : TagTraits<0x3008, 0x0162, VR::DA, 1, 1> {};
+		struct SafePositionExitTime : TagTraits<0x3008, 0x0164, VR::TM, 1, 1> {};
+		struct SafePositionReturnDate : TagTraits<0x3008, 0x0166, VR::DA, 1, 1> {};
+		struct SafePositionReturnTime : TagTraits<0x3008, 0x0168, VR::TM, 1, 1> {};
+		struct PulseSpecificBrachyControlPointDeliveredSequence : TagTraits<0x3008, 0x0171, VR::SQ, 1, 1> {};
+		struct PulseNumber : TagTraits<0x3008, 0x0172, VR::US, 1, 1> {};
+		struct BrachyPulseControlPointDeliveredSequence : TagTraits<0x3008, 0x0173, VR::SQ, 1, 1> {};
+		struct CurrentTreatmentStatus : TagTraits<0x3008, 0x0200, VR::CS, 1, 1> {};
+		struct TreatmentStatusComment : TagTraits<0x3008, 0x0202, VR::ST, 1, 1> {};
+		struct FractionGroupSummarySequence : TagTraits<0x3008, 0x0220, VR::SQ, 1, 1> {};
+		struct ReferencedFractionNumber : TagTraits<0x3008, 0x0223, VR::IS, 1, 1> {};
+		struct FractionGroupType : TagTraits<0x3008, 0x0224, VR::CS, 1, 1> {};
+		struct BeamStopperPosition : TagTraits<0x3008, 0x0230, VR::CS, 1, 1> {};
+		struct FractionStatusSummarySequence : TagTraits<0x3008, 0x0240, VR::SQ, 1, 1> {};
+		struct TreatmentDate : TagTraits<0x3008, 0x0250, VR::DA, 1, 1> {};
+		struct TreatmentTime : TagTraits<0x3008, 0x0251, VR::TM, 1, 1> {};
+		struct RTPlanLabel : TagTraits<0x300a, 0x0002, VR::SH, 1, 1> {};
+		struct RTPlanName : TagTraits<0x300a, 0x0003, VR::LO, 1, 1> {};
+		struct RTPlanDescription : TagTraits<0x300a, 0x0004, VR::ST, 1, 1> {};
+		struct RTPlanDate : TagTraits<0x300a, 0x0006, VR::DA, 1, 1> {};
+		struct RTPlanTime : TagTraits<0x300a, 0x0007, VR::TM, 1, 1> {};
+		struct TreatmentProtocols : TagTraits<0x300a, 0x0009, VR::LO, 1, 0> {};
+		struct PlanIntent : TagTraits<0x300a, 0x000a, VR::CS, 1, 1> {};
+		struct TreatmentSites : TagTraits<0x300a, 0x000b, VR::LO, 1, 0> {};
+		struct RTPlanGeometry : TagTraits<0x300a, 0x000c, VR::CS, 1, 1> {};
+		struct PrescriptionDescription : TagTraits<0x300a, 0x000e, VR::ST, 1, 1> {};
+		struct DoseReferenceSequence : TagTraits<0x300a, 0x0010, VR::SQ, 1, 1> {};
+		struct DoseReferenceNumber : TagTraits<0x300a, 0x0012, VR::IS, 1, 1> {};
+		struct DoseReferenceUID : TagTraits<0x300a, 0x0013, VR::UI, 1, 1> {};
+		struct DoseReferenceStructureType : TagTraits<0x300a, 0x0014, VR::CS, 1, 1> {};
+		struct NominalBeamEnergyUnit : TagTraits<0x300a, 0x0015, VR::CS, 1, 1> {};
+		struct DoseReferenceDescription : TagTraits<0x300a, 0x0016, VR::LO, 1, 1> {};
+		struct DoseReferencePointCoordinates : TagTraits<0x300a, 0x0018, VR::DS, 3, 3> {};
+		struct NominalPriorDose : TagTraits<0x300a, 0x001a, VR::DS, 1, 1> {};
+		struct DoseReferenceType : TagTraits<0x300a, 0x0020, VR::CS, 1, 1> {};
+		struct ConstraintWeight : TagTraits<0x300a, 0x0021, VR::DS, 1, 1> {};
+		struct DeliveryWarningDose : TagTraits<0x300a, 0x0022, VR::DS, 1, 1> {};
+		struct DeliveryMaximumDose : TagTraits<0x300a, 0x0023, VR::DS, 1, 1> {};
+		struct TargetMinimumDose : TagTraits<0x300a, 0x0025, VR::DS, 1, 1> {};
+		struct TargetPrescriptionDose : TagTraits<0x300a, 0x0026, VR::DS, 1, 1> {};
+		struct TargetMaximumDose : TagTraits<0x300a, 0x0027, VR::DS, 1, 1> {};
+		struct TargetUnderdoseVolumeFraction : TagTraits<0x300a, 0x0028, VR::DS, 1, 1> {};
+		struct OrganAtRiskFullVolumeDose : TagTraits<0x300a, 0x002a, VR::DS, 1, 1> {};
+		struct OrganAtRiskLimitDose : TagTraits<0x300a, 0x002b, VR::DS, 1, 1> {};
+		struct OrganAtRiskMaximumDose : TagTraits<0x300a, 0x002c, VR::DS, 1, 1> {};
+		struct OrganAtRiskOverdoseVolumeFraction : TagTraits<0x300a, 0x002d, VR::DS, 1, 1> {};
+		struct ToleranceTableSequence : TagTraits<0x300a, 0x0040, VR::SQ, 1, 1> {};
+		struct ToleranceTableNumber : TagTraits<0x300a, 0x0042, VR::IS, 1, 1> {};
+		struct ToleranceTableLabel : TagTraits<0x300a, 0x0043, VR::SH, 1, 1> {};
+		struct GantryAngleTolerance : TagTraits<0x300a, 0x0044, VR::DS, 1, 1> {};
+		struct BeamLimitingDeviceAngleTolerance : TagTraits<0x300a, 0x0046, VR::DS, 1, 1> {};
+		struct BeamLimitingDeviceToleranceSequence : TagTraits<0x300a, 0x0048, VR::SQ, 1, 1> {};
+		struct BeamLimitingDevicePositionTolerance : TagTraits<0x300a, 0x004a, VR::DS, 1, 1> {};
+		struct SnoutPositionTolerance : TagTraits<0x300a, 0x004b, VR::FL, 1, 1> {};
+		struct PatientSupportAngleTolerance : TagTraits<0x300a, 0x004c, VR::DS, 1, 1> {};
+		struct TableTopEccentricAngleTolerance : TagTraits<0x300a, 0x004e, VR::DS, 1, 1> {};
+		struct TableTopPitchAngleTolerance : TagTraits<0x300a, 0x004f, VR::FL, 1, 1> {};
+		struct TableTopRollAngleTolerance : TagTraits<0x300a, 0x0050, VR::FL, 1, 1> {};
+		struct TableTopVerticalPositionTolerance : TagTraits<0x300a, 0x0051, VR::DS, 1, 1> {};
+		struct TableTopLongitudinalPositionTolerance : TagTraits<0x300a, 0x0052, VR::DS, 1, 1> {};
+		struct TableTopLateralPositionTolerance : TagTraits<0x300a, 0x0053, VR::DS, 1, 1> {};
+		struct RTPlanRelationship : TagTraits<0x300a, 0x0055, VR::CS, 1, 1> {};
+		struct FractionGroupSequence : TagTraits<0x300a, 0x0070, VR::SQ, 1, 1> {};
+		struct FractionGroupNumber : TagTraits<0x300a, 0x0071, VR::IS, 1, 1> {};
+		struct FractionGroupDescription : TagTraits<0x300a, 0x0072, VR::LO, 1, 1> {};
+		struct NumberOfFractionsPlanned : TagTraits<0x300a, 0x0078, VR::IS, 1, 1> {};
+		struct NumberOfFractionPatternDigitsPerDay : TagTraits<0x300a, 0x0079, VR::IS, 1, 1> {};
+		struct RepeatFractionCycleLength : TagTraits<0x300a, 0x007a, VR::IS, 1, 1> {};
+		struct FractionPattern : TagTraits<0x300a, 0x007b, VR::LT, 1, 1> {};
+		struct NumberOfBeams : TagTraits<0x300a, 0x0080, VR::IS, 1, 1> {};
+		struct BeamDoseSpecificationPoint : TagTraits<0x300a, 0x0082, VR::DS, 3, 3> {};
+		struct ReferencedDoseReferenceUID : TagTraits<0x300a, 0x0083, VR::UI, 1, 1> {};
+		struct BeamDose : TagTraits<0x300a, 0x0084, VR::DS, 1, 1> {};
+		struct BeamMeterset : TagTraits<0x300a, 0x0086, VR::DS, 1, 1> {};
+		struct BeamDosePointDepth : TagTraits<0x300a, 0x0088, VR::FL, 1, 1> {};
+		struct BeamDosePointEquivalentDepth : TagTraits<0x300a, 0x0089, VR::FL, 1, 1> {};
+		struct BeamDosePointSSD : TagTraits<0x300a, 0x008a, VR::FL, 1, 1> {};
+		struct BeamDoseMeaning : TagTraits<0x300a, 0x008b, VR::CS, 1, 1> {};
+		struct BeamDoseVerificationControlPointSequence : TagTraits<0x300a, 0x008c, VR::SQ, 1, 1> {};
+		struct AverageBeamDosePointDepth : TagTraits<0x300a, 0x008d, VR::FL, 1, 1> {};
+		struct AverageBeamDosePointEquivalentDepth : TagTraits<0x300a, 0x008e, VR::FL, 1, 1> {};
+		struct AverageBeamDosePointSSD : TagTraits<0x300a, 0x008f, VR::FL, 1, 1> {};
+		struct BeamDoseType : TagTraits<0x300a, 0x0090, VR::CS, 1, 1> {};
+		struct AlternateBeamDose : TagTraits<0x300a, 0x0091, VR::DS, 1, 1> {};
+		struct AlternateBeamDoseType : TagTraits<0x300a, 0x0092, VR::CS, 1, 1> {};
+		struct NumberOfBrachyApplicationSetups : TagTraits<0x300a, 0x00a0, VR::IS, 1, 1> {};
+		struct BrachyApplicationSetupDoseSpecificationPoint : TagTraits<0x300a, 0x00a2, VR::DS, 3, 3> {};
+		struct BrachyApplicationSetupDose : TagTraits<0x300a, 0x00a4, VR::DS, 1, 1> {};
+		struct BeamSequence : TagTraits<0x300a, 0x00b0, VR::SQ, 1, 1> {};
+		struct TreatmentMachineName : TagTraits<0x300a, 0x00b2, VR::SH, 1, 1> {};
+		struct PrimaryDosimeterUnit : TagTraits<0x300a, 0x00b3, VR::CS, 1, 1> {};
+		struct SourceAxisDistance : TagTraits<0x300a, 0x00b4, VR::DS, 1, 1> {};
+		struct BeamLimitingDeviceSequence : TagTraits<0x300a, 0x00b6, VR::SQ, 1, 1> {};
+		struct RTBeamLimitingDeviceType : TagTraits<0x300a, 0x00b8, VR::CS, 1, 1> {};
+		struct SourceToBeamLimitingDeviceDistance : TagTraits<0x300a, 0x00ba, VR::DS, 1, 1> {};
+		struct IsocenterToBeamLimitingDeviceDistance : TagTraits<0x300a, 0x00bb, VR::FL, 1, 1> {};
+		struct NumberOfLeafJawPairs : TagTraits<0x300a, 0x00bc, VR::IS, 1, 1> {};
+		struct LeafPositionBoundaries : TagTraits<0x300a, 0x00be, VR::DS, 3, 0> {};
+		struct BeamNumber : TagTraits<0x300a, 0x00c0, VR::IS, 1, 1> {};
+		struct BeamName : TagTraits<0x300a, 0x00c2, VR::LO, 1, 1> {};
+		struct BeamDescription : TagTraits<0x300a, 0x00c3, VR::ST, 1, 1> {};
+		struct BeamType : TagTraits<0x300a, 0x00c4, VR::CS, 1, 1> {};
+		struct BeamDeliveryDurationLimit : TagTraits<0x300a, 0x00c5, VR::FD, 1, 1> {};
+		struct RadiationType : TagTraits<0x300a, 0x00c6, VR::CS, 1, 1> {};
+		struct HighDoseTechniqueType : TagTraits<0x300a, 0x00c7, VR::CS, 1, 1> {};
+		struct ReferenceImageNumber : TagTraits<0x300a, 0x00c8, VR::IS, 1, 1> {};
+		struct PlannedVerificationImageSequence : TagTraits<0x300a, 0x00ca, VR::SQ, 1, 1> {};
+		struct ImagingDeviceSpecificAcquisitionParameters : TagTraits<0x300a, 0x00cc, VR::LO, 1, 0> {};
+		struct TreatmentDeliveryType : TagTraits<0x300a, 0x00ce, VR::CS, 1, 1> {};
+		struct NumberOfWedges : TagTraits<0x300a, 0x00d0, VR::IS, 1, 1> {};
+		struct WedgeSequence : TagTraits<0x300a, 0x00d1, VR::SQ, 1, 1> {};
+		struct WedgeNumber : TagTraits<0x300a, 0x00d2, VR::IS, 1, 1> {};
+		struct WedgeType : TagTraits<0x300a, 0x00d3, VR::CS, 1, 1> {};
+		struct WedgeID : TagTraits<0x300a, 0x00d4, VR::SH, 1, 1> {};
+		struct WedgeAngle : TagTraits<0x300a, 0x00d5, VR::IS, 1, 1> {};
+		struct WedgeFactor : TagTraits<0x300a, 0x00d6, VR::DS, 1, 1> {};
+		struct TotalWedgeTrayWaterEquivalentThickness : TagTraits<0x300a, 0x00d7, VR::FL, 1, 1> {};
+		struct WedgeOrientation : TagTraits<0x300a, 0x00d8, VR::DS, 1, 1> {};
+		struct IsocenterToWedgeTrayDistance : TagTraits<0x300a, 0x00d9, VR::FL, 1, 1> {};
+		struct SourceToWedgeTrayDistance : TagTraits<0x300a, 0x00da, VR::DS, 1, 1> {};
+		struct WedgeThinEdgePosition : TagTraits<0x300a, 0x00db, VR::FL, 1, 1> {};
+		struct BolusID : TagTraits<0x300a, 0x00dc, VR::SH, 1, 1> {};
+		struct BolusDescription : TagTraits<0x300a, 0x00dd, VR::ST, 1, 1> {};
+		struct EffectiveWedgeAngle : TagTraits<0x300a, 0x00de, VR::DS, 1, 1> {};
+		struct NumberOfCompensators : TagTraits<0x300a, 0x00e0, VR::IS, 1, 1> {};
+		struct MaterialID : TagTraits<0x300a, 0x00e1, VR::SH, 1, 1> {};
+		struct TotalCompensatorTrayFactor : TagTraits<0x300a, 0x00e2, VR::DS, 1, 1> {};
+		struct CompensatorSequence : TagTraits<0x300a, 0x00e3, VR::SQ, 1, 1> {};
+		struct CompensatorNumber : TagTraits<0x300a, 0x00e4, VR::IS, 1, 1> {};
+		struct CompensatorID : TagTraits<0x300a, 0x00e5, VR::SH, 1, 1> {};
+		struct SourceToCompensatorTrayDistance : TagTraits<0x300a, 0x00e6, VR::DS, 1, 1> {};
+		struct CompensatorRows : TagTraits<0x300a, 0x00e7, VR::IS, 1, 1> {};
+		struct CompensatorColumns : TagTraits<0x300a, 0x00e8, VR::IS, 1, 1> {};
+		struct CompensatorPixelSpacing : TagTraits<0x300a, 0x00e9, VR::DS, 2, 2> {};
+		struct CompensatorPosition : TagTraits<0x300a, 0x00ea, VR::DS, 2, 2> {};
+		struct CompensatorTransmissionData : TagTraits<0x300a, 0x00eb, VR::DS, 1, 0> {};
+		struct CompensatorThicknessData : TagTraits<0x300a, 0x00ec, VR::DS, 1, 0> {};
+		struct NumberOfBoli : TagTraits<0x300a, 0x00ed, VR::IS, 1, 1> {};
+		struct CompensatorType : TagTraits<0x300a, 0x00ee, VR::CS, 1, 1> {};
+		struct CompensatorTrayID : TagTraits<0x300a, 0x00ef, VR::SH, 1, 1> {};
+		struct NumberOfBlocks : TagTraits<0x300a, 0x00f0, VR::IS, 1, 1> {};
+		struct TotalBlockTrayFactor : TagTraits<0x300a, 0x00f2, VR::DS, 1, 1> {};
+		struct TotalBlockTrayWaterEquivalentThickness : TagTraits<0x300a, 0x00f3, VR::FL, 1, 1> {};
+		struct BlockSequence : TagTraits<0x300a, 0x00f4, VR::SQ, 1, 1> {};
+		struct BlockTrayID : TagTraits<0x300a, 0x00f5, VR::SH, 1, 1> {};
+		struct SourceToBlockTrayDistance : TagTraits<0x300a, 0x00f6, VR::DS, 1, 1> {};
+		struct IsocenterToBlockTrayDistance : TagTraits<0x300a, 0x00f7, VR::FL, 1, 1> {};
+		struct BlockType : TagTraits<0x300a, 0x00f8, VR::CS, 1, 1> {};
+		struct AccessoryCode : TagTraits<0x300a, 0x00f9, VR::LO, 1, 1> {};
+		struct BlockDivergence : TagTraits<0x300a, 0x00fa, VR::CS, 1, 1> {};
+		struct BlockMountingPosition : TagTraits<0x300a, 0x00fb, VR::CS, 1, 1> {};
+		struct BlockNumber : TagTraits<0x300a, 0x00fc, VR::IS, 1, 1> {};
+		struct BlockName : TagTraits<0x300a, 0x00fe, VR::LO, 1, 1> {};
+		struct BlockThickness : TagTraits<0x300a, 0x0100, VR::DS, 1, 1> {};
+		struct BlockTransmission : TagTraits<0x300a, 0x0102, VR::DS, 1, 1> {};
+		struct BlockNumberOfPoints : TagTraits<0x300a, 0x0104, VR::IS, 1, 1> {};
+		struct BlockData : TagTraits<0x300a, 0x0106, VR::DS, 2, 0> {};
+		struct ApplicatorSequence : TagTraits<0x300a, 0x0107, VR::SQ, 1, 1> {};
+		struct ApplicatorID : TagTraits<0x300a, 0x0108, VR::SH, 1, 1> {};
+		struct ApplicatorType : TagTraits<0x300a, 0x0109, VR::CS, 1, 1> {};
+		struct ApplicatorDescription : TagTraits<0x300a, 0x010a, VR::LO, 1, 1> {};
+		struct CumulativeDoseReferenceCoefficient : TagTraits<0x300a, 0x010c, VR::DS, 1, 1> {};
+		struct FinalCumulativeMetersetWeight : TagTraits<0x300a, 0x010e, VR::DS, 1, 1> {};
+		struct NumberOfControlPoints : TagTraits<0x300a, 0x0110, VR::IS, 1, 1> {};
+		struct ControlPointSequence : TagTraits<0x300a, 0x0111, VR::SQ, 1, 1> {};
+		struct ControlPointIndex : TagTraits<0x300a, 0x0112, VR::IS, 1, 1> {};
+		struct NominalBeamEnergy : TagTraits<0x300a, 0x0114, VR::DS, 1, 1> {};
+		struct DoseRateSet : TagTraits<0x300a, 0x0115, VR::DS, 1, 1> {};
+		struct WedgePositionSequence : TagTraits<0x300a, 0x0116, VR::SQ, 1, 1> {};
+		struct WedgePosition : TagTraits<0x300a, 0x0118, VR::CS, 1, 1> {};
+		struct BeamLimitingDevicePositionSequence : TagTraits<0x300a, 0x011a, VR::SQ, 1, 1> {};
+		struct LeafJawPositions : TagTraits<0x300a, 0x011c, VR::DS, 2, 0> {};
+		struct GantryAngle : TagTraits<0x300a, 0x011e, VR::DS, 1, 1> {};
+		struct GantryRotationDirection : TagTraits<0x300a, 0x011f, VR::CS, 1, 1> {};
+		struct BeamLimitingDeviceAngle : TagTraits<0x300a, 0x0120, VR::DS, 1, 1> {};
+		struct BeamLimitingDeviceRotationDirection : TagTraits<0x300a, 0x0121, VR::CS, 1, 1> {};
+		struct PatientSupportAngle : TagTraits<0x300a, 0x0122, VR::DS, 1, 1> {};
+		struct PatientSupportRotationDirection : TagTraits<0x300a, 0x0123, VR::CS, 1, 1> {};
+		struct TableTopEccentricAxisDistance : TagTraits<0x300a, 0x0124, VR::DS, 1, 1> {};
+		struct TableTopEccentricAngle : TagTraits<0x300a, 0x0125, VR::DS, 1, 1> {};
+		struct TableTopEccentricRotationDirection : TagTraits<0x300a, 0x0126, VR::CS, 1, 1> {};
+		struct TableTopVerticalPosition : TagTraits<0x300a, 0x0128, VR::DS, 1, 1> {};
+		struct TableTopLongitudinalPosition : TagTraits<0x300a, 0x0129, VR::DS, 1, 1> {};
+		struct TableTopLateralPosition : TagTraits<0x300a, 0x012a, VR::DS, 1, 1> {};
+		struct IsocenterPosition : TagTraits<0x300a, 0x012c, VR::DS, 3, 3> {};
+		struct SurfaceEntryPoint : TagTraits<0x300a, 0x012e, VR::DS, 3, 3> {};
+		struct SourceToSurfaceDistance : TagTraits<0x300a, 0x0130, VR::DS, 1, 1> {};
+		struct AverageBeamDosePointSourceToExternalContourDistance : TagTraits<0x300a, 0x0131, VR::FL, 1, 1> {};
+		struct SourceToExternalContourDistance : TagTraits<0x300a, 0x0132, VR::FL, 1, 1> {};
+		struct ExternalContourEntryPoint : TagTraits<0x300a, 0x0133, VR::FL, 3, 3> {};
+		struct CumulativeMetersetWeight : TagTraits<0x300a, 0x0134, VR::DS, 1, 1> {};
+		struct TableTopPitchAngle : TagTraits<0x300a, 0x0140, VR::FL, 1, 1> {};
+		struct TableTopPitchRotationDirection : TagTraits<0x300a, 0x0142, VR::CS, 1, 1> {};
+		struct TableTopRollAngle : TagTraits<0x300a, 0x0144, VR::FL, 1, 1> {};
+		struct TableTopRollRotationDirection : TagTraits<0x300a, 0x0146, VR::CS, 1, 1> {};
+		struct HeadFixationAngle : TagTraits<0x300a, 0x0148, VR::FL, 1, 1> {};
+		struct GantryPitchAngle : TagTraits<0x300a, 0x014a, VR::FL, 1, 1> {};
+		struct GantryPitchRotationDirection : TagTraits<0x300a, 0x014c, VR::CS, 1, 1> {};
+		struct GantryPitchAngleTolerance : TagTraits<0x300a, 0x014e, VR::FL, 1, 1> {};
+		struct FixationEye : TagTraits<0x300a, 0x0150, VR::CS, 1, 1> {};
+		struct ChairHeadFramePosition : TagTraits<0x300a, 0x0151, VR::DS, 1, 1> {};
+		struct HeadFixationAngleTolerance : TagTraits<0x300a, 0x0152, VR::DS, 1, 1> {};
+		struct ChairHeadFramePositionTolerance : TagTraits<0x300a, 0x0153, VR::DS, 1, 1> {};
+		struct FixationLightAzimuthalAngleTolerance : TagTraits<0x300a, 0x0154, VR::DS, 1, 1> {};
+		struct FixationLightPolarAngleTolerance : TagTraits<0x300a, 0x0155, VR::DS, 1, 1> {};
+		struct PatientSetupSequence : TagTraits<0x300a, 0x0180, VR::SQ, 1, 1> {};
+		struct PatientSetupNumber : TagTraits<0x300a, 0x0182, VR::IS, 1, 1> {};
+		struct PatientSetupLabel : TagTraits<0x300a, 0x0183, VR::LO, 1, 1> {};
+		struct PatientAdditionalPosition : TagTraits<0x300a, 0x0184, VR::LO, 1, 1> {};
+		struct FixationDeviceSequence : TagTraits<0x300a, 0x0190, VR::SQ, 1, 1> {};
+		struct FixationDeviceType : TagTraits<0x300a, 0x0192, VR::CS, 1, 1> {};
+		struct FixationDeviceLabel : TagTraits<0x300a, 0x0194, VR::SH, 1, 1> {};
+		struct FixationDeviceDescription : TagTraits<0x300a, 0x0196, VR::ST, 1, 1> {};
+		struct FixationDevicePosition : TagTraits<0x300a, 0x0198, VR::SH, 1, 1> {};
+		struct FixationDevicePitchAngle : TagTraits<0x300a, 0x0199, VR::FL, 1, 1> {};
+		struct FixationDeviceRollAngle : TagTraits<0x300a, 0x019a, VR::FL, 1, 1> {};
+		struct ShieldingDeviceSequence : TagTraits<0x300a, 0x01a0, VR::SQ, 1, 1> {};
+		struct ShieldingDeviceType : TagTraits<0x300a, 0x01a2, VR::CS, 1, 1> {};
+		struct ShieldingDeviceLabel : TagTraits<0x300a, 0x01a4, VR::SH, 1, 1> {};
+		struct ShieldingDeviceDescription : TagTraits<0x300a, 0x01a6, VR::ST, 1, 1> {};
+		struct ShieldingDevicePosition : TagTraits<0x300a, 0x01a8, VR::SH, 1, 1> {};
+		struct SetupTechnique : TagTraits<0x300a, 0x01b0, VR::CS, 1, 1> {};
+		struct SetupTechniqueDescription : TagTraits<0x300a, 0x01b2, VR::ST, 1, 1> {};
+		struct SetupDeviceSequence : TagTraits<0x300a, 0x01b4, VR::SQ, 1, 1> {};
+		struct SetupDeviceType : TagTraits<0x300a, 0x01b6, VR::CS, 1, 1> {};
+		struct SetupDeviceLabel : TagTraits<0x300a, 0x01b8, VR::SH, 1, 1> {};
+		struct SetupDeviceDescription : TagTraits<0x300a, 0x01ba, VR::ST, 1, 1> {};
+		struct SetupDeviceParameter : TagTraits<0x300a, 0x01bc, VR::DS, 1, 1> {};
+		struct SetupReferenceDescription : TagTraits<0x300a, 0x01d0, VR::ST, 1, 1> {};
+		struct TableTopVerticalSetupDisplacement : TagTraits<0x300a, 0x01d2, VR::DS, 1, 1> {};
+		struct TableTopLongitudinalSetupDisplacement : TagTraits<0x300a, 0x01d4, VR::DS, 1, 1> {};
+		struct TableTopLateralSetupDisplacement : TagTraits<0x300a, 0x01d6, VR::DS, 1, 1> {};
+		struct BrachyTreatmentTechnique : TagTraits<0x300a, 0x0200, VR::CS, 1, 1> {};
+		struct BrachyTreatmentType : TagTraits<0x300a, 0x0202, VR::CS, 1, 1> {};
+		struct TreatmentMachineSequence : TagTraits<0x300a, 0x0206, VR::SQ, 1, 1> {};
+		struct SourceSequence : TagTraits<0x300a, 0x0210, VR::SQ, 1, 1> {};
+		struct SourceNumber : TagTraits<0x300a, 0x0212, VR::IS, 1, 1> {};
+		struct SourceType : TagTraits<0x300a, 0x0214, VR::CS, 1, 1> {};
+		struct SourceManufacturer : TagTraits<0x300a, 0x0216, VR::LO, 1, 1> {};
+		struct ActiveSourceDiameter : TagTraits<0x300a, 0x0218, VR::DS, 1, 1> {};
+		struct ActiveSourceLength : TagTraits<0x300a, 0x021a, VR::DS, 1, 1> {};
+		struct SourceModelID : TagTraits<0x300a, 0x021b, VR::SH, 1, 1> {};
+		struct SourceDescription : TagTraits<0x300a, 0x021c, VR::LO, 1, 1> {};
+		struct SourceEncapsulationNominalThickness : TagTraits<0x300a, 0x0222, VR::DS, 1, 1> {};
+		struct SourceEncapsulationNominalTransmission : TagTraits<0x300a, 0x0224, VR::DS, 1, 1> {};
+		struct SourceIsotopeName : TagTraits<0x300a, 0x0226, VR::LO, 1, 1> {};
+		struct SourceIsotopeHalfLife : TagTraits<0x300a, 0x0228, VR::DS, 1, 1> {};
+		struct SourceStrengthUnits : TagTraits<0x300a, 0x0229, VR::CS, 1, 1> {};
+		struct ReferenceAirKermaRate : TagTraits<0x300a, 0x022a, VR::DS, 1, 1> {};
+		struct SourceStrength : TagTraits<0x300a, 0x022b, VR::DS, 1, 1> {};
+		struct SourceStrengthReferenceDate : TagTraits<0x300a, 0x022c, VR::DA, 1, 1> {};
+		struct SourceStrengthReferenceTime : TagTraits<0x300a, 0x022e, VR::TM, 1, 1> {};
+		struct ApplicationSetupSequence : TagTraits<0x300a, 0x0230, VR::SQ, 1, 1> {};
+		struct ApplicationSetupType : TagTraits<0x300a, 0x0232, VR::CS, 1, 1> {};
+		struct ApplicationSetupNumber : TagTraits<0x300a, 0x0234, VR::IS, 1, 1> {};
+		struct ApplicationSetupName : TagTraits<0x300a, 0x0236, VR::LO, 1, 1> {};
+		struct ApplicationSetupManufacturer : TagTraits<0x300a, 0x0238, VR::LO, 1, 1> {};
+		struct TemplateNumber : TagTraits<0x300a, 0x0240, VR::IS, 1, 1> {};
+		struct TemplateType : TagTraits<0x300a, 0x0242, VR::SH, 1, 1> {};
+		struct TemplateName : TagTraits<0x300a, 0x0244, VR::LO, 1, 1> {};
+		struct TotalReferenceAirKerma : TagTraits<0x300a, 0x0250, VR::DS, 1, 1> {};
+		struct BrachyAccessoryDeviceSequence : TagTraits<0x300a, 0x0260, VR::SQ, 1, 1> {};
+		struct BrachyAccessoryDeviceNumber : TagTraits<0x300a, 0x0262, VR::IS, 1, 1> {};
+		struct BrachyAccessoryDeviceID : TagTraits<0x300a, 0x0263, VR::SH, 1, 1> {};
+		struct BrachyAccessoryDeviceType : TagTraits<0x300a, 0x0264, VR::CS, 1, 1> {};
+		struct BrachyAccessoryDeviceName : TagTraits<0x300a, 0x0266, VR::LO, 1, 1> {};
+		struct BrachyAccessoryDeviceNominalThickness : TagTraits<0x300a, 0x026a, VR::DS, 1, 1> {};
+		struct BrachyAccessoryDeviceNominalTransmission : TagTraits<0x300a, 0x026c, VR::DS, 1, 1> {};
+		struct ChannelSequence : TagTraits<0x300a, 0x0280, VR::SQ, 1, 1> {};
+		struct ChannelNumber : TagTraits<0x300a, 0x0282, VR::IS, 1, 1> {};
+		struct ChannelLength : TagTraits<0x300a, 0x0284, VR::DS, 1, 1> {};
+		struct ChannelTotalTime : TagTraits<0x300a, 0x0286, VR::DS, 1, 1> {};
+		struct SourceMovementType : TagTraits<0x300a, 0x0288, VR::CS, 1, 1> {};
+		struct NumberOfPulses : TagTraits<0x300a, 0x028a, VR::IS, 1, 1> {};
+		struct PulseRepetitionInterval : TagTraits<0x300a, 0x028c, VR::DS, 1, 1> {};
+		struct SourceApplicatorNumber : TagTraits<0x300a, 0x0290, VR::IS, 1, 1> {};
+		struct SourceApplicatorID : TagTraits<0x300a, 0x0291, VR::SH, 1, 1> {};
+		struct SourceApplicatorType : TagTraits<0x300a, 0x0292, VR::CS, 1, 1> {};
+		struct SourceApplicatorName : TagTraits<0x300a, 0x0294, VR::LO, 1, 1> {};
+		struct SourceApplicatorLength : TagTraits<0x300a, 0x0296, VR::DS, 1, 1> {};
+		struct SourceApplicatorManufacturer : TagTraits<0x300a, 0x0298, VR::LO, 1, 1> {};
+		struct SourceApplicatorWallNominalThickness : TagTraits<0x300a, 0x029c, VR::DS, 1, 1> {};
+		struct SourceApplicatorWallNominalTransmission : TagTraits<0x300a, 0x029e, VR::DS, 1, 1> {};
+		struct SourceApplicatorStepSize : TagTraits<0x300a, 0x02a0, VR::DS, 1, 1> {};
+		struct TransferTubeNumber : TagTraits<0x300a, 0x02a2, VR::IS, 1, 1> {};
+		struct TransferTubeLength : TagTraits<0x300a, 0x02a4, VR::DS, 1, 1> {};
+		struct ChannelShieldSequence : TagTraits<0x300a, 0x02b0, VR::SQ, 1, 1> {};
+		struct ChannelShieldNumber : TagTraits<0x300a, 0x02b2, VR::IS, 1, 1> {};
+		struct ChannelShieldID : TagTraits<0x300a, 0x02b3, VR::SH, 1, 1> {};
+		struct ChannelShieldName : TagTraits<0x300a, 0x02b4, VR::LO, 1, 1> {};
+		struct ChannelShieldNominalThickness : TagTraits<0x300a, 0x02b8, VR::DS, 1, 1> {};
+		struct ChannelShieldNominalTransmission : TagTraits<0x300a, 0x02ba, VR::DS, 1, 1> {};
+		struct FinalCumulativeTimeWeight : TagTraits<0x300a, 0x02c8, VR::DS, 1, 1> {};
+		struct BrachyControlPointSequence : TagTraits<0x300a, 0x02d0, VR::SQ, 1, 1> {};
+		struct ControlPointRelativePosition : TagTraits<0x300a, 0x02d2, VR::DS, 1, 1> {};
+		struct ControlPoint3DPosition : TagTraits<0x300a, 0x02d4, VR::DS, 3, 3> {};
+		struct CumulativeTimeWeight : TagTraits<0x300a, 0x02d6, VR::DS, 1, 1> {};
+		struct CompensatorDivergence : TagTraits<0x300a, 0x02e0, VR::CS, 1, 1> {};
+		struct CompensatorMountingPosition : TagTraits<0x300a, 0x02e1, VR::CS, 1, 1> {};
+		struct SourceToCompensatorDistance : TagTraits<0x300a, 0x02e2, VR::DS, 1, 0> {};
+		struct TotalCompensatorTrayWaterEquivalentThickness : TagTraits<0x300a, 0x02e3, VR::FL, 1, 1> {};
+		struct IsocenterToCompensatorTrayDistance : TagTraits<0x300a, 0x02e4, VR::FL, 1, 1> {};
+		struct CompensatorColumnOffset : TagTraits<0x300a, 0x02e5, VR::FL, 1, 1> {};
+		struct IsocenterToCompensatorDistances : TagTraits<0x300a, 0x02e6, VR::FL, 1, 0> {};
+		struct CompensatorRelativeStoppingPowerRatio : TagTraits<0x300a, 0x02e7, VR::FL, 1, 1> {};
+		struct CompensatorMillingToolDiameter : TagTraits<0x300a, 0x02e8, VR::FL, 1, 1> {};
+		struct IonRangeCompensatorSequence : TagTraits<0x300a, 0x02ea, VR::SQ, 1, 1> {};
+		struct CompensatorDescription : TagTraits<0x300a, 0x02eb, VR::LT, 1, 1> {};
+		struct RadiationMassNumber : TagTraits<0x300a, 0x0302, VR::IS, 1, 1> {};
+		struct RadiationAtomicNumber : TagTraits<0x300a, 0x0304, VR::IS, 1, 1> {};
+		struct RadiationChargeState : TagTraits<0x300a, 0x0306, VR::SS, 1, 1> {};
+		struct ScanMode : TagTraits<0x300a, 0x0308, VR::CS, 1, 1> {};
+		struct ModulatedScanModeType : TagTraits<0x300a, 0x0309, VR::CS, 1, 1> {};
+		struct VirtualSourceAxisDistances : TagTraits<0x300a, 0x030a, VR::FL, 2, 2> {};
+		struct SnoutSequence : TagTraits<0x300a, 0x030c, VR::SQ, 1, 1> {};
+		struct SnoutPosition : TagTraits<0x300a, 0x030d, VR::FL, 1, 1> {};
+		struct SnoutID : TagTraits<0x300a, 0x030f, VR::SH, 1, 1> {};
+		struct NumberOfRangeShifters : TagTraits<0x300a, 0x0312, VR::IS, 1, 1> {};
+		struct RangeShifterSequence : TagTraits<0x300a, 0x0314, VR::SQ, 1, 1> {};
+		struct RangeShifterNumber : TagTraits<0x300a, 0x0316, VR::IS, 1, 1> {};
+		struct RangeShifterID : TagTraits<0x300a, 0x0318, VR::SH, 1, 1> {};
+		struct RangeShifterType : TagTraits<0x300a, 0x0320, VR::CS, 1, 1> {};
+		struct RangeShifterDescription : TagTraits<0x300a, 0x0322, VR::LO, 1, 1> {};
+		struct NumberOfLateralSpreadingDevices : TagTraits<0x300a, 0x0330, VR::IS, 1, 1> {};
+		struct LateralSpreadingDeviceSequence : TagTraits<0x300a, 0x0332, VR::SQ, 1, 1> {};
+		struct LateralSpreadingDeviceNumber : TagTraits<0x300a, 0x0334, VR::IS, 1, 1> {};
+		struct LateralSpreadingDeviceID : TagTraits<0x300a, 0x0336, VR::SH, 1, 1> {};
+		struct LateralSpreadingDeviceType : TagTraits<0x300a, 0x0338, VR::CS, 1, 1> {};
+		struct LateralSpreadingDeviceDescription : TagTraits<0x300a, 0x033a, VR::LO, 1, 1> {};
+		struct LateralSpreadingDeviceWaterEquivalentThickness : TagTraits<0x300a, 0x033c, VR::FL, 1, 1> {};
+		struct NumberOfRangeModulators : TagTraits<0x300a, 0x0340, VR::IS, 1, 1> {};
+		struct RangeModulatorSequence : TagTraits<0x300a, 0x0342, VR::SQ, 1, 1> {};
+		struct RangeModulatorNumber : TagTraits<0x300a, 0x0344, VR::IS, 1, 1> {};
+		struct RangeModulatorID : TagTraits<0x300a, 0x0346, VR::SH, 1, 1> {};
+		struct RangeModulatorType : TagTraits<0x300a, 0x0348, VR::CS, 1, 1> {};
+		struct RangeModulatorDescription : TagTraits<0x300a, 0x034a, VR::LO, 1, 1> {};
+		struct BeamCurrentModulationID : TagTraits<0x300a, 0x034c, VR::SH, 1, 1> {};
+		struct PatientSupportType : TagTraits<0x300a, 0x0350, VR::CS, 1, 1> {};
+		struct PatientSupportID : TagTraits<0x300a, 0x0352, VR::SH, 1, 1> {};
+		struct PatientSupportAccessoryCode : TagTraits<0x300a, 0x0354, VR::LO, 1, 1> {};
+		struct TrayAccessoryCode : TagTraits<0x300a, 0x0355, VR::LO, 1, 1> {};
+		struct FixationLightAzimuthalAngle : TagTraits<0x300a, 0x0356, VR::FL, 1, 1> {};
+		struct FixationLightPolarAngle : TagTraits<0x300a, 0x0358, VR::FL, 1, 1> {};
+		struct MetersetRate : TagTraits<0x300a, 0x035a, VR::FL, 1, 1> {};
+		struct RangeShifterSettingsSequence : TagTraits<0x300a, 0x0360, VR::SQ, 1, 1> {};
+		struct RangeShifterSetting : TagTraits<0x300a, 0x0362, VR::LO, 1, 1> {};
+		struct IsocenterToRangeShifterDistance : TagTraits<0x300a, 0x0364, VR::FL, 1, 1> {};
+		struct RangeShifterWaterEquivalentThickness : TagTraits<0x300a, 0x0366, VR::FL, 1, 1> {};
+		struct LateralSpreadingDeviceSettingsSequence : TagTraits<0x300a, 0x0370, VR::SQ, 1, 1> {};
+		struct LateralSpreadingDeviceSetting : TagTraits<0x300a, 0x0372, VR::LO, 1, 1> {};
+		struct IsocenterToLateralSpreadingDeviceDistance : TagTraits<0x300a, 0x0374, VR::FL, 1, 1> {};
+		struct RangeModulatorSettingsSequence : TagTraits<0x300a, 0x0380, VR::SQ, 1, 1> {};
+		struct RangeModulatorGatingStartValue : TagTraits<0x300a, 0x0382, VR::FL, 1, 1> {};
+		struct RangeModulatorGatingStopValue : TagTraits<0x300a, 0x0384, VR::FL, 1, 1> {};
+		struct RangeModulatorGatingStartWaterEquivalentThickness : TagTraits<0x300a, 0x0386, VR::FL, 1, 1> {};
+		struct RangeModulatorGatingStopWaterEquivalentThickness : TagTraits<0x300a, 0x0388, VR::FL, 1, 1> {};
+		struct IsocenterToRangeModulatorDistance : TagTraits<0x300a, 0x038a, VR::FL, 1, 1> {};
+		struct ScanSpotTimeOffset : TagTraits<0x300a, 0x038f, VR::FL, 1, 0> {};
+		struct ScanSpotTuneID : TagTraits<0x300a, 0x0390, VR::SH, 1, 1> {};
+		struct ScanSpotPrescribedIndices : TagTraits<0x300a, 0x0391, VR::IS, 1, 0> {};
+		struct NumberOfScanSpotPositions : TagTraits<0x300a, 0x0392, VR::IS, 1, 1> {};
+		struct ScanSpotReordered : TagTraits<0x300a, 0x0393, VR::CS, 1, 1> {};
+		struct ScanSpotPositionMap : TagTraits<0x300a, 0x0394, VR::FL, 1, 0> {};
+		struct ScanSpotReorderingAllowed : TagTraits<0x300a, 0x0395, VR::CS, 1, 1> {};
+		struct ScanSpotMetersetWeights : TagTraits<0x300a, 0x0396, VR::FL, 1, 0> {};
+		struct ScanningSpotSize : TagTraits<0x300a, 0x0398, VR::FL, 2, 2> {};
+		struct NumberOfPaintings : TagTraits<0x300a, 0x039a, VR::IS, 1, 1> {};
+		struct IonToleranceTableSequence : TagTraits<0x300a, 0x03a0, VR::SQ, 1, 1> {};
+		struct IonBeamSequence : TagTraits<0x300a, 0x03a2, VR::SQ, 1, 1> {};
+		struct IonBeamLimitingDeviceSequence : TagTraits<0x300a, 0x03a4, VR::SQ, 1, 1> {};
+		struct IonBlockSequence : TagTraits<0x300a, 0x03a6, VR::SQ, 1, 1> {};
+		struct IonControlPointSequence : TagTraits<0x300a, 0x03a8, VR::SQ, 1, 1> {};
+		struct IonWedgeSequence : TagTraits<0x300a, 0x03aa, VR::SQ, 1, 1> {};
+		struct IonWedgePositionSequence : TagTraits<0x300a, 0x03ac, VR::SQ, 1, 1> {};
+		struct ReferencedSetupImageSequence : TagTraits<0x300a, 0x0401, VR::SQ, 1, 1> {};
+		struct SetupImageComment : TagTraits<0x300a, 0x0402, VR::ST, 1, 1> {};
+		struct MotionSynchronizationSequence : TagTraits<0x300a, 0x0410, VR::SQ, 1, 1> {};
+		struct ControlPointOrientation : TagTraits<0x300a, 0x0412, VR::FL, 3, 3> {};
+		struct GeneralAccessorySequence : TagTraits<0x300a, 0x0420, VR::SQ, 1, 1> {};
+		struct GeneralAccessoryID : TagTraits<0x300a, 0x0421, VR::SH, 1, 1> {};
+		struct GeneralAccessoryDescription : TagTraits<0x300a, 0x0422, VR::ST, 1, 1> {};
+		struct GeneralAccessoryType : TagTraits<0x300a, 0x0423, VR::CS, 1, 1> {};
+		struct GeneralAccessoryNumber : TagTraits<0x300a, 0x0424, VR::IS, 1, 1> {};
+		struct SourceToGeneralAccessoryDistance : TagTraits<0x300a, 0x0425, VR::FL, 1, 1> {};
+		struct ApplicatorGeometrySequence : TagTraits<0x300a, 0x0431, VR::SQ, 1, 1> {};
+		struct ApplicatorApertureShape : TagTraits<0x300a, 0x0432, VR::CS, 1, 1> {};
+		struct ApplicatorOpening : TagTraits<0x300a, 0x0433, VR::FL, 1, 1> {};
+		struct ApplicatorOpeningX : TagTraits<0x300a, 0x0434, VR::FL, 1, 1> {};
+		struct ApplicatorOpeningY : TagTraits<0x300a, 0x0435, VR::FL, 1, 1> {};
+		struct SourceToApplicatorMountingPositionDistance : TagTraits<0x300a, 0x0436, VR::FL, 1, 1> {};
+		struct NumberOfBlockSlabItems : TagTraits<0x300a, 0x0440, VR::IS, 1, 1> {};
+		struct BlockSlabSequence : TagTraits<0x300a, 0x0441, VR::SQ, 1, 1> {};
+		struct BlockSlabThickness : TagTraits<0x300a, 0x0442, VR::DS, 1, 1> {};
+		struct BlockSlabNumber : TagTraits<0x300a, 0x0443, VR::US, 1, 1> {};
+		struct DeviceMotionControlSequence : TagTraits<0x300a, 0x0450, VR::SQ, 1, 1> {};
+		struct DeviceMotionExecutionMode : TagTraits<0x300a, 0x0451, VR::CS, 1, 1> {};
+		struct DeviceMotionObservationMode : TagTraits<0x300a, 0x0452, VR::CS, 1, 1> {};
+		struct DeviceMotionParameterCodeSequence : TagTraits<0x300a, 0x0453, VR::SQ, 1, 1> {};
+		struct DistalDepthFraction : TagTraits<0x300a, 0x0501, VR::FL, 1, 1> {};
+		struct DistalDepth : TagTraits<0x300a, 0x0502, VR::FL, 1, 1> {};
+		struct NominalRangeModulationFractions : TagTraits<0x300a, 0x0503, VR::FL, 2, 2> {};
+		struct NominalRangeModulatedRegionDepths : TagTraits<0x300a, 0x0504, VR::FL, 2, 2> {};
+		struct DepthDoseParametersSequence : TagTraits<0x300a, 0x0505, VR::SQ, 1, 1> {};
+		struct DeliveredDepthDoseParametersSequence : TagTraits<0x300a, 0x0506, VR::SQ, 1, 1> {};
+		struct DeliveredDistalDepthFraction : TagTraits<0x300a, 0x0507, VR::FL, 1, 1> {};
+		struct DeliveredDistalDepth : TagTraits<0x300a, 0x0508, VR::FL, 1, 1> {};
+		struct DeliveredNominalRangeModulationFractions : TagTraits<0x300a, 0x0509, VR::FL, 2, 2> {};
+		struct DeliveredNominalRangeModulatedRegionDepths : TagTraits<0x300a, 0x0510, VR::FL, 2, 2> {};
+		struct DeliveredReferenceDoseDefinition : TagTraits<0x300a, 0x0511, VR::CS, 1, 1> {};
+		struct ReferenceDoseDefinition : TagTraits<0x300a, 0x0512, VR::CS, 1, 1> {};
+		struct ReferencedRTPlanSequence : TagTraits<0x300c, 0x0002, VR::SQ, 1, 1> {};
+		struct ReferencedBeamSequence : TagTraits<0x300c, 0x0004, VR::SQ, 1, 1> {};
+		struct ReferencedBeamNumber : TagTraits<0x300c, 0x0006, VR::IS, 1, 1> {};
+		struct ReferencedReferenceImageNumber : TagTraits<0x300c, 0x0007, VR::IS, 1, 1> {};
+		struct StartCumulativeMetersetWeight : TagTraits<0x300c, 0x0008, VR::DS, 1, 1> {};
+		struct EndCumulativeMetersetWeight : TagTraits<0x300c, 0x0009, VR::DS, 1, 1> {};
+		struct ReferencedBrachyApplicationSetupSequence : TagTraits<0x300c, 0x000a, VR::SQ, 1, 1> {};
+		struct ReferencedBrachyApplicationSetupNumber : TagTraits<0x300c, 0x000c, VR::IS, 1, 1> {};
+		struct ReferencedSourceNumber : TagTraits<0x300c, 0x000e, VR::IS, 1, 1> {};
+		struct ReferencedFractionGroupSequence : TagTraits<0x300c, 0x0020, VR::SQ, 1, 1> {};
+		struct ReferencedFractionGroupNumber : TagTraits<0x300c, 0x0022, VR::IS, 1, 1> {};
+		struct ReferencedVerificationImageSequence : TagTraits<0x300c, 0x0040, VR::SQ, 1, 1> {};
+		struct ReferencedReferenceImageSequence : TagTraits<0x300c, 0x0042, VR::SQ, 1, 1> {};
+		struct ReferencedDoseReferenceSequence : TagTraits<0x300c, 0x0050, VR::SQ, 1, 1> {};
+		struct ReferencedDoseReferenceNumber : TagTraits<0x300c, 0x0051, VR::IS, 1, 1> {};
+		struct BrachyReferencedDoseReferenceSequence : TagTraits<0x300c, 0x0055, VR::SQ, 1, 1> {};
+		struct ReferencedStructureSetSequence : TagTraits<0x300c, 0x0060, VR::SQ, 1, 1> {};
+		struct ReferencedPatientSetupNumber : TagTraits<0x300c, 0x006a, VR::IS, 1, 1> {};
+		struct ReferencedDoseSequence : TagTraits<0x300c, 0x0080, VR::SQ, 1, 1> {};
+		struct ReferencedToleranceTableNumber : TagTraits<0x300c, 0x00a0, VR::IS, 1, 1> {};
+		struct ReferencedBolusSequence : TagTraits<0x300c, 0x00b0, VR::SQ, 1, 1> {};
+		struct ReferencedWedgeNumber : TagTraits<0x300c, 0x00c0, VR::IS, 1, 1> {};
+		struct ReferencedCompensatorNumber : TagTraits<0x300c, 0x00d0, VR::IS, 1, 1> {};
+		struct ReferencedBlockNumber : TagTraits<0x300c, 0x00e0, VR::IS, 1, 1> {};
+		struct ReferencedControlPointIndex : TagTraits<0x300c, 0x00f0, VR::IS, 1, 1> {};
+		struct ReferencedControlPointSequence : TagTraits<0x300c, 0x00f2, VR::SQ, 1, 1> {};
+		struct ReferencedStartControlPointIndex : TagTraits<0x300c, 0x00f4, VR::IS, 1, 1> {};
+		struct ReferencedStopControlPointIndex : TagTraits<0x300c, 0x00f6, VR::IS, 1, 1> {};
+		struct ReferencedRangeShifterNumber : TagTraits<0x300c, 0x0100, VR::IS, 1, 1> {};
+		struct ReferencedLateralSpreadingDeviceNumber : TagTraits<0x300c, 0x0102, VR::IS, 1, 1> {};
+		struct ReferencedRangeModulatorNumber : TagTraits<0x300c, 0x0104, VR::IS, 1, 1> {};
+		struct OmittedBeamTaskSequence : TagTraits<0x300c, 0x0111, VR::SQ, 1, 1> {};
+		struct ReasonForOmission : TagTraits<0x300c, 0x0112, VR::CS, 1, 1> {};
+		struct ReasonForOmissionDescription : TagTraits<0x300c, 0x0113, VR::LO, 1, 1> {};
+		struct ApprovalStatus : TagTraits<0x300e, 0x0002, VR::CS, 1, 1> {};
+		struct ReviewDate : TagTraits<0x300e, 0x0004, VR::DA, 1, 1> {};
+		struct ReviewTime : TagTraits<0x300e, 0x0005, VR::TM, 1, 1> {};
+		struct ReviewerName : TagTraits<0x300e, 0x0008, VR::PN, 1, 1> {};
+		struct Arbitrary : TagTraits<0x4000, 0x0010, VR::LT, 1, 1> {};
+		struct TextComments : TagTraits<0x4000, 0x4000, VR::LT, 1, 1> {};
+		struct ResultsID : TagTraits<0x4008, 0x0040, VR::SH, 1, 1> {};
+		struct ResultsIDIssuer : TagTraits<0x4008, 0x0042, VR::LO, 1, 1> {};
+		struct ReferencedInterpretationSequence : TagTraits<0x4008, 0x0050, VR::SQ, 1, 1> {};
+		struct ReportProductionStatusTrial : TagTraits<0x4008, 0x00ff, VR::CS, 1, 1> {};
+		struct InterpretationRecordedDate : TagTraits<0x4008, 0x0100, VR::DA, 1, 1> {};
+		struct InterpretationRecordedTime : TagTraits<0x4008, 0x0101, VR::TM, 1, 1> {};
+		struct InterpretationRecorder : TagTraits<0x4008, 0x0102, VR::PN, 1, 1> {};
+		struct ReferenceToRecordedSound : TagTraits<0x4008, 0x0103, VR::LO, 1, 1> {};
+		struct InterpretationTranscriptionDate : TagTraits<0x4008, 0x0108, VR::DA, 1, 1> {};
+		struct InterpretationTranscriptionTime : TagTraits<0x4008, 0x0109, VR::TM, 1, 1> {};
+		struct InterpretationTranscriber : TagTraits<0x4008, 0x010a, VR::PN, 1, 1> {};
+		struct InterpretationText : TagTraits<0x4008, 0x010b, VR::ST, 1, 1> {};
+		struct InterpretationAuthor : TagTraits<0x4008, 0x010c, VR::PN, 1, 1> {};
+		struct InterpretationApproverSequence : TagTraits<0x4008, 0x0111, VR::SQ, 1, 1> {};
+		struct InterpretationApprovalDate : TagTraits<0x4008, 0x0112, VR::DA, 1, 1> {};
+		struct InterpretationApprovalTime : TagTraits<0x4008, 0x0113, VR::TM, 1, 1> {};
+		struct PhysicianApprovingInterpretation : TagTraits<0x4008, 0x0114, VR::PN, 1, 1> {};
+		struct InterpretationDiagnosisDescription : TagTraits<0x4008, 0x0115, VR::LT, 1, 1> {};
+		struct InterpretationDiagnosisCodeSequence : TagTraits<0x4008, 0x0117, VR::SQ, 1, 1> {};
+		struct ResultsDistributionListSequence : TagTraits<0x4008, 0x0118, VR::SQ, 1, 1> {};
+		struct DistributionName : TagTraits<0x4008, 0x0119, VR::PN, 1, 1> {};
+		struct DistributionAddress : TagTraits<0x4008, 0x011a, VR::LO, 1, 1> {};
+		struct InterpretationID : TagTraits<0x4008, 0x0200, VR::SH, 1, 1> {};
+		struct InterpretationIDIssuer : TagTraits<0x4008, 0x0202, VR::LO, 1, 1> {};
+		struct InterpretationTypeID : TagTraits<0x4008, 0x0210, VR::CS, 1, 1> {};
+		struct InterpretationStatusID : TagTraits<0x4008, 0x0212, VR::CS, 1, 1> {};
+		struct Impressions : TagTraits<0x4008, 0x0300, VR::ST, 1, 1> {};
+		struct ResultsComments : TagTraits<0x4008, 0x4000, VR::ST, 1, 1> {};
+		struct LowEnergyDetectors : TagTraits<0x4010, 0x0001, VR::CS, 1, 1> {};
+		struct HighEnergyDetectors : TagTraits<0x4010, 0x0002, VR::CS, 1, 1> {};
+		struct DetectorGeometrySequence : TagTraits<0x4010, 0x0004, VR::SQ, 1, 1> {};
+		struct ThreatROIVoxelSequence : TagTraits<0x4010, 0x1001, VR::SQ, 1, 1> {};
+		struct ThreatROIBase : TagTraits<0x4010, 0x1004, VR::FL, 3, 3> {};
+		struct ThreatROIExtents : TagTraits<0x4010, 0x1005, VR::FL, 3, 3> {};
+		struct ThreatROIBitmap : TagTraits<0x4010, 0x1006, VR::OB, 1, 1> {};
+		struct RouteSegmentID : TagTraits<0x4010, 0x1007, VR::SH, 1, 1> {};
+		struct GantryType : TagTraits<0x4010, 0x1008, VR::CS, 1, 1> {};
+		struct OOIOwnerType : TagTraits<0x4010, 0x1009, VR::CS, 1, 1> {};
+		struct RouteSegmentSequence : TagTraits<0x4010, 0x100a, VR::SQ, 1, 1> {};
+		struct PotentialThreatObjectID : TagTraits<0x4010, 0x1010, VR::US, 1, 1> {};
+		struct ThreatSequence : TagTraits<0x4010, 0x1011, VR::SQ, 1, 1> {};
+		struct ThreatCategory : TagTraits<0x4010, 0x1012, VR::CS, 1, 1> {};
+		struct ThreatCategoryDescription : TagTraits<0x4010, 0x1013, VR::LT, 1, 1> {};
+		struct ATDAbilityAssessment : TagTraits<0x4010, 0x1014, VR::CS, 1, 1> {};
+		struct ATDAssessmentFlag : TagTraits<0x4010, 0x1015, VR::CS, 1, 1> {};
+		struct ATDAssessmentProbability : TagTraits<0x4010, 0x1016, VR::FL, 1, 1> {};
+		struct Mass : TagTraits<0x4010, 0x1017, VR::FL, 1, 1> {};
+		struct Density : TagTraits<0x4010, 0x1018, VR::FL, 1, 1> {};
+		struct ZEffective : TagTraits<0x4010, 0x1019, VR::FL, 1, 1> {};
+		struct BoardingPassID : TagTraits<0x4010, 0x101a, VR::SH, 1, 1> {};
+		struct CenterOfMass : TagTraits<0x4010, 0x101b, VR::FL, 3, 3> {};
+		struct CenterOfPTO : TagTraits<0x4010, 0x101c, VR::FL, 3, 3> {};
+		struct BoundingPolygon : TagTraits<0x4010, 0x101d, VR::FL, 6, 0> {};
+		struct RouteSegmentStartLocationID : TagTraits<0x4010, 0x101e, VR::SH, 1, 1> {};
+		struct RouteSegmentEndLocationID : TagTraits<0x4010, 0x101f, VR::SH, 1, 1> {};
+		struct RouteSegmentLocationIDType : TagTraits<0x4010, 0x1020, VR::CS, 1, 1> {};
+		struct AbortReason : TagTraits<0x4010, 0x1021, VR::CS, 1, 0> {};
+		struct VolumeOfPTO : TagTraits<0x4010, 0x1023, VR::FL, 1, 1> {};
+		struct AbortFlag : TagTraits<0x4010, 0x1024, VR::CS, 1, 1> {};
+		struct RouteSegmentStartTime : TagTraits<0x4010, 0x1025, VR::DT, 1, 1> {};
+		struct RouteSegmentEndTime : TagTraits<0x4010, 0x1026, VR::DT, 1, 1> {};
+		struct TDRType : TagTraits<0x4010, 0x1027, VR::CS, 1, 1> {};
+		struct InternationalRouteSegment : TagTraits<0x4010, 0x1028, VR::CS, 1, 1> {};
+		struct ThreatDetectionAlgorithmandVersion : TagTraits<0x4010, 0x1029, VR::LO, 1, 0> {};
+		struct AssignedLocation : TagTraits<0x4010, 0x102a, VR::SH, 1, 1> {};
+		struct AlarmDecisionTime : TagTraits<0x4010, 0x102b, VR::DT, 1, 1> {};
+		struct AlarmDecision : TagTraits<0x4010, 0x1031, VR::CS, 1, 1> {};
+		struct NumberOfTotalObjects : TagTraits<0x4010, 0x1033, VR::US, 1, 1> {};
+		struct NumberOfAlarmObjects : TagTraits<0x4010, 0x1034, VR::US, 1, 1> {};
+		struct PTORepresentationSequence : TagTraits<0x4010, 0x1037, VR::SQ, 1, 1> {};
+		struct ATDAssessmentSequence : TagTraits<0x4010, 0x1038, VR::SQ, 1, 1> {};
+		struct TIPType : TagTraits<0x4010, 0x1039, VR::CS, 1, 1> {};
+		struct DICOSVersion : TagTraits<0x4010, 0x103a, VR::CS, 1, 1> {};
+		struct OOIOwnerCreationTime : TagTraits<0x4010, 0x1041, VR::DT, 1, 1> {};
+		struct OOIType : TagTraits<0x4010, 0x1042, VR::CS, 1, 1> {};
+		struct OOISize : TagTraits<0x4010, 0x1043, VR::FL, 3, 3> {};
+		struct AcquisitionStatus : TagTraits<0x4010, 0x1044, VR::CS, 1, 1> {};
+		struct BasisMaterialsCodeSequence : TagTraits<0x4010, 0x1045, VR::SQ, 1, 1> {};
+		struct PhantomType : TagTraits<0x4010, 0x1046, VR::CS, 1, 1> {};
+		struct OOIOwnerSequence : TagTraits<0x4010, 0x1047, VR::SQ, 1, 1> {};
+		struct ScanType : TagTraits<0x4010, 0x1048, VR::CS, 1, 1> {};
+		struct ItineraryID : TagTraits<0x4010, 0x1051, VR::LO, 1, 1> {};
+		struct ItineraryIDType : TagTraits<0x4010, 0x1052, VR::SH, 1, 1> {};
+		struct ItineraryIDAssigningAuthority : TagTraits<0x4010, 0x1053, VR::LO, 1, 1> {};
+		struct RouteID : TagTraits<0x4010, 0x1054, VR::SH, 1, 1> {};
+		struct RouteIDAssigningAuthority : TagTraits<0x4010, 0x1055, VR::SH, 1, 1> {};
+		struct InboundArrivalType : TagTraits<0x4010, 0x1056, VR::CS, 1, 1> {};
+		struct CarrierID : TagTraits<0x4010, 0x1058, VR::SH, 1, 1> {};
+		struct CarrierIDAssigningAuthority : TagTraits<0x4010, 0x1059, VR::CS, 1, 1> {};
+		struct SourceOrientation : TagTraits<0x4010, 0x1060, VR::FL, 3, 3> {};
+		struct SourcePosition : TagTraits<0x4010, 0x1061, VR::FL, 3, 3> {};
+		struct BeltHeight : TagTraits<0x4010, 0x1062, VR::FL, 1, 1> {};
+		struct AlgorithmRoutingCodeSequence : TagTraits<0x4010, 0x1064, VR::SQ, 1, 1> {};
+		struct TransportClassification : TagTraits<0x4010, 0x1067, VR::CS, 1, 1> {};
+		struct OOITypeDescriptor : TagTraits<0x4010, 0x1068, VR::LT, 1, 1> {};
+		struct TotalProcessingTime : TagTraits<0x4010, 0x1069, VR::FL, 1, 1> {};
+		struct DetectorCalibrationData : TagTraits<0x4010, 0x106c, VR::OB, 1, 1> {};
+		struct AdditionalScreeningPerformed : TagTraits<0x4010, 0x106d, VR::CS, 1, 1> {};
+		struct AdditionalInspectionSelectionCriteria : TagTraits<0x4010, 0x106e, VR::CS, 1, 1> {};
+		struct AdditionalInspectionMethodSequence : TagTraits<0x4010, 0x106f, VR::SQ, 1, 1> {};
+		struct AITDeviceType : TagTraits<0x4010, 0x1070, VR::CS, 1, 1> {};
+		struct QRMeasurementsSequence : TagTraits<0x4010, 0x1071, VR::SQ, 1, 1> {};
+		struct TargetMaterialSequence : TagTraits<0x4010, 0x1072, VR::SQ, 1, 1> {};
+		struct SNRThreshold : TagTraits<0x4010, 0x1073, VR::FD, 1, 1> {};
+		struct ImageScaleRepresentation : TagTraits<0x4010, 0x1075, VR::DS, 1, 1> {};
+		struct ReferencedPTOSequence : TagTraits<0x4010, 0x1076, VR::SQ, 1, 1> {};
+		struct ReferencedTDRInstanceSequence : TagTraits<0x4010, 0x1077, VR::SQ, 1, 1> {};
+		struct PTOLocationDescription : TagTraits<0x4010, 0x1078, VR::ST, 1, 1> {};
+		struct AnomalyLocatorIndicatorSequence : TagTraits<0x4010, 0x1079, VR::SQ, 1, 1> {};
+		struct AnomalyLocatorIndicator : TagTraits<0x4010, 0x107a, VR::FL, 3, 3> {};
+		struct PTORegionSequence : TagTraits<0x4010, 0x107b, VR::SQ, 1, 1> {};
+		struct InspectionSelectionCriteria : TagTraits<0x4010, 0x107c, VR::CS, 1, 1> {};
+		struct SecondaryInspectionMethodSequence : TagTraits<0x4010, 0x107d, VR::SQ, 1, 1> {};
+		struct PRCSToRCSOrientation : TagTraits<0x4010, 0x107e, VR::DS, 6, 6> {};
+		struct MACParametersSequence : TagTraits<0x4ffe, 0x0001, VR::SQ, 1, 1> {};
+		struct SharedFunctionalGroupsSequence : TagTraits<0x5200, 0x9229, VR::SQ, 1, 1> {};
+		struct PerFrameFunctionalGroupsSequence : TagTraits<0x5200, 0x9230, VR::SQ, 1, 1> {};
+		struct WaveformSequence : TagTraits<0x5400, 0x0100, VR::SQ, 1, 1> {};
+		struct WaveformBitsAllocated : TagTraits<0x5400, 0x1004, VR::US, 1, 1> {};
+		struct WaveformSampleInterpretation : TagTraits<0x5400, 0x1006, VR::CS, 1, 1> {};
+		struct FirstOrderPhaseCorrectionAngle : TagTraits<0x5600, 0x0010, VR::OF, 1, 1> {};
+		struct SpectroscopyData : TagTraits<0x5600, 0x0020, VR::OF, 1, 1> {};
+		struct ExtendedOffsetTable : TagTraits<0x7fe0, 0x0001, VR::OV, 1, 1> {};
+		struct ExtendedOffsetTableLengths : TagTraits<0x7fe0, 0x0002, VR::OV, 1, 1> {};
+		struct FloatPixelData : TagTraits<0x7fe0, 0x0008, VR::OF, 1, 1> {};
+		struct DoubleFloatPixelData : TagTraits<0x7fe0, 0x0009, VR::OD, 1, 1> {};
+		struct CoefficientsSDVN : TagTraits<0x7fe0, 0x0020, VR::OW, 1, 1> {};
+		struct CoefficientsSDHN : TagTraits<0x7fe0, 0x0030, VR::OW, 1, 1> {};
+		struct CoefficientsSDDN : TagTraits<0x7fe0, 0x0040, VR::OW, 1, 1> {};
+		struct DigitalSignaturesSequence : TagTraits<0xfffa, 0xfffa, VR::SQ, 1, 1> {};
+		struct DataSetTrailingPadding : TagTraits<0xfffc, 0xfffc, VR::OB, 1, 1> {};
+	} // namespace tags
+} // namespace emdl
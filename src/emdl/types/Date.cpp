@@ -1,4 +1,5 @@
 #include <emdl/types/Date.h>
+#include <emdl/types/DateTimeParser.h>
 #include <emdl/Exception.h>
 
 #include <ctime>
@@ -6,10 +7,6 @@
 #include <tuple>
 #include <fmt/format.h>
 
-#ifdef WIN32
-#define sscanf sscanf_s
-#endif
-
 namespace emdl
 {
 	namespace types
@@ -25,18 +22,7 @@ namespace emdl
 
 		Date::Date(const std::string& date)
 		{
-			auto len = date.size();
-			if (len == 8) // YYYYMMDD
-			{
-				if (sscanf(date.c_str(), "%04d%02u%02u", &m_year, &m_month, &m_day) != 3)
-					throw emdl::Exception("Error parsing a DA value: {}", date);
-			}
-			else if (len == 10) // YYYY-MM-DD with any delimiter
-			{
-				if (sscanf(date.c_str(), "%04d%*c%02u%*c%02u", &m_year, &m_month, &m_day) != 3)
-					throw emdl::Exception("Error parsing a DA value: {}", date);
-			}
-			else
+			if (parseDate({date.data(), date.size()}, *this) != ParseResult::Ok)
 				throw emdl::Exception("Error parsing a DA value: {}", date);
 		}
 
@@ -1,17 +1,12 @@
 #include <emdl/types/DateTime.h>
+#include <emdl/types/DateTimeParser.h>
 #include <emdl/Exception.h>
 
-#include <clocale>
 #include <cstdlib>
 #include <ctime>
 #include <chrono>
-#include <tuple>
 #include <fmt/format.h>
 
-#ifdef WIN32
-#define sscanf sscanf_s
-#endif
-
 namespace emdl
 {
 	namespace types
@@ -25,53 +20,10 @@ namespace emdl
 		{
 		}
 
-		DateTime::DateTime(std::string dateTime)
+		DateTime::DateTime(const std::string& dateTime)
 		{
-			if (dateTime.size() < 8)
-				throw emdl::Exception("Error parsing a DT value: {}", dateTime);
-
-			// Check if there is a time zone
-			int timeZone = 0;
-			std::string timeZoneStr = dateTime.substr(dateTime.size() - 5);
-			if (timeZoneStr.size() == 5 && ((timeZoneStr[0] == '+') || (timeZoneStr[0] == '-')))
-			{
-				int hours;
-				unsigned int minutes;
-				if (sscanf(timeZoneStr.c_str(), "%03i%02u", &hours, &minutes) == 2)
-				{
-					timeZone = (hours > 0)
-								   ? (hours * 60 + minutes)
-								   : (hours * 60 - minutes);
-					dateTime = dateTime.substr(0, dateTime.size() - 5);
-				}
-				else
-					throw emdl::Exception("Error parsing the time zone of a DT value: {}", dateTime);
-			}
-
-			unsigned int year, month, day, hours = 0, minutes = 0;
-			double seconds = 0;
-
-			// Format: YYYYMMDDHHMM[SS[.FFFFFF]]
-			if (sscanf(dateTime.c_str(), "%04u%02u%02u%02u%02u", &year, &month, &day, &hours, &minutes) < 5)
+			if (parseDateTime({dateTime.data(), dateTime.size()}, *this) != ParseResult::Ok)
 				throw emdl::Exception("Error parsing a DT value: {}", dateTime);
-
-			// Seconds
-			if (dateTime.size() > 12)
-			{
-				dateTime.erase(0, 12);
-
-				// We replace the '.' with the current locale decimal point character, so we can use atof
-				auto pos = dateTime.find('.');
-				if (pos != std::string::npos)
-					dateTime[pos] = *std::localeconv()->decimal_point;
-
-				char* e;
-				seconds = std::strtod(dateTime.c_str(), &e);
-				if (*e != '\0' || errno)
-					throw emdl::Exception("Error parsing the seconds of a TM value: {}", dateTime);
-			}
-
-			set(year, month, day, hours, minutes, seconds, timeZone);
 		}
 
 		void DateTime::set(int year, unsigned int month, unsigned int day,
@@ -153,8 +105,7 @@ namespace emdl
 
 		bool operator<(const DateTime& lhs, const DateTime& rhs)
 		{
-			return std::tuple<Date, Time>(lhs.date(), lhs.time())
-				   < std::tuple<Date, Time>(rhs.date(), rhs.time());
+			return encodeDateTime(lhs) < encodeDateTime(rhs);
 		}
 
 		bool operator>(const DateTime& lhs, const DateTime& rhs)
@@ -174,8 +125,7 @@ namespace emdl
 
 		bool operator==(const DateTime& lhs, const DateTime& rhs)
 		{
-			return lhs.date() == rhs.date()
-				   && lhs.time() == rhs.time();
+			return encodeDateTime(lhs) == encodeDateTime(rhs);
 		}
 
 		bool operator!=(const DateTime& lhs, const DateTime& rhs)
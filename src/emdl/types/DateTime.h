@@ -14,7 +14,7 @@ namespace emdl
 			DateTime();
 			DateTime(int year, unsigned int month, unsigned int day,
 					 unsigned int hours, unsigned int minutes, double seconds, int timeZone = 0);
-			explicit DateTime(const std::string dateTime);
+			explicit DateTime(const std::string& dateTime);
 
 			void set(int year, unsigned int month, unsigned int day,
 					 unsigned int hours, unsigned int minutes, double seconds, int timeZone = 0);
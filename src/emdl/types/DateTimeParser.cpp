@@ -0,0 +1,246 @@
+#include <emdl/types/DateTimeParser.h>
+
+#include <cmath>
+
+namespace
+{
+	using namespace emdl;
+	using namespace emdl::types;
+
+	const int64_t microsecondsPerMinute = 60 * 1000000LL;
+	const int64_t microsecondsPerDay = 24 * 60 * microsecondsPerMinute;
+
+	// Size without the trailing spaces (and null byte, used as padding by some writers)
+	size_t trimmedSize(ArrayView<const char> str)
+	{
+		auto size = str.size();
+		while (size && (str.data()[size - 1] == ' ' || str.data()[size - 1] == '\0'))
+			--size;
+		return size;
+	}
+
+	bool isDigit(char c)
+	{
+		return c >= '0' && c <= '9';
+	}
+
+	bool readDigits(const char* data, size_t count, unsigned int& value)
+	{
+		value = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (!isDigit(data[i]))
+				return false;
+			value = value * 10 + (data[i] - '0');
+		}
+		return true;
+	}
+
+	// Days since 1970-01-01 in the proleptic Gregorian calendar (algorithm of H. Hinnant)
+	int32_t daysFromCivil(int year, unsigned int month, unsigned int day)
+	{
+		year -= month <= 2;
+		const int era = (year >= 0 ? year : year - 399) / 400;
+		const unsigned int yearOfEra = static_cast<unsigned int>(year - era * 400);
+		const unsigned int dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+		const unsigned int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+		return era * 146097 + static_cast<int32_t>(dayOfEra) - 719468;
+	}
+
+	Date civilFromDays(int32_t days)
+	{
+		days += 719468;
+		const int era = (days >= 0 ? days : days - 146096) / 146097;
+		const unsigned int dayOfEra = static_cast<unsigned int>(days - era * 146097);
+		const unsigned int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+		const unsigned int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+		const unsigned int mp = (5 * dayOfYear + 2) / 153;
+		const unsigned int day = dayOfYear - (153 * mp + 2) / 5 + 1;
+		const unsigned int month = mp < 10 ? mp + 3 : mp - 9;
+		const int year = static_cast<int>(yearOfEra) + era * 400 + (month <= 2);
+		return Date(year, month, day);
+	}
+
+	bool isValidDate(unsigned int year, unsigned int month, unsigned int day)
+	{
+		static const unsigned int daysInMonth[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+		if (month < 1 || month > 12 || day < 1)
+			return false;
+
+		const bool leapYear = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+		return day <= daysInMonth[month - 1] + (month == 2 && leapYear);
+	}
+
+	// Parse "HH[MM[SS[.F{1,6}]]]", with optional ':' between the components if allowed
+	ParseResult parseClock(const char* data, size_t size, bool colons, unsigned int& hours, unsigned int& minutes, double& seconds)
+	{
+		hours = minutes = 0;
+		seconds = 0;
+		size_t pos = 0;
+
+		unsigned int wholeSeconds = 0;
+		unsigned int* fields[] = {&hours, &minutes, &wholeSeconds};
+		size_t nbFields = 0;
+		for (; nbFields < 3 && pos < size; ++nbFields)
+		{
+			if (nbFields && colons && data[pos] == ':')
+				++pos;
+			if (pos + 2 > size || !readDigits(data + pos, 2, *fields[nbFields]))
+				return ParseResult::InvalidFormat;
+			pos += 2;
+		}
+
+		// Fraction of the seconds
+		unsigned int fraction = 0;
+		if (pos < size)
+		{
+			if (data[pos] != '.' || nbFields < 3)
+				return ParseResult::InvalidFormat;
+			const auto digits = size - pos - 1;
+			if (digits > 6 || !readDigits(data + pos + 1, digits, fraction))
+				return ParseResult::InvalidFormat;
+			for (auto i = digits; i < 6; ++i)
+				fraction *= 10;
+		}
+
+		if (hours > 23 || minutes > 59 || wholeSeconds > 60)
+			return ParseResult::InvalidValue;
+		seconds = wholeSeconds + fraction / 1e6;
+		return ParseResult::Ok;
+	}
+
+	int64_t timeOfDay(unsigned int hours, unsigned int minutes, double seconds, int timeZone)
+	{
+		return (static_cast<int64_t>(hours) * 60 + minutes - timeZone) * microsecondsPerMinute + std::llround(seconds * 1e6);
+	}
+}
+
+namespace emdl
+{
+	namespace types
+	{
+		ParseResult parseDate(ArrayView<const char> str, Date& date)
+		{
+			const auto size = trimmedSize(str);
+			const auto data = str.data();
+			if (!size)
+				return ParseResult::Empty;
+
+			unsigned int year, month, day;
+			if (size == 8) // YYYYMMDD
+			{
+				if (!readDigits(data, 4, year) || !readDigits(data + 4, 2, month) || !readDigits(data + 6, 2, day))
+					return ParseResult::InvalidFormat;
+			}
+			else if (size == 10) // YYYY.MM.DD with any delimiter
+			{
+				if (!readDigits(data, 4, year) || !readDigits(data + 5, 2, month) || !readDigits(data + 8, 2, day))
+					return ParseResult::InvalidFormat;
+			}
+			else
+				return ParseResult::InvalidFormat;
+
+			if (!isValidDate(year, month, day))
+				return ParseResult::InvalidValue;
+			date.set(year, month, day);
+			return ParseResult::Ok;
+		}
+
+		ParseResult parseTime(ArrayView<const char> str, Time& time)
+		{
+			const auto size = trimmedSize(str);
+			if (!size)
+				return ParseResult::Empty;
+
+			unsigned int hours, minutes;
+			double seconds;
+			const auto result = parseClock(str.data(), size, true, hours, minutes, seconds);
+			if (result == ParseResult::Ok)
+				time.set(hours, minutes, seconds);
+			return result;
+		}
+
+		ParseResult parseDateTime(ArrayView<const char> str, DateTime& dateTime)
+		{
+			auto size = trimmedSize(str);
+			const auto data = str.data();
+			if (!size)
+				return ParseResult::Empty;
+
+			// Time zone offset &ZZXX
+			int timeZone = 0;
+			if (size >= 5 && (data[size - 5] == '+' || data[size - 5] == '-'))
+			{
+				unsigned int zoneHours, zoneMinutes;
+				if (!readDigits(data + size - 4, 2, zoneHours) || !readDigits(data + size - 2, 2, zoneMinutes))
+					return ParseResult::InvalidFormat;
+				if (zoneHours > 14 || zoneMinutes > 59)
+					return ParseResult::InvalidValue;
+				timeZone = static_cast<int>(zoneHours * 60 + zoneMinutes);
+				if (data[size - 5] == '-')
+					timeZone = -timeZone;
+				size -= 5;
+			}
+
+			unsigned int year, month = 1, day = 1;
+			if (size < 4 || !readDigits(data, 4, year))
+				return ParseResult::InvalidFormat;
+			if (size > 4 && (size < 6 || !readDigits(data + 4, 2, month)))
+				return ParseResult::InvalidFormat;
+			if (size > 6 && (size < 8 || !readDigits(data + 6, 2, day)))
+				return ParseResult::InvalidFormat;
+			if (!isValidDate(year, month, day))
+				return ParseResult::InvalidValue;
+
+			unsigned int hours = 0, minutes = 0;
+			double seconds = 0;
+			if (size > 8)
+			{
+				const auto result = parseClock(data + 8, size - 8, false, hours, minutes, seconds);
+				if (result != ParseResult::Ok)
+					return result;
+			}
+
+			dateTime.set(year, month, day, hours, minutes, seconds, timeZone);
+			return ParseResult::Ok;
+		}
+
+		int32_t encodeDate(const Date& date)
+		{
+			return daysFromCivil(date.year(), date.month(), date.day());
+		}
+
+		Date decodeDate(int32_t days)
+		{
+			return civilFromDays(days);
+		}
+
+		int64_t encodeTime(const Time& time)
+		{
+			return timeOfDay(time.hours(), time.minutes(), time.seconds(), time.timeZone());
+		}
+
+		int64_t encodeDateTime(const DateTime& dateTime)
+		{
+			return encodeDate(dateTime.date()) * microsecondsPerDay + encodeTime(dateTime.time());
+		}
+
+		DateTime decodeDateTime(int64_t microseconds, int timeZone)
+		{
+			const auto local = microseconds + timeZone * microsecondsPerMinute;
+			auto days = local / microsecondsPerDay;
+			auto remainder = local % microsecondsPerDay;
+			if (remainder < 0)
+			{
+				--days;
+				remainder += microsecondsPerDay;
+			}
+
+			const auto date = civilFromDays(static_cast<int32_t>(days));
+			const auto minutes = remainder / microsecondsPerMinute;
+			const auto seconds = (remainder % microsecondsPerMinute) / 1e6;
+			return DateTime(date.year(), date.month(), date.day(),
+							static_cast<unsigned int>(minutes / 60), static_cast<unsigned int>(minutes % 60), seconds, timeZone);
+		}
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <emdl/types/DateTime.h>
+#include <emdl/ArrayView.h>
+
+#include <cstdint>
+
+namespace emdl
+{
+	namespace types
+	{
+		//! Result of the parsing of a DA, TM or DT value
+		enum class ParseResult : uint8_t
+		{
+			Ok,
+			Empty,
+			InvalidFormat, // Unexpected character or length
+			InvalidValue // Month, day, hours, minutes, seconds or time zone out of range
+		};
+
+		//! Parse a DA value "YYYYMMDD", or "YYYY.MM.DD" with any delimiter (ACR-NEMA). Trailing spaces are ignored.
+		//! Does not allocate, does not depend on the locale and does not throw.
+		EMDL_API ParseResult parseDate(ArrayView<const char> str, Date& date);
+
+		//! Parse a TM value "HH[MM[SS[.F{1,6}]]]", or "HH:MM[:SS[.F{1,6}]]" (ACR-NEMA). Trailing spaces are ignored.
+		EMDL_API ParseResult parseTime(ArrayView<const char> str, Time& time);
+
+		//! Parse a DT value "YYYY[MM[DD[HH[MM[SS[.F{1,6}]]]]]][&ZZXX]". Trailing spaces are ignored.
+		//! The missing components are the first month, the first day and midnight, the time zone offset is 0 if missing.
+		EMDL_API ParseResult parseDateTime(ArrayView<const char> str, DateTime& dateTime);
+
+		//! Number of days since 1970-01-01, comparable as integers
+		EMDL_API int32_t encodeDate(const Date& date);
+
+		//! Date from a number of days since 1970-01-01
+		EMDL_API Date decodeDate(int32_t days);
+
+		//! Number of microseconds since midnight UTC, the time zone offset being subtracted. Comparable as integers.
+		EMDL_API int64_t encodeTime(const Time& time);
+
+		//! Number of microseconds since 1970-01-01T00:00:00 UTC, the time zone offset being subtracted. Comparable as integers.
+		EMDL_API int64_t encodeDateTime(const DateTime& dateTime);
+
+		//! Date and time from a number of microseconds since 1970-01-01T00:00:00 UTC, expressed with the time zone offset (in minutes)
+		EMDL_API DateTime decodeDateTime(int64_t microseconds, int timeZone = 0);
+	}
+}
@@ -1,18 +1,12 @@
 #include <emdl/types/Time.h>
+#include <emdl/types/DateTimeParser.h>
 #include <emdl/Exception.h>
 
-#include <clocale>
-#include <cstdlib>
 #include <ctime>
 #include <chrono>
 #include <tuple>
-#include <errno.h>
 #include <fmt/format.h>
 
-#ifdef WIN32
-#define sscanf sscanf_s
-#endif
-
 namespace emdl
 {
 	namespace types
@@ -27,33 +21,10 @@ namespace emdl
 		{
 		}
 
-		Time::Time(std::string timeStr)
+		Time::Time(const std::string& time)
 		{
-			// Remove ':'
-			if ((timeStr.size() > 5) && (timeStr[5] == ':'))
-				timeStr.erase(5, 1);
-			if ((timeStr.size() > 2) && (timeStr[2] == ':'))
-				timeStr.erase(2, 1);
-
-			// Format is HH[MM[SS[.FFFFFF]]]
-			if (sscanf(timeStr.c_str(), "%02u%02u", &m_hours, &m_minutes) < 1)
-				throw emdl::Exception("Error parsing a TM value: {}", timeStr);
-
-			// Parse seconds as double
-			if (timeStr.size() > 4)
-			{
-				timeStr.erase(0, 4);
-
-				// We replace the '.' with the current locale decimal point character, so we can use atof
-				auto pos = timeStr.find('.');
-				if (pos != std::string::npos)
-					timeStr[pos] = *std::localeconv()->decimal_point;
-
-				char* e;
-				m_seconds = std::strtod(timeStr.c_str(), &e);
-				if (*e != '\0' || errno)
-					throw emdl::Exception("Error parsing the seconds of a TM value: {}", timeStr);
-			}
+			if (parseTime({time.data(), time.size()}, *this) != ParseResult::Ok)
+				throw emdl::Exception("Error parsing a TM value: {}", time);
 		}
 
 		void Time::set(unsigned int hours, unsigned int minutes, double seconds, int timeZone)
@@ -131,10 +102,7 @@ namespace emdl
 
 		bool operator<(const Time& lhs, const Time& rhs)
 		{
-			double l = (lhs.hours() * 60 + lhs.minutes() - lhs.timeZone()) * 60 + lhs.seconds();
-			double r = (rhs.hours() * 60 + rhs.minutes() - rhs.timeZone()) * 60 + rhs.seconds();
-
-			return l < r;
+			return encodeTime(lhs) < encodeTime(rhs);
 		}
 
 		bool operator>(const Time& lhs, const Time& rhs)
@@ -154,11 +122,7 @@ namespace emdl
 
 		bool operator==(const Time& lhs, const Time& rhs)
 		{
-			const int lm = lhs.hours() * 60 + lhs.minutes() - lhs.timeZone();
-			const int rm = rhs.hours() * 60 + rhs.minutes() - rhs.timeZone();
-
-			return lm == rm
-				   && lhs.seconds() == rhs.seconds();
+			return encodeTime(lhs) == encodeTime(rhs);
 		}
 
 		bool operator!=(const Time& lhs, const Time& rhs)
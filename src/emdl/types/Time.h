@@ -13,7 +13,7 @@ namespace emdl
 		public:
 			Time();
 			Time(unsigned int hours, unsigned int minutes, double seconds, int timeZone = 0);
-			explicit Time(const std::string time);
+			explicit Time(const std::string& time);
 
 			void set(unsigned int hours, unsigned int minutes, double seconds, int timeZone = 0);
 			void setHours(unsigned int hours);